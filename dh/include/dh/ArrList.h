@@ -5,7 +5,7 @@
  * @file    ArrList.h
  * @author  Gyeongtae Kim (dev-dasae) <codingpelican@gmail.com>
  * @date    2025-01-09 (date of creation)
- * @updated 2026-01-03 (date of last update)
+ * @updated 2026-02-26 (date of last update)
  * @ingroup dasae-headers(dh)
  * @prefix  ArrList
  *
@@ -306,12 +306,12 @@ $extern fn_((ArrList_shift(ArrList* self, u_V$raw ret_mem))(O$u_V$raw));
 #define T_use_ArrList_at$(_T...) \
     $attr($inline_always) \
     $static fn_((tpl_id(ArrList_at, _T)(ArrList$(_T) self, usize idx))(const _T*)) { \
-        return u_castP$((const _T*)(ArrList_at(*self.as_raw, typeInfo$(_T), idx))); \
+        return S_at((self.items)[idx]); \
     }
 #define T_use_ArrList_atMut$(_T...) \
     $attr($inline_always) \
     $static fn_((tpl_id(ArrList_atMut, _T)(ArrList$(_T) self, usize idx))(_T*)) { \
-        return u_castP$((_T*)(ArrList_atMut(*self.as_raw, typeInfo$(_T), idx))); \
+        return S_at((self.items)[idx]); \
     }
 #define T_use_ArrList_front$(_T...) \
     $attr($inline_always) \
@@ -506,18 +506,24 @@ $extern fn_((ArrList_shift(ArrList* self, u_V$raw ret_mem))(O$u_V$raw));
 
 #define T_use_ArrList_append$(_T...) \
     $attr($inline_always $must_check) \
-    $static fn_((tpl_id(ArrList_append, _T)(P$$(ArrList$(_T)) self, mem_Allocator gpa, _T item))(mem_Err$void)) { \
-        return ArrList_append(self->as_raw, gpa, u_anyV(item)); \
-    }
+    $static fn_((tpl_id(ArrList_append, _T)(P$$(ArrList$(_T)) self, mem_Allocator gpa, _T item))(mem_Err$void) $scope) { \
+        /* only growth goes through the TypeInfo path */ \
+        if (self->items.len == self->cap) { return_(ArrList_append(self->as_raw, gpa, u_anyV(item))); } \
+        self->items.ptr[self->items.len++] = item; \
+        return_ok({}); \
+    } $unscoped_(fn)
 #define T_use_ArrList_appendFixed$(_T...) \
     $attr($inline_always $must_check) \
-    $static fn_((tpl_id(ArrList_appendFixed, _T)(P$$(ArrList$(_T)) self, _T item))(mem_Err$void)) { \
-        return ArrList_appendFixed(self->as_raw, u_anyV(item)); \
-    }
+    $static fn_((tpl_id(ArrList_appendFixed, _T)(P$$(ArrList$(_T)) self, _T item))(mem_Err$void) $scope) { \
+        if (self->items.len == self->cap) { return_err(mem_Err_OutOfMemory()); } \
+        self->items.ptr[self->items.len++] = item; \
+        return_ok({}); \
+    } $unscoped_(fn)
 #define T_use_ArrList_appendWithin$(_T...) \
     $attr($inline_always) \
     $static fn_((tpl_id(ArrList_appendWithin, _T)(P$$(ArrList$(_T)) self, _T item))(void)) { \
-        return ArrList_appendWithin(self->as_raw, u_anyV(item)); \
+        claim_assert(self->items.len < self->cap); \
+        self->items.ptr[self->items.len++] = item; \
     }
 #define T_use_ArrList_appendS$(_T...) \
     $attr($inline_always $must_check) \
@@ -646,7 +652,8 @@ $extern fn_((ArrList_shift(ArrList* self, u_V$raw ret_mem))(O$u_V$raw));
 #define T_use_ArrList_pop$(_T...) \
     $attr($inline_always) \
     $static fn_((tpl_id(ArrList_pop, _T)(P$$(ArrList$(_T)) self))(O$(_T)) $scope) { \
-        return_(u_castO$((ReturnType)(ArrList_pop(self->as_raw, u_retV$(_T))))); \
+        if (self->items.len == 0) { return_none(); } \
+        return_some(self->items.ptr[--self->items.len]); \
     } $unscoped_(fn)
 #define T_use_ArrList_removeOrdd$(_T...) \
     $attr($inline_always) \
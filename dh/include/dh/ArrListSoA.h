@@ -0,0 +1,130 @@
+/**
+ * @copyright Copyright (c) 2026 Gyeongtae Kim
+ * @license   MIT License - see LICENSE file for details
+ *
+ * @file    ArrListSoA.h
+ * @author  Gyeongtae Kim (dev-dasae) <codingpelican@gmail.com>
+ * @date    2026-10-17 (date of creation)
+ * @updated 2026-10-17 (date of last update)
+ * @ingroup dasae-headers(dh)
+ * @prefix  ArrListSoA
+ *
+ * @brief   Dynamic struct-of-arrays list
+ * @details Stores a record described by its field `TypeInfo`s as one column per field,
+ *          laid out in a single block as `{T0[cap], T1[cap], ...}` by `u_typeInfoRecordN`.
+ *          The capacity is kept a multiple of `arch_cache_line_bytes` and the block is
+ *          aligned to a cache line, so every column starts on a cache line and the
+ *          slices from `ArrListSoA_field$`/`ArrListSoA_fieldMut$` suit aligned vector loads.
+ *          Records go in and out whole as the matching struct, whose layout is
+ *          `u_typeInfoRecord` of the same fields.
+ */
+#ifndef ArrListSoA__included
+#define ArrListSoA__included 1
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/*========== Includes =======================================================*/
+
+#include "meta.h"
+#include "sort.h"
+#include "mem/Allocator.h"
+
+/*========== Macros and Declarations ========================================*/
+
+/// Capacities are rounded up to a multiple of this many records
+#define ArrListSoA_cap_align (arch_cache_line_bytes)
+/// Most fields a record may have
+#define ArrListSoA_fields_max (32u)
+
+/* ArrListSoA Raw Structure */
+typedef struct ArrListSoA {
+    /// `{T0[cap], T1[cap], ...}`; null while `cap` is 0
+    var_(bytes, P$raw);
+    var_(len, usize);
+    var_(cap, usize);
+    /// Borrowed; must outlive the list
+    var_(fields, S_const$TypeInfo);
+} ArrListSoA;
+T_use$((ArrListSoA)(O, E));
+T_use_E$($set(mem_Err)(ArrListSoA));
+
+/*========== Function Prototypes ============================================*/
+
+$extern fn_((ArrListSoA_empty(S_const$TypeInfo fields))(ArrListSoA));
+$attr($must_check)
+$extern fn_((ArrListSoA_init(S_const$TypeInfo fields, mem_Allocator gpa, usize cap))(mem_Err$ArrListSoA));
+$extern fn_((ArrListSoA_fini(ArrListSoA* self, mem_Allocator gpa))(void));
+
+$extern fn_((ArrListSoA_len(ArrListSoA self))(usize));
+$extern fn_((ArrListSoA_cap(ArrListSoA self))(usize));
+$extern fn_((ArrListSoA_isEmpty(ArrListSoA self))(bool));
+/// `TypeInfo` of one whole record, as passed to `append`/`get`
+$extern fn_((ArrListSoA_recordType(ArrListSoA self))(TypeInfo));
+/// Column `field_idx`, `len` long
+$extern fn_((ArrListSoA_field(ArrListSoA self, usize field_idx))(u_S_const$raw));
+$extern fn_((ArrListSoA_fieldMut(ArrListSoA self, usize field_idx))(u_S$raw));
+
+$attr($must_check)
+$extern fn_((ArrListSoA_ensureCap(ArrListSoA* self, mem_Allocator gpa, usize new_cap))(mem_Err$void));
+$attr($must_check)
+$extern fn_((ArrListSoA_ensureCapPrecise(ArrListSoA* self, mem_Allocator gpa, usize new_cap))(mem_Err$void));
+$attr($must_check)
+$extern fn_((ArrListSoA_ensureUnusedCap(ArrListSoA* self, mem_Allocator gpa, usize additional))(mem_Err$void));
+$extern fn_((ArrListSoA_shrinkRetainingCap(ArrListSoA* self, usize new_len))(void));
+$extern fn_((ArrListSoA_clearRetainingCap(ArrListSoA* self))(void));
+$extern fn_((ArrListSoA_clearAndFree(ArrListSoA* self, mem_Allocator gpa))(void));
+
+/// New records are left uninitialized, to be filled through the columns
+$attr($must_check)
+$extern fn_((ArrListSoA_resize(ArrListSoA* self, mem_Allocator gpa, usize new_len))(mem_Err$void));
+/// Index of a new, uninitialized record
+$extern fn_((ArrListSoA_addBackWithin(ArrListSoA* self))(usize));
+
+$attr($must_check)
+$extern fn_((ArrListSoA_append(ArrListSoA* self, mem_Allocator gpa, u_V$raw item))(mem_Err$void));
+$extern fn_((ArrListSoA_appendWithin(ArrListSoA* self, u_V$raw item))(void));
+
+/// Scatter `item` into the columns at `idx`
+$extern fn_((ArrListSoA_set(ArrListSoA self, usize idx, u_V$raw item))(void));
+/// Gather the record at `idx` into `ret_mem`
+$extern fn_((ArrListSoA_get(ArrListSoA self, usize idx, u_V$raw ret_mem))(u_V$raw));
+
+$extern fn_((ArrListSoA_pop(ArrListSoA* self, u_V$raw ret_mem))(O$u_V$raw));
+/// Shifts every column after `idx` down by one
+$extern fn_((ArrListSoA_removeOrdd(ArrListSoA* self, usize idx, u_V$raw ret_mem))(u_V$raw));
+/// Moves the last record into `idx`
+$extern fn_((ArrListSoA_removeSwap(ArrListSoA* self, usize idx, u_V$raw ret_mem))(u_V$raw));
+
+/// Orders the records by column `field_idx`, swapping every column alike (unstable)
+$extern fn_((ArrListSoA_sortByField(ArrListSoA* self, usize field_idx, sort_OrdFn ordFn))(void));
+$extern fn_((ArrListSoA_sortByFieldCtx(ArrListSoA* self, usize field_idx, sort_OrdCtxFn ordFn, u_P_const$raw ctx))(void));
+
+/// Column `field_idx` as `S_const$(_T)`: `ArrListSoA_field$((f32)(list, Particle_mass))`
+#define ArrListSoA_field$(/*(_T)(_self: ArrListSoA, _field_idx: usize)*/... /*(S_const$(_T))*/) \
+    __step__ArrListSoA_field$(__step__ArrListSoA_field$__parse __VA_ARGS__)
+/// Column `field_idx` as `S$(_T)`
+#define ArrListSoA_fieldMut$(/*(_T)(_self: ArrListSoA, _field_idx: usize)*/... /*(S$(_T))*/) \
+    __step__ArrListSoA_fieldMut$(__step__ArrListSoA_fieldMut$__parse __VA_ARGS__)
+
+/*========== Macros and Definitions =========================================*/
+
+#define __step__ArrListSoA_field$__parse(_T...) _T,
+#define __step__ArrListSoA_field$(...) ____ArrListSoA_field$(__VA_ARGS__)
+#define ____ArrListSoA_field$(_T, _args...) ({ \
+    let __column = ArrListSoA_field _args; \
+    debug_assert_eqBy(__column.type, typeInfo$(_T), TypeInfo_eq); \
+    u_castS$((S_const$(_T))(__column)); \
+})
+#define __step__ArrListSoA_fieldMut$__parse(_T...) _T,
+#define __step__ArrListSoA_fieldMut$(...) ____ArrListSoA_fieldMut$(__VA_ARGS__)
+#define ____ArrListSoA_fieldMut$(_T, _args...) ({ \
+    let __column = ArrListSoA_fieldMut _args; \
+    debug_assert_eqBy(__column.type, typeInfo$(_T), TypeInfo_eq); \
+    u_castS$((S$(_T))(__column)); \
+})
+
+#if defined(__cplusplus)
+} /* extern "C" */
+#endif /* defined(__cplusplus) */
+#endif /* ArrListSoA__included */
@@ -5,7 +5,7 @@
  * @file    ArrPQue.h
  * @author  Gyeongtae Kim (dev-dasae) <codingpelican@gmail.com>
  * @date    2025-01-09 (date of creation)
- * @updated 2025-12-09 (date of last update)
+ * @updated 2026-02-26 (date of last update)
  * @ingroup dasae-headers(dh)
  * @prefix  ArrPQue
  *
@@ -165,6 +165,43 @@ $extern fn_((ArrPQue_Iter_nextMut(ArrPQue_Iter* self, TypeInfo type))(O$u_P$raw)
     T_decl_ArrPQue$(_T); \
     T_impl_ArrPQue$(_T)
 
+/* Typed fast paths move elements by value and call the comparator directly,
+ * skipping the TypeInfo-sized staging copies of the generic heap operations */
+$attr($inline_always)
+$static fn_((ArrPQue__ordP(P_const$ArrPQue_Ctx ctx, u_P_const$raw lhs, u_P_const$raw rhs))(cmp_Ord)) {
+    return ctx->ordFn(u_load(u_deref(lhs)), u_load(u_deref(rhs)), u_load(u_deref(ctx->inner)));
+};
+/* Appends `_item` and sifts the hole up, moving parents down until it fits */
+#define ____ArrPQue_siftUp$(_T, _self, _item...) do { \
+    const _T* __item = &(_item); \
+    var __idx = (_self)->items.len++; \
+    while (__idx > 0) { \
+        let __parent = (__idx - 1) >> 1; \
+        if (ArrPQue__ordP((_self)->ctx, u_anyP(__item), u_anyP(&(_self)->items.ptr[__parent]).as_const) != cmp_Ord_lt) { break; } \
+        (_self)->items.ptr[__idx] = (_self)->items.ptr[__parent]; \
+        __idx = __parent; \
+    } \
+    (_self)->items.ptr[__idx] = *__item; \
+} while (false)
+/* Places `_item` at the root hole and sifts it down, moving smaller children up */
+#define ____ArrPQue_siftDown$(_T, _self, _item...) do { \
+    const _T* __item = &(_item); \
+    let __len = (_self)->items.len; \
+    var_(__idx, usize) = 0; \
+    while (true) { \
+        var __child = (__idx << 1) + 1; \
+        if (__child >= __len) { break; } \
+        if (__child + 1 < __len \
+            && ArrPQue__ordP((_self)->ctx, u_anyP(&(_self)->items.ptr[__child]).as_const, u_anyP(&(_self)->items.ptr[__child + 1]).as_const) == cmp_Ord_gt) { \
+            __child++; \
+        } \
+        if (ArrPQue__ordP((_self)->ctx, u_anyP(__item), u_anyP(&(_self)->items.ptr[__child]).as_const) != cmp_Ord_gt) { break; } \
+        (_self)->items.ptr[__idx] = (_self)->items.ptr[__child]; \
+        __idx = __child; \
+    } \
+    (_self)->items.ptr[__idx] = *__item; \
+} while (false)
+
 /* clang-format off */
 #define T_use_ArrPQue_empty$(_T...) \
     $attr($inline_always) \
@@ -286,18 +323,23 @@ $extern fn_((ArrPQue_Iter_nextMut(ArrPQue_Iter* self, TypeInfo type))(O$u_P$raw)
 
 #define T_use_ArrPQue_enque$(_T...) \
     $attr($inline_always $must_check) \
-    $static fn_((tpl_id(ArrPQue_enque, _T)(P$$(ArrPQue$(_T)) self, mem_Allocator gpa, _T item))(mem_Err$void)) { \
-        return ArrPQue_enque(self->as_raw, gpa, u_anyV(item)); \
-    }
+    $static fn_((tpl_id(ArrPQue_enque, _T)(P$$(ArrPQue$(_T)) self, mem_Allocator gpa, _T item))(mem_Err$void) $scope) { \
+        if (self->items.len == self->cap) { try_(ArrPQue_ensureUnusedCap(self->as_raw, typeInfo$(_T), gpa, 1)); } \
+        ____ArrPQue_siftUp$(_T, self, item); \
+        return_ok({}); \
+    } $unscoped_(fn)
 #define T_use_ArrPQue_enqueFixed$(_T...) \
     $attr($inline_always $must_check) \
-    $static fn_((tpl_id(ArrPQue_enqueFixed, _T)(P$$(ArrPQue$(_T)) self, _T item))(mem_Err$void)) { \
-        return ArrPQue_enqueFixed(self->as_raw, u_anyV(item)); \
-    }
+    $static fn_((tpl_id(ArrPQue_enqueFixed, _T)(P$$(ArrPQue$(_T)) self, _T item))(mem_Err$void) $scope) { \
+        if (self->items.len == self->cap) { return_err(mem_Err_OutOfMemory()); } \
+        ____ArrPQue_siftUp$(_T, self, item); \
+        return_ok({}); \
+    } $unscoped_(fn)
 #define T_use_ArrPQue_enqueWithin$(_T...) \
     $attr($inline_always) \
     $static fn_((tpl_id(ArrPQue_enqueWithin, _T)(P$$(ArrPQue$(_T)) self, _T item))(void)) { \
-        return ArrPQue_enqueWithin(self->as_raw, u_anyV(item)); \
+        claim_assert(self->items.len < self->cap); \
+        ____ArrPQue_siftUp$(_T, self, item); \
     }
 #define T_use_ArrPQue_enqueS$(_T...) \
     $attr($inline_always $must_check) \
@@ -318,7 +360,11 @@ $extern fn_((ArrPQue_Iter_nextMut(ArrPQue_Iter* self, TypeInfo type))(O$u_P$raw)
 #define T_use_ArrPQue_deque$(_T...) \
     $attr($inline_always) \
     $static fn_((tpl_id(ArrPQue_deque, _T)(P$$(ArrPQue$(_T)) self))(O$(_T)) $scope) { \
-        return_(u_castO$((ReturnType)(ArrPQue_deque(self->as_raw, u_retV$(_T))))); \
+        if (self->items.len == 0) { return_none(); } \
+        let top = self->items.ptr[0]; \
+        let last = self->items.ptr[--self->items.len]; \
+        if (self->items.len > 0) { ____ArrPQue_siftDown$(_T, self, last); } \
+        return_some(top); \
     } $unscoped_(fn)
 #define T_use_ArrPQue_removeAt$(_T...) \
     $attr($inline_always) \
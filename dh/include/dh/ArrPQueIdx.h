@@ -0,0 +1,300 @@
+/**
+ * @copyright Copyright (c) 2026 Gyeongtae Kim
+ * @license   MIT License - see LICENSE file for details
+ *
+ * @file    ArrPQueIdx.h
+ * @author  Gyeongtae Kim (dev-dasae) <codingpelican@gmail.com>
+ * @date    2026-10-17 (date of creation)
+ * @updated 2026-10-17 (date of last update)
+ * @ingroup dasae-headers(dh)
+ * @prefix  ArrPQueIdx
+ *
+ * @brief   Indexed d-ary priority queue (min-heap) keyed by caller handles
+ * @details Every element is enqueued under a handle in `[0, cap)`, such as a vertex id.
+ *          A position map from handle to heap slot makes `contains` and `at` O(1) and
+ *          `update` (decrease/increase-key) and `remove` by handle O(log n), where
+ *          `ArrPQue_update` has to find the element first. The arity is a power of two
+ *          (4 by default); wider nodes make the heap shallower and keep each group of
+ *          siblings in one or two cache lines.
+ */
+#ifndef ArrPQueIdx__included
+#define ArrPQueIdx__included 1
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/*========== Includes =======================================================*/
+
+#include "ArrPQue.h"
+
+/*========== Macros and Declarations ========================================*/
+
+/// Arity used by `ArrPQueIdx_empty`/`ArrPQueIdx_init` callers that have no better choice
+#define ArrPQueIdx_arity_default (4u)
+/// Slot recorded for a handle that is not queued
+#define ArrPQueIdx_slot_none (usize_limit_max)
+
+/* ArrPQueIdx Anonymous */
+#define ArrPQueIdx$$(_T...) __comp_anon__ArrPQueIdx$$(_T)
+/* ArrPQueIdx Alias */
+#define ArrPQueIdx$(_T...) __comp_alias__ArrPQueIdx$(_T)
+/* ArrPQueIdx Template */
+#define T_decl_ArrPQueIdx$(_T...) __comp_gen__T_decl_ArrPQueIdx$(_T)
+#define T_impl_ArrPQueIdx$(_T...) __comp_gen__T_impl_ArrPQueIdx$(_T)
+#define T_use_ArrPQueIdx$(_T...) __comp_gen__T_use_ArrPQueIdx$(_T)
+
+/* ArrPQueIdx Raw Structure */
+typedef struct ArrPQueIdx {
+    var_(items, S$raw);
+    /// Handle of the element in each heap slot
+    var_(handles, usize*);
+    /// Heap slot of each handle, or `ArrPQueIdx_slot_none`; `cap` entries after `handles`
+    var_(slots, usize*);
+    var_(cap, usize);
+    /// Children of slot `i` are `(i << arity_log2) + 1` onwards
+    var_(arity_log2, u8);
+    var_(ctx, P_const$ArrPQue_Ctx);
+    debug_only(var_(type, TypeInfo);)
+} ArrPQueIdx;
+T_use$((ArrPQueIdx)(O, E));
+T_use_E$($set(mem_Err)(ArrPQueIdx));
+
+/* --- Function Prototypes --- */
+
+/// `arity` must be a power of two, at least 2
+$extern fn_((ArrPQueIdx_empty(TypeInfo type, u32 arity, P_const$ArrPQue_Ctx ctx))(ArrPQueIdx));
+/// Room for handles `[0, cap)`
+$attr($must_check)
+$extern fn_((ArrPQueIdx_init(TypeInfo type, mem_Allocator gpa, usize cap, u32 arity, P_const$ArrPQue_Ctx ctx))(mem_Err$ArrPQueIdx));
+$extern fn_((ArrPQueIdx_fini(ArrPQueIdx* self, TypeInfo type, mem_Allocator gpa))(void));
+
+$extern fn_((ArrPQueIdx_len(ArrPQueIdx self))(usize));
+$extern fn_((ArrPQueIdx_cap(ArrPQueIdx self))(usize));
+$extern fn_((ArrPQueIdx_arity(ArrPQueIdx self))(u32));
+$extern fn_((ArrPQueIdx_isEmpty(ArrPQueIdx self))(bool));
+$extern fn_((ArrPQueIdx_contains(ArrPQueIdx self, usize handle))(bool));
+$extern fn_((ArrPQueIdx_peek(ArrPQueIdx self, TypeInfo type))(O$u_P_const$raw));
+$extern fn_((ArrPQueIdx_peekHandle(ArrPQueIdx self))(O$usize));
+/// Element queued under `handle`
+$extern fn_((ArrPQueIdx_at(ArrPQueIdx self, TypeInfo type, usize handle))(O$u_P_const$raw));
+$extern fn_((ArrPQueIdx_items(ArrPQueIdx self, TypeInfo type))(u_S_const$raw));
+$extern fn_((ArrPQueIdx_itemsMut(ArrPQueIdx self, TypeInfo type))(u_S$raw));
+
+/// Grow the handle range to at least `[0, new_cap)`
+$attr($must_check)
+$extern fn_((ArrPQueIdx_ensureCap(ArrPQueIdx* self, TypeInfo type, mem_Allocator gpa, usize new_cap))(mem_Err$void));
+$attr($must_check)
+$extern fn_((ArrPQueIdx_ensureCapPrecise(ArrPQueIdx* self, TypeInfo type, mem_Allocator gpa, usize new_cap))(mem_Err$void));
+$extern fn_((ArrPQueIdx_clearRetainingCap(ArrPQueIdx* self))(void));
+$extern fn_((ArrPQueIdx_clearAndFree(ArrPQueIdx* self, TypeInfo type, mem_Allocator gpa))(void));
+
+/// Queue `item` under `handle`, growing the handle range if needed; `handle` must not be queued
+$attr($must_check)
+$extern fn_((ArrPQueIdx_enque(ArrPQueIdx* self, mem_Allocator gpa, usize handle, u_V$raw item))(mem_Err$void));
+$extern fn_((ArrPQueIdx_enqueWithin(ArrPQueIdx* self, usize handle, u_V$raw item))(void));
+
+/// Pop the minimum into `ret_mem` and return its handle
+$extern fn_((ArrPQueIdx_deque(ArrPQueIdx* self, u_V$raw ret_mem))(O$usize));
+/// Remove the element queued under `handle`, if any
+$extern fn_((ArrPQueIdx_remove(ArrPQueIdx* self, usize handle, u_V$raw ret_mem))(O$u_V$raw));
+/// Replace the element queued under `handle` and restore the heap in O(log n)
+$extern fn_((ArrPQueIdx_update(ArrPQueIdx* self, usize handle, u_V$raw item))(void));
+
+/*========== Macros and Definitions =========================================*/
+
+#define __comp_anon__ArrPQueIdx$$(_T...) \
+    union { \
+        struct { \
+            var_(items, S$$(_T)); \
+            var_(handles, usize*); \
+            var_(slots, usize*); \
+            var_(cap, usize); \
+            var_(arity_log2, u8); \
+            var_(ctx, P_const$ArrPQue_Ctx); \
+            debug_only(var_(type, TypeInfo);) \
+        }; \
+        var_(as_raw, ArrPQueIdx) $like_ref; \
+    }
+#define __comp_alias__ArrPQueIdx$(_T...) pp_join($, ArrPQueIdx, _T)
+#define __comp_gen__T_decl_ArrPQueIdx$(_T...) \
+    $maybe_unused typedef union ArrPQueIdx$(_T) ArrPQueIdx$(_T); \
+    T_decl_O$(ArrPQueIdx$(_T)); \
+    T_decl_E$(ArrPQueIdx$(_T)); \
+    T_decl_E$($set(mem_Err)(ArrPQueIdx$(_T)))
+#define __comp_gen__T_impl_ArrPQueIdx$(_T...) \
+    union ArrPQueIdx$(_T) { \
+        struct { \
+            var_(items, S$(_T)); \
+            var_(handles, usize*); \
+            var_(slots, usize*); \
+            var_(cap, usize); \
+            var_(arity_log2, u8); \
+            var_(ctx, P_const$ArrPQue_Ctx); \
+            debug_only(var_(type, TypeInfo);) \
+        }; \
+        var_(as_raw, ArrPQueIdx) $like_ref; \
+    }; \
+    T_impl_O$(ArrPQueIdx$(_T)); \
+    T_impl_E$(ArrPQueIdx$(_T)); \
+    T_impl_E$($set(mem_Err)(ArrPQueIdx$(_T)))
+#define __comp_gen__T_use_ArrPQueIdx$(_T...) \
+    T_decl_ArrPQueIdx$(_T); \
+    T_impl_ArrPQueIdx$(_T)
+
+/* Typed fast paths move elements by value and call the comparator directly,
+ * keeping `handles` and `slots` in step with every move */
+/* Sifts the hole at `_slot` up until `_item` fits, then places it under `_handle` */
+#define ____ArrPQueIdx_siftUp$(_T, _self, _slot, _handle, _item...) do { \
+    const _T* __item = &(_item); \
+    var_(__slot, usize) = (_slot); \
+    while (__slot > 0) { \
+        let __parent = (__slot - 1) >> (_self)->arity_log2; \
+        if (ArrPQue__ordP((_self)->ctx, u_anyP(__item), u_anyP(&(_self)->items.ptr[__parent]).as_const) != cmp_Ord_lt) { break; } \
+        (_self)->items.ptr[__slot] = (_self)->items.ptr[__parent]; \
+        (_self)->handles[__slot] = (_self)->handles[__parent]; \
+        (_self)->slots[(_self)->handles[__slot]] = __slot; \
+        __slot = __parent; \
+    } \
+    (_self)->items.ptr[__slot] = *__item; \
+    (_self)->handles[__slot] = (_handle); \
+    (_self)->slots[_handle] = __slot; \
+} while (false)
+/* Sifts the hole at `_slot` down, moving the smallest child up until `_item` fits */
+#define ____ArrPQueIdx_siftDown$(_T, _self, _slot, _handle, _item...) do { \
+    const _T* __item = &(_item); \
+    let __len = (_self)->items.len; \
+    var_(__slot, usize) = (_slot); \
+    while (true) { \
+        let __first = (__slot << (_self)->arity_log2) + 1; \
+        if (__first >= __len) { break; } \
+        let __end = prim_min(__first + (lit_n$(usize)(1) << (_self)->arity_log2), __len); \
+        var __best = __first; \
+        for (usize __child = __first + 1; __child < __end; ++__child) { \
+            if (ArrPQue__ordP((_self)->ctx, u_anyP(&(_self)->items.ptr[__child]).as_const, u_anyP(&(_self)->items.ptr[__best]).as_const) == cmp_Ord_lt) { \
+                __best = __child; \
+            } \
+        } \
+        if (ArrPQue__ordP((_self)->ctx, u_anyP(__item), u_anyP(&(_self)->items.ptr[__best]).as_const) != cmp_Ord_gt) { break; } \
+        (_self)->items.ptr[__slot] = (_self)->items.ptr[__best]; \
+        (_self)->handles[__slot] = (_self)->handles[__best]; \
+        (_self)->slots[(_self)->handles[__slot]] = __slot; \
+        __slot = __best; \
+    } \
+    (_self)->items.ptr[__slot] = *__item; \
+    (_self)->handles[__slot] = (_handle); \
+    (_self)->slots[_handle] = __slot; \
+} while (false)
+
+/* clang-format off */
+#define T_use_ArrPQueIdx_empty$(_T...) \
+    $attr($inline_always) \
+    $static fn_((tpl_id(ArrPQueIdx_empty, _T)(u32 arity, P_const$ArrPQue_Ctx ctx))(ArrPQueIdx$(_T))) { \
+        return type$((ArrPQueIdx$(_T))(ArrPQueIdx_empty(typeInfo$(_T), arity, ctx))); \
+    }
+#define T_use_ArrPQueIdx_init$(_T...) \
+    $attr($inline_always $must_check) \
+    $static fn_((tpl_id(ArrPQueIdx_init, _T)(mem_Allocator gpa, usize cap, u32 arity, P_const$ArrPQue_Ctx ctx))(E$($set(mem_Err)(ArrPQueIdx$(_T)))) $scope) { \
+        return_(typeE$((ReturnType)(ArrPQueIdx_init(typeInfo$(_T), gpa, cap, arity, ctx)))); \
+    } $unscoped_(fn)
+#define T_use_ArrPQueIdx_fini$(_T...) \
+    $attr($inline_always) \
+    $static fn_((tpl_id(ArrPQueIdx_fini, _T)(P$$(ArrPQueIdx$(_T)) self, mem_Allocator gpa))(void)) { \
+        return ArrPQueIdx_fini(self->as_raw, typeInfo$(_T), gpa); \
+    }
+
+#define T_use_ArrPQueIdx_len$(_T...) \
+    $attr($inline_always) \
+    $static fn_((tpl_id(ArrPQueIdx_len, _T)(ArrPQueIdx$(_T) self))(usize)) { \
+        return ArrPQueIdx_len(*self.as_raw); \
+    }
+#define T_use_ArrPQueIdx_cap$(_T...) \
+    $attr($inline_always) \
+    $static fn_((tpl_id(ArrPQueIdx_cap, _T)(ArrPQueIdx$(_T) self))(usize)) { \
+        return ArrPQueIdx_cap(*self.as_raw); \
+    }
+#define T_use_ArrPQueIdx_contains$(_T...) \
+    $attr($inline_always) \
+    $static fn_((tpl_id(ArrPQueIdx_contains, _T)(ArrPQueIdx$(_T) self, usize handle))(bool)) { \
+        return handle < self.cap && self.slots[handle] != ArrPQueIdx_slot_none; \
+    }
+#define T_use_ArrPQueIdx_peek$(_T...) \
+    $attr($inline_always) \
+    $static fn_((tpl_id(ArrPQueIdx_peek, _T)(ArrPQueIdx$(_T) self))(O$(P_const$(_T)))) { \
+        return u_castO$((O$(P_const$(_T)))(ArrPQueIdx_peek(*self.as_raw, typeInfo$(_T)))); \
+    }
+#define T_use_ArrPQueIdx_peekHandle$(_T...) \
+    $attr($inline_always) \
+    $static fn_((tpl_id(ArrPQueIdx_peekHandle, _T)(ArrPQueIdx$(_T) self))(O$usize)) { \
+        return ArrPQueIdx_peekHandle(*self.as_raw); \
+    }
+#define T_use_ArrPQueIdx_at$(_T...) \
+    $attr($inline_always) \
+    $static fn_((tpl_id(ArrPQueIdx_at, _T)(ArrPQueIdx$(_T) self, usize handle))(O$(P_const$(_T)))) { \
+        return u_castO$((O$(P_const$(_T)))(ArrPQueIdx_at(*self.as_raw, typeInfo$(_T), handle))); \
+    }
+
+#define T_use_ArrPQueIdx_ensureCap$(_T...) \
+    $attr($inline_always $must_check) \
+    $static fn_((tpl_id(ArrPQueIdx_ensureCap, _T)(P$$(ArrPQueIdx$(_T)) self, mem_Allocator gpa, usize new_cap))(mem_Err$void)) { \
+        return ArrPQueIdx_ensureCap(self->as_raw, typeInfo$(_T), gpa, new_cap); \
+    }
+#define T_use_ArrPQueIdx_clearRetainingCap$(_T...) \
+    $attr($inline_always) \
+    $static fn_((tpl_id(ArrPQueIdx_clearRetainingCap, _T)(P$$(ArrPQueIdx$(_T)) self))(void)) { \
+        return ArrPQueIdx_clearRetainingCap(self->as_raw); \
+    }
+
+#define T_use_ArrPQueIdx_enque$(_T...) \
+    $attr($inline_always $must_check) \
+    $static fn_((tpl_id(ArrPQueIdx_enque, _T)(P$$(ArrPQueIdx$(_T)) self, mem_Allocator gpa, usize handle, _T item))(mem_Err$void) $scope) { \
+        if (self->cap <= handle) { try_(ArrPQueIdx_ensureCap(self->as_raw, typeInfo$(_T), gpa, handle + 1)); } \
+        claim_assert(self->slots[handle] == ArrPQueIdx_slot_none); \
+        ____ArrPQueIdx_siftUp$(_T, self, self->items.len++, handle, item); \
+        return_ok({}); \
+    } $unscoped_(fn)
+#define T_use_ArrPQueIdx_enqueWithin$(_T...) \
+    $attr($inline_always) \
+    $static fn_((tpl_id(ArrPQueIdx_enqueWithin, _T)(P$$(ArrPQueIdx$(_T)) self, usize handle, _T item))(void)) { \
+        claim_assert(handle < self->cap); \
+        claim_assert(self->slots[handle] == ArrPQueIdx_slot_none); \
+        ____ArrPQueIdx_siftUp$(_T, self, self->items.len++, handle, item); \
+    }
+
+#define T_use_ArrPQueIdx_deque$(_T...) \
+    $attr($inline_always) \
+    $static fn_((tpl_id(ArrPQueIdx_deque, _T)(P$$(ArrPQueIdx$(_T)) self, _T* ret))(O$usize) $scope) { \
+        if (self->items.len == 0) { return_none(); } \
+        let top = self->handles[0]; \
+        if (ret != null) { *ret = self->items.ptr[0]; } \
+        self->slots[top] = ArrPQueIdx_slot_none; \
+        let last_slot = --self->items.len; \
+        if (last_slot > 0) { \
+            let last = self->items.ptr[last_slot]; \
+            let last_handle = self->handles[last_slot]; \
+            ____ArrPQueIdx_siftDown$(_T, self, 0, last_handle, last); \
+        } \
+        return_some(top); \
+    } $unscoped_(fn)
+#define T_use_ArrPQueIdx_remove$(_T...) \
+    $attr($inline_always) \
+    $static fn_((tpl_id(ArrPQueIdx_remove, _T)(P$$(ArrPQueIdx$(_T)) self, usize handle))(O$(_T)) $scope) { \
+        return_(u_castO$((ReturnType)(ArrPQueIdx_remove(self->as_raw, handle, u_retV$(_T))))); \
+    } $unscoped_(fn)
+#define T_use_ArrPQueIdx_update$(_T...) \
+    $attr($inline_always) \
+    $static fn_((tpl_id(ArrPQueIdx_update, _T)(P$$(ArrPQueIdx$(_T)) self, usize handle, _T item))(void)) { \
+        claim_assert(handle < self->cap); \
+        let slot = self->slots[handle]; \
+        claim_assert(slot != ArrPQueIdx_slot_none); \
+        if (ArrPQue__ordP(self->ctx, u_anyP(&item).as_const, u_anyP(&self->items.ptr[slot]).as_const) == cmp_Ord_lt) { \
+            ____ArrPQueIdx_siftUp$(_T, self, slot, handle, item); \
+        } else { \
+            ____ArrPQueIdx_siftDown$(_T, self, slot, handle, item); \
+        } \
+    }
+/* clang-format on */
+
+#if defined(__cplusplus)
+} /* extern "C" */
+#endif /* defined(__cplusplus) */
+#endif /* ArrPQueIdx__included */
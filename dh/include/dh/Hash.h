@@ -0,0 +1,176 @@
+/**
+ * @copyright Copyright (c) 2025 Gyeongtae Kim
+ * @license   MIT License - see LICENSE file for details
+ *
+ * @file    Hash.h
+ * @author  Gyeongtae Kim (dev-dasae) <codingpelican@gmail.com>
+ * @date    2025-12-14 (date of creation)
+ * @updated 2025-12-14 (date of last update)
+ * @version v0.1
+ * @ingroup dasae-headers(dh)
+ * @prefix  Hash
+ *
+ * @brief   Fast non-cryptographic 64-bit hash family
+ * @details Wide-stride multiply-mix hash (rapidhash/wyhash lineage) used as the
+ *          default engine of HashMap, HashSet and the runtime string hash.
+ *          - Byte strings are consumed 8 bytes at a time with three independent
+ *            lanes for inputs longer than 48 bytes, so the loop is bound by
+ *            multiplier throughput instead of the per-byte dependency chain of FNV.
+ *          - Inputs of 16 bytes or fewer take a branch-light overlapping-read path.
+ *          - Fixed-width integer keys have dedicated single-multiply mixers.
+ *          - With `Hash_use_aes` (default: `arch_has_aes`), long inputs are
+ *            absorbed by four AES round lanes (AES-NI / ARMv8 Crypto).
+ *          - With `Hash_use_crc32c` (default: off), integer mixers use the
+ *            hardware CRC32C instruction followed by one multiply.
+ *          Every output bit depends on every input bit, so both the low bits
+ *          (slot index) and the top 7 bits (control fingerprint) are usable.
+ *          Hash values are NOT stable across targets or configurations;
+ *          do not persist them.
+ */
+#ifndef Hash__included
+#define Hash__included 1
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/*========== Includes =======================================================*/
+
+#include "dh/prl.h"
+
+/*========== Macros and Declarations ========================================*/
+
+/* --- Configuration --- */
+
+#if !defined(Hash_use_aes)
+#define Hash_use_aes __comp_bool__Hash_use_aes
+#endif /* !defined(Hash_use_aes) */
+#define __comp_bool__Hash_use_aes arch_has_aes
+
+/// CRC32C is linear over GF(2); it is only followed by one multiply, so the
+/// avalanche is weaker than the default mixers. Opt-in for dense integer keys.
+#if !defined(Hash_use_crc32c)
+#define Hash_use_crc32c __comp_bool__Hash_use_crc32c
+#endif /* !defined(Hash_use_crc32c) */
+#define __comp_bool__Hash_use_crc32c pp_false
+
+#define Hash__use_crc32c_x86 (Hash_use_crc32c && arch_has_crc32 && arch_is_x86_family)
+#define Hash__use_crc32c_arm (Hash_use_crc32c && arch_has_crc32 && arch_is_arm_family)
+#if Hash__use_crc32c_x86
+#include <nmmintrin.h>
+#elif Hash__use_crc32c_arm
+#include <arm_acle.h>
+#endif
+
+/// Inputs at least this long take the AES bulk path when `Hash_use_aes` is enabled.
+#define Hash_aes_threshold_bytes (128)
+
+/* --- Seeds and Secrets --- */
+
+#define Hash_seed_default (0xbdd89aa982704029ull)
+#define Hash_secret_0 (0x2d358dccaa6c78a5ull)
+#define Hash_secret_1 (0x8bb84b93962eacc9ull)
+#define Hash_secret_2 (0x4b33a62ed433d4a3ull)
+
+/* --- Primitives --- */
+
+/// 64x64 -> 128-bit multiply; stores the low half in `*lhs` and the high half in `*rhs`.
+$attr($inline_always)
+$static fn_((Hash_mum(u64* lhs, u64* rhs))(void));
+/// Folded multiply: xor of the low and high halves of the 128-bit product.
+$attr($inline_always)
+$static fn_((Hash_mix(u64 lhs, u64 rhs))(u64));
+
+/* --- Fixed-width integer mixers --- */
+
+$attr($inline_always)
+$static fn_((Hash_u8(u8 val, u64 seed))(u64));
+$attr($inline_always)
+$static fn_((Hash_u16(u16 val, u64 seed))(u64));
+$attr($inline_always)
+$static fn_((Hash_u32(u32 val, u64 seed))(u64));
+$attr($inline_always)
+$static fn_((Hash_u64(u64 val, u64 seed))(u64));
+
+/* --- Byte strings --- */
+
+/// Hashes `bytes` with the widest path enabled for this target.
+$extern fn_((Hash_bytes(S_const$u8 bytes, u64 seed))(u64));
+/// Scalar reference implementation; identical to `Hash_bytes` when `Hash_use_aes` is off.
+$extern fn_((Hash_bytesPortable(S_const$u8 bytes, u64 seed))(u64));
+/// Hashes the raw bytes of a value; dispatches to the integer mixers for 1/2/4/8-byte types.
+$extern fn_((Hash_val(u_V$raw val, u64 seed))(u64));
+
+/*========== Macros and Definitions =========================================*/
+
+$static fn_((Hash_mum(u64* lhs, u64* rhs))(void)) {
+#if defined(__SIZEOF_INT128__)
+    let product = as$(unsigned __int128)(*lhs) * (*rhs);
+    *lhs = as$(u64)(product);
+    *rhs = as$(u64)(product >> 64);
+#else  /* !defined(__SIZEOF_INT128__) */
+    let ha = *lhs >> 32;
+    let hb = *rhs >> 32;
+    let la = as$(u64)(as$(u32)(*lhs));
+    let lb = as$(u64)(as$(u32)(*rhs));
+    let rh = ha * hb;
+    let rm0 = ha * lb;
+    let rm1 = hb * la;
+    let rl = la * lb;
+    let t = rl + (rm0 << 32);
+    var_(carry, u64) = t < rl;
+    let lo = t + (rm1 << 32);
+    carry += lo < t;
+    let hi = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+    *lhs = lo;
+    *rhs = hi;
+#endif /* !defined(__SIZEOF_INT128__) */
+};
+
+$static fn_((Hash_mix(u64 lhs, u64 rhs))(u64)) {
+    Hash_mum(&lhs, &rhs);
+    return lhs ^ rhs;
+};
+
+$static fn_((Hash_u64(u64 val, u64 seed))(u64)) {
+#if Hash__use_crc32c_x86
+    let lo = as$(u64)(_mm_crc32_u64(as$(u32)(seed), val));
+    let hi = as$(u64)(_mm_crc32_u64(as$(u32)(seed >> 32), (val >> 32) | (val << 32)));
+    let h = ((hi << 32) | lo) * Hash_secret_0;
+    return h ^ (h >> 32);
+#elif Hash__use_crc32c_arm
+    let lo = as$(u64)(__crc32cd(as$(u32)(seed), val));
+    let hi = as$(u64)(__crc32cd(as$(u32)(seed >> 32), (val >> 32) | (val << 32)));
+    let h = ((hi << 32) | lo) * Hash_secret_0;
+    return h ^ (h >> 32);
+#else
+    var_(a, u64) = val ^ Hash_secret_1;
+    var_(b, u64) = ((val >> 32) | (val << 32)) ^ seed;
+    Hash_mum(&a, &b);
+    return Hash_mix(a ^ Hash_secret_0 ^ 8, b ^ Hash_secret_1);
+#endif
+};
+
+$static fn_((Hash_u32(u32 val, u64 seed))(u64)) {
+#if Hash__use_crc32c_x86 || Hash__use_crc32c_arm
+    return Hash_u64(val, seed);
+#else
+    let wide = (as$(u64)(val) << 32) | val;
+    var_(a, u64) = wide ^ Hash_secret_1;
+    var_(b, u64) = wide ^ seed;
+    Hash_mum(&a, &b);
+    return Hash_mix(a ^ Hash_secret_0 ^ 4, b ^ Hash_secret_1);
+#endif
+};
+
+$static fn_((Hash_u16(u16 val, u64 seed))(u64)) {
+    return Hash_u32((as$(u32)(val) << 16) | val, seed ^ 2);
+};
+
+$static fn_((Hash_u8(u8 val, u64 seed))(u64)) {
+    return Hash_u32(as$(u32)(val) * 0x01010101u, seed ^ 1);
+};
+
+#if defined(__cplusplus)
+} /* extern "C" */
+#endif /* defined(__cplusplus) */
+#endif /* Hash__included */
@@ -205,11 +205,23 @@ $extern fn_((HashMap_Ensured_foundExistingMut(
 /* --- HashMap_Ctx: Context for hash and equality functions --- */
 
 typedef u_HashCtxFn HashMap_HashFn;
+/// Hashes the key bytes with the `Hash` engine (fixed-width mixers for 1/2/4/8-byte keys).
 $extern fn_((HashMap_HashFn_default(u_V$raw val, u_V$raw ctx))(u64));
 claim_assert_static(Type_eq$(HashMap_HashFn, TypeOf(&HashMap_HashFn_default)));
+$extern fn_((HashMap_HashFn_u8(u_V$raw val, u_V$raw ctx))(u64));
+$extern fn_((HashMap_HashFn_u16(u_V$raw val, u_V$raw ctx))(u64));
+$extern fn_((HashMap_HashFn_u32(u_V$raw val, u_V$raw ctx))(u64));
+$extern fn_((HashMap_HashFn_u64(u_V$raw val, u_V$raw ctx))(u64));
+/// Hashes the contents of a `S_const$u8` key (not the slice header).
+$extern fn_((HashMap_HashFn_str(u_V$raw val, u_V$raw ctx))(u64));
 typedef u_EqlCtxFn HashMap_EqlFn;
 $extern fn_((HashMap_EqlFn_default(u_V$raw lhs, u_V$raw rhs, u_V$raw ctx))(bool));
 claim_assert_static(Type_eq$(HashMap_EqlFn, TypeOf(&HashMap_EqlFn_default)));
+$extern fn_((HashMap_EqlFn_u8(u_V$raw lhs, u_V$raw rhs, u_V$raw ctx))(bool));
+$extern fn_((HashMap_EqlFn_u16(u_V$raw lhs, u_V$raw rhs, u_V$raw ctx))(bool));
+$extern fn_((HashMap_EqlFn_u32(u_V$raw lhs, u_V$raw rhs, u_V$raw ctx))(bool));
+$extern fn_((HashMap_EqlFn_u64(u_V$raw lhs, u_V$raw rhs, u_V$raw ctx))(bool));
+$extern fn_((HashMap_EqlFn_str(u_V$raw lhs, u_V$raw rhs, u_V$raw ctx))(bool));
 
 typedef struct HashMap_Ctx {
     var_(inner, u_P_const$raw);
@@ -218,6 +230,11 @@ typedef struct HashMap_Ctx {
 } HashMap_Ctx;
 T_use_P$(HashMap_Ctx);
 $extern fn_((HashMap_Ctx_default(void))(P_const$HashMap_Ctx));
+/// Picks the fixed-width hash/eql pair for integer-like keys (size 1/2/4/8 with
+/// matching alignment) once at construction; other key types get `HashMap_Ctx_default()`.
+$extern fn_((HashMap_Ctx_for(TypeInfo key_ty))(P_const$HashMap_Ctx));
+/// Context for `S_const$u8` keys compared by content.
+$extern fn_((HashMap_Ctx_str(void))(P_const$HashMap_Ctx));
 
 /* --- HashMap: Main hash map structure --- */
 
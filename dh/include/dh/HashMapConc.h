@@ -0,0 +1,219 @@
+/**
+ * @copyright Copyright (c) 2025 Gyeongtae Kim
+ * @license   MIT License - see LICENSE file for details
+ *
+ * @file    HashMapConc.h
+ * @author  Gyeongtae Kim (dev-dasae) <codingpelican@gmail.com>
+ * @date    2025-12-15 (date of creation)
+ * @updated 2025-12-15 (date of last update)
+ * @version v0.1
+ * @ingroup dasae-headers(dh)
+ * @prefix  HashMapConc
+ *
+ * @brief   Concurrent sharded hash map with lock-free reads
+ * @details The key space is split into a power-of-two number of shards, each one a
+ *          cache-line aligned `HashMap` (same `HashMap_Ctrl` layout and probing)
+ *          guarded by a seqlock.
+ *          - `by`/`contains` never lock: they snapshot the shard, probe it, and
+ *            retry only if a writer touched that shard in the meantime.
+ *          - `put`/`remove` lock a single shard, so writers on different shards
+ *            never contend.
+ *          - A grown shard table is retired, not freed, because a reader may still
+ *            be probing it. Readers announce a global epoch while they probe; a
+ *            retired table is freed by the next growth of its shard or by
+ *            `HashMapConc_reclaim` once every reader that could have seen it is done.
+ *          - Removals leave tombstones; once they make up a quarter of a shard, the
+ *            next `put` rehashes that shard in place instead of growing it.
+ *          Readers may observe a half-written slot before the retry, so the
+ *          context's hash/eql functions must not dereference pointers stored in
+ *          keys (the default and fixed-width contexts are safe; `HashMap_Ctx_str` is not).
+ *          No pointer-returning lookups are offered: a pointer into a shard cannot
+ *          outlive the seqlock validation.
+ *          `gpa` must be thread-safe when writers run on several threads (e.g. `heap_Smp`).
+ */
+#ifndef HashMapConc__included
+#define HashMapConc__included 1
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/*========== Includes =======================================================*/
+
+#include "dh/prl.h"
+#include "dh/mem/Allocator.h"
+#include "dh/HashMap.h"
+#include "dh/Thrd/Mtx.h"
+
+/*========== Macros and Declarations ========================================*/
+
+#define HashMapConc_default_shard_count (lit_n$(u32)(64))
+
+/* --- HashMapConc_Shard: One seqlock-protected table --- */
+
+typedef struct HashMapConc_Retired HashMapConc_Retired;
+struct HashMapConc_Retired {
+    var_(next, HashMapConc_Retired*);
+    var_(map, HashMap);
+    /// Reader epoch when the table was replaced; only readers announcing it or
+    /// an older one may still be probing the table.
+    var_(epoch, usize);
+};
+
+typedef struct HashMapConc_Shard {
+    var_(_avoid_false_sharing, Void) $align(arch_cache_line_bytes);
+    /// Odd while a writer is mutating `map`.
+    var_(seq, atom_V$u32);
+    /// Serializes writers of this shard.
+    var_(mtx, Thrd_Mtx);
+    var_(map, HashMap);
+    /// Tables replaced by growth, kept alive for in-flight readers.
+    var_(retired, HashMapConc_Retired*);
+    /// Removals since the last rehash, an upper bound on the tombstones in `map`.
+    var_(removed, u32);
+} HashMapConc_Shard;
+T_use$((HashMapConc_Shard)(P, S));
+
+/* --- HashMapConc: Main structure --- */
+
+#define HashMapConc$$(_K, _V...) __comp_anon__HashMapConc$$(_K, _V)
+#define HashMapConc$(_K, _V...) __comp_alias__HashMapConc$(_K, _V)
+#define T_decl_HashMapConc$(_K, _V...) __comp_gen__T_decl_HashMapConc$(_K, _V)
+#define T_impl_HashMapConc$(_K, _V...) __comp_gen__T_impl_HashMapConc$(_K, _V)
+#define T_use_HashMapConc$(_K, _V...) __comp_gen__T_use_HashMapConc$(_K, _V)
+
+typedef struct HashMapConc {
+    var_(shards, S$HashMapConc_Shard);
+    /// Context containing hash and equality functions (shared by every shard).
+    var_(ctx, P_const$HashMap_Ctx);
+    debug_only(struct {
+        var_(key_ty, TypeInfo);
+        var_(val_ty, TypeInfo);
+    });
+} HashMapConc;
+T_use$((HashMapConc)(O, E));
+T_use_E$($set(mem_Err)(HashMapConc));
+
+/* --- Construction/Destruction --- */
+
+/// `shard_count` is rounded up to a power of two (0 selects `HashMapConc_default_shard_count`);
+/// `cap` is the expected total element count, spread evenly over the shards.
+$attr($must_check)
+$extern fn_((HashMapConc_init(
+    TypeInfo key_ty, TypeInfo val_ty, P_const$HashMap_Ctx ctx, mem_Allocator gpa, u32 shard_count, u32 cap
+))(mem_Err$HashMapConc));
+/// Not thread-safe: no other operation may run concurrently.
+$extern fn_((HashMapConc_fini(
+    HashMapConc* self, TypeInfo key_ty, TypeInfo val_ty, mem_Allocator gpa
+))(void));
+/// Frees the tables retired by growth that no reader can still be probing.
+/// Safe to call concurrently with every operation but `HashMapConc_fini`.
+$extern fn_((HashMapConc_reclaim(
+    HashMapConc self, TypeInfo key_ty, TypeInfo val_ty, mem_Allocator gpa
+))(void));
+
+/* --- Capacity --- */
+
+/// Approximate while writers are active.
+$extern fn_((HashMapConc_count(HashMapConc self))(usize));
+
+/* --- Lock-free Lookup --- */
+
+$extern fn_((HashMapConc_by(HashMapConc self, u_V$raw key, u_V$raw ret_mem))(O$u_V$raw));
+$extern fn_((HashMapConc_contains(HashMapConc self, TypeInfo val_ty, u_V$raw key))(bool));
+
+/* --- Shard-locked Mutation --- */
+
+/// Insert or update. May allocate (grows only the owning shard).
+$attr($must_check)
+$extern fn_((HashMapConc_put(HashMapConc self, mem_Allocator gpa, u_V$raw key, u_V$raw val))(mem_Err$void));
+/// Remove entry if present, returning true if removed.
+$extern fn_((HashMapConc_remove(HashMapConc self, TypeInfo val_ty, u_V$raw key))(bool));
+
+/*========== Macros and Definitions =========================================*/
+
+#define __comp_anon__HashMapConc$$(_K, _V...) \
+    union { \
+        struct { \
+            var_(shards, S$HashMapConc_Shard); \
+            var_(ctx, P_const$HashMap_Ctx); \
+            debug_only(struct { \
+                var_(key_ty, TypeInfo); \
+                var_(val_ty, TypeInfo); \
+            }); \
+        }; \
+        var_(as_raw, HashMapConc) $like_ref; \
+    }
+#define __comp_alias__HashMapConc$(_K, _V...) tpl_id$1T$2U(HashMapConc, _K, _V)
+#define __comp_gen__T_decl_HashMapConc$(_K, _V...) \
+    $maybe_unused typedef union HashMapConc$(_K, _V) HashMapConc$(_K, _V); \
+    T_decl_E$($set(mem_Err)(HashMapConc$(_K, _V)))
+#define __comp_gen__T_impl_HashMapConc$(_K, _V...) \
+    union HashMapConc$(_K, _V) { \
+        struct { \
+            var_(shards, S$HashMapConc_Shard); \
+            var_(ctx, P_const$HashMap_Ctx); \
+            debug_only(struct { \
+                var_(key_ty, TypeInfo); \
+                var_(val_ty, TypeInfo); \
+            }); \
+        }; \
+        var_(as_raw, HashMapConc) $like_ref; \
+    }; \
+    T_impl_E$($set(mem_Err)(HashMapConc$(_K, _V)))
+#define __comp_gen__T_use_HashMapConc$(_K, _V...) \
+    T_decl_HashMapConc$(_K, _V); \
+    T_impl_HashMapConc$(_K, _V)
+
+/* clang-format off */
+#define T_use_HashMapConc_init$(_K, _V...) \
+    $attr($inline_always $must_check) \
+    $static fn_((tpl_id$1T$2U(HashMapConc_init, _K, _V)( \
+        P_const$HashMap_Ctx ctx, mem_Allocator gpa, u32 shard_count, u32 cap \
+    ))(E$($set(mem_Err)(HashMapConc$(_K, _V)))) $scope) { \
+        return_(typeE$((ReturnT)(HashMapConc_init(typeInfo$(_K), typeInfo$(_V), ctx, gpa, shard_count, cap)))); \
+    } $unscoped_(fn)
+#define T_use_HashMapConc_fini$(_K, _V...) \
+    $attr($inline_always) \
+    $static fn_((tpl_id$1T$2U(HashMapConc_fini, _K, _V)( \
+        HashMapConc$(_K, _V)* self, mem_Allocator gpa \
+    ))(void)) { \
+        return HashMapConc_fini(self->as_raw, typeInfo$(_K), typeInfo$(_V), gpa); \
+    }
+#define T_use_HashMapConc_reclaim$(_K, _V...) \
+    $attr($inline_always) \
+    $static fn_((tpl_id$1T$2U(HashMapConc_reclaim, _K, _V)( \
+        HashMapConc$(_K, _V) self, mem_Allocator gpa \
+    ))(void)) { \
+        return HashMapConc_reclaim(*self.as_raw, typeInfo$(_K), typeInfo$(_V), gpa); \
+    }
+#define T_use_HashMapConc_count$(_K, _V...) \
+    $attr($inline_always) \
+    $static fn_((tpl_id$1T$2U(HashMapConc_count, _K, _V)(HashMapConc$(_K, _V) self))(usize)) { \
+        return HashMapConc_count(*self.as_raw); \
+    }
+#define T_use_HashMapConc_by$(_K, _V...) \
+    $attr($inline_always) \
+    $static fn_((tpl_id$1T$2U(HashMapConc_by, _K, _V)(HashMapConc$(_K, _V) self, _K key))(O$(_V))) { \
+        return u_castO$((O$(_V))(HashMapConc_by(*self.as_raw, u_anyV(key), u_retV$(_V)))); \
+    }
+#define T_use_HashMapConc_contains$(_K, _V...) \
+    $attr($inline_always) \
+    $static fn_((tpl_id$1T$2U(HashMapConc_contains, _K, _V)(HashMapConc$(_K, _V) self, _K key))(bool)) { \
+        return HashMapConc_contains(*self.as_raw, typeInfo$(_V), u_anyV(key)); \
+    }
+#define T_use_HashMapConc_put$(_K, _V...) \
+    $attr($inline_always $must_check) \
+    $static fn_((tpl_id$1T$2U(HashMapConc_put, _K, _V)(HashMapConc$(_K, _V) self, mem_Allocator gpa, _K key, _V val))(mem_Err$void)) { \
+        return HashMapConc_put(*self.as_raw, gpa, u_anyV(key), u_anyV(val)); \
+    }
+#define T_use_HashMapConc_remove$(_K, _V...) \
+    $attr($inline_always) \
+    $static fn_((tpl_id$1T$2U(HashMapConc_remove, _K, _V)(HashMapConc$(_K, _V) self, _K key))(bool)) { \
+        return HashMapConc_remove(*self.as_raw, typeInfo$(_V), u_anyV(key)); \
+    }
+/* clang-format on */
+
+#if defined(__cplusplus)
+} /* extern "C" */
+#endif /* defined(__cplusplus) */
+#endif /* HashMapConc__included */
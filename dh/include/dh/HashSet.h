@@ -124,6 +124,10 @@ claim_assert_static(Type_eq$(HashSet_EqlFn, TypeOf(&HashSet_EqlFn_default)));
 typedef HashMap_Ctx HashSet_Ctx;
 T_use_P$(HashSet_Ctx);
 $extern fn_((HashSet_Ctx_default(void))(P_const$HashSet_Ctx));
+/// See `HashMap_Ctx_for`.
+$extern fn_((HashSet_Ctx_for(TypeInfo key_ty))(P_const$HashSet_Ctx));
+/// See `HashMap_Ctx_str`.
+$extern fn_((HashSet_Ctx_str(void))(P_const$HashSet_Ctx));
 
 /* --- HashSet: Main hash set structure --- */
 
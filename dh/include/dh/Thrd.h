@@ -38,6 +38,9 @@ extern "C" {
 #include "Thrd/ResetEvent.h"
 #include "Thrd/WaitGroup.h"
 
+#include "Thrd/Pool.h"
+#include "Thrd/Chan.h"
+
 #if defined(__cplusplus)
 } /* extern "C" */
 #endif /* defined(__cplusplus) */
@@ -0,0 +1,269 @@
+/**
+ * @copyright Copyright (c) 2025 Gyeongtae Kim
+ * @license   MIT License - see LICENSE file for details
+ *
+ * @file    Chan.h
+ * @author  Gyeongtae Kim (dev-dasae) <codingpelican@gmail.com>
+ * @date    2025-12-26 (date of creation)
+ * @updated 2025-12-26 (date of last update)
+ * @version v0.1-alpha
+ * @ingroup dasae-headers(dh)/Thrd
+ * @prefix  Thrd_Chan
+ *
+ * @brief   Bounded channels for passing values between threads
+ * @details A fixed-capacity ring of values, copied in and out by value.
+ *          - `Thrd_Chan_Mode_mpmc`: Vyukov's bounded queue. Every slot carries a sequence
+ *            number, so producers and consumers only contend on the `tail`/`head` CAS.
+ *          - `Thrd_Chan_Mode_spsc`: one producer thread and one consumer thread. Both sides
+ *            are wait-free: each owns its index and keeps a cached copy of the other one.
+ *          `try*` never blocks. Blocking operations spin briefly, then park on a `Thrd_Ftx`;
+ *          the opposite side only issues a wake-up when someone is actually parked.
+ *          `sendS`/`recvS` move a whole slice per index update, amortizing the atomics.
+ *          After `Thrd_Chan_close`, sends fail with `Closed`; receivers drain what is left,
+ *          then fail with `Closed` too.
+ */
+#ifndef Thrd_Chan__included
+#define Thrd_Chan__included 1
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/*========== Includes =======================================================*/
+
+#include "cfg.h"
+#include "common.h"
+#include "Ftx.h"
+
+/*========== Macros and Declarations ========================================*/
+
+/// Busy-wait rounds a blocking operation performs before parking.
+#define Thrd_Chan_spin_rounds (64u)
+
+typedef enum_(Thrd_Chan_Mode $bits(8)) {
+    /// Any number of producer and consumer threads.
+    Thrd_Chan_Mode_mpmc = 0,
+    /// Exactly one producer thread and one consumer thread.
+    Thrd_Chan_Mode_spsc = 1
+} Thrd_Chan_Mode;
+
+errset_((Thrd_Chan_Err)(Closed, Timeout));
+T_use_E$($set(Thrd_Chan_Err)(bool));
+T_use_E$($set(Thrd_Chan_Err)(usize));
+T_use_E$($set(Thrd_Chan_Err)(u_V$raw));
+
+#define Thrd_Chan$$(_T...) __comp_anon__Thrd_Chan$$(_T)
+#define Thrd_Chan$(_T...) __comp_alias__Thrd_Chan$(_T)
+#define T_decl_Thrd_Chan$(_T...) __comp_gen__T_decl_Thrd_Chan$(_T)
+#define T_impl_Thrd_Chan$(_T...) __comp_gen__T_impl_Thrd_Chan$(_T)
+#define T_use_Thrd_Chan$(_T...) __comp_gen__T_use_Thrd_Chan$(_T)
+
+typedef struct Thrd_Chan {
+    /* Producer side */
+    var_(_avoid_false_sharing_send, Void) $align(arch_cache_line_bytes);
+    /// Next position to write.
+    var_(tail, atom_V$usize);
+    /// SPSC only: the producer's last observed `head`.
+    var_(head_cache, usize);
+    /* Consumer side */
+    var_(_avoid_false_sharing_recv, Void) $align(arch_cache_line_bytes);
+    /// Next position to read.
+    var_(head, atom_V$usize);
+    /// SPSC only: the consumer's last observed `tail`.
+    var_(tail_cache, usize);
+    /* Parking */
+    var_(_avoid_false_sharing_park, Void) $align(arch_cache_line_bytes);
+    /// Bumped when values become available while a receiver is parked.
+    var_(recv_seq, atom_V$u32);
+    var_(recv_waiters, atom_V$u32);
+    /// Bumped when slots become free while a sender is parked.
+    var_(send_seq, atom_V$u32);
+    var_(send_waiters, atom_V$u32);
+    var_(is_closed, atom_V$u32);
+    /* Read-only after init */
+    var_(_avoid_false_sharing_ring, Void) $align(arch_cache_line_bytes);
+    /// `mask + 1` slots of `stride` bytes; MPMC slots start with a `atom_V$usize` sequence.
+    var_(slots, S$u8);
+    var_(stride, usize);
+    var_(elem_offset, usize);
+    var_(mask, usize);
+    var_(elem_ty, TypeInfo);
+    var_(mode, Thrd_Chan_Mode);
+} Thrd_Chan;
+T_use$((Thrd_Chan)(O, E));
+T_use_E$($set(mem_Err)(Thrd_Chan));
+
+/* --- Construction/Destruction --- */
+
+/// `cap` is rounded up to a power of two (at least 2).
+/// The result must be moved to its final address before any thread uses it.
+$attr($must_check)
+$extern fn_((Thrd_Chan_init(TypeInfo elem_ty, mem_Allocator gpa, usize cap, Thrd_Chan_Mode mode))(mem_Err$Thrd_Chan));
+/// Not thread-safe: no other operation may run concurrently. Values still queued are dropped.
+$extern fn_((Thrd_Chan_fini(Thrd_Chan* self, TypeInfo elem_ty, mem_Allocator gpa))(void));
+
+/* --- State --- */
+
+/// Wakes every parked sender and receiver; further sends fail with `Closed`.
+$extern fn_((Thrd_Chan_close(Thrd_Chan* self))(void));
+$extern fn_((Thrd_Chan_isClosed(const Thrd_Chan* self))(bool));
+$extern fn_((Thrd_Chan_cap(const Thrd_Chan* self))(usize));
+/// Approximate while other threads are sending or receiving.
+$extern fn_((Thrd_Chan_len(const Thrd_Chan* self))(usize));
+
+/* --- Send --- */
+
+/// Returns false instead of blocking when the channel is full.
+$attr($must_check)
+$extern fn_((Thrd_Chan_trySend(Thrd_Chan* self, u_V$raw item))(Thrd_Chan_Err$bool));
+$attr($must_check)
+$extern fn_((Thrd_Chan_send(Thrd_Chan* self, u_V$raw item))(Thrd_Chan_Err$void));
+/// Sends as many leading items as fit without blocking, returning the count.
+$attr($must_check)
+$extern fn_((Thrd_Chan_trySendS(Thrd_Chan* self, u_S_const$raw items))(Thrd_Chan_Err$usize));
+/// Blocks until every item is sent. On `Closed`, a prefix of `items` may already have been sent.
+$attr($must_check)
+$extern fn_((Thrd_Chan_sendS(Thrd_Chan* self, u_S_const$raw items))(Thrd_Chan_Err$void));
+
+/* --- Receive --- */
+
+$extern fn_((Thrd_Chan_tryRecv(Thrd_Chan* self, u_V$raw ret_mem))(O$u_V$raw));
+$attr($must_check)
+$extern fn_((Thrd_Chan_recv(Thrd_Chan* self, u_V$raw ret_mem))(Thrd_Chan_Err$u_V$raw));
+/// Like `Thrd_Chan_recv`, failing with `Timeout` once `timeout` has elapsed.
+$attr($must_check)
+$extern fn_((Thrd_Chan_timedRecv(Thrd_Chan* self, u_V$raw ret_mem, time_Duration timeout))(Thrd_Chan_Err$u_V$raw));
+/// Receives up to `buf.len` values without blocking, returning the count.
+$extern fn_((Thrd_Chan_tryRecvS(Thrd_Chan* self, u_S$raw buf))(usize));
+/// Blocks until at least one value is available, then receives up to `buf.len` of them.
+$attr($must_check)
+$extern fn_((Thrd_Chan_recvS(Thrd_Chan* self, u_S$raw buf))(Thrd_Chan_Err$usize));
+
+/*========== Macros and Definitions =========================================*/
+
+#define __comp_anon__Thrd_Chan$$(_T...) \
+    union { \
+        struct { \
+            var_(_avoid_false_sharing_send, Void) $align(arch_cache_line_bytes); \
+            var_(tail, atom_V$usize); \
+            var_(head_cache, usize); \
+            var_(_avoid_false_sharing_recv, Void) $align(arch_cache_line_bytes); \
+            var_(head, atom_V$usize); \
+            var_(tail_cache, usize); \
+            var_(_avoid_false_sharing_park, Void) $align(arch_cache_line_bytes); \
+            var_(recv_seq, atom_V$u32); \
+            var_(recv_waiters, atom_V$u32); \
+            var_(send_seq, atom_V$u32); \
+            var_(send_waiters, atom_V$u32); \
+            var_(is_closed, atom_V$u32); \
+            var_(_avoid_false_sharing_ring, Void) $align(arch_cache_line_bytes); \
+            var_(slots, S$u8); \
+            var_(stride, usize); \
+            var_(elem_offset, usize); \
+            var_(mask, usize); \
+            var_(elem_ty, TypeInfo); \
+            var_(mode, Thrd_Chan_Mode); \
+        }; \
+        var_(as_raw, Thrd_Chan) $like_ref; \
+    }
+#define __comp_alias__Thrd_Chan$(_T...) pp_join($, Thrd_Chan, _T)
+#define __comp_gen__T_decl_Thrd_Chan$(_T...) \
+    $maybe_unused typedef union Thrd_Chan$(_T) Thrd_Chan$(_T); \
+    T_decl_E$($set(mem_Err)(Thrd_Chan$(_T))); \
+    T_decl_E$($set(Thrd_Chan_Err)(_T))
+#define __comp_gen__T_impl_Thrd_Chan$(_T...) \
+    union Thrd_Chan$(_T) { \
+        struct { \
+            var_(_avoid_false_sharing_send, Void) $align(arch_cache_line_bytes); \
+            var_(tail, atom_V$usize); \
+            var_(head_cache, usize); \
+            var_(_avoid_false_sharing_recv, Void) $align(arch_cache_line_bytes); \
+            var_(head, atom_V$usize); \
+            var_(tail_cache, usize); \
+            var_(_avoid_false_sharing_park, Void) $align(arch_cache_line_bytes); \
+            var_(recv_seq, atom_V$u32); \
+            var_(recv_waiters, atom_V$u32); \
+            var_(send_seq, atom_V$u32); \
+            var_(send_waiters, atom_V$u32); \
+            var_(is_closed, atom_V$u32); \
+            var_(_avoid_false_sharing_ring, Void) $align(arch_cache_line_bytes); \
+            var_(slots, S$u8); \
+            var_(stride, usize); \
+            var_(elem_offset, usize); \
+            var_(mask, usize); \
+            var_(elem_ty, TypeInfo); \
+            var_(mode, Thrd_Chan_Mode); \
+        }; \
+        var_(as_raw, Thrd_Chan) $like_ref; \
+    }; \
+    T_impl_E$($set(mem_Err)(Thrd_Chan$(_T))); \
+    T_impl_E$($set(Thrd_Chan_Err)(_T))
+#define __comp_gen__T_use_Thrd_Chan$(_T...) \
+    T_decl_Thrd_Chan$(_T); \
+    T_impl_Thrd_Chan$(_T)
+
+/* clang-format off */
+#define T_use_Thrd_Chan_init$(_T...) \
+    $attr($inline_always $must_check) \
+    $static fn_((tpl_id(Thrd_Chan_init, _T)( \
+        mem_Allocator gpa, usize cap, Thrd_Chan_Mode mode \
+    ))(E$($set(mem_Err)(Thrd_Chan$(_T)))) $scope) { \
+        return_(typeE$((ReturnType)(Thrd_Chan_init(typeInfo$(_T), gpa, cap, mode)))); \
+    } $unscoped_(fn)
+#define T_use_Thrd_Chan_fini$(_T...) \
+    $attr($inline_always) \
+    $static fn_((tpl_id(Thrd_Chan_fini, _T)(Thrd_Chan$(_T)* self, mem_Allocator gpa))(void)) { \
+        return Thrd_Chan_fini(self->as_raw, typeInfo$(_T), gpa); \
+    }
+#define T_use_Thrd_Chan_trySend$(_T...) \
+    $attr($inline_always $must_check) \
+    $static fn_((tpl_id(Thrd_Chan_trySend, _T)(Thrd_Chan$(_T)* self, _T item))(Thrd_Chan_Err$bool)) { \
+        return Thrd_Chan_trySend(self->as_raw, u_anyV(item)); \
+    }
+#define T_use_Thrd_Chan_send$(_T...) \
+    $attr($inline_always $must_check) \
+    $static fn_((tpl_id(Thrd_Chan_send, _T)(Thrd_Chan$(_T)* self, _T item))(Thrd_Chan_Err$void)) { \
+        return Thrd_Chan_send(self->as_raw, u_anyV(item)); \
+    }
+#define T_use_Thrd_Chan_trySendS$(_T...) \
+    $attr($inline_always $must_check) \
+    $static fn_((tpl_id(Thrd_Chan_trySendS, _T)(Thrd_Chan$(_T)* self, S$(const _T) items))(Thrd_Chan_Err$usize)) { \
+        return Thrd_Chan_trySendS(self->as_raw, u_anyS(items)); \
+    }
+#define T_use_Thrd_Chan_sendS$(_T...) \
+    $attr($inline_always $must_check) \
+    $static fn_((tpl_id(Thrd_Chan_sendS, _T)(Thrd_Chan$(_T)* self, S$(const _T) items))(Thrd_Chan_Err$void)) { \
+        return Thrd_Chan_sendS(self->as_raw, u_anyS(items)); \
+    }
+#define T_use_Thrd_Chan_tryRecv$(_T...) \
+    $attr($inline_always) \
+    $static fn_((tpl_id(Thrd_Chan_tryRecv, _T)(Thrd_Chan$(_T)* self))(O$(_T)) $scope) { \
+        return_(u_castO$((ReturnType)(Thrd_Chan_tryRecv(self->as_raw, u_retV$(_T))))); \
+    } $unscoped_(fn)
+#define T_use_Thrd_Chan_recv$(_T...) \
+    $attr($inline_always $must_check) \
+    $static fn_((tpl_id(Thrd_Chan_recv, _T)(Thrd_Chan$(_T)* self))(E$($set(Thrd_Chan_Err)(_T))) $scope) { \
+        return_(u_castE$((ReturnType)(Thrd_Chan_recv(self->as_raw, u_retV$(_T))))); \
+    } $unscoped_(fn)
+#define T_use_Thrd_Chan_timedRecv$(_T...) \
+    $attr($inline_always $must_check) \
+    $static fn_((tpl_id(Thrd_Chan_timedRecv, _T)( \
+        Thrd_Chan$(_T)* self, time_Duration timeout \
+    ))(E$($set(Thrd_Chan_Err)(_T))) $scope) { \
+        return_(u_castE$((ReturnType)(Thrd_Chan_timedRecv(self->as_raw, u_retV$(_T), timeout)))); \
+    } $unscoped_(fn)
+#define T_use_Thrd_Chan_tryRecvS$(_T...) \
+    $attr($inline_always) \
+    $static fn_((tpl_id(Thrd_Chan_tryRecvS, _T)(Thrd_Chan$(_T)* self, S$(_T) buf))(usize)) { \
+        return Thrd_Chan_tryRecvS(self->as_raw, u_anyS(buf)); \
+    }
+#define T_use_Thrd_Chan_recvS$(_T...) \
+    $attr($inline_always $must_check) \
+    $static fn_((tpl_id(Thrd_Chan_recvS, _T)(Thrd_Chan$(_T)* self, S$(_T) buf))(Thrd_Chan_Err$usize)) { \
+        return Thrd_Chan_recvS(self->as_raw, u_anyS(buf)); \
+    }
+/* clang-format on */
+
+#if defined(__cplusplus)
+} /* extern "C" */
+#endif /* defined(__cplusplus) */
+#endif /* Thrd_Chan__included */
@@ -0,0 +1,152 @@
+/**
+ * @copyright Copyright (c) 2025 Gyeongtae Kim
+ * @license   MIT License - see LICENSE file for details
+ *
+ * @file    Pool.h
+ * @author  Gyeongtae Kim (dev-dasae) <codingpelican@gmail.com>
+ * @date    2025-12-24 (date of creation)
+ * @updated 2025-12-24 (date of last update)
+ * @version v0.1-alpha
+ * @ingroup dasae-headers(dh)/Thrd
+ * @prefix  Thrd_Pool
+ *
+ * @brief   Work-stealing thread pool
+ * @details A fixed set of worker threads, each owning a Chase-Lev deque.
+ *          - Workers push and pop at the bottom of their own deque (LIFO, cache-warm);
+ *            idle workers steal from the top of a randomly chosen victim (FIFO).
+ *          - Tasks submitted from non-worker threads go through a bounded injector queue.
+ *            When both the local deque and the injector are full, the submitter runs the task inline.
+ *          - Idle workers spin briefly, then park on a `Thrd_Ftx` until new work is pushed.
+ *          Tasks are plain `Thrd_FnCtx` instances built with `Thrd_fn_`/`Thrd_FnCtx_from$`;
+ *          the caller owns their storage until they complete (use a `Thrd_Pool_Scope` to know when).
+ */
+#ifndef Thrd_Pool__included
+#define Thrd_Pool__included 1
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/*========== Includes =======================================================*/
+
+#include "cfg.h"
+#include "common.h"
+#include "Ftx.h"
+#include "Mtx.h"
+
+/*========== Macros and Declarations ========================================*/
+
+#define Thrd_Pool_Cfg_default_deque_cap (4096u)
+#define Thrd_Pool_Cfg_default_injector_cap (4096u)
+#define Thrd_Pool_Cfg_default_stack_size (2ull * 1024ull * 1024ull)
+/// Busy-wait rounds an idle worker performs before parking.
+#define Thrd_Pool_spin_rounds (64u)
+
+typedef struct Thrd_Pool Thrd_Pool;
+typedef struct Thrd_Pool_Scope Thrd_Pool_Scope;
+
+/// A queued unit of work. `scope` is null for detached tasks.
+typedef struct Thrd_Pool_Task {
+    var_(fn_ctx, Thrd_FnCtx*);
+    var_(scope, Thrd_Pool_Scope*);
+} Thrd_Pool_Task;
+T_use$((Thrd_Pool_Task)(S, O));
+
+/// Per-worker state; `top`/`bottom` index the Chase-Lev ring `tasks`.
+typedef struct Thrd_Pool_Worker {
+    var_(_avoid_false_sharing, Void) $align(arch_cache_line_bytes);
+    /// Advanced by thieves (CAS) and by the owner when taking the last task.
+    var_(top, atom_V$isize);
+    /// Written only by the owner.
+    var_(bottom, atom_V$isize);
+    var_(tasks, S$Thrd_Pool_Task);
+    var_(pool, Thrd_Pool*);
+    var_(thrd, Thrd);
+    /// Xorshift state for victim selection.
+    var_(rng, u64);
+    var_(idx, u32);
+} Thrd_Pool_Worker;
+T_use$((Thrd_Pool_Worker)(S));
+
+typedef struct Thrd_Pool_Cfg {
+    /// Number of workers (0 selects `Thrd_cpuCount()`).
+    var_(thrd_count, u32);
+    /// Per-worker deque capacity, rounded up to a power of two.
+    var_(deque_cap, u32);
+    /// Capacity of the queue used by non-worker submitters.
+    var_(injector_cap, u32);
+    var_(stack_size, usize);
+} Thrd_Pool_Cfg;
+static const Thrd_Pool_Cfg Thrd_Pool_Cfg_default = {
+    .thrd_count = 0,
+    .deque_cap = Thrd_Pool_Cfg_default_deque_cap,
+    .injector_cap = Thrd_Pool_Cfg_default_injector_cap,
+    .stack_size = Thrd_Pool_Cfg_default_stack_size,
+};
+
+struct Thrd_Pool {
+    var_(gpa, mem_Allocator);
+    var_(workers, S$Thrd_Pool_Worker);
+    /// Bounded FIFO ring for tasks submitted from outside the pool.
+    struct {
+        var_(mtx, Thrd_Mtx);
+        var_(tasks, S$Thrd_Pool_Task);
+        var_(head, usize);
+        var_(len, usize);
+        /// Mirror of `len` readable without the lock.
+        var_(queued, atom_V$usize);
+    } injector;
+    /// Number of workers currently parked (or about to park).
+    var_(sleepers, atom_V$u32);
+    /// Bumped on every wake-up so parked workers notice new work.
+    var_(wake_seq, atom_V$u32);
+    var_(is_shutdown, atom_V$u32);
+};
+
+/// Starts the workers. `self` must stay at a fixed address until `Thrd_Pool_fini`.
+/// `gpa` backs the deques and worker contexts only; it is not used on the task path.
+$attr($must_check)
+$extern fn_((Thrd_Pool_init(Thrd_Pool* self, mem_Allocator gpa, Thrd_Pool_Cfg cfg))(E$void));
+/// Runs every queued task to completion, then joins and frees the workers.
+$extern fn_((Thrd_Pool_fini(Thrd_Pool* self))(void));
+$extern fn_((Thrd_Pool_thrdCount(const Thrd_Pool* self))(usize));
+/// Index of the calling worker of `self`, or none when called from another thread.
+$extern fn_((Thrd_Pool_currentIdx(const Thrd_Pool* self))(O$usize));
+
+/// Queues a detached task. `fn_ctx` must stay valid until the task has run.
+$extern fn_((Thrd_Pool_spawn(Thrd_Pool* self, Thrd_FnCtx* fn_ctx))(void));
+
+/* --- Thrd_Pool_Scope: Fork/join group --- */
+
+struct Thrd_Pool_Scope {
+    var_(pool, Thrd_Pool*);
+    /// Tasks spawned in this scope that have not finished yet.
+    var_(pending, atom_V$u32);
+    var_(is_joined, bool);
+};
+$extern fn_((Thrd_Pool_Scope_init(Thrd_Pool* pool))(Thrd_Pool_Scope));
+$extern fn_((Thrd_Pool_Scope_spawn(Thrd_Pool_Scope* self, Thrd_FnCtx* fn_ctx))(void));
+/// Blocks until every task spawned in the scope has finished.
+/// The caller helps by running queued tasks while it waits, so nested scopes do not deadlock.
+$extern fn_((Thrd_Pool_Scope_wait(Thrd_Pool_Scope* self))(void));
+
+/// Statement form: `Thrd_Pool_scope(pool, s) { Thrd_Pool_Scope_spawn(&s, ...); }`
+/// waits for the spawned tasks when the block ends (do not `break`/`return` out of it).
+#define Thrd_Pool_scope(_pool, _scope...) __step__Thrd_Pool_scope(_pool, _scope)
+
+/* --- Data parallelism --- */
+
+use_Callable(Thrd_Pool_ForFn, (R range), void);
+/// Calls `fn` over disjoint sub-ranges of `range`, each at most `grain` long (0 picks a grain
+/// yielding roughly eight chunks per worker). The range is split in halves recursively so thieves
+/// take large pieces; returns once every sub-range has been processed.
+$extern fn_((Thrd_Pool_parallelFor(Thrd_Pool* self, R range, usize grain, Thrd_Pool_ForFn fn))(void));
+
+/*========== Macros and Definitions =========================================*/
+
+#define __step__Thrd_Pool_scope(_pool, _scope...) \
+    for (var _scope = Thrd_Pool_Scope_init(_pool); !_scope.is_joined; Thrd_Pool_Scope_wait(&_scope))
+
+#if defined(__cplusplus)
+} /* extern "C" */
+#endif /* defined(__cplusplus) */
+#endif /* Thrd_Pool__included */
@@ -74,6 +74,7 @@ typedef struct Thrd_Mtx__Impl Thrd_Mtx__Impl;
 typedef struct Thrd_Cond__Impl Thrd_Cond__Impl;
 typedef struct Thrd_RWLock__Impl Thrd_RWLock__Impl;
 T_use_atom_V$(usize); /* for Thrd_WaitGroup */
+T_use_atom_V$(isize); /* for Thrd_Pool */
 
 #if defined(__cplusplus)
 } /* extern "C" */
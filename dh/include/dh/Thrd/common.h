@@ -112,6 +112,17 @@ $extern fn_((Thrd_spawn(Thrd_SpawnCfg cfg, Thrd_FnCtx* fn_ctx))(E$Thrd)) $must_c
 $extern fn_((Thrd_detach(Thrd self))(void));
 $extern fn_((Thrd_join(Thrd self))(Thrd_FnCtx*));
 
+// Thread exit hook: `fn` runs on the registering thread once its `Thrd_spawn` function returns
+typedef fn_(((*Thrd_ExitFn)(void))(void));
+typedef struct Thrd_ExitHook Thrd_ExitHook;
+struct Thrd_ExitHook {
+    var_(next, Thrd_ExitHook*);
+    var_(fn, Thrd_ExitFn);
+};
+/// Hooks run newest first and must stay alive until then (a `$Thrd_local` hook does).
+/// Threads not started by `Thrd_spawn`, the main thread included, never run them.
+$extern fn_((Thrd_onExit(Thrd_ExitHook* hook))(void));
+
 // Mutex type
 typedef struct Thrd_Mtx Thrd_Mtx;
 // Mutex recursive type
@@ -0,0 +1,178 @@
+/**
+ * @copyright Copyright (c) 2026 Gyeongtae Kim
+ * @license   MIT License - see LICENSE file for details
+ *
+ * @file    Exec.h
+ * @author  Gyeongtae Kim (dev-dasae) <codingpelican@gmail.com>
+ * @date    2026-10-17 (date of creation)
+ * @updated 2026-10-17 (date of last update)
+ * @ingroup dasae-headers(dh)/async
+ * @prefix  Co_Exec
+ *
+ * @brief   Single-threaded event loop for stackless coroutines
+ * @details Resumes ready `Co_Ctx` frames in FIFO order and parks suspended ones on a
+ *          hierarchical timing wheel of `Co_Exec_wheel_levels` levels with
+ *          `Co_Exec_wheel_slots` slots each, one tick per `Co_Exec.tick_ns`.
+ *
+ *          Timers are intrusive (`Co_Timer` lives in the waiting coroutine's locals),
+ *          so arming and cancelling never allocate and cost O(1): a timer is linked
+ *          into the slot of the highest tick digit where its deadline differs from
+ *          the wheel clock, and drops one level each time the clock reaches that
+ *          slot. Per-level occupancy masks let the clock jump straight to the next
+ *          non-empty slot, and a whole level-0 slot expires with one list splice.
+ *
+ *          Deadlines are counted from the wheel clock, which `Co_Exec_poll` moves
+ *          to the current time once per iteration.
+ */
+#ifndef async_Exec__included
+#define async_Exec__included 1
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/*========== Includes =======================================================*/
+
+#include "dh/async.h"
+#include "dh/mem/Allocator.h"
+#include "dh/time/Instant.h"
+
+/*========== Macros and Declarations ========================================*/
+
+#define Co_Exec_wheel_bits (6u)
+#define Co_Exec_wheel_slots (1u << Co_Exec_wheel_bits)
+/// 6 levels of 64 slots span 2^36 ticks (about 795 days at 1 ms); later deadlines are re-parked
+#define Co_Exec_wheel_levels (6u)
+#define Co_Exec_tick_default (time_Duration_milli)
+
+typedef struct Co_Timer_Link Co_Timer_Link;
+struct Co_Timer_Link {
+    var_(prev, Co_Timer_Link*);
+    var_(next, Co_Timer_Link*);
+};
+
+typedef enum Co_Timer_State {
+    Co_Timer_State_idle = 0,
+    /// Linked into the wheel or the due list
+    Co_Timer_State_armed,
+    /// Its frame was queued because the deadline passed
+    Co_Timer_State_expired,
+    /// Its frame was queued by `Co_Exec_wake` before the deadline
+    Co_Timer_State_notified,
+} Co_Timer_State;
+
+/// Must stay at one address while pending; `link` comes first so a link is its timer.
+typedef struct Co_Timer {
+    var_(link, Co_Timer_Link);
+    var_(deadline, u64);
+    var_(frame, Co_Ctx*);
+    var_(bucket, u16);
+    var_(state, Co_Timer_State);
+} Co_Timer;
+#define Co_Timer_init() ((Co_Timer){ .link = { .prev = null, .next = null }, .deadline = 0, .frame = null, .bucket = 0, .state = Co_Timer_State_idle })
+
+/// Still linked; its frame has not been queued yet
+$extern fn_((Co_Timer_isPending(const Co_Timer* self))(bool));
+/// Its frame was queued because the deadline passed
+$extern fn_((Co_Timer_isExpired(const Co_Timer* self))(bool));
+
+typedef struct Co_Exec {
+    var_(gpa, mem_Allocator);
+    var_(origin, time_Instant);
+    var_(tick_ns, u64);
+    /// Wheel clock in ticks since `origin`
+    var_(now, u64);
+    /// Timers linked into the wheel or the due list
+    var_(pending, usize);
+    var_(occupied, A$$(Co_Exec_wheel_levels, u64));
+    var_(buckets, A$$(Co_Exec_wheel_levels * Co_Exec_wheel_slots, Co_Timer_Link));
+    /// Timers with no deadline, released only by `Co_Exec_wake` or `Co_Exec_cancel`
+    var_(parked, Co_Timer_Link);
+    /// Timers whose frames are queued on the next `Co_Exec_drain`
+    var_(due, Co_Timer_Link);
+    var_(due_len, usize);
+    /// Ring of frames to resume; `ready_cap` is zero or a power of two
+    var_(ready, Co_Ctx**);
+    var_(ready_head, usize);
+    var_(ready_len, usize);
+    var_(ready_cap, usize);
+} Co_Exec;
+
+/* --- Construction/Destruction --- */
+
+/// `tick` is the wheel resolution; deadlines round up to whole ticks.
+/// Slot lists are circular through heads inside the executor, so it is set up in place and must not move.
+$extern fn_((Co_Exec_init(Co_Exec* self, mem_Allocator gpa, time_Duration tick))(void));
+$extern fn_((Co_Exec_fini(Co_Exec* self))(void));
+
+/* --- Clock --- */
+
+/// Wheel clock as an instant
+$extern fn_((Co_Exec_now(const Co_Exec* self))(time_Instant));
+/// Time until the wheel has work: zero with frames ready, none when no pending timer has a deadline
+$extern fn_((Co_Exec_untilNext(const Co_Exec* self))(O$time_Duration));
+$extern fn_((Co_Exec_isIdle(const Co_Exec* self))(bool));
+$extern fn_((Co_Exec_readyLen(const Co_Exec* self))(usize));
+$extern fn_((Co_Exec_pendingLen(const Co_Exec* self))(usize));
+
+/* --- Timers --- */
+
+/// Queues `frame` once `after` has passed on the wheel clock; re-arms a pending timer
+$extern fn_((Co_Exec_arm(Co_Exec* self, Co_Timer* timer, Co_Ctx* frame, time_Duration after))(void));
+$extern fn_((Co_Exec_armAt(Co_Exec* self, Co_Timer* timer, Co_Ctx* frame, time_Instant deadline))(void));
+/// Makes `timer` pending with no deadline, for waits that another event source ends with `Co_Exec_wake`
+$extern fn_((Co_Exec_park(Co_Exec* self, Co_Timer* timer, Co_Ctx* frame))(void));
+/// Unlinks a pending timer without queueing its frame; false if it was not pending
+$extern fn_((Co_Exec_cancel(Co_Exec* self, Co_Timer* timer))(bool));
+/// Queues the frame of a pending timer now, marking it notified; false if it was not pending
+$extern fn_((Co_Exec_wake(Co_Exec* self, Co_Timer* timer))(bool));
+
+/* --- Scheduling --- */
+
+/// Queues `frame` to be resumed on the next poll
+$attr($must_check)
+$extern fn_((Co_Exec_spawn(Co_Exec* self, Co_Ctx* frame))(mem_Err$void));
+/// Moves the wheel clock forward to `until`, expiring every timer due by then.
+/// Expired frames are queued by the next `Co_Exec_drain`; the clock never moves back.
+$extern fn_((Co_Exec_advanceTo(Co_Exec* self, time_Instant until))(void));
+/// Queues the frames of expired and woken timers
+$attr($must_check)
+$extern fn_((Co_Exec_drain(Co_Exec* self))(mem_Err$void));
+/// Resumes the frames queued so far, skipping finished ones; frames they queue wait for the next call
+$extern fn_((Co_Exec_runReady(Co_Exec* self))(usize));
+/// One loop iteration: advance to the current time, drain, then run the ready frames
+$attr($must_check)
+$extern fn_((Co_Exec_poll(Co_Exec* self))(mem_Err$void));
+/// Polls until nothing is ready or due, sleeping the thread until the next deadline.
+/// Parked timers alone do not keep it running, since nothing here could wake them.
+$attr($must_check)
+$extern fn_((Co_Exec_run(Co_Exec* self))(mem_Err$void));
+
+/* --- Coroutine Primitives --- */
+
+/// Suspends the calling coroutine for `_dur` on `_exec`; a zero duration yields to the other ready frames.
+/// `_timer` must outlive the wait (keep it in the locals), and the calling frame must be
+/// the one the executor resumes, since the timer queues `ctx` itself.
+#define Co_sleep(_exec, _timer, _dur...) \
+    do { \
+        Co_Exec_arm(_exec, _timer, ctx->anyraw, _dur); \
+        while (Co_Timer_isPending(_timer)) { suspend_(); } \
+    } while (false)
+
+/// Suspends the calling coroutine until `_cond` holds or `_dur` passes.
+/// The side that makes `_cond` true calls `Co_Exec_wake(_exec, _timer)`;
+/// afterwards `Co_Timer_isExpired(_timer)` tells a timeout from a wakeup.
+/// A timer still pending from an earlier wait is cancelled first.
+#define Co_timeout(_exec, _timer, _dur, _cond...) \
+    do { \
+        let_ignore = Co_Exec_cancel(_exec, _timer); \
+        (_timer)->state = Co_Timer_State_idle; \
+        if (_cond) { break; } \
+        Co_Exec_arm(_exec, _timer, ctx->anyraw, _dur); \
+        while (!(_cond) && Co_Timer_isPending(_timer)) { suspend_(); } \
+        let_ignore = Co_Exec_cancel(_exec, _timer); \
+    } while (false)
+
+#if defined(__cplusplus)
+} /* extern "C" */
+#endif /* defined(__cplusplus) */
+#endif /* async_Exec__included */
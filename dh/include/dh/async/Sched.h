@@ -0,0 +1,203 @@
+/**
+ * @copyright Copyright (c) 2026 Gyeongtae Kim
+ * @license   MIT License - see LICENSE file for details
+ *
+ * @file    Sched.h
+ * @author  Gyeongtae Kim (dev-dasae) <codingpelican@gmail.com>
+ * @date    2026-10-17 (date of creation)
+ * @updated 2026-10-17 (date of last update)
+ * @ingroup dasae-headers(dh)/async
+ * @prefix  Co_Sched
+ *
+ * @brief   Work-stealing M:N scheduler for stackless coroutines
+ * @details Resumes `Co_Ctx` frames on a fixed set of worker threads, laid out like `Thrd_Pool`
+ *          (both share the deque and parking code in `src/Thrd_internal_steal.h`):
+ *          - Each worker owns a Chase-Lev deque of `Co_Task`s; it pushes and pops at the
+ *            bottom, and idle workers steal from the top of a randomly chosen victim.
+ *          - Tasks woken from outside the pool (or past a full deque) go to an unbounded,
+ *            intrusive injector list, and so do tasks woken while running (yields):
+ *            they line up behind every queued task instead of popping straight back.
+ *          - Idle workers spin briefly, then park on a `Thrd_Ftx` until a task is queued.
+ *
+ *          A `Co_Task` is queued at most once at a time: `Co_Task_wake` on a running task
+ *          only marks it, and the worker requeues it after the frame suspends, so wakeups
+ *          racing a suspension are never lost and a frame never runs on two threads.
+ *
+ *          `Co_Mailbox` is a lock-free multi-producer, single-consumer queue of intrusive
+ *          nodes (Vyukov) whose sends wake the receiving task.
+ */
+#ifndef async_Sched__included
+#define async_Sched__included 1
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/*========== Includes =======================================================*/
+
+#include "dh/async.h"
+#include "dh/mem/Allocator.h"
+#include "dh/Thrd/common.h"
+#include "dh/Thrd/Ftx.h"
+#include "dh/Thrd/Mtx.h"
+
+/*========== Macros and Declarations ========================================*/
+
+#define Co_Sched_Cfg_default_deque_cap (4096u)
+#define Co_Sched_Cfg_default_stack_size (256ull * 1024ull)
+/// Busy-wait rounds an idle worker performs before parking.
+#define Co_Sched_spin_rounds (64u)
+
+typedef struct Co_Sched Co_Sched;
+typedef struct Co_Task Co_Task;
+
+typedef enum Co_Task_State {
+    /// Zeroed and not spawned yet; wakes are dropped, since the first resume sees whatever was sent
+    Co_Task_State_unspawned = 0,
+    /// Suspended and not queued; `Co_Task_wake` queues it
+    Co_Task_State_idle,
+    /// Queued on a deque or the injector
+    Co_Task_State_scheduled,
+    /// Being resumed by a worker
+    Co_Task_State_running,
+    /// Woken while running; requeued once the frame suspends
+    Co_Task_State_notified,
+    /// The frame returned
+    Co_Task_State_done,
+} Co_Task_State;
+
+/// Scheduling handle for one frame; must stay at one address until the task is done.
+/// Zero it before handing it out as a mailbox owner ahead of `Co_Sched_spawn`.
+struct Co_Task {
+    var_(frame, Co_Ctx*);
+    var_(sched, Co_Sched*);
+    /// A `Co_Task_State`
+    var_(state, atom_V$u32);
+    /// Injector link
+    var_(next, Co_Task*);
+};
+
+/// Queued unless already queued or done; a running task is requeued after it suspends.
+/// Callable from any thread.
+$extern fn_((Co_Task_wake(Co_Task* self))(void));
+$extern fn_((Co_Task_isDone(const Co_Task* self))(bool));
+
+/// Per-worker state; `top`/`bottom` index the Chase-Lev ring `tasks`.
+typedef struct Co_Sched_Worker {
+    var_(_avoid_false_sharing, Void) $align(arch_cache_line_bytes);
+    /// Advanced by thieves (CAS) and by the owner when taking the last task.
+    var_(top, atom_V$isize);
+    /// Written only by the owner.
+    var_(bottom, atom_V$isize);
+    var_(tasks, Co_Task**);
+    var_(cap, usize);
+    var_(sched, Co_Sched*);
+    var_(thrd, Thrd);
+    /// Xorshift state for victim selection.
+    var_(rng, u64);
+    /// Frames resumed by this worker
+    var_(resumed, u64);
+    var_(idx, u32);
+} Co_Sched_Worker;
+T_use$((Co_Sched_Worker)(S));
+
+typedef struct Co_Sched_Cfg {
+    /// Number of workers (0 selects `Thrd_cpuCount()`).
+    var_(thrd_count, u32);
+    /// Per-worker deque capacity, rounded up to a power of two.
+    var_(deque_cap, u32);
+    var_(stack_size, usize);
+} Co_Sched_Cfg;
+static const Co_Sched_Cfg Co_Sched_Cfg_default = {
+    .thrd_count = 0,
+    .deque_cap = Co_Sched_Cfg_default_deque_cap,
+    .stack_size = Co_Sched_Cfg_default_stack_size,
+};
+
+struct Co_Sched {
+    var_(gpa, mem_Allocator);
+    var_(workers, S$Co_Sched_Worker);
+    /// FIFO of tasks queued from outside the pool, past a full deque, or woken while running.
+    struct {
+        var_(mtx, Thrd_Mtx);
+        var_(head, Co_Task*);
+        var_(tail, Co_Task*);
+        /// Mirror of the list length readable without the lock.
+        var_(queued, atom_V$usize);
+    } injector;
+    /// Spawned tasks that are not done yet; `Co_Sched_wait` parks on it.
+    var_(live, atom_V$u32);
+    /// Number of workers currently parked (or about to park).
+    var_(sleepers, atom_V$u32);
+    /// Bumped on every wake-up so parked workers notice new work.
+    var_(wake_seq, atom_V$u32);
+    var_(is_shutdown, atom_V$u32);
+};
+
+/* --- Construction/Destruction --- */
+
+/// Starts the workers. `self` must stay at a fixed address until `Co_Sched_fini`.
+/// `gpa` backs the deques and worker contexts only; it is not used on the task path.
+$attr($must_check)
+$extern fn_((Co_Sched_init(Co_Sched* self, mem_Allocator gpa, Co_Sched_Cfg cfg))(E$void));
+/// Waits for every spawned task, then joins and frees the workers.
+$extern fn_((Co_Sched_fini(Co_Sched* self))(void));
+$extern fn_((Co_Sched_thrdCount(const Co_Sched* self))(usize));
+
+/* --- Scheduling --- */
+
+/// Queues `frame` as `task`; both must stay valid until the task is done.
+$extern fn_((Co_Sched_spawn(Co_Sched* self, Co_Task* task, Co_Ctx* frame))(void));
+/// Blocks until every spawned task is done. Tasks left idle with nobody to wake them keep it waiting.
+$extern fn_((Co_Sched_wait(Co_Sched* self))(void));
+/// Task being resumed on the calling thread, or null outside a worker.
+$extern fn_((Co_Sched_currentTask(void))(Co_Task*));
+
+/* --- Co_Mailbox: Lock-free MPSC queue --- */
+
+/// Embed as the first field of a message; `next` is owned by the mailbox while queued.
+typedef struct Co_Mailbox_Node Co_Mailbox_Node;
+struct Co_Mailbox_Node {
+    var_(next, Co_Mailbox_Node*);
+};
+T_use$((Co_Mailbox_Node)(P));
+T_use$((P$Co_Mailbox_Node)(O));
+
+typedef struct Co_Mailbox {
+    var_(_avoid_false_sharing_send, Void) $align(arch_cache_line_bytes);
+    /// Last node pushed; swapped by every sender.
+    var_(in, Co_Mailbox_Node*);
+    var_(_avoid_false_sharing_recv, Void) $align(arch_cache_line_bytes);
+    /// Oldest node, touched only by the receiver.
+    var_(out, Co_Mailbox_Node*);
+    /// Placeholder that keeps the list non-empty
+    var_(stub, Co_Mailbox_Node);
+    /// Woken on every send; null for a mailbox polled by hand
+    var_(owner, Co_Task*);
+} Co_Mailbox;
+
+/// Links through `stub`, so the mailbox is set up in place and must not move.
+$extern fn_((Co_Mailbox_init(Co_Mailbox* self, Co_Task* owner))(void));
+/// Enqueues `node` and wakes the owner. Callable from any thread.
+$extern fn_((Co_Mailbox_send(Co_Mailbox* self, Co_Mailbox_Node* node))(void));
+/// Dequeues the oldest node. Receiver only; none while a concurrent send is half done,
+/// which is fine for the owner since that send still wakes it.
+$extern fn_((Co_Mailbox_tryRecv(Co_Mailbox* self))(O$P$Co_Mailbox_Node));
+
+/* --- Coroutine Primitives --- */
+
+/// Lets the other queued tasks run before the calling frame continues. Only inside a task.
+#define Co_Sched_yield() \
+    do { \
+        Co_Task_wake(Co_Sched_currentTask()); \
+        suspend_(); \
+    } while (false)
+
+/// Suspends the calling task until `_mailbox` yields a node, stored into `_p_node`
+/// (keep it in the locals). The calling task must be the mailbox owner.
+#define Co_Mailbox_recv(_mailbox, _p_node...) \
+    while (((_p_node) = orelse_((Co_Mailbox_tryRecv(_mailbox))(null))) == null) { suspend_(); }
+
+#if defined(__cplusplus)
+} /* extern "C" */
+#endif /* defined(__cplusplus) */
+#endif /* async_Sched__included */
@@ -127,10 +127,12 @@ extern "C" {
  *   - SSSE3:         <tmmintrin.h>
  *   - SSE4.1/4.2:    <smmintrin.h> / <nmmintrin.h>
  *   - AVX/AVX2/AVX512/FMA: <immintrin.h> (unified header)
+ *   - AES-NI:        <wmmintrin.h>
  *
  * ARM:
  *   - NEON:          <arm_neon.h>
  *   - SVE:           <arm_sve.h>
+ *   - AES/CRC32:     <arm_neon.h> / <arm_acle.h>
  *
  * RISC-V:
  *   - RVV:           <riscv_vector.h>
@@ -152,6 +154,9 @@ extern "C" {
 #define arch_has_sve __comp_bool__arch_has_sve
 /* --- RISC-V Vector Extension --- */
 #define arch_has_rvv __comp_bool__arch_has_rvv
+/* --- Crypto/Checksum Extensions (x86 AES-NI/SSE4.2, ARMv8 Crypto/CRC) --- */
+#define arch_has_aes __comp_bool__arch_has_aes
+#define arch_has_crc32 __comp_bool__arch_has_crc32
 
 /* --- SIMD Availability Summary --- */
 
@@ -383,6 +388,8 @@ extern "C" {
 #define __comp_bool__arch_has_neon 0
 #define __comp_bool__arch_has_sve 0
 #define __comp_bool__arch_has_rvv 0
+#define __comp_bool__arch_has_aes 0
+#define __comp_bool__arch_has_crc32 0
 
 /* --- x86/x86_64 SIMD Detection --- */
 
@@ -448,6 +455,18 @@ extern "C" {
 #define __comp_bool__arch_has_fma 1
 #endif /* defined(__FMA__) */
 
+/* AES-NI */
+#if defined(__AES__)
+#undef __comp_bool__arch_has_aes
+#define __comp_bool__arch_has_aes 1
+#endif /* defined(__AES__) */
+
+/* CRC32C (part of SSE4.2) */
+#if defined(__SSE4_2__)
+#undef __comp_bool__arch_has_crc32
+#define __comp_bool__arch_has_crc32 1
+#endif /* defined(__SSE4_2__) */
+
 #endif /* arch_is_x86_family */
 
 /* --- ARM SIMD Detection --- */
@@ -466,6 +485,18 @@ extern "C" {
 #define __comp_bool__arch_has_sve 1
 #endif /* defined(__ARM_FEATURE_SVE) */
 
+/* AES (ARMv8 Cryptography Extension) */
+#if defined(__ARM_FEATURE_AES) || defined(__ARM_FEATURE_CRYPTO)
+#undef __comp_bool__arch_has_aes
+#define __comp_bool__arch_has_aes 1
+#endif /* defined(__ARM_FEATURE_AES) || defined(__ARM_FEATURE_CRYPTO) */
+
+/* CRC32/CRC32C (ARMv8 CRC Extension) */
+#if defined(__ARM_FEATURE_CRC32)
+#undef __comp_bool__arch_has_crc32
+#define __comp_bool__arch_has_crc32 1
+#endif /* defined(__ARM_FEATURE_CRC32) */
+
 #endif /* arch_is_arm_family */
 
 /* --- RISC-V Vector Extension Detection --- */
@@ -245,6 +245,56 @@ $extern fn_((fmt_format(io_Writer writer, S_const$u8 fmt, ...))(E$void)) $must_c
 /// Format values using va_list (for wrapper functions)
 $extern fn_((fmt_formatVaArgs(io_Writer writer, S_const$u8 fmt, va_list va_args))(E$void)) $must_check;
 
+/* --- Compiled Formats --- */
+
+/// `fmt_Compiled.arg_tags` entry for an index no spec reads; its argument is skipped
+#define fmt_Compiled_arg_unused (0xFFu)
+
+/// One `{...}` of a compiled format, with the literal text before it
+typedef struct fmt_CompiledSpec {
+    var_(spec, fmt_Spec);
+    var_(arg_index, u8);
+    /// Literal text contains `{{` or `}}` to collapse while writing
+    var_(literal_escaped, bool);
+    var_(literal, S_const$u8);
+} fmt_CompiledSpec;
+/// Format string parsed once: specs in order, literal runs between them and
+/// the argument types to read from `va_list`
+typedef struct fmt_Compiled {
+    var_(specs, A$$(fmt_max_args, fmt_CompiledSpec));
+    var_(spec_count, u8);
+    /// Arguments to read, one past the highest index referenced
+    var_(arg_count, u8);
+    /// Collection tag per argument, or `fmt_Compiled_arg_unused`
+    var_(arg_tags, A$$(fmt_max_args, u8));
+    var_(arg_wrappers, A$$(fmt_max_args, O$fmt_TypePrefix));
+    var_(trailing_escaped, bool);
+    var_(trailing, S_const$u8);
+} fmt_Compiled;
+T_use_E$(fmt_Compiled);
+/// Per-call-site cache for `fmt_formatCached`; zero-initialize with static storage
+typedef struct fmt_CompiledSite {
+    /// 0 until compiled, 1 while one thread stores it, then `fmt_CompiledSite_ready`
+    var_(state, u32);
+    /// Format string `compiled` was parsed from; other strings at the site are not cached
+    var_(fmt, S_const$u8);
+    var_(compiled, fmt_Compiled);
+} fmt_CompiledSite;
+
+/// Parse `fmt` once; the returned literal runs point into `fmt`, which must outlive them
+$extern fn_((fmt_compile(S_const$u8 fmt))(E$fmt_Compiled)) $must_check;
+/// Format values with a compiled format string
+$extern fn_((fmt_formatCompiled(io_Writer writer, const fmt_Compiled* compiled, ...))(E$void)) $must_check;
+/// Format values with a compiled format string using va_list (for wrapper functions)
+$extern fn_((fmt_formatCompiledVaArgs(io_Writer writer, const fmt_Compiled* compiled, va_list va_args))(E$void)) $must_check;
+/// Format with `fmt` compiled on first use and cached in `site`; `fmt` must have static storage.
+/// The cache is keyed on the pointer and length of `fmt`, so a site reached with another
+/// format string parses that one on every call instead of reusing the first.
+$extern fn_((fmt_formatSite(io_Writer writer, fmt_CompiledSite* site, S_const$u8 fmt, ...))(E$void)) $must_check;
+$extern fn_((fmt_formatSiteVaArgs(io_Writer writer, fmt_CompiledSite* site, S_const$u8 fmt, va_list va_args))(E$void)) $must_check;
+/// `fmt_format` with the literal format string compiled once per call site
+#define fmt_formatCached(_writer, _fmt_w_args...) __op__fmt_formatCached(pp_uniqTok(site), _writer, _fmt_w_args)
+
 /* --- Direct Type Formatting APIs --- */
 
 /// Format a boolean val with spec
@@ -314,6 +364,16 @@ $extern fn_((fmt_parseFlt(S_const$u8 str))(E$f64)) $must_check;
 $extern fn_((fmt_parse$f64(S_const$u8 str))(E$f64)) $must_check;
 $extern fn_((fmt_parse$f32(S_const$u8 str))(E$f32)) $must_check;
 
+/*========== Macros and Definitions =========================================*/
+
+/// `fmt_CompiledSite.state` once `compiled` may be read without synchronization
+#define fmt_CompiledSite_ready (2u)
+
+#define __op__fmt_formatCached(__site, _writer, _fmt_w_args...) ({ \
+    $static fmt_CompiledSite __site = {}; \
+    fmt_formatSite(_writer, &__site, _fmt_w_args); \
+})
+
 #if defined(__cplusplus)
 } /* extern "C" */
 #endif /* defined(__cplusplus) */
@@ -5,7 +5,7 @@
  * @file    File.h
  * @author  Gyeongtae Kim (dev-dasae) <codingpelican@gmail.com>
  * @date    2025-06-21 (date of creation)
- * @updated 2025-06-21 (date of last update)
+ * @updated 2025-12-28 (date of last update)
  * @version v0.1-alpha
  * @ingroup dasae-headers(dh)/fs
  * @prefix  fs_File
@@ -21,6 +21,7 @@ extern "C" {
 #include "dh/fs/common.h"
 #include "dh/io/Reader.h"
 #include "dh/io/Writer.h"
+#include "dh/io/Fixed.h"
 
 /*========== Macros and Declarations ========================================*/
 
@@ -91,9 +92,112 @@ $attr($inline_always)
 $static fn_((fs_File_handle(fs_File self))(fs_File_Handle)) { return self.handle; };
 
 $extern fn_((fs_File_close(fs_File self))(void));
+/// Reader over the file cursor
 $extern fn_((fs_File_reader(fs_File self))(io_Reader));
+/// Unbuffered writer at the file cursor; provides `writeVec` through `fs_File_writev`
 $extern fn_((fs_File_writer(fs_File self))(io_Writer));
 
+/* --- Positional and Vectored I/O --- */
+
+typedef enum_(fs_File_SeekFrom $bits(8)) {
+    fs_File_SeekFrom_start = 0,
+    fs_File_SeekFrom_current,
+    fs_File_SeekFrom_end,
+} fs_File_SeekFrom;
+
+/// Read at `offset` without using the file cursor, so threads can share one file.
+/// (On Windows the cursor still moves.) Returns 0 at end of file.
+$extern fn_((fs_File_pread(fs_File self, S$u8 buf, u64 offset))(E$usize)) $must_check;
+/// Write at `offset` without using the file cursor (on Windows the cursor still moves)
+$extern fn_((fs_File_pwrite(fs_File self, S_const$u8 bytes, u64 offset))(E$usize)) $must_check;
+/// Scatter read into `bufs` in order with one syscall; may stop short
+$extern fn_((fs_File_readv(fs_File self, S_const$S$u8 bufs))(E$usize)) $must_check;
+/// Gather write of `segs` in order with one syscall; may stop short
+$extern fn_((fs_File_writev(fs_File self, S_const$S_const$u8 segs))(E$usize)) $must_check;
+/// Move the cursor; returns the new position from the start of the file
+$extern fn_((fs_File_seek(fs_File self, i64 offset, fs_File_SeekFrom from))(E$u64)) $must_check;
+$extern fn_((fs_File_getPos(fs_File self))(E$u64)) $must_check;
+/// Size of the file, which is the position just past its last byte
+$extern fn_((fs_File_getEndPos(fs_File self))(E$u64)) $must_check;
+
+/* --- Memory-Mapped Files --- */
+
+/// Access pattern hint for a mapping (`madvise` on POSIX; ignored where unsupported)
+typedef enum_(fs_File_MapAdvice $bits(8)) {
+    fs_File_MapAdvice_normal = 0,
+    fs_File_MapAdvice_sequential,
+    fs_File_MapAdvice_random,
+    fs_File_MapAdvice_will_need,
+    fs_File_MapAdvice_dont_need,
+} fs_File_MapAdvice;
+
+typedef struct fs_File_MapFlags {
+    /// `read_only` or `read_write`; the file must have been opened with at least that access
+    fs_File_OpenMode mode;
+    /// Copy-on-write: writes stay in this process and never reach the file
+    bool is_private;
+    /// Fault in the whole range up front instead of on first touch
+    bool populate;
+    fs_File_MapAdvice advice;
+    /// Byte offset into the file; need not be page aligned
+    usize offset;
+    /// Bytes to map; `0` maps from `offset` to the end of the file
+    usize len;
+} fs_File_MapFlags;
+static const fs_File_MapFlags fs_File_MapFlags_default = {
+    .mode = fs_File_OpenMode_read_only,
+    .is_private = false,
+    .populate = false,
+    .advice = fs_File_MapAdvice_normal,
+    .offset = 0,
+    .len = 0,
+};
+
+typedef struct fs_MappedFile {
+    /// The requested bytes of the file
+    S$u8 bytes;
+    /// Page-aligned span actually mapped (covers `bytes`)
+    S$u8 region;
+    fs_File file;
+#if plat_is_windows
+    HANDLE mapping;
+#endif /* plat_is_windows */
+    bool is_writable;
+} fs_MappedFile;
+T_use_E$(fs_MappedFile);
+
+/// Map part of `self` into memory. The mapping outlives `self` being closed, but a
+/// waiting `fs_MappedFile_sync` on Windows also flushes through `self`.
+/// An empty range yields an empty mapping.
+$extern fn_((fs_File_map(fs_File self, fs_File_MapFlags flags))(E$fs_MappedFile)) $must_check;
+$extern fn_((fs_MappedFile_unmap(fs_MappedFile* self))(void));
+$attr($inline_always)
+$static fn_((fs_MappedFile_bytes(fs_MappedFile self))(S_const$u8)) { return self.bytes.as_const; };
+$attr($inline_always)
+$static fn_((fs_MappedFile_bytesMut(fs_MappedFile self))(S$u8)) {
+    claim_assert_fmt(self.is_writable, "mapping is read-only");
+    return self.bytes;
+};
+/// Re-hint the access pattern of the whole mapping
+$extern fn_((fs_MappedFile_advise(fs_MappedFile self, fs_File_MapAdvice advice))(void));
+/// Write dirty pages back to the file; when `waits` is false the write-back is only scheduled
+$extern fn_((fs_MappedFile_sync(fs_MappedFile self, bool waits))(E$void)) $must_check;
+
+/// Reader over a mapping. `take`/`takeUntilByte` return views into the mapping
+/// without copying; `fs_MappedFile_reader` adapts it to `io_Reader` for existing consumers.
+typedef struct fs_MappedFile_Reader {
+    io_Fixed_Reader fixed;
+} fs_MappedFile_Reader;
+$extern fn_((fs_MappedFile_Reader_init(fs_MappedFile mapped))(fs_MappedFile_Reader));
+/// Bytes not consumed yet
+$extern fn_((fs_MappedFile_Reader_rest(fs_MappedFile_Reader self))(S_const$u8));
+/// Consume and return up to `n` bytes; empty at end of mapping
+$extern fn_((fs_MappedFile_Reader_take(fs_MappedFile_Reader* self, usize n))(S_const$u8));
+/// Consume through the next `delim` and return the bytes before it; the last
+/// unterminated piece is returned as is, then none at end of mapping
+$extern fn_((fs_MappedFile_Reader_takeUntilByte(fs_MappedFile_Reader* self, u8 delim))(O$S_const$u8));
+$extern fn_((fs_MappedFile_reader(fs_MappedFile_Reader* self))(io_Reader));
+
 $attr($inline_always)
 $static fn_((fs_File_Handle_promote(fs_File_Handle self))(fs_File)) { return lit$((fs_File){ .handle = self }); };
 
@@ -36,7 +36,9 @@ errset_((fs_File_Err)(
     AccessDenied,
     OpenFailed,
     ReadFailed,
-    WriteFailed
+    WriteFailed,
+    SeekFailed,
+    MapFailed
 ));
 
 #if defined(__cplusplus)
@@ -5,14 +5,22 @@
  * @file    Arena.h
  * @author  Gyeongtae Kim (dev-dasae) <codingpelican@gmail.com>
  * @date    2025-03-26 (date of creation)
- * @updated 2025-03-26 (date of last update)
- * @version v0.1-alpha.1
+ * @updated 2026-02-27 (date of last update)
+ * @version v0.1-alpha.2
  * @ingroup dasae-headers(dh)/heap
  * @prefix  heap_Arena
  *
  * @brief   Arena allocator that wraps another allocator for bulk freeing
  * @details Takes an existing allocator, wraps it, and provides an interface
  *          where you can allocate without freeing, and then free it all together.
+ *
+ *          Savepoints (`heap_Arena_save`/`heap_Arena_restore`) free everything allocated
+ *          after them, for nested temporary lifetimes. `heap_Arena_scratch` hands out
+ *          per-thread scratch arenas, skipping the ones a caller already uses.
+ *
+ *          `heap_Arena_Virt` reserves one contiguous virtual range up front and commits
+ *          pages as the bump pointer reaches them, so allocations never hop between
+ *          buffers and growing the last allocation never moves it.
  */
 #ifndef heap_Arena__included
 #define heap_Arena__included 1
@@ -42,6 +50,8 @@ struct heap_Arena {
     mem_Allocator child_allocator;
     heap_Arena_State state;
 };
+T_use$((heap_Arena)(P));
+T_use$((P$heap_Arena)(S));
 /// Get allocator interface for instance
 $extern fn_((heap_Arena_allocator(heap_Arena* self))(mem_Allocator));
 /// Initialize with child allocator
@@ -57,9 +67,57 @@ typedef variant_((heap_Arena_ResetMode $bits(8))(
 )) heap_Arena_ResetMode;
 /// Query current memory capacity of arena
 $extern fn_((heap_Arena_queryCap(const heap_Arena* self))(usize));
-/// Reset arena with specified mode
+/// Reset arena with specified mode; invalidates every savepoint
 $extern fn_((heap_Arena_reset(heap_Arena* self, heap_Arena_ResetMode mode))(bool));
 
+/// Position of the bump pointer, to return to later
+typedef struct heap_Arena_Savepoint {
+    O$P$ListSgl_Link$usize buf;
+    usize end_idx;
+} heap_Arena_Savepoint;
+/// Marks the current position; savepoints nest and must be restored innermost first
+$extern fn_((heap_Arena_save(const heap_Arena* self))(heap_Arena_Savepoint));
+/// Frees everything allocated after `savepoint`, including the buffers added since
+$extern fn_((heap_Arena_restore(heap_Arena* self, heap_Arena_Savepoint savepoint))(void));
+
+/// Scratch arenas per thread; a callee can always find one its caller is not using
+/// as long as fewer than this many are live in one call chain.
+#define heap_Arena_scratch_count (2)
+typedef struct heap_Arena_Scratch {
+    var_(arena, heap_Arena*);
+    var_(savepoint, heap_Arena_Savepoint);
+} heap_Arena_Scratch;
+/// Begins a temporary lifetime on a scratch arena of the calling thread that is
+/// not in `conflicts` (the arenas the caller allocates its results from).
+/// Backed by page memory; end it with `heap_Arena_Scratch_end`.
+$extern fn_((heap_Arena_scratch(S_const$P$heap_Arena conflicts))(heap_Arena_Scratch));
+/// Frees everything allocated on the scratch arena since it was handed out
+$extern fn_((heap_Arena_Scratch_end(heap_Arena_Scratch self))(void));
+/// Returns the memory of the calling thread's scratch arenas, e.g. before the thread exits
+$extern fn_((heap_Arena_scratchFini(void))(void));
+
+/// Arena over one reserved virtual range, committed on demand
+typedef struct heap_Arena_Virt {
+    /// Whole reservation; only `[0, committed)` is accessible
+    var_(reserved, S$u8);
+    var_(committed, usize);
+    var_(end_idx, usize);
+} heap_Arena_Virt;
+T_use_E$($set(mem_Err)(heap_Arena_Virt));
+/// Pages are committed in steps of this many bytes at least.
+#define heap_Arena_Virt_commit_granule (lit_n$(usize)(64) * 1024)
+/// Reserves `reserve_len` bytes of address space; nothing is committed yet.
+$attr($must_check)
+$extern fn_((heap_Arena_Virt_init(usize reserve_len))(mem_Err$heap_Arena_Virt));
+/// Releases the whole reservation
+$extern fn_((heap_Arena_Virt_fini(heap_Arena_Virt* self))(void));
+$extern fn_((heap_Arena_Virt_allocator(heap_Arena_Virt* self))(mem_Allocator));
+$extern fn_((heap_Arena_Virt_save(const heap_Arena_Virt* self))(usize));
+/// Frees everything allocated after `savepoint`; committed pages stay committed
+$extern fn_((heap_Arena_Virt_restore(heap_Arena_Virt* self, usize savepoint))(void));
+/// Frees everything and decommits the pages beyond `retain` bytes
+$extern fn_((heap_Arena_Virt_reset(heap_Arena_Virt* self, usize retain))(void));
+
 #if defined(__cplusplus)
 } /* extern "C" */
 #endif /* defined(__cplusplus) */
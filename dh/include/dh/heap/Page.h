@@ -5,14 +5,19 @@
  * @file    Page.h
  * @author  Gyeongtae Kim (dev-dasae) <codingpelican@gmail.com>
  * @date    2025-01-15 (date of creation)
- * @updated 2025-03-20 (date of last update)
- * @version v0.1-alpha.1
+ * @updated 2026-02-27 (date of last update)
+ * @version v0.1-alpha.2
  * @ingroup dasae-headers(dh)/heap
  * @prefix  heap_Page
  *
  * @brief   Page allocator using OS virtual memory APIs
  * @details Uses OS-level virtual memory APIs to allocate memory in page-sized blocks.
  *          Provides a simple interface for allocating and freeing memory.
+ *
+ *          On Linux, growth goes through `mremap`: in place for `resize`, and moving
+ *          the pages rather than copying them for `remap`. `heap_Page_Cfg` selects huge
+ *          pages, pre-faulting and how shrunk tails are given back. A zeroed `heap_Page`
+ *          uses the defaults.
  */
 #ifndef heap_Page__included
 #define heap_Page__included 1
@@ -26,10 +31,53 @@ extern "C" {
 
 /*========== Macros and Declarations ========================================*/
 
-/// Page allocator instance (minimal state)
+/// Size of a huge page on the targets that have them (x86-64 and aarch64 with 4 KiB base pages).
+#define heap_Page_huge_page_size (lit_n$(usize)(2) * 1024 * 1024)
+
+/// Huge page backing
+typedef enum heap_Page_Huge {
+    /// Base pages only
+    heap_Page_Huge_none = 0,
+    /// Advise transparent huge pages (`MADV_HUGEPAGE`); the kernel backs what it can
+    heap_Page_Huge_transparent = 1,
+    /// Map from the reserved huge page pool (`MAP_HUGETLB`), falling back to
+    /// transparent huge pages when the pool is empty
+    heap_Page_Huge_explicit = 2,
+} heap_Page_Huge;
+
+/// How the pages of a shrunk tail are given back
+typedef enum heap_Page_Shrink {
+    /// `MADV_DONTNEED`: released at once; touching them again reads zeroes
+    heap_Page_Shrink_dontneed = 0,
+    /// `MADV_FREE`: released lazily under memory pressure, cheaper when the buffer
+    /// is likely to grow back
+    heap_Page_Shrink_free = 1,
+} heap_Page_Shrink;
+
+typedef struct heap_Page_Cfg {
+    var_(huge, heap_Page_Huge);
+    /// Fault every page in at map time (`MAP_POPULATE`) instead of on first touch.
+    var_(populate, bool);
+    var_(shrink, heap_Page_Shrink);
+    /// Mapping granularity in bytes, rounded up to a multiple of the page size
+    /// (of `heap_Page_huge_page_size` with `heap_Page_Huge_explicit`);
+    /// 0 selects the page size, or `heap_Page_huge_page_size` with huge pages.
+    /// Shrinking unmaps whole granules and advises the rest per `shrink`.
+    var_(granule, usize);
+} heap_Page_Cfg;
+static const heap_Page_Cfg heap_Page_Cfg_default = {
+    .huge = heap_Page_Huge_none,
+    .populate = false,
+    .shrink = heap_Page_Shrink_dontneed,
+    .granule = 0,
+};
+
+/// Page allocator instance
 typedef struct heap_Page {
-    Void unused_[0];
+    var_(cfg, heap_Page_Cfg);
 } heap_Page;
+/// Page allocator with `cfg` instead of the defaults
+$extern fn_((heap_Page_fromCfg(heap_Page_Cfg cfg))(heap_Page));
 /// Get allocator interface for instance
 $extern fn_((heap_Page_allocator(heap_Page* self))(mem_Allocator));
 /// Get next virtual memory address hint
@@ -0,0 +1,219 @@
+/**
+ * @copyright Copyright (c) 2026 Gyeongtae Kim
+ * @license   MIT License - see LICENSE file for details
+ *
+ * @file    Pool.h
+ * @author  Gyeongtae Kim (dev-dasae) <codingpelican@gmail.com>
+ * @date    2026-02-27 (date of creation)
+ * @updated 2026-02-27 (date of last update)
+ * @version v0.1-alpha
+ * @ingroup dasae-headers(dh)/heap
+ * @prefix  heap_Pool
+ *
+ * @brief   Object pool: fixed-size slots of one type with O(1) create/destroy
+ * @details Slots live in chunks taken from a child allocator; chunk `k` holds
+ *          `first_chunk_len << k` slots, so the chunk table never moves and a slot
+ *          index maps to its chunk with one bit scan. Freed slots form an intrusive
+ *          free list (the next index is stored in the slot itself), and chunks are
+ *          only returned to the child allocator by `heap_Pool_fini`.
+ *
+ *          Every slot carries a generation that is bumped by both create and destroy,
+ *          so a `heap_Pool_Hdl` (index + generation) taken before a destroy no longer
+ *          resolves afterwards, even once the slot is reused.
+ *
+ *          `heap_Pool_allocator` adapts a pool to `mem_Allocator` for requests that fit
+ *          one slot, e.g. the nodes of `ListSgl`/`ListDbl`.
+ *
+ *          Typed wrappers returning pointers need `T_use_P$(T)`, `T_use_O$(P$T)` and
+ *          `T_use_E$($set(mem_Err)(P$T))` for the element type `T`.
+ */
+#ifndef heap_Pool__included
+#define heap_Pool__included 1
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/*========== Includes =======================================================*/
+
+#include "cfg.h"
+#include "dh/Thrd/Mtx.h"
+
+/*========== Macros and Declarations ========================================*/
+
+/// Chunks a pool can grow to; chunk sizes double, so this bounds the slot count only by `u32`.
+#define heap_Pool_max_chunks (32u)
+/// Slot index that terminates the free list and marks an invalid handle.
+#define heap_Pool_nil_idx u32_limit_max
+#define heap_Pool_Cfg_default_first_chunk_len (64u)
+
+typedef struct heap_Pool_Cfg {
+    /// Slots of the first chunk, rounded up to a power of two.
+    var_(first_chunk_len, u32);
+    /// Serializes create/destroy and growth with a mutex, so threads can share the pool.
+    /// Handle lookups take no lock either way.
+    var_(is_thrd_safe, bool);
+} heap_Pool_Cfg;
+static const heap_Pool_Cfg heap_Pool_Cfg_default = {
+    .first_chunk_len = heap_Pool_Cfg_default_first_chunk_len,
+    .is_thrd_safe = false,
+};
+
+/// Generation-checked reference to a pool slot.
+typedef struct heap_Pool_Hdl {
+    var_(idx, u32);
+    /// Odd while the slot is live; a handle only resolves while it matches the slot's.
+    var_(gen, u32);
+} heap_Pool_Hdl;
+T_use$((heap_Pool_Hdl)(O, E));
+T_use_E$($set(mem_Err)(heap_Pool_Hdl));
+static const heap_Pool_Hdl heap_Pool_Hdl_nil = { .idx = heap_Pool_nil_idx, .gen = 0 };
+
+#define heap_Pool$$(_T...) __comp_anon__heap_Pool$$(_T)
+#define heap_Pool$(_T...) __comp_alias__heap_Pool$(_T)
+#define T_decl_heap_Pool$(_T...) __comp_gen__T_decl_heap_Pool$(_T)
+#define T_impl_heap_Pool$(_T...) __comp_gen__T_impl_heap_Pool$(_T)
+#define T_use_heap_Pool$(_T...) __comp_gen__T_use_heap_Pool$(_T)
+
+typedef struct heap_Pool {
+    var_(child_allocator, mem_Allocator);
+    /// Chunk `k` holds `first_chunk_len << k` slots; the first `chunk_count` are allocated.
+    var_(chunks, A$$(heap_Pool_max_chunks, P$u8));
+    var_(chunk_count, u32);
+    var_(first_chunk_log2, u32);
+    /// Head of the intrusive free list, or `heap_Pool_nil_idx`.
+    var_(free_head, u32);
+    /// Slots at and after this index have never been handed out.
+    var_(bump_idx, u32);
+    var_(cap, u32);
+    /// Live slots.
+    var_(len, u32);
+    /// Bytes from one slot to the next: header, then the element.
+    var_(stride, usize);
+    var_(elem_offset, usize);
+    var_(elem_ty, TypeInfo);
+    var_(is_thrd_safe, bool);
+    var_(mtx, Thrd_Mtx);
+} heap_Pool;
+T_use$((heap_Pool)(O, E));
+
+/// Allocates nothing until the first create.
+$extern fn_((heap_Pool_init(TypeInfo elem_ty, mem_Allocator child_allocator, heap_Pool_Cfg cfg))(heap_Pool));
+/// Returns every chunk to the child allocator; live objects are dropped.
+$extern fn_((heap_Pool_fini(heap_Pool* self, TypeInfo elem_ty))(void));
+$extern fn_((heap_Pool_len(const heap_Pool* self))(usize));
+$extern fn_((heap_Pool_cap(const heap_Pool* self))(usize));
+
+/// Pops the free list, or takes the next never-used slot, adding a chunk when full.
+$attr($must_check)
+$extern fn_((heap_Pool_create(heap_Pool* self, TypeInfo elem_ty))(mem_Err$u_P$raw));
+/// `obj` must come from `self` and still be live.
+$extern fn_((heap_Pool_destroy(heap_Pool* self, u_P$raw obj))(void));
+
+$attr($must_check)
+$extern fn_((heap_Pool_createHdl(heap_Pool* self, TypeInfo elem_ty))(mem_Err$heap_Pool_Hdl));
+/// Returns false, and does nothing, for a stale or nil handle.
+$extern fn_((heap_Pool_destroyHdl(heap_Pool* self, heap_Pool_Hdl hdl))(bool));
+$extern fn_((heap_Pool_isLive(const heap_Pool* self, heap_Pool_Hdl hdl))(bool));
+/// None for a stale or nil handle.
+$extern fn_((heap_Pool_at(const heap_Pool* self, TypeInfo elem_ty, heap_Pool_Hdl hdl))(O$u_P$raw));
+/// Handle of a live object of `self`.
+$extern fn_((heap_Pool_hdlOf(const heap_Pool* self, u_P_const$raw obj))(heap_Pool_Hdl));
+
+/// Serves requests that fit one slot (length and alignment); larger ones fail.
+/// Resizing within the slot succeeds in place.
+$extern fn_((heap_Pool_allocator(heap_Pool* self))(mem_Allocator));
+
+/*========== Macros and Definitions =========================================*/
+
+#define __comp_anon__heap_Pool$$(_T...) \
+    union { \
+        struct { \
+            var_(child_allocator, mem_Allocator); \
+            var_(chunks, A$$(heap_Pool_max_chunks, P$u8)); \
+            var_(chunk_count, u32); \
+            var_(first_chunk_log2, u32); \
+            var_(free_head, u32); \
+            var_(bump_idx, u32); \
+            var_(cap, u32); \
+            var_(len, u32); \
+            var_(stride, usize); \
+            var_(elem_offset, usize); \
+            var_(elem_ty, TypeInfo); \
+            var_(is_thrd_safe, bool); \
+            var_(mtx, Thrd_Mtx); \
+        }; \
+        var_(as_raw, heap_Pool) $like_ref; \
+    }
+#define __comp_alias__heap_Pool$(_T...) pp_join($, heap_Pool, _T)
+#define __comp_gen__T_decl_heap_Pool$(_T...) \
+    $maybe_unused typedef union heap_Pool$(_T) heap_Pool$(_T)
+#define __comp_gen__T_impl_heap_Pool$(_T...) \
+    union heap_Pool$(_T) { \
+        struct { \
+            var_(child_allocator, mem_Allocator); \
+            var_(chunks, A$$(heap_Pool_max_chunks, P$u8)); \
+            var_(chunk_count, u32); \
+            var_(first_chunk_log2, u32); \
+            var_(free_head, u32); \
+            var_(bump_idx, u32); \
+            var_(cap, u32); \
+            var_(len, u32); \
+            var_(stride, usize); \
+            var_(elem_offset, usize); \
+            var_(elem_ty, TypeInfo); \
+            var_(is_thrd_safe, bool); \
+            var_(mtx, Thrd_Mtx); \
+        }; \
+        var_(as_raw, heap_Pool) $like_ref; \
+    }
+#define __comp_gen__T_use_heap_Pool$(_T...) \
+    T_decl_heap_Pool$(_T); \
+    T_impl_heap_Pool$(_T)
+
+/* clang-format off */
+#define T_use_heap_Pool_init$(_T...) \
+    $attr($inline_always) \
+    $static fn_((tpl_id(heap_Pool_init, _T)(mem_Allocator child_allocator, heap_Pool_Cfg cfg))(heap_Pool$(_T))) { \
+        return type$((heap_Pool$(_T))(heap_Pool_init(typeInfo$(_T), child_allocator, cfg))); \
+    }
+#define T_use_heap_Pool_fini$(_T...) \
+    $attr($inline_always) \
+    $static fn_((tpl_id(heap_Pool_fini, _T)(P$$(heap_Pool$(_T)) self))(void)) { \
+        return heap_Pool_fini(self->as_raw, typeInfo$(_T)); \
+    }
+#define T_use_heap_Pool_create$(_T...) \
+    $attr($inline_always $must_check) \
+    $static fn_((tpl_id(heap_Pool_create, _T)(P$$(heap_Pool$(_T)) self))(E$($set(mem_Err)(P$(_T)))) $scope) { \
+        return_(u_castE$((ReturnType)(heap_Pool_create(self->as_raw, typeInfo$(_T))))); \
+    } $unscoped_(fn)
+#define T_use_heap_Pool_destroy$(_T...) \
+    $attr($inline_always) \
+    $static fn_((tpl_id(heap_Pool_destroy, _T)(P$$(heap_Pool$(_T)) self, P$(_T) obj))(void)) { \
+        return heap_Pool_destroy(self->as_raw, u_anyP(obj)); \
+    }
+#define T_use_heap_Pool_createHdl$(_T...) \
+    $attr($inline_always $must_check) \
+    $static fn_((tpl_id(heap_Pool_createHdl, _T)(P$$(heap_Pool$(_T)) self))(mem_Err$heap_Pool_Hdl)) { \
+        return heap_Pool_createHdl(self->as_raw, typeInfo$(_T)); \
+    }
+#define T_use_heap_Pool_destroyHdl$(_T...) \
+    $attr($inline_always) \
+    $static fn_((tpl_id(heap_Pool_destroyHdl, _T)(P$$(heap_Pool$(_T)) self, heap_Pool_Hdl hdl))(bool)) { \
+        return heap_Pool_destroyHdl(self->as_raw, hdl); \
+    }
+#define T_use_heap_Pool_at$(_T...) \
+    $attr($inline_always) \
+    $static fn_((tpl_id(heap_Pool_at, _T)(P_const$$(heap_Pool$(_T)) self, heap_Pool_Hdl hdl))(O$(P$(_T)))) { \
+        return u_castO$((O$(P$(_T)))(heap_Pool_at(self->as_raw, typeInfo$(_T), hdl))); \
+    }
+#define T_use_heap_Pool_hdlOf$(_T...) \
+    $attr($inline_always) \
+    $static fn_((tpl_id(heap_Pool_hdlOf, _T)(P_const$$(heap_Pool$(_T)) self, P_const$(_T) obj))(heap_Pool_Hdl)) { \
+        return heap_Pool_hdlOf(self->as_raw, u_anyP(obj)); \
+    }
+/* clang-format on */
+
+#if defined(__cplusplus)
+} /* extern "C" */
+#endif /* defined(__cplusplus) */
+#endif /* heap_Pool__included */
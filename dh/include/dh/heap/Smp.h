@@ -5,7 +5,7 @@
  * @file    Smp.h
  * @author  Gyeongtae Kim (dev-dasae) <codingpelican@gmail.com>
  * @date    2026-01-19 (date of creation)
- * @updated 2026-01-19 (date of last update)
+ * @updated 2026-02-27 (date of last update)
  * @ingroup dasae-headers(dh)/heap
  * @prefix  heap_Smp
  *
@@ -13,6 +13,20 @@
  * @details This allocator performs high-performance SMP (multi-threaded, cache-friendly)
  *          algorithms regardless of the memory source. It completely eliminates OS dependencies
  *          by accepting a parent allocator at initialization time.
+ *
+ *          Small requests are served from `heap_Smp_slab_len`-aligned slabs, each
+ *          dedicated to one size class and owned by one thread meta. A slab is carved
+ *          out of a backing block twice its size, so the backing allocator only needs
+ *          to guarantee its usual alignment. Slabs that become
+ *          empty are cached for `heap_Smp_Cfg.decay` and then returned to the backing
+ *          allocator, so the resident set shrinks after a burst instead of only growing.
+ *
+ *          Every allocating thread claims a thread meta of its own, so allocation and
+ *          frees of its own slots take no lock. A pointer freed by another thread is
+ *          pushed onto its slab's remote free list with a CAS, and the slab is queued
+ *          on the owner, which takes the slots back on its next slow-path allocation.
+ *          Metas are spilled from the backing allocator once the preallocated ones are
+ *          all owned, so there is no upper bound on the thread count.
  */
 #ifndef heap_Smp__included
 #define heap_Smp__included 1
@@ -23,32 +37,70 @@ extern "C" {
 /*========== Includes =======================================================*/
 
 #include "cfg.h"
-#include "dh/Thrd/Mtx.h"
+#include "dh/Thrd/cfg.h"
+#include "dh/time/Instant.h"
 
 /*========== Macros and Declarations ========================================*/
 
-#define heap_Smp_max_thrd_count \
-    128
 #define heap_Smp_slab_len \
     prim_max_static(heap_page_size, 64 * 1024)
 #define heap_Smp_min_size_class /* Because of storing free list pointers, the minimum size class is 3 */ \
     uint_log2_static(sizeOf$(usize))
-#define heap_Smp_size_class_count \
-    (uint_log2_static(heap_Smp_slab_len) - heap_Smp_min_size_class)
-#define heap_Smp_max_alloc_search /* Before mapping a fresh page, `alloc` will rotate this many times */ \
-    1
+#define heap_Smp_size_class_count /* Quarter-power classes up to half a slab; pow2 mode uses a subset */ \
+    (4 * (uint_log2_static(heap_Smp_slab_len) - heap_Smp_min_size_class - 2))
+#define heap_Smp_Cfg_default_decay_secs \
+    10
+
+/// Spacing of the size classes below half a slab.
+typedef enum heap_Smp_SizeClasses {
+    /// 8, 16, 32, ...: cheapest mapping, up to 2x internal fragmentation.
+    heap_Smp_SizeClasses_pow2 = 0,
+    /// 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, ...: four classes per power of two,
+    /// bounding internal fragmentation to 25%.
+    heap_Smp_SizeClasses_quarter = 1,
+} heap_Smp_SizeClasses;
+
+typedef struct heap_Smp_Cfg {
+    var_(size_classes, heap_Smp_SizeClasses);
+    /// How long an empty slab stays cached for reuse before it is returned to
+    /// the backing allocator. Zero returns it as soon as it empties.
+    var_(decay, time_Duration);
+} heap_Smp_Cfg;
+static const heap_Smp_Cfg heap_Smp_Cfg_default = {
+    .size_classes = heap_Smp_SizeClasses_pow2,
+    .decay = { .secs = heap_Smp_Cfg_default_decay_secs, .nanos = 0 },
+};
+
+/// Slab header, stored in the last cache line(s) of every slab.
+typedef struct heap_Smp_Slab heap_Smp_Slab;
+
+/// Per-class counters of one thread meta.
+typedef struct heap_Smp_ClassCounts {
+    var_(slab_count, usize);
+    var_(slot_count, usize);
+    var_(requested, usize);
+} heap_Smp_ClassCounts;
 
 typedef struct heap_Smp_ThrdMeta {
     var_(_avoid_false_sharing, Void) $align(arch_cache_line_bytes);
-    /// Protects the state in this struct (per-thread state).
-    /// Threads lock this before accessing their own state in order
-    /// to support freelist reclamation.
-    var_(mtx, Thrd_Mtx);
-    /// For each size class, tracks the next address to be returned from
-    /// `alloc` when the freelist is empty.
-    var_(next_addrs, A$$(heap_Smp_size_class_count, usize));
-    /// For each size class, points to the freed pointer.
-    var_(frees, A$$(heap_Smp_size_class_count, usize));
+    /// Token of the thread that owns this meta, or 0 while it is free to claim.
+    /// Only the owner touches the lists and counters below and the slabs it owns.
+    var_(owner, atom_V$usize);
+    /// Next meta spilled from the backing allocator (see `heap_Smp.spilled_metas`).
+    var_(next_spilled, struct heap_Smp_ThrdMeta*);
+    /// For each size class, the slabs with at least one free slot.
+    var_(partials, A$$(heap_Smp_size_class_count, heap_Smp_Slab*));
+    var_(counts, A$$(heap_Smp_size_class_count, heap_Smp_ClassCounts));
+    /// Empty slabs, most recently emptied first, waiting for reuse or decay.
+    var_(empties_head, heap_Smp_Slab*);
+    var_(empties_tail, heap_Smp_Slab*);
+    var_(empty_count, usize);
+    var_(_avoid_false_sharing_remote, Void) $align(arch_cache_line_bytes);
+    /// Slabs that received frees from other threads, as a lock-free stack pushed
+    /// by the freeing threads and taken whole by the owner.
+    var_(remote_slabs, atom_V$usize);
+    /// Decay or purge requested by another thread, served by the owner.
+    var_(purge_req, atom_V$u32);
 } heap_Smp_ThrdMeta;
 T_use_prl$(heap_Smp_ThrdMeta);
 
@@ -56,19 +108,77 @@ typedef struct heap_Smp {
     /// Parent allocator that provides backing memory
     /// Can be any allocator: PageAllocator, SbrkAllocator, FixedAllocator, etc.
     var_(backing_allocator, mem_Allocator);
-    /// Per-thread metadata array
+    /// Preallocated thread metas; each allocating thread claims one for itself.
     var_(thrd_metas, S$heap_Smp_ThrdMeta);
-    /// CPU count (cached for performance)
-    var_(cpu_count, u32);
+    /// Metas allocated from the backing allocator once every meta in `thrd_metas`
+    /// is owned, linked through `next_spilled` (a `heap_Smp_ThrdMeta*`).
+    var_(spilled_metas, atom_V$usize);
+    /// Keys this instance in the thread-local meta caches; never reused.
+    var_(id, usize);
+    var_(cfg, heap_Smp_Cfg);
+    /// Link in the instances visited by thread-exit hooks, joined when the first
+    /// thread claims a meta (the address of `self` is fixed from then on).
+    var_(live_next, struct heap_Smp*);
+    var_(is_live, atom_V$u32);
 } heap_Smp;
 T_use_P$(heap_Smp);
 T_use_E$($set(mem_Err)(P$heap_Smp));
 $extern let_(heap_Smp_vt, mem_Allocator_VT);
 $extern fn_((heap_Smp_allocator(heap_Smp* self))(mem_Allocator));
 $extern fn_((heap_Smp_from(mem_Allocator backing_allocator, S$heap_Smp_ThrdMeta thrd_metas))(heap_Smp));
+$extern fn_((heap_Smp_fromCfg(mem_Allocator backing_allocator, S$heap_Smp_ThrdMeta thrd_metas, heap_Smp_Cfg cfg))(heap_Smp));
 $attr($must_check)
 $extern fn_((heap_Smp_createOnHeap(mem_Allocator backing_allocator, usize thrd_meta_count))(mem_Err$P$heap_Smp));
+$attr($must_check)
+$extern fn_((heap_Smp_createOnHeapCfg(mem_Allocator backing_allocator, usize thrd_meta_count, heap_Smp_Cfg cfg))(mem_Err$P$heap_Smp));
+/// Calls `heap_Smp_fini` before freeing `self`.
 $extern fn_((heap_Smp_destroyOnHeap(P$heap_Smp* self))(void));
+/// Returns cached empty slabs and spilled thread metas to the backing allocator.
+/// Must not race with any other use of `self`, though threads may exit meanwhile.
+/// Slabs that still hold live allocations stay with the backing allocator.
+$extern fn_((heap_Smp_fini(heap_Smp* self))(void));
+/// Gives up the thread meta of the calling thread so another thread can claim it.
+/// A `Thrd_spawn` thread does this for every live instance when it exits; call it
+/// from other threads before they exit to keep their cached slabs reusable, or
+/// their metas are only reclaimed by a thread that reuses the same thread-local
+/// storage.
+$extern fn_((heap_Smp_detachThrd(heap_Smp* self))(void));
+
+/// Byte counts of one size class. Requests larger than half a slab go
+/// straight to the backing allocator and are not counted.
+typedef struct heap_Smp_ClassStats {
+    var_(slot_size, usize);
+    var_(slab_count, usize);
+    /// Bytes of slabs currently dedicated to this class.
+    var_(resident, usize);
+    /// Bytes of the slots handed out.
+    var_(active, usize);
+    /// Bytes the callers asked for.
+    var_(requested, usize);
+    /// `resident - requested`: slot rounding plus free slots in partial slabs.
+    var_(fragmented, usize);
+} heap_Smp_ClassStats;
+typedef struct heap_Smp_Stats {
+    var_(classes, A$$(heap_Smp_size_class_count, heap_Smp_ClassStats));
+    var_(resident, usize);
+    var_(active, usize);
+    var_(requested, usize);
+    var_(fragmented, usize);
+    /// Bytes of empty slabs kept for reuse (not included in `resident`).
+    var_(cached, usize);
+} heap_Smp_Stats;
+/// Sums the counters of every thread meta without stopping their owners, so the
+/// result is approximate while other threads allocate. Frees from a thread other
+/// than the owner are counted once the owner collects them.
+$extern fn_((heap_Smp_stats(heap_Smp* self))(heap_Smp_Stats));
+/// Returns the empty slabs older than `cfg.decay` to the backing allocator.
+/// Expired slabs are otherwise only released when a free empties another slab
+/// of the same thread meta. Metas owned by other threads are only flagged and
+/// served on their owner's next slow-path allocation. Returns the number of
+/// bytes released by the calling thread.
+$extern fn_((heap_Smp_decay(heap_Smp* self))(usize));
+/// Returns every cached empty slab to the backing allocator, regardless of age.
+$extern fn_((heap_Smp_purge(heap_Smp* self))(usize));
 
 #if defined(__cplusplus)
 } /* extern "C" */
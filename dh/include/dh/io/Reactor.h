@@ -0,0 +1,178 @@
+/**
+ * @copyright Copyright (c) 2026 Gyeongtae Kim
+ * @license   MIT License - see LICENSE file for details
+ *
+ * @file    Reactor.h
+ * @author  Gyeongtae Kim (dev-dasae) <codingpelican@gmail.com>
+ * @date    2026-10-17 (date of creation)
+ * @updated 2026-10-17 (date of last update)
+ * @ingroup dasae-headers(dh)/io
+ * @prefix  io_Reactor
+ *
+ * @brief   File descriptor readiness and I/O completion for `Co_Exec` coroutines
+ * @details An `io_Reactor_Op` describes one wait or transfer on a `fs_File_Handle`.
+ *          `io_Reactor_await` runs it from inside an `async_fn_scope`, parking the
+ *          frame on the executor until the operation can finish, so a pipe or socket
+ *          read never blocks the thread. `io_Reactor_run` drives the executor and
+ *          waits for events while every coroutine is parked.
+ *
+ *          The default backend is edge-triggered epoll: a handle is registered and
+ *          made non-blocking on first use, until `io_Reactor_deregister` restores its
+ *          flags, and a transfer is retried whenever its direction turns ready. Only
+ *          one operation per direction may wait on a handle; another one fails with
+ *          `EBUSY` instead of waiting. Regular files cannot be polled, so transfers on
+ *          them finish in place. Building with `io_Reactor_use_uring` switches to
+ *          io_uring, which submits the transfers themselves and resumes the frame on
+ *          their completion; an operation fails the same way when the submission
+ *          queue stays full after a flush.
+ *
+ *          Linux only; `io_Reactor_init` fails with `io_Reactor_Err_Unsupported` elsewhere.
+ */
+#ifndef io_Reactor__included
+#define io_Reactor__included 1
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/*========== Includes =======================================================*/
+
+#include "dh/async/Exec.h"
+#include "dh/fs/File.h"
+
+/*========== Macros and Definitions =========================================*/
+
+#if !defined(io_Reactor_use_uring)
+#define io_Reactor_use_uring __comp_bool__io_Reactor_use_uring
+#endif /* !defined(io_Reactor_use_uring) */
+#define __comp_bool__io_Reactor_use_uring pp_false
+
+/*========== Macros and Declarations ========================================*/
+
+errset_((io_Reactor_Err)(
+    Unsupported,
+    SetupFailed,
+    WaitFailed,
+    Timeout
+));
+
+typedef enum_(io_Reactor_OpKind $bits(8)) {
+    io_Reactor_OpKind_readable = 0,
+    io_Reactor_OpKind_writable,
+    io_Reactor_OpKind_read,
+    io_Reactor_OpKind_write,
+} io_Reactor_OpKind;
+
+typedef enum_(io_Reactor_OpState $bits(8)) {
+    io_Reactor_OpState_idle = 0,
+    /// Parked until the handle turns ready or the transfer completes
+    io_Reactor_OpState_waiting,
+    /// Timed out with a transfer in flight; parked until the kernel lets go of it
+    io_Reactor_OpState_cancelling,
+    io_Reactor_OpState_done,
+} io_Reactor_OpState;
+
+/// Keep it in the coroutine's locals: it must stay at one address until `io_Reactor_await` returns.
+typedef struct io_Reactor_Op {
+    var_(timer, Co_Timer);
+    var_(handle, fs_File_Handle);
+    var_(kind, io_Reactor_OpKind);
+    var_(state, io_Reactor_OpState);
+    var_(timed_out, bool);
+    var_(has_timeout, bool);
+    var_(buf, S$u8);
+    var_(timeout, time_Duration);
+    var_(deadline, time_Instant);
+    /// Bytes transferred or the ready event mask, or a negated errno
+    var_(result, i64);
+} io_Reactor_Op;
+
+/// Wait until `handle` can be read without blocking
+$extern fn_((io_Reactor_Op_readable(fs_File_Handle handle))(io_Reactor_Op));
+/// Wait until `handle` can be written without blocking
+$extern fn_((io_Reactor_Op_writable(fs_File_Handle handle))(io_Reactor_Op));
+/// Read up to `buf.len` bytes at the file cursor; 0 means end of file
+$extern fn_((io_Reactor_Op_read(fs_File_Handle handle, S$u8 buf))(io_Reactor_Op));
+/// Write some of `bytes` at the file cursor; may stop short
+$extern fn_((io_Reactor_Op_write(fs_File_Handle handle, S_const$u8 bytes))(io_Reactor_Op));
+/// Gives up with `io_Reactor_Err_Timeout` once `timeout` passes on the executor's clock
+$extern fn_((io_Reactor_Op_withTimeout(io_Reactor_Op self, time_Duration timeout))(io_Reactor_Op));
+/// Bytes transferred (the ready event mask for waits), once `io_Reactor_await` returned
+$extern fn_((io_Reactor_Op_result(const io_Reactor_Op* self))(E$usize)) $must_check;
+
+/// io_uring rings as mapped from the kernel
+typedef struct io_Reactor_Ring {
+    var_(sq_head, u32*);
+    var_(sq_tail, u32*);
+    var_(sq_mask, u32);
+    var_(sq_entries, u32);
+    var_(sq_array, u32*);
+    var_(sqes, P$raw);
+    var_(cq_head, u32*);
+    var_(cq_tail, u32*);
+    var_(cq_mask, u32);
+    var_(cqes, P$raw);
+    var_(sq_map, S$u8);
+    /// Empty when the kernel maps both rings at once
+    var_(cq_map, S$u8);
+    var_(sqe_map, S$u8);
+    /// Entries filled since the last `io_uring_enter`
+    var_(unsubmitted, u32);
+} io_Reactor_Ring;
+
+/// Per-descriptor epoll state, indexed by the descriptor
+typedef struct io_Reactor_Slot {
+    var_(reader, io_Reactor_Op*);
+    var_(writer, io_Reactor_Op*);
+    /// `EPOLLIN`/`EPOLLOUT` seen since a transfer in that direction last would block
+    var_(ready, u32);
+    /// Descriptor status flags from before registration, restored by `io_Reactor_deregister`
+    var_(flags, i32);
+    var_(mode, u8);
+} io_Reactor_Slot;
+
+typedef struct io_Reactor {
+    var_(exec, Co_Exec*);
+    var_(fd, i32);
+    /// Operations parked on the kernel
+    var_(in_flight, usize);
+#if io_Reactor_use_uring
+    var_(ring, io_Reactor_Ring);
+#else  /* !io_Reactor_use_uring */
+    /// `events_cap` entries of `struct epoll_event`
+    var_(events, P$raw);
+    var_(events_cap, u32);
+    var_(slots, io_Reactor_Slot*);
+    var_(slots_len, usize);
+#endif /* !io_Reactor_use_uring */
+} io_Reactor;
+T_use_E$(io_Reactor);
+
+/* --- Construction/Destruction --- */
+
+/// `entries` is the number of events taken per wait (the ring depth with io_uring).
+/// Buffers come from the executor's allocator; the executor must outlive the reactor.
+$extern fn_((io_Reactor_init(Co_Exec* exec, u32 entries))(E$io_Reactor)) $must_check;
+$extern fn_((io_Reactor_fini(io_Reactor* self))(void));
+/// Forget `handle` before closing it, restoring the blocking mode it had; nothing may be waiting on it
+$extern fn_((io_Reactor_deregister(io_Reactor* self, fs_File_Handle handle))(void));
+
+/* --- Operations --- */
+
+/// Advances `op` for `frame`; true while the frame has to stay suspended
+$extern fn_((io_Reactor_step(io_Reactor* self, io_Reactor_Op* op, Co_Ctx* frame))(bool));
+/// Waits up to `timeout` (none waits until an event arrives) and wakes the frames of finished operations
+$extern fn_((io_Reactor_poll(io_Reactor* self, O$time_Duration timeout))(E$usize)) $must_check;
+/// Polls the executor and the reactor in turn until both are idle
+$extern fn_((io_Reactor_run(io_Reactor* self))(E$void)) $must_check;
+
+/* --- Coroutine Primitives --- */
+
+/// Runs `_op` from the calling coroutine, suspending until it finishes; read the outcome
+/// with `io_Reactor_Op_result`. The calling frame must be the one the executor resumes.
+#define io_Reactor_await(_reactor, _op...) \
+    while (io_Reactor_step(_reactor, _op, ctx->anyraw)) { suspend_(); }
+
+#if defined(__cplusplus)
+} /* extern "C" */
+#endif /* defined(__cplusplus) */
+#endif /* io_Reactor__included */
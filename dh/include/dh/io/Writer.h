@@ -5,7 +5,7 @@
  * @file    Writer.h
  * @author  Gyeongtae Kim (dev-dasae) <codingpelican@gmail.com>
  * @date    2025-05-13 (date of creation)
- * @updated 2025-05-13 (date of last update)
+ * @updated 2025-12-29 (date of last update)
  * @version v0.1-alpha
  * @ingroup dasae-headers(dh)/io
  * @prefix  io_Writer
@@ -26,10 +26,18 @@ extern "C" {
 typedef struct io_Writer {
     var_(ctx, P$raw);
     fn_(((*write)(P$raw ctx, S_const$u8 bytes))(E$usize)) $must_check;
+    /// Optional gather write (may be partial, like `writev`); null when the sink has no
+    /// cheaper path than repeated `write`. Only unbuffered system sinks set it, so
+    /// `fmt_format` and `io_Buf_Writer` treat its presence as "each call is a syscall".
+    fn_(((*writeVec)(P$raw ctx, S_const$S_const$u8 segs))(E$usize)) $must_check;
 } io_Writer;
 
 $extern fn_((io_Writer_write(io_Writer self, S_const$u8 bytes))(E$usize)) $must_check;
 $extern fn_((io_Writer_writeBytes(io_Writer self, S_const$u8 bytes))(E$void)) $must_check;
+/// Write from `segs` in order; returns the bytes written, which may stop short
+$extern fn_((io_Writer_writeVec(io_Writer self, S_const$S_const$u8 segs))(E$usize)) $must_check;
+/// Write all of `segs`, as one gather write per call to `writeVec` when available
+$extern fn_((io_Writer_writeVecAll(io_Writer self, S_const$S_const$u8 segs))(E$void)) $must_check;
 $extern fn_((io_Writer_writeBytesN(io_Writer self, S_const$u8 bytes, usize n))(E$void)) $must_check;
 $extern fn_((io_Writer_writeByte(io_Writer self, u8 byte))(E$void)) $must_check;
 $extern fn_((io_Writer_writeByteN(io_Writer self, u8 byte, usize n))(E$void)) $must_check;
@@ -40,6 +48,23 @@ $extern fn_((io_Writer_printVaArgs(io_Writer self, S_const$u8 fmt, va_list va_ar
 $extern fn_((io_Writer_println(io_Writer self, S_const$u8 fmt, ...))(E$void)) $must_check;
 $extern fn_((io_Writer_printlnVaArgs(io_Writer self, S_const$u8 fmt, va_list va_args))(E$void)) $must_check;
 
+struct fmt_CompiledSite;
+/// `io_Writer_print` with `fmt` compiled on first use and cached in `site` (see `fmt_formatSite`)
+$extern fn_((io_Writer_printSite(io_Writer self, struct fmt_CompiledSite* site, S_const$u8 fmt, ...))(E$void)) $must_check;
+$extern fn_((io_Writer_printlnSite(io_Writer self, struct fmt_CompiledSite* site, S_const$u8 fmt, ...))(E$void)) $must_check;
+/// `io_Writer_print` with the literal format string compiled once per call site; needs "dh/fmt/common.h"
+#define io_Writer_printCached(_self, _fmt_w_args...) __op__io_Writer_printCached(pp_uniqTok(site), _self, _fmt_w_args)
+#define io_Writer_printlnCached(_self, _fmt_w_args...) __op__io_Writer_printlnCached(pp_uniqTok(site), _self, _fmt_w_args)
+
+#define __op__io_Writer_printCached(__site, _self, _fmt_w_args...) ({ \
+    $static struct fmt_CompiledSite __site = {}; \
+    io_Writer_printSite(_self, &__site, _fmt_w_args); \
+})
+#define __op__io_Writer_printlnCached(__site, _self, _fmt_w_args...) ({ \
+    $static struct fmt_CompiledSite __site = {}; \
+    io_Writer_printlnSite(_self, &__site, _fmt_w_args); \
+})
+
 #if defined(__cplusplus)
 } /* extern "C" */
 #endif /* defined(__cplusplus) */
@@ -5,7 +5,7 @@
  * @file    log.h
  * @author  Gyeongtae Kim (dev-dasae) <codingpelican@gmail.com>
  * @date    2025-01-03 (date of creation)
- * @updated 2025-01-04 (date of last update)
+ * @updated 2025-12-27 (date of last update)
  * @version v0.1-alpha
  * @ingroup dasae-headers(dh)
  * @prefix  log
@@ -14,6 +14,10 @@
  * @details Provides logging functionality with configurable output destination,
  *          log levels, and formatting options. Supports file and stderr output,
  *          timestamps, log levels, source location, and function name display.
+ *          In async mode (`log_initAsync`) each thread appends records to its own
+ *          lock-free ring and a background thread formats and writes them in batches.
+ *          A `Thrd_spawn` thread hands its ring back when it exits, so a new thread
+ *          reuses it; rings of other threads stay allocated until `log_finiAsync`.
  */
 
 #ifndef LOG_INCLUDED
@@ -24,6 +28,7 @@ extern "C" {
 
 #include "prl.h"
 #include "fs.h"
+#include "mem/Allocator.h"
 #include <stdio.h> /* TODO: Use io or fs instead of this */
 
 // Log levels
@@ -45,6 +50,27 @@ typedef struct log_Config {
     bool shows_function;  // Whether to show function name
 } log_Config;
 
+// What a logging thread does when its async ring is full
+typedef enum log_Overflow {
+    log_Overflow_drop,  // Discard the message
+    log_Overflow_block, // Wait until the drain thread makes room
+    log_Overflow_count, // Discard the message; the drain thread reports how many were lost
+} log_Overflow;
+
+// Async mode configuration
+typedef struct log_AsyncConfig {
+    usize ring_cap;        // Records per thread ring (rounded up to a power of two)
+    usize buf_size;        // Bytes the drain thread buffers before issuing a write
+    u32 flush_interval_ms; // Longest time a record waits before being written
+    log_Overflow overflow; // Policy when a thread's ring is full
+} log_AsyncConfig;
+static const log_AsyncConfig log_AsyncConfig_default = {
+    .ring_cap = 1024,
+    .buf_size = 64ull * 1024ull,
+    .flush_interval_ms = 10,
+    .overflow = log_Overflow_count,
+};
+
 // Initialize logging with a file
 extern fs_File_Err$void log_init(const char* filename) $must_check;
 // Initialize logging with an existing file handle
@@ -52,6 +78,17 @@ extern void log_initWithFile(FILE* file);
 // Close logging
 extern void log_fini(void);
 
+// Switch to async mode: log calls enqueue records, a background thread writes them.
+// Messages longer than the record text are truncated.
+extern E$void log_initAsync(mem_Allocator gpa, log_AsyncConfig config) $must_check;
+// Write every queued record, stop the drain thread and return to synchronous mode.
+// No other thread may log concurrently.
+extern void log_finiAsync(void);
+// Block until every record queued before the call has been written
+extern void log_flush(void);
+// Messages discarded by the overflow policy since `log_initAsync`
+extern usize log_droppedCount(void);
+
 // Configuration setters
 extern void log_setLevel(log_Level level);
 extern void log_showTimestamp(bool shows);
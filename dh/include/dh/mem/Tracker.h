@@ -5,8 +5,8 @@
  * @file    Tracker.h
  * @author  Gyeongtae Kim (dev-dasae) <codingpelican@gmail.com>
  * @date    2025-01-09 (date of creation)
- * @updated 2025-03-22 (date of last update)
- * @version v0.1-alpha.2
+ * @updated 2026-02-27 (date of last update)
+ * @version v0.1-alpha.3
  * @ingroup dasae-headers(dh)/mem
  * @prefix  mem_Tracker
  *
@@ -14,6 +14,16 @@
  * @details Tracks memory allocations, frees, remaps, and detects issues like
  *          memory leaks, double frees, and invalid frees. Provides detailed
  *          reports with allocation source locations and timestamps.
+ *
+ *          Live allocations sit in a hash table keyed by address, so register and
+ *          free cost O(1) instead of a list walk. Counters per call site (`SrcLoc`)
+ *          are updated with atomics and can be read at any time through
+ *          `mem_Tracker_stats`/`mem_Tracker_sites`, or dumped periodically.
+ *
+ *          With `mem_Tracker_Cfg.sample_interval` set, only about one allocation
+ *          per that many bytes is tracked (a Poisson process over allocated bytes,
+ *          as in tcmalloc); each sample is weighted so the counters stay unbiased
+ *          estimates, and unsampled allocations cost one thread-local subtraction.
  */
 #ifndef mem_Tracker__included
 #define mem_Tracker__included 1
@@ -29,16 +39,63 @@ extern "C" {
 #if defined(MEM_NO_TRACE_ALLOC_AND_FREE) || !debug_comp_enabled
 #else
 #include "dh/mem/Allocator.h"
+#include "dh/Thrd/Mtx.h"
+#include "dh/time/Instant.h"
 #include <stdio.h> /* TODO: Remove this dependency */
 
 /*========== Memory Tracking Types =========================================*/
 
+/// Distinct call sites with their own counters; later sites are counted only in the totals.
+#define mem_Tracker_max_sites (4096u)
+#define mem_Tracker_Cfg_default_sample_interval (0)
+#define mem_Tracker_Cfg_default_snapshot_sites (16u)
+
+typedef struct mem_Tracker_Cfg {
+    /// Mean bytes between sampled allocations; 0 tracks every allocation.
+    var_(sample_interval, usize);
+    /// Writes one log line per alloc, remap and free (slow: stdio on every call).
+    var_(logs_events, bool);
+    /// Dumps a snapshot at least this often from the allocating thread; zero disables it.
+    var_(snapshot_interval, time_Duration);
+    /// Call sites listed per snapshot, by live bytes.
+    var_(snapshot_sites, u32);
+} mem_Tracker_Cfg;
+static const mem_Tracker_Cfg mem_Tracker_Cfg_default = {
+    .sample_interval = mem_Tracker_Cfg_default_sample_interval,
+    .logs_events = false,
+    .snapshot_interval = { .secs = 0, .nanos = 0 },
+    .snapshot_sites = mem_Tracker_Cfg_default_snapshot_sites,
+};
+
+/// Totals; estimates scaled from the samples while sampling.
+typedef struct mem_Tracker_Stats {
+    var_(live_bytes, usize);
+    var_(live_count, usize);
+    var_(alloc_bytes, usize);
+    var_(alloc_count, usize);
+} mem_Tracker_Stats;
+
+/// Counters of one call site; estimates while sampling.
+typedef struct mem_Tracker_Site {
+    var_(src_loc, SrcLoc);
+    var_(alloc_bytes, usize);
+    var_(alloc_count, usize);
+    var_(free_bytes, usize);
+    var_(free_count, usize);
+} mem_Tracker_Site;
+T_use_S$(mem_Tracker_Site);
+
 typedef struct mem_Tracker {
     mem_Allocator gpa; /* Allocator */
-    struct mem_Allocation* allocations; /* Linked list of allocations */
     FILE* log_file; /* Log file handle */
-    usize total_allocated; /* Total bytes allocated */
-    usize active_allocs; /* Number of active allocations */
+    mem_Tracker_Cfg cfg; /* Sampling and reporting options */
+    Thrd_Mtx mtx; /* Guards the live table and the log */
+    struct mem_Tracker__Live* lives; /* Open-addressed table of tracked allocations */
+    usize lives_cap; /* Slots in `lives`, a power of two */
+    usize lives_len; /* Occupied slots */
+    mem_Tracker_Stats stats; /* Updated atomically */
+    time_Instant started_at; /* Initialization time */
+    time_Instant last_snapshot; /* Time of the last periodic snapshot */
 } mem_Tracker;
 
 /*========== Memory Tracker Interface ======================================*/
@@ -47,6 +104,8 @@ typedef struct mem_Tracker {
 extern fn_((mem_Tracker_initWithPath(S_const$u8 log_path))(E$void)) $must_check;
 /// Generate final report and cleanup
 extern fn_((mem_Tracker_finiAndGenerateReport(void))(void));
+/// Replace the options; a new sample interval applies from each thread's next sample
+extern fn_((mem_Tracker_configure(mem_Tracker_Cfg cfg))(void));
 
 /// Register allocation (e.g., alloc, create)
 extern fn_((mem_Tracker_registerAlloc(P$raw ptr, usize size, SrcLoc src_loc))(void));
@@ -55,6 +114,13 @@ extern fn_((mem_Tracker_registerRemap(P$raw old_ptr, P$raw new_ptr, usize new_si
 /// Register deallocation (e.g., free, destroy)
 extern fn_((mem_Tracker_registerFree(P$raw ptr, SrcLoc src_loc))(bool));
 
+/// Current totals, without locking
+extern fn_((mem_Tracker_stats(void))(mem_Tracker_Stats));
+/// Copy the call sites with the most live bytes into `buf`, largest first; returns how many were copied
+extern fn_((mem_Tracker_sites(S$mem_Tracker_Site buf))(usize));
+/// Write the totals and the busiest call sites to the log now
+extern fn_((mem_Tracker_dumpSnapshot(void))(void));
+
 /// Get singleton instance
 extern fn_((mem_Tracker_instance(void))(mem_Tracker*));
 #endif /* defined(MEM_NO_TRACE_ALLOC_AND_FREE) || !debug_comp_enabled */
@@ -37,6 +37,8 @@ extern "C" {
 // Fixed page size (may be different per platform)
 #define mem_page_size /*: usize*/ __comp_const__mem_page_size
 
+#define __comp_const__mem_search_lanes pp_if_(arch_has_avx2)(pp_then_(32u), pp_else_(16u))
+
 /* --- Integer Bit Operations --- */
 
 $attr($inline_always)
@@ -348,6 +350,25 @@ $extern fn_((mem_endsWith(u_S_const$raw haystack, u_S_const$raw needle))(bool));
         return mem_endsWith(u_anyS(haystack), u_anyS(needle)); \
     }
 
+/* --- Byte Search --- */
+
+/// Vector width of the byte-search kernels: 32 with AVX2, else 16 (SSE2/NEON/portable)
+#define mem_search_lanes __comp_const__mem_search_lanes
+
+/// Index of the first `byte` in `haystack` (memchr)
+$extern fn_((mem_idxByte(S_const$u8 haystack, u8 byte))(O$usize));
+/// Index of the last `byte` in `haystack` (memrchr)
+$extern fn_((mem_idxLastByte(S_const$u8 haystack, u8 byte))(O$usize));
+/// Index of the first byte equal to either of the two
+$extern fn_((mem_idxAnyByte2(S_const$u8 haystack, u8 byte0, u8 byte1))(O$usize));
+/// Index of the first byte equal to any of the three
+$extern fn_((mem_idxAnyByte3(S_const$u8 haystack, u8 byte0, u8 byte1, u8 byte2))(O$usize));
+/// Index of the first byte in `set`; uses the kernels above for sets of up to three bytes
+$extern fn_((mem_idxAnyBytes(S_const$u8 haystack, S_const$u8 set))(O$usize));
+/// Index of the first occurrence of `needle` (memmem); an empty needle is found at 0.
+/// Candidates are filtered by the needle's first and last byte a vector at a time.
+$extern fn_((mem_idxBytes(S_const$u8 haystack, S_const$u8 needle))(O$usize));
+
 typedef enum_(mem_DelimType $bits(8)) {
     mem_delimType_value = 0,
     mem_delimType_pattern = 1,
@@ -788,6 +788,10 @@ T_use_Vec$(4, u32); /* Vec$4$u32  - 4x uint32   */
 T_use_Vec$(8, u32); /* Vec$8$u32  - 8x uint32   */
 T_use_Vec$(16, u32); /* Vec$16$u32 - 16x uint32  */
 
+T_use_Vec$(16, u8); /* Vec$16$u8  - 16x uint8   */
+T_use_Vec$(32, u8); /* Vec$32$u8  - 32x uint8   */
+T_use_Vec$(16, u16); /* Vec$16$u16 - 16x uint16  */
+
 T_use_Vec$(1, u64); /* Vec$1$u64  - 1x uint64   */
 T_use_Vec$(2, u64); /* Vec$2$u64  - 2x uint64   */
 T_use_Vec$(4, u64); /* Vec$4$u64  - 4x uint64   */
@@ -857,6 +861,12 @@ extern "C" {
 /// Move mask from vector comparison to integer
 #define Vec_moveMask(_vec) __op__Vec_moveMask(_vec)
 
+/// Move mask of a 16/32-lane byte comparison: bit `i` is the top bit of byte lane `i`
+#define Vec_moveMaskBytes(_vec) __op__Vec_moveMaskBytes(pp_uniqTok(vec), _vec)
+
+/// 16-entry table lookup on 16 byte lanes: lane `i` becomes `_table[_idx[i] & 15]`
+#define Vec_lookupBytes(_table, _idx) __op__Vec_lookupBytes(pp_uniqTok(table), pp_uniqTok(idx), _table, _idx)
+
 /*---------- Cache Control --------------------------------------------------*/
 
 /// Prefetch data into cache
@@ -1096,6 +1106,96 @@ extern "C" {
 
 #endif
 
+#if (arch_is_x86 || arch_is_x86_64) && arch_has_sse2
+
+#define __op__Vec_moveMaskBytes(__vec, _vec...) ({ \
+    let __vec = (_vec); \
+    var_(__mask, u32) = 0; \
+    if (sizeof(__vec) == 16) { \
+        __mask = (u32)_mm_movemask_epi8(*((__m128i*)&__vec)); \
+    } else if (sizeof(__vec) == 32) { \
+        __mask = __op__Vec_moveMaskBytes__256((__m128i*)&__vec); \
+    } else { \
+        __mask = __op__Vec_moveMaskBytes__lanes(__vec); \
+    } \
+    __mask; \
+})
+#if arch_has_avx2
+#define __op__Vec_moveMaskBytes__256(_p_halves) \
+    ((u32)_mm256_movemask_epi8(*((__m256i*)(_p_halves))))
+#else
+#define __op__Vec_moveMaskBytes__256(_p_halves) \
+    ((u32)_mm_movemask_epi8((_p_halves)[0]) | ((u32)_mm_movemask_epi8((_p_halves)[1]) << 16))
+#endif
+
+#elif arch_is_aarch64
+
+/* NEON has no movemask: spread each top bit over its lane, weight the lane by its bit, then sum each half */
+#define __op__Vec_moveMaskBytes(__vec, _vec...) ({ \
+    static const u8 __weights[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 }; \
+    let __vec = (_vec); \
+    let __halves = (uint8x16_t*)&__vec; \
+    var_(__mask, u32) = 0; \
+    for (usize __i = 0; __i < sizeof(__vec) / 16; ++__i) { \
+        let __tops = vreinterpretq_u8_s8(vshrq_n_s8(vreinterpretq_s8_u8(__halves[__i]), 7)); \
+        let __bits = vandq_u8(__tops, vld1q_u8(__weights)); \
+        __mask |= ((u32)vaddv_u8(vget_low_u8(__bits)) | ((u32)vaddv_u8(vget_high_u8(__bits)) << 8)) << (__i * 16); \
+    } \
+    __mask; \
+})
+
+#else
+
+#define __op__Vec_moveMaskBytes(__vec, _vec...) ({ \
+    let __vec = (_vec); \
+    __op__Vec_moveMaskBytes__lanes(__vec); \
+})
+
+#endif
+
+/* Top bit of each byte lane, one lane at a time */
+#define __op__Vec_moveMaskBytes__lanes(_vec...) ({ \
+    var_(__lanes_mask, u32) = 0; \
+    for (usize __lane = 0; __lane < sizeof(_vec); ++__lane) { \
+        __lanes_mask |= (u32)((as$(u8)((_vec)[__lane]) >> 7) & 1u) << __lane; \
+    } \
+    __lanes_mask; \
+})
+
+#if (arch_is_x86 || arch_is_x86_64) && arch_has_ssse3
+
+#define __op__Vec_lookupBytes(__table, __idx, _table, _idx...) ({ \
+    let __table = (_table); \
+    let __idx = (_idx) & 0x0F; \
+    var_(__result, TypeOfUnqual(__table)); \
+    *((__m128i*)&__result) = _mm_shuffle_epi8(*((__m128i*)&__table), *((__m128i*)&__idx)); \
+    __result; \
+})
+
+#elif arch_is_aarch64
+
+#define __op__Vec_lookupBytes(__table, __idx, _table, _idx...) ({ \
+    let __table = (_table); \
+    let __idx = (_idx) & 0x0F; \
+    var_(__result, TypeOfUnqual(__table)); \
+    *((uint8x16_t*)&__result) = vqtbl1q_u8(*((uint8x16_t*)&__table), *((uint8x16_t*)&__idx)); \
+    __result; \
+})
+
+#else
+
+#define __op__Vec_lookupBytes(__table, __idx, _table, _idx...) ({ \
+    let __table = (_table); \
+    let __idx = (_idx); \
+    var_(__result, TypeOfUnqual(__table)); \
+    for (usize __i = 0; __i < 16; ++__i) { \
+        __result[__i] = __table[__idx[__i] & 0x0F]; \
+    } \
+    __result; \
+})
+
+#endif
+
 /*---------- Prefetch -------------------------------------------------------*/
 
 #define __op__Vec_prefetch(_p_addr, _locality) \
@@ -5,7 +5,7 @@
  * @file    sort.h
  * @author  Gyeongtae Kim (dev-dasae) <codingpelican@gmail.com>
  * @date    2025-01-22 (date of creation)
- * @updated 2026-02-13 (date of last update)
+ * @updated 2026-02-24 (date of last update)
  * @ingroup dasae-headers(dh)
  * @prefix  sort
  *
@@ -13,6 +13,8 @@
  * @details Provides optimal stable and unstable sorting functions isolated by
  *          auxiliary memory constraints (O(1), O(K), O(N)).
  *          Supports index-based context sorting for non-contiguous layouts.
+ *          Parallel variants split work across a `Thrd_Pool`.
+ *          Radix variants sort integer/float keys without comparisons.
  */
 #ifndef sort__included
 #define sort__included 1
@@ -36,6 +38,11 @@ extern "C" {
 #define sort_threshold_pdq_partial_insert_sort __const__sort_threshold_pdq_partial_insert_sort
 #define sort_limit_pdq_offset_blocks __const__sort_limit_pdq_offset_blocks
 #define sort_limit_block_cache_stack_bytes __const__sort_limit_block_cache_stack_bytes
+#define sort_threshold_par_grain __const__sort_threshold_par_grain
+#define sort_limit_par_chunks __const__sort_limit_par_chunks
+#define sort_threshold_radix_insert_sort __const__sort_threshold_radix_insert_sort
+
+typedef struct Thrd_Pool Thrd_Pool;
 
 /// Callable types for pointer-based sorting functions
 use_Callable(sort_OrdFn, (u_V$raw lhs, u_V$raw rhs), cmp_Ord);
@@ -112,6 +119,74 @@ $extern fn_((sort_blockAlloc(mem_Allocator gpa, u_S$raw seq, sort_OrdFn ordFn))(
 $attr($must_check)
 $extern fn_((sort_blockCtxAlloc(mem_Allocator gpa, u_S$raw seq, sort_OrdCtxFn ordFn, u_P_const$raw ctx))(mem_Err$u_S$raw));
 
+/*========== Parallel ==========*/
+
+/// Parallel pdqsort: partitions larger than `sort_threshold_par_grain` are split with a
+/// chunked parallel partition and both sides sorted as fork/join tasks on `pool`;
+/// smaller ones use `sort_pdq`. Unstable. `ordFn` is called from several threads at once.
+/// - Time Complexity: O(N log N / P) expected, O(N log N) worst.
+/// - Space Complexity: O(log N) stack per worker.
+$extern fn_((sort_pdqPar(Thrd_Pool* pool, u_S$raw seq, sort_OrdFn ordFn))(void));
+$extern fn_((sort_pdqParCtx(Thrd_Pool* pool, u_S$raw seq, sort_OrdCtxFn ordFn, u_P_const$raw ctx))(void));
+
+/// Parallel stable merge sort: runs are sorted with `sort_blockCache` in parallel, then merged
+/// level by level, each merge split among workers at co-ranked positions.
+/// Falls back to `sort_blockAlloc` below `sort_threshold_par_grain`.
+/// - Time Complexity: O(N log N / P + N log P).
+/// - Space Complexity: O(N) from `gpa`.
+$attr($must_check)
+$extern fn_((sort_blockPar(Thrd_Pool* pool, mem_Allocator gpa, u_S$raw seq, sort_OrdFn ordFn))(mem_Err$u_S$raw));
+$attr($must_check)
+$extern fn_((sort_blockParCtx(
+    Thrd_Pool* pool, mem_Allocator gpa, u_S$raw seq, sort_OrdCtxFn ordFn, u_P_const$raw ctx
+))(mem_Err$u_S$raw));
+
+/*========== Radix ==========*/
+
+/// Callable type extracting an unsigned sort key from an element; order keys with the
+/// `sort_radixKey$*` helpers to sort by signed or floating-point fields.
+use_Callable(sort_KeyFn, (u_V$raw item), u64);
+
+/// LSD Radix Sort: one 8-bit digit per pass, skipping digits every key shares. Stable.
+/// Signed and floating-point keys are remapped to order-preserving unsigned bits in place;
+/// floats order as `-inf < ... < -0.0 < +0.0 < ... < +inf`, NaNs at the ends by sign.
+/// - Time Complexity: O(N * W / 8) for W-bit keys.
+/// - Space Complexity: O(N) from `gpa`.
+$attr($must_check)
+$extern fn_((sort_radix$u32(mem_Allocator gpa, S$u32 seq))(mem_Err$void));
+$attr($must_check)
+$extern fn_((sort_radix$u64(mem_Allocator gpa, S$u64 seq))(mem_Err$void));
+$attr($must_check)
+$extern fn_((sort_radix$i32(mem_Allocator gpa, S$i32 seq))(mem_Err$void));
+$attr($must_check)
+$extern fn_((sort_radix$i64(mem_Allocator gpa, S$i64 seq))(mem_Err$void));
+$attr($must_check)
+$extern fn_((sort_radix$f32(mem_Allocator gpa, S$f32 seq))(mem_Err$void));
+$attr($must_check)
+$extern fn_((sort_radix$f64(mem_Allocator gpa, S$f64 seq))(mem_Err$void));
+/// LSD Radix Sort over records: keys are extracted once, then keys and records move together. Stable.
+/// - Time Complexity: O(N * 8) passes at most, one `keyFn` call per element.
+/// - Space Complexity: O(N) records and O(2N) keys from `gpa`.
+$attr($must_check)
+$extern fn_((sort_radixByKey(mem_Allocator gpa, u_S$raw seq, sort_KeyFn keyFn))(mem_Err$void));
+
+/// American Flag Sort: in-place MSD radix sort permuting elements into 256 buckets per digit.
+/// Buckets below `sort_threshold_radix_insert_sort` finish with insertion sort. Unstable.
+/// - Time Complexity: O(N * W / 8) for W-bit keys.
+/// - Space Complexity: O(W / 8) stack frames of 256 counters.
+$extern fn_((sort_radixFlag$u32(S$u32 seq))(void));
+$extern fn_((sort_radixFlag$u64(S$u64 seq))(void));
+$extern fn_((sort_radixFlag$i64(S$i64 seq))(void));
+$extern fn_((sort_radixFlag$f64(S$f64 seq))(void));
+/// In-place variant of `sort_radixByKey`; `keyFn` is called on every digit visit. Unstable.
+$extern fn_((sort_radixFlagByKey(u_S$raw seq, sort_KeyFn keyFn))(void));
+
+/// Order-preserving unsigned keys, for use inside a `sort_KeyFn`
+$attr($inline_always)
+$static fn_((sort_radixKey$i64(i64 val))(u64));
+$attr($inline_always)
+$static fn_((sort_radixKey$f64(f64 val))(u64));
+
 /*========== Macros and Definitions =========================================*/
 
 #define __const__sort_threshold_fallback_to_insert_sort 24
@@ -122,6 +197,9 @@ $extern fn_((sort_blockCtxAlloc(mem_Allocator gpa, u_S$raw seq, sort_OrdCtxFn or
 #define __const__sort_threshold_pdq_partial_insert_sort 50
 #define __const__sort_limit_pdq_offset_blocks 64
 #define __const__sort_limit_block_cache_stack_bytes pp_if_(arch_bits_is_64bit)(pp_then_(4096), pp_else_(2048))
+#define __const__sort_threshold_par_grain 8192
+#define __const__sort_limit_par_chunks 64
+#define __const__sort_threshold_radix_insert_sort 32
 
 fn_((sort_IdxCtx_ord(sort_IdxCtx self, usize lhs, usize rhs))(cmp_Ord)) {
     return invoke(self.ordFn, lhs, rhs, u_load(u_deref(self.inner)));
@@ -130,6 +208,15 @@ fn_((sort_IdxCtx_swap(sort_IdxCtx self, usize lhs, usize rhs))(void)) {
     return invoke(self.swapFn, lhs, rhs, u_load(u_deref(self.inner)));
 };
 
+fn_((sort_radixKey$i64(i64 val))(u64)) {
+    return bitCast$((u64)(val)) ^ (as$(u64)(1) << 63);
+};
+fn_((sort_radixKey$f64(f64 val))(u64)) {
+    let bits = bitCast$((u64)(val));
+    /* negatives: flip every bit; positives: flip the sign bit */
+    return bits ^ ((as$(u64)(0) - (bits >> 63)) | (as$(u64)(1) << 63));
+};
+
 #if defined(__cplusplus)
 } /* $extern "C" */
 #endif /* defined(__cplusplus) */
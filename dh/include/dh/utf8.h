@@ -52,6 +52,9 @@ T_use_E$(utf8_SeqLen);
 T_use_E$($set(utf8_Err)(utf8_SeqLen));
 
 #define utf8_replacement_ch __comp_int__utf8_replacement_ch
+/// Block-wise (SIMD) validation, counting and transcoding; defaults to `arch_simd_use`,
+/// define `UTF8_NO_SIMD` to build the scalar loops only.
+#define utf8_simd_enabled __comp_bool__utf8_simd_enabled
 
 $attr($must_check)
 $extern fn_((utf8_codepointSeqLen(u32 codepoint))(utf8_Err$utf8_SeqLen));
@@ -77,7 +80,11 @@ $extern fn_((utf8_decode4(utf8_Decode4Buf bytes))(utf8_Err$u32));
 
 $extern fn_((utf8_isValid(u32 codepoint))(bool));
 $extern fn_((utf8_validate(S_const$u8 bytes))(bool));
+/// Codepoints in `bytes`; undecodable bytes are skipped and not counted.
 $extern fn_((utf8_count(S_const$u8 bytes))(usize));
+/// Reference implementations decoding one codepoint at a time.
+$extern fn_((utf8_validateScalar(S_const$u8 bytes))(bool));
+$extern fn_((utf8_countScalar(S_const$u8 bytes))(usize));
 
 typedef struct utf8_View {
     var_(bytes, S_const$u8);
@@ -107,6 +114,12 @@ $extern fn_((utf8_Iter_peekAtBytes(utf8_Iter* self, usize n))(O$S_const$u8));
 /// https://en.wikipedia.org/wiki/Specials_(Unicode_block)#Replacement_character
 #define __comp_int__utf8_replacement_ch 0xFFFDu
 
+#if defined(UTF8_NO_SIMD)
+#define __comp_bool__utf8_simd_enabled 0
+#else
+#define __comp_bool__utf8_simd_enabled arch_simd_use
+#endif /* defined(UTF8_NO_SIMD) */
+
 #if defined(__cplusplus)
 } /* extern "C" */
 #endif /* defined(__cplusplus) */
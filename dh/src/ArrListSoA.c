@@ -0,0 +1,268 @@
+#include "dh/ArrListSoA.h"
+#include "dh/mem/common.h"
+
+/// Block for `cap` records; `cap` is a multiple of `ArrListSoA_cap_align`, so every column
+/// size is a multiple of a cache line and each column offset lands on one
+$attr($inline_always)
+$static fn_((blockType(S_const$TypeInfo fields, usize cap))(TypeInfo)) {
+    var block = u_typeInfoRecordN(cap, fields);
+    block.align = prim_max(as$(mem_Align)(block.align), mem_alignToLog2(arch_cache_line_bytes));
+    return block;
+};
+
+$attr($inline_always)
+$static fn_((ArrListSoA__block(ArrListSoA self))(u_P$raw)) {
+    return (u_P$raw){ .raw = self.bytes, .type = blockType(self.fields, self.cap) };
+};
+
+$static fn_((growCap(usize current, usize minimum))(usize)) {
+    usize grown = current;
+    do { grown = usize_addSat(grown, grown / 2 + ArrListSoA_cap_align); } while (grown < minimum);
+    return grown;
+};
+
+// ============================================================================
+// Core Functions
+// ============================================================================
+
+fn_((ArrListSoA_empty(S_const$TypeInfo fields))(ArrListSoA)) {
+    claim_assert_nonnull(fields.ptr);
+    claim_assert(0 < fields.len && fields.len <= ArrListSoA_fields_max);
+    return (ArrListSoA){
+        .bytes = null,
+        .len = 0,
+        .cap = 0,
+        .fields = fields,
+    };
+};
+
+fn_((ArrListSoA_init(S_const$TypeInfo fields, mem_Allocator gpa, usize cap))(mem_Err$ArrListSoA) $scope) {
+    var list = ArrListSoA_empty(fields);
+    try_(ArrListSoA_ensureCapPrecise(&list, gpa, cap));
+    return_ok(list);
+} $unscoped_(fn);
+
+fn_((ArrListSoA_fini(ArrListSoA* self, mem_Allocator gpa))(void)) {
+    claim_assert_nonnull(self);
+    ArrListSoA_clearAndFree(self, gpa);
+};
+
+fn_((ArrListSoA_len(ArrListSoA self))(usize)) {
+    return self.len;
+};
+
+fn_((ArrListSoA_cap(ArrListSoA self))(usize)) {
+    return self.cap;
+};
+
+fn_((ArrListSoA_isEmpty(ArrListSoA self))(bool)) {
+    return self.len == 0;
+};
+
+fn_((ArrListSoA_recordType(ArrListSoA self))(TypeInfo)) {
+    return u_typeInfoRecord(self.fields);
+};
+
+fn_((ArrListSoA_field(ArrListSoA self, usize field_idx))(u_S_const$raw)) {
+    return ArrListSoA_fieldMut(self, field_idx).as_const;
+};
+
+fn_((ArrListSoA_fieldMut(ArrListSoA self, usize field_idx))(u_S$raw)) {
+    claim_assert_fmt(field_idx < self.fields.len, "Field index out of bounds: idx({:uz}) >= len({:uz})", field_idx, self.fields.len);
+    if (self.cap == 0) {
+        let type = *S_at((self.fields)[field_idx]);
+        return u_init$S((type)(null, 0));
+    }
+    return u_prefixS(u_fieldSliMut(ArrListSoA__block(self), self.cap, self.fields, field_idx), self.len);
+};
+
+fn_((ArrListSoA_ensureCap(ArrListSoA* self, mem_Allocator gpa, usize new_cap))(mem_Err$void) $scope) {
+    claim_assert_nonnull(self);
+    if (new_cap <= self->cap) { return_ok({}); }
+    return ArrListSoA_ensureCapPrecise(self, gpa, growCap(self->cap, new_cap));
+} $unscoped_(fn);
+
+fn_((ArrListSoA_ensureCapPrecise(ArrListSoA* self, mem_Allocator gpa, usize new_cap))(mem_Err$void) $scope) {
+    claim_assert_nonnull(self);
+    if (new_cap <= self->cap) { return_ok({}); }
+    // Bounds the block size well below overflow, padding included
+    let record_size = prim_max(1, u_sizeOfRecord(self->fields));
+    if (usize_limit_max / 2 / record_size < new_cap) { return_err(mem_Err_OutOfMemory()); }
+
+    let cap = mem_alignFwd(new_cap, ArrListSoA_cap_align);
+    let block = try_(mem_Allocator_create(gpa, blockType(self->fields, cap)));
+    if (self->cap != 0) {
+        for (usize field_idx = 0; field_idx < self->fields.len; ++field_idx) {
+            let column = u_fieldSliMut(block, cap, self->fields, field_idx);
+            u_memcpyS(u_prefixS(column, self->len), ArrListSoA_field(*self, field_idx));
+        }
+        mem_Allocator_destroy(gpa, ArrListSoA__block(*self));
+    }
+    self->bytes = block.raw;
+    self->cap = cap;
+    return_ok({});
+} $unscoped_(fn);
+
+fn_((ArrListSoA_ensureUnusedCap(ArrListSoA* self, mem_Allocator gpa, usize additional))(mem_Err$void) $scope) {
+    claim_assert_nonnull(self);
+    if (usize_limit_max - self->len < additional) { return_err(mem_Err_OutOfMemory()); }
+    return ArrListSoA_ensureCap(self, gpa, self->len + additional);
+} $unscoped_(fn);
+
+fn_((ArrListSoA_shrinkRetainingCap(ArrListSoA* self, usize new_len))(void)) {
+    claim_assert_nonnull(self);
+    claim_assert(new_len <= self->len);
+    self->len = new_len;
+};
+
+fn_((ArrListSoA_clearRetainingCap(ArrListSoA* self))(void)) {
+    claim_assert_nonnull(self);
+    self->len = 0;
+};
+
+fn_((ArrListSoA_clearAndFree(ArrListSoA* self, mem_Allocator gpa))(void)) {
+    claim_assert_nonnull(self);
+    if (self->cap != 0) { mem_Allocator_destroy(gpa, ArrListSoA__block(*self)); }
+    *self = ArrListSoA_empty(self->fields);
+};
+
+// ============================================================================
+// Record Operations
+// ============================================================================
+
+fn_((ArrListSoA_resize(ArrListSoA* self, mem_Allocator gpa, usize new_len))(mem_Err$void) $scope) {
+    claim_assert_nonnull(self);
+    try_(ArrListSoA_ensureCap(self, gpa, new_len));
+    self->len = new_len;
+    return_ok({});
+} $unscoped_(fn);
+
+fn_((ArrListSoA_addBackWithin(ArrListSoA* self))(usize)) {
+    claim_assert_nonnull(self);
+    claim_assert(self->len < self->cap);
+    return self->len++;
+};
+
+fn_((ArrListSoA_append(ArrListSoA* self, mem_Allocator gpa, u_V$raw item))(mem_Err$void) $scope) {
+    claim_assert_nonnull(self);
+    debug_assert_eqBy(ArrListSoA_recordType(*self), item.inner_type, TypeInfo_eq);
+    try_(ArrListSoA_ensureUnusedCap(self, gpa, 1));
+    ArrListSoA_appendWithin(self, item);
+    return_ok({});
+} $unscoped_(fn);
+
+fn_((ArrListSoA_appendWithin(ArrListSoA* self, u_V$raw item))(void)) {
+    claim_assert_nonnull(self);
+    debug_assert_eqBy(ArrListSoA_recordType(*self), item.inner_type, TypeInfo_eq);
+    ArrListSoA_set(*self, ArrListSoA_addBackWithin(self), item);
+};
+
+fn_((ArrListSoA_set(ArrListSoA self, usize idx, u_V$raw item))(void)) {
+    claim_assert_fmt(idx < self.len, "Index out of bounds: idx({:uz}) >= len({:uz})", idx, self.len);
+    debug_assert_eqBy(ArrListSoA_recordType(self), item.inner_type, TypeInfo_eq);
+    for (usize field_idx = 0; field_idx < self.fields.len; ++field_idx) {
+        let src = u_fieldPtr(item.ref.as_const, self.fields, field_idx);
+        u_memcpy(u_atS(ArrListSoA_fieldMut(self, field_idx), idx), src);
+    }
+};
+
+fn_((ArrListSoA_get(ArrListSoA self, usize idx, u_V$raw ret_mem))(u_V$raw)) {
+    claim_assert_fmt(idx < self.len, "Index out of bounds: idx({:uz}) >= len({:uz})", idx, self.len);
+    debug_assert_eqBy(ArrListSoA_recordType(self), ret_mem.inner_type, TypeInfo_eq);
+    for (usize field_idx = 0; field_idx < self.fields.len; ++field_idx) {
+        let dst = u_fieldPtrMut(ret_mem.ref, self.fields, field_idx);
+        u_memcpy(dst, u_atS(ArrListSoA_field(self, field_idx), idx));
+    }
+    return ret_mem;
+};
+
+fn_((ArrListSoA_pop(ArrListSoA* self, u_V$raw ret_mem))(O$u_V$raw) $scope) {
+    claim_assert_nonnull(self);
+    if (self->len == 0) { return_none(); }
+    let value = ArrListSoA_get(*self, self->len - 1, ret_mem);
+    self->len -= 1;
+    return_some(value);
+} $unscoped_(fn);
+
+fn_((ArrListSoA_removeOrdd(ArrListSoA* self, usize idx, u_V$raw ret_mem))(u_V$raw)) {
+    claim_assert_nonnull(self);
+    let value = ArrListSoA_get(*self, idx, ret_mem);
+    for (usize field_idx = 0; field_idx < self->fields.len; ++field_idx) {
+        let column = ArrListSoA_fieldMut(*self, field_idx);
+        u_memmoveS(u_sliceS(column, $r(idx, self->len - 1)), u_sliceS(column, $r(idx + 1, self->len)).as_const);
+    }
+    self->len -= 1;
+    return value;
+};
+
+fn_((ArrListSoA_removeSwap(ArrListSoA* self, usize idx, u_V$raw ret_mem))(u_V$raw)) {
+    claim_assert_nonnull(self);
+    let value = ArrListSoA_get(*self, idx, ret_mem);
+    let last = self->len - 1;
+    if (idx != last) {
+        for (usize field_idx = 0; field_idx < self->fields.len; ++field_idx) {
+            let column = ArrListSoA_fieldMut(*self, field_idx);
+            u_memcpy(u_atS(column, idx), u_atS(column, last).as_const);
+        }
+    }
+    self->len -= 1;
+    return value;
+};
+
+// ============================================================================
+// Sorting
+// ============================================================================
+
+/// Compares through the key column and swaps through every column
+typedef struct ArrListSoA__Sort {
+    var_(columns, S$u_S$raw);
+    var_(key, u_S$raw);
+    var_(ordFn, sort_OrdCtxFn);
+    var_(ctx, u_P_const$raw);
+} ArrListSoA__Sort;
+
+$static fn_((ArrListSoA__ordIdx(usize lhs, usize rhs, u_V$raw ctx))(cmp_Ord)) {
+    let sort = u_castV$((ArrListSoA__Sort)(ctx));
+    let lhs_ptr = u_atS(sort.key, lhs).as_const;
+    let rhs_ptr = u_atS(sort.key, rhs).as_const;
+    return invoke(sort.ordFn, u_load(u_deref(lhs_ptr)), u_load(u_deref(rhs_ptr)), u_load(u_deref(sort.ctx)));
+};
+
+$static fn_((ArrListSoA__swapIdx(usize lhs, usize rhs, u_V$raw ctx))(void)) {
+    let sort = u_castV$((ArrListSoA__Sort)(ctx));
+    for_(($s(sort.columns))(column) { mem_swapP(u_atS(*column, lhs), u_atS(*column, rhs)); });
+};
+
+typedef struct ArrListSoA__OrdNoCtx {
+    var_(ordFn, sort_OrdFn);
+} ArrListSoA__OrdNoCtx;
+
+$static fn_((ArrListSoA__ordNoCtx(u_V$raw lhs, u_V$raw rhs, u_V$raw ctx))(cmp_Ord)) {
+    let no_ctx = u_castV$((ArrListSoA__OrdNoCtx)(ctx));
+    return invoke(no_ctx.ordFn, lhs, rhs);
+};
+
+fn_((ArrListSoA_sortByField(ArrListSoA* self, usize field_idx, sort_OrdFn ordFn))(void)) {
+    let_(no_ctx, ArrListSoA__OrdNoCtx) = { .ordFn = ordFn };
+    ArrListSoA_sortByFieldCtx(self, field_idx, wrapFn$(sort_OrdCtxFn, ArrListSoA__ordNoCtx), u_anyP(&no_ctx));
+};
+
+fn_((ArrListSoA_sortByFieldCtx(ArrListSoA* self, usize field_idx, sort_OrdCtxFn ordFn, u_P_const$raw ctx))(void)) {
+    claim_assert_nonnull(self);
+    claim_assert_fmt(field_idx < self->fields.len, "Field index out of bounds: idx({:uz}) >= len({:uz})", field_idx, self->fields.len);
+    if (self->len <= 1) { return; }
+    var_(columns, A$$(ArrListSoA_fields_max, u_S$raw)) = A_zero();
+    let all = u_fieldSlisMut(ArrListSoA__block(*self), self->cap, self->fields, A_ref$((S$u_S$raw)(columns)));
+    let_(sort, ArrListSoA__Sort) = {
+        .columns = prefixS(all, self->fields.len),
+        .key = ArrListSoA_fieldMut(*self, field_idx),
+        .ordFn = ordFn,
+        .ctx = ctx,
+    };
+    let_(idx_ctx, sort_IdxCtx) = {
+        .inner = u_anyP(&sort),
+        .ordFn = wrapFn(ArrListSoA__ordIdx),
+        .swapFn = wrapFn(ArrListSoA__swapIdx),
+    };
+    sort_pdqIdx($rt(self->len), idx_ctx);
+};
@@ -0,0 +1,291 @@
+#include "dh/ArrPQueIdx.h"
+#include "dh/mem/common.h"
+
+$attr($inline_always)
+$static fn_((calcInitCap(TypeInfo type))(usize)) {
+    return as$(usize)(prim_max(1, arch_cache_line_bytes / prim_max(1, type.size)));
+};
+
+$static fn_((growCap(TypeInfo type, usize current, usize minimum))(usize)) {
+    let init_cap = calcInitCap(type);
+    usize grown = current;
+    do { grown = usize_addSat(grown, grown / 2 + init_cap); } while (grown < minimum);
+    return grown;
+};
+
+$attr($inline_always)
+$static fn_((ArrPQueIdx__lt(ArrPQueIdx* self, u_P_const$raw lhs, u_P_const$raw rhs))(bool)) {
+    let l = u_load(u_deref(lhs));
+    let r = u_load(u_deref(rhs));
+    let ordFn = self->ctx->ordFn;
+    let ctx = u_load(u_deref(self->ctx->inner));
+    return u_ordCtx(l, r, ordFn, ctx) == cmp_Ord_lt;
+};
+
+/// Handles and slots share one block of `2 * cap` entries
+$attr($inline_always)
+$static fn_((ArrPQueIdx__index(ArrPQueIdx self))(S$usize)) {
+    return (S$usize){ .ptr = self.handles, .len = self.cap * 2 };
+};
+
+// ============================================================================
+// Heap Operations (d-ary Min-Heap)
+// ============================================================================
+
+$attr($inline_always)
+$static fn_((parentSlot(ArrPQueIdx* self, usize slot))(usize)) {
+    return (slot - 1) >> self->arity_log2;
+};
+
+$attr($inline_always)
+$static fn_((firstChildSlot(ArrPQueIdx* self, usize slot))(usize)) {
+    return (slot << self->arity_log2) + 1;
+};
+
+// Move the element in slot `src` to slot `dst` and record where its handle went
+$attr($inline_always)
+$static fn_((moveSlot(ArrPQueIdx* self, TypeInfo type, usize dst, usize src))(void)) {
+    u_memcpy(u_atS(ArrPQueIdx_itemsMut(*self, type), dst), u_atS(ArrPQueIdx_items(*self, type), src));
+    let handle = self->handles[src];
+    self->handles[dst] = handle;
+    self->slots[handle] = dst;
+};
+
+$attr($inline_always)
+$static fn_((placeSlot(ArrPQueIdx* self, TypeInfo type, usize slot, usize handle, u_P_const$raw item))(void)) {
+    u_memcpy(u_atS(ArrPQueIdx_itemsMut(*self, type), slot), item);
+    self->handles[slot] = handle;
+    self->slots[handle] = slot;
+};
+
+// Sift the hole at `slot` up until `item` fits; `item` must not live in the heap
+$static fn_((siftUp(ArrPQueIdx* self, TypeInfo type, usize slot, usize handle, u_P_const$raw item))(void)) {
+    while (slot > 0) {
+        let parent = parentSlot(self, slot);
+        // If item >= parent (min-heap), we're done
+        if (!ArrPQueIdx__lt(self, item, u_atS(ArrPQueIdx_items(*self, type), parent))) { break; }
+        moveSlot(self, type, slot, parent);
+        slot = parent;
+    }
+    placeSlot(self, type, slot, handle, item);
+};
+
+// Sift the hole at `slot` down, pulling up the smallest child until `item` fits
+$static fn_((siftDown(ArrPQueIdx* self, TypeInfo type, usize slot, usize handle, u_P_const$raw item))(void)) {
+    let len = self->items.len;
+    let arity = lit_n$(usize)(1) << self->arity_log2;
+    while (true) {
+        let first = firstChildSlot(self, slot);
+        if (first >= len) { break; }
+        let end = prim_min(first + arity, len);
+        var best = first;
+        for (usize child = first + 1; child < end; ++child) {
+            let items = ArrPQueIdx_items(*self, type);
+            if (ArrPQueIdx__lt(self, u_atS(items, child), u_atS(items, best))) { best = child; }
+        }
+        // If item <= smallest child, we're done
+        if (!ArrPQueIdx__lt(self, u_atS(ArrPQueIdx_items(*self, type), best), item)) { break; }
+        moveSlot(self, type, slot, best);
+        slot = best;
+    }
+    placeSlot(self, type, slot, handle, item);
+};
+
+// Take the element out of `slot` and refill the hole with the last element
+$static fn_((removeSlot(ArrPQueIdx* self, TypeInfo type, usize slot, u_V$raw ret_mem))(void)) {
+    u_memcpy(ret_mem.ref, u_atS(ArrPQueIdx_items(*self, type), slot));
+    self->slots[self->handles[slot]] = ArrPQueIdx_slot_none;
+    let last_slot = --self->items.len;
+    if (slot == last_slot) { return; }
+    let last = u_deref(u_memcpy(u_allocV(type).ref, u_atS(ArrPQueIdx_items(*self, type), last_slot)));
+    let last_handle = self->handles[last_slot];
+    if (0 < slot && ArrPQueIdx__lt(self, last.ref.as_const, u_atS(ArrPQueIdx_items(*self, type), parentSlot(self, slot)))) {
+        siftUp(self, type, slot, last_handle, last.ref.as_const);
+    } else {
+        siftDown(self, type, slot, last_handle, last.ref.as_const);
+    }
+};
+
+// ============================================================================
+// Core Functions
+// ============================================================================
+
+fn_((ArrPQueIdx_empty(TypeInfo type, u32 arity, P_const$ArrPQue_Ctx ctx))(ArrPQueIdx)) {
+    claim_assert_nonnull(ctx);
+    claim_assert(2 <= arity && (arity & (arity - 1)) == 0);
+    let_ignore = type;
+    return (ArrPQueIdx){
+        .items = zero$S(),
+        .handles = null,
+        .slots = null,
+        .cap = 0,
+        .arity_log2 = as$(u8)(mem_trailingZeros32(arity)),
+        .ctx = ctx,
+        debug_only(.type = type)
+    };
+};
+
+fn_((ArrPQueIdx_init(TypeInfo type, mem_Allocator gpa, usize cap, u32 arity, P_const$ArrPQue_Ctx ctx))(mem_Err$ArrPQueIdx) $scope) {
+    var pq = ArrPQueIdx_empty(type, arity, ctx);
+    try_(ArrPQueIdx_ensureCapPrecise(&pq, type, gpa, cap));
+    return_ok(pq);
+} $unscoped_(fn);
+
+fn_((ArrPQueIdx_fini(ArrPQueIdx* self, TypeInfo type, mem_Allocator gpa))(void)) {
+    claim_assert_nonnull(self);
+    debug_assert_eqBy(self->type, type, TypeInfo_eq);
+    ArrPQueIdx_clearAndFree(self, type, gpa);
+};
+
+fn_((ArrPQueIdx_len(ArrPQueIdx self))(usize)) {
+    return self.items.len;
+};
+
+fn_((ArrPQueIdx_cap(ArrPQueIdx self))(usize)) {
+    return self.cap;
+};
+
+fn_((ArrPQueIdx_arity(ArrPQueIdx self))(u32)) {
+    return as$(u32)(1) << self.arity_log2;
+};
+
+fn_((ArrPQueIdx_isEmpty(ArrPQueIdx self))(bool)) {
+    return self.items.len == 0;
+};
+
+fn_((ArrPQueIdx_contains(ArrPQueIdx self, usize handle))(bool)) {
+    return handle < self.cap && self.slots[handle] != ArrPQueIdx_slot_none;
+};
+
+fn_((ArrPQueIdx_peek(ArrPQueIdx self, TypeInfo type))(O$u_P_const$raw) $scope) {
+    debug_assert_eqBy(self.type, type, TypeInfo_eq);
+    if (self.items.len == 0) { return_none(); }
+    return_some(u_atS(ArrPQueIdx_items(self, type), 0));
+} $unscoped_(fn);
+
+fn_((ArrPQueIdx_peekHandle(ArrPQueIdx self))(O$usize) $scope) {
+    if (self.items.len == 0) { return_none(); }
+    return_some(self.handles[0]);
+} $unscoped_(fn);
+
+fn_((ArrPQueIdx_at(ArrPQueIdx self, TypeInfo type, usize handle))(O$u_P_const$raw) $scope) {
+    debug_assert_eqBy(self.type, type, TypeInfo_eq);
+    if (!ArrPQueIdx_contains(self, handle)) { return_none(); }
+    return_some(u_atS(ArrPQueIdx_items(self, type), self.slots[handle]));
+} $unscoped_(fn);
+
+fn_((ArrPQueIdx_items(ArrPQueIdx self, TypeInfo type))(u_S_const$raw)) {
+    debug_assert_eqBy(self.type, type, TypeInfo_eq);
+    return u_from$S((const type)(self.items.as_const));
+};
+
+fn_((ArrPQueIdx_itemsMut(ArrPQueIdx self, TypeInfo type))(u_S$raw)) {
+    debug_assert_eqBy(self.type, type, TypeInfo_eq);
+    return u_from$S((type)(self.items));
+};
+
+fn_((ArrPQueIdx_ensureCap(ArrPQueIdx* self, TypeInfo type, mem_Allocator gpa, usize new_cap))(mem_Err$void) $scope) {
+    claim_assert_nonnull(self);
+    debug_assert_eqBy(self->type, type, TypeInfo_eq);
+    if (new_cap <= self->cap) { return_ok({}); }
+    return ArrPQueIdx_ensureCapPrecise(self, type, gpa, growCap(type, self->cap, new_cap));
+} $unscoped_(fn);
+
+fn_((ArrPQueIdx_ensureCapPrecise(ArrPQueIdx* self, TypeInfo type, mem_Allocator gpa, usize new_cap))(mem_Err$void) $guard) {
+    claim_assert_nonnull(self);
+    debug_assert_eqBy(self->type, type, TypeInfo_eq);
+    if (new_cap <= self->cap) { return_ok({}); }
+    if (usize_limit_max / 2 < new_cap) { return_err(mem_Err_OutOfMemory()); }
+
+    // Items and the position map move together, so a failed allocation leaves both intact
+    let new_items = try_(mem_Allocator_alloc(gpa, type, new_cap));
+    errdefer_($ignore, mem_Allocator_free(gpa, new_items));
+    let new_index = u_castS$((S$usize)(try_(mem_Allocator_alloc(gpa, typeInfo$(usize), new_cap * 2))));
+    let new_handles = new_index.ptr;
+    let new_slots = new_index.ptr + new_cap;
+    if (self->cap != 0) {
+        u_memcpyS(u_prefixS(new_items, self->items.len), ArrPQueIdx_items(*self, type));
+        prim_memcpy(new_handles, self->handles, self->items.len * sizeOf$(usize));
+        prim_memcpy(new_slots, self->slots, self->cap * sizeOf$(usize));
+        mem_Allocator_free(gpa, u_init$S((type)(self->items.ptr, self->cap)));
+        mem_Allocator_free(gpa, u_anyS(ArrPQueIdx__index(*self)));
+    }
+    for (usize handle = self->cap; handle < new_cap; ++handle) { new_slots[handle] = ArrPQueIdx_slot_none; }
+    self->items.ptr = new_items.ptr;
+    self->handles = new_handles;
+    self->slots = new_slots;
+    self->cap = new_cap;
+    return_ok({});
+} $unguarded_(fn);
+
+fn_((ArrPQueIdx_clearRetainingCap(ArrPQueIdx* self))(void)) {
+    claim_assert_nonnull(self);
+    for (usize slot = 0; slot < self->items.len; ++slot) {
+        self->slots[self->handles[slot]] = ArrPQueIdx_slot_none;
+    }
+    self->items.len = 0;
+};
+
+fn_((ArrPQueIdx_clearAndFree(ArrPQueIdx* self, TypeInfo type, mem_Allocator gpa))(void)) {
+    claim_assert_nonnull(self);
+    debug_assert_eqBy(self->type, type, TypeInfo_eq);
+    if (self->cap != 0) {
+        mem_Allocator_free(gpa, u_init$S((type)(self->items.ptr, self->cap)));
+        mem_Allocator_free(gpa, u_anyS(ArrPQueIdx__index(*self)));
+    }
+    *self = ArrPQueIdx_empty(type, ArrPQueIdx_arity(*self), self->ctx);
+};
+
+// ============================================================================
+// Enqueue, Dequeue and Update Operations
+// ============================================================================
+
+fn_((ArrPQueIdx_enque(ArrPQueIdx* self, mem_Allocator gpa, usize handle, u_V$raw item))(mem_Err$void) $scope) {
+    claim_assert_nonnull(self);
+    let type = item.inner_type;
+    debug_assert_eqBy(self->type, type, TypeInfo_eq);
+    if (self->cap <= handle) { try_(ArrPQueIdx_ensureCap(self, type, gpa, handle + 1)); }
+    return_ok_void(ArrPQueIdx_enqueWithin(self, handle, item));
+} $unscoped_(fn);
+
+fn_((ArrPQueIdx_enqueWithin(ArrPQueIdx* self, usize handle, u_V$raw item))(void)) {
+    claim_assert_nonnull(self);
+    let type = item.inner_type;
+    debug_assert_eqBy(self->type, type, TypeInfo_eq);
+    claim_assert(handle < self->cap);
+    claim_assert(self->slots[handle] == ArrPQueIdx_slot_none);
+    siftUp(self, type, self->items.len++, handle, item.ref.as_const);
+};
+
+fn_((ArrPQueIdx_deque(ArrPQueIdx* self, u_V$raw ret_mem))(O$usize) $scope) {
+    claim_assert_nonnull(self);
+    let type = ret_mem.inner_type;
+    debug_assert_eqBy(self->type, type, TypeInfo_eq);
+    if (self->items.len == 0) { return_none(); }
+    let handle = self->handles[0];
+    removeSlot(self, type, 0, ret_mem);
+    return_some(handle);
+} $unscoped_(fn);
+
+fn_((ArrPQueIdx_remove(ArrPQueIdx* self, usize handle, u_V$raw ret_mem))(O$u_V$raw) $scope) {
+    claim_assert_nonnull(self);
+    let type = ret_mem.inner_type;
+    debug_assert_eqBy(self->type, type, TypeInfo_eq);
+    if (!ArrPQueIdx_contains(*self, handle)) { return_none(); }
+    removeSlot(self, type, self->slots[handle], ret_mem);
+    return_some(ret_mem);
+} $unscoped_(fn);
+
+fn_((ArrPQueIdx_update(ArrPQueIdx* self, usize handle, u_V$raw item))(void)) {
+    claim_assert_nonnull(self);
+    let type = item.inner_type;
+    debug_assert_eqBy(self->type, type, TypeInfo_eq);
+    claim_assert(ArrPQueIdx_contains(*self, handle));
+    let slot = self->slots[handle];
+    // Decrease-key moves toward the root, anything else toward the leaves
+    if (ArrPQueIdx__lt(self, item.ref.as_const, u_atS(ArrPQueIdx_items(*self, type), slot))) {
+        siftUp(self, type, slot, handle, item.ref.as_const);
+    } else {
+        siftDown(self, type, slot, handle, item.ref.as_const);
+    }
+};
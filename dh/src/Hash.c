@@ -0,0 +1,193 @@
+#include "dh/Hash.h"
+#include "dh/mem/common.h"
+
+/*========== Internal Declarations ==========================================*/
+
+#define Hash__use_aes_x86 (Hash_use_aes && arch_is_x86_family && arch_has_sse2)
+#define Hash__use_aes_arm (Hash_use_aes && arch_is_arm_family && arch_has_neon)
+#if Hash__use_aes_x86
+#include <emmintrin.h>
+#include <wmmintrin.h>
+#elif Hash__use_aes_arm
+#include <arm_neon.h>
+#endif
+
+$attr($inline_always)
+$static fn_((Hash__read64(const u8* p))(u64));
+$attr($inline_always)
+$static fn_((Hash__read32(const u8* p))(u64));
+/// Shared tail for inputs of more than 16 bytes; `p`/`len` is the unconsumed suffix
+/// (`len` may be below 16: the final reads then overlap already-absorbed bytes).
+$attr($inline_always)
+$static fn_((Hash__finish(const u8* p, usize len, usize total, u64 seed))(u64));
+/// Scalar 3-lane bulk loop over 48-byte blocks.
+$attr($inline_always)
+$static fn_((Hash__bulk48(const u8** p, usize* len, u64 seed))(u64));
+#if Hash__use_aes_x86 || Hash__use_aes_arm
+/// AES 4-lane bulk loop over 64-byte blocks; leaves at least 1 byte unconsumed.
+$static fn_((Hash__bulkAes(const u8** p, usize* len, u64 seed))(u64));
+#endif /* Hash__use_aes_x86 || Hash__use_aes_arm */
+
+/*========== External Definitions ===========================================*/
+
+fn_((Hash_bytes(S_const$u8 bytes, u64 seed))(u64)) {
+#if Hash__use_aes_x86 || Hash__use_aes_arm
+    if (Hash_aes_threshold_bytes <= bytes.len) {
+        var p = bytes.ptr;
+        var len = bytes.len;
+        seed ^= Hash_mix(seed ^ Hash_secret_0, Hash_secret_1) ^ bytes.len;
+        seed = Hash__bulkAes(&p, &len, seed);
+        if (48 < len) { seed = Hash__bulk48(&p, &len, seed); }
+        return Hash__finish(p, len, bytes.len, seed);
+    }
+#endif /* Hash__use_aes_x86 || Hash__use_aes_arm */
+    return Hash_bytesPortable(bytes, seed);
+};
+
+fn_((Hash_bytesPortable(S_const$u8 bytes, u64 seed))(u64)) {
+    var p = bytes.ptr;
+    var len = bytes.len;
+    seed ^= Hash_mix(seed ^ Hash_secret_0, Hash_secret_1) ^ len;
+    if (len <= 16) {
+        var_(a, u64) = 0;
+        var_(b, u64) = 0;
+        if (4 <= len) {
+            let last = p + len - 4;
+            let delta = (len & 24) >> (len >> 3);
+            a = (Hash__read32(p) << 32) | Hash__read32(last);
+            b = (Hash__read32(p + delta) << 32) | Hash__read32(last - delta);
+        } else if (0 < len) {
+            a = (as$(u64)(p[0]) << 56) | (as$(u64)(p[len >> 1]) << 32) | p[len - 1];
+        }
+        a ^= Hash_secret_1;
+        b ^= seed;
+        Hash_mum(&a, &b);
+        return Hash_mix(a ^ Hash_secret_0 ^ bytes.len, b ^ Hash_secret_1);
+    }
+    if (48 < len) { seed = Hash__bulk48(&p, &len, seed); }
+    return Hash__finish(p, len, bytes.len, seed);
+};
+
+fn_((Hash_val(u_V$raw val, u64 seed))(u64)) {
+    let p = as$(const u8*)(val.inner);
+    switch (val.type.size) {
+    case sizeOf$(u8):
+        return Hash_u8(*p, seed);
+    case sizeOf$(u16):
+        return Hash_u16(as$(u16)(p[0] | (as$(u16)(p[1]) << 8)), seed);
+    case sizeOf$(u32):
+        return Hash_u32(as$(u32)(Hash__read32(p)), seed);
+    case sizeOf$(u64):
+        return Hash_u64(Hash__read64(p), seed);
+    default:
+        return Hash_bytes(slice$P(p, $r(0, val.type.size)), seed);
+    }
+};
+
+/*========== Internal Definitions ===========================================*/
+
+$static fn_((Hash__read64(const u8* p))(u64)) {
+    var_(v, u64) = 0;
+    __builtin_memcpy(&v, p, sizeOf$(u64));
+    return mem_littleToNative64(v);
+};
+
+$static fn_((Hash__read32(const u8* p))(u64)) {
+    var_(v, u32) = 0;
+    __builtin_memcpy(&v, p, sizeOf$(u32));
+    return mem_littleToNative32(v);
+};
+
+$static fn_((Hash__finish(const u8* p, usize len, usize total, u64 seed))(u64)) {
+    if (16 < len) {
+        seed = Hash_mix(Hash__read64(p) ^ Hash_secret_2, Hash__read64(p + 8) ^ seed ^ Hash_secret_1);
+        if (32 < len) {
+            seed = Hash_mix(Hash__read64(p + 16) ^ Hash_secret_2, Hash__read64(p + 24) ^ seed);
+        }
+    }
+    var_(a, u64) = Hash__read64(p + len - 16) ^ Hash_secret_1;
+    var_(b, u64) = Hash__read64(p + len - 8) ^ seed;
+    Hash_mum(&a, &b);
+    return Hash_mix(a ^ Hash_secret_0 ^ total, b ^ Hash_secret_1);
+};
+
+$static fn_((Hash__bulk48(const u8** p, usize* len, u64 seed))(u64)) {
+    var cur = *p;
+    var rem = *len;
+    var see1 = seed;
+    var see2 = seed;
+    while (48 <= rem) {
+        seed = Hash_mix(Hash__read64(cur) ^ Hash_secret_0, Hash__read64(cur + 8) ^ seed);
+        see1 = Hash_mix(Hash__read64(cur + 16) ^ Hash_secret_1, Hash__read64(cur + 24) ^ see1);
+        see2 = Hash_mix(Hash__read64(cur + 32) ^ Hash_secret_2, Hash__read64(cur + 40) ^ see2);
+        cur += 48;
+        rem -= 48;
+    }
+    *p = cur;
+    *len = rem;
+    return seed ^ see1 ^ see2;
+};
+
+#if Hash__use_aes_x86
+
+$static fn_((Hash__bulkAes(const u8** p, usize* len, u64 seed))(u64)) {
+    var cur = *p;
+    var rem = *len;
+    let key = _mm_set_epi64x(as$(i64)(Hash_secret_1), as$(i64)(Hash_secret_0));
+    var s0 = _mm_set_epi64x(as$(i64)(seed), as$(i64)(Hash_secret_0));
+    var s1 = _mm_set_epi64x(as$(i64)(seed ^ Hash_secret_1), as$(i64)(Hash_secret_1));
+    var s2 = _mm_set_epi64x(as$(i64)(seed ^ Hash_secret_2), as$(i64)(Hash_secret_2));
+    var s3 = _mm_set_epi64x(as$(i64)(~seed), as$(i64)(Hash_secret_0 ^ Hash_secret_2));
+    while (64 < rem) {
+        s0 = _mm_aesenc_si128(s0, _mm_loadu_si128(as$(const __m128i*)(cur)));
+        s1 = _mm_aesenc_si128(s1, _mm_loadu_si128(as$(const __m128i*)(cur + 16)));
+        s2 = _mm_aesenc_si128(s2, _mm_loadu_si128(as$(const __m128i*)(cur + 32)));
+        s3 = _mm_aesenc_si128(s3, _mm_loadu_si128(as$(const __m128i*)(cur + 48)));
+        cur += 64;
+        rem -= 64;
+    }
+    /* Two full rounds per lane so a single block diffuses across all 16 bytes */
+    s0 = _mm_aesenc_si128(_mm_aesenc_si128(s0, s1), key);
+    s2 = _mm_aesenc_si128(_mm_aesenc_si128(s2, s3), key);
+    s0 = _mm_aesenc_si128(_mm_aesenc_si128(s0, s2), key);
+    *p = cur;
+    *len = rem;
+    let lo = as$(u64)(_mm_cvtsi128_si64(s0));
+    let hi = as$(u64)(_mm_cvtsi128_si64(_mm_unpackhi_epi64(s0, s0)));
+    return Hash_mix(lo ^ Hash_secret_2, hi ^ seed);
+};
+
+#elif Hash__use_aes_arm
+
+/// Equivalent of x86 `aesenc(state, key)` built from ARMv8 AESE (xor+sub+shift) and AESMC.
+$attr($inline_always)
+$static fn_((Hash__aesenc(uint8x16_t state, uint8x16_t key))(uint8x16_t)) {
+    return veorq_u8(vaesmcq_u8(vaeseq_u8(state, vdupq_n_u8(0))), key);
+};
+
+$static fn_((Hash__bulkAes(const u8** p, usize* len, u64 seed))(u64)) {
+    var cur = *p;
+    var rem = *len;
+    let key = vreinterpretq_u8_u64(vcombine_u64(vcreate_u64(Hash_secret_0), vcreate_u64(Hash_secret_1)));
+    var s0 = vreinterpretq_u8_u64(vcombine_u64(vcreate_u64(Hash_secret_0), vcreate_u64(seed)));
+    var s1 = vreinterpretq_u8_u64(vcombine_u64(vcreate_u64(Hash_secret_1), vcreate_u64(seed ^ Hash_secret_1)));
+    var s2 = vreinterpretq_u8_u64(vcombine_u64(vcreate_u64(Hash_secret_2), vcreate_u64(seed ^ Hash_secret_2)));
+    var s3 = vreinterpretq_u8_u64(vcombine_u64(vcreate_u64(Hash_secret_0 ^ Hash_secret_2), vcreate_u64(~seed)));
+    while (64 < rem) {
+        s0 = Hash__aesenc(s0, vld1q_u8(cur));
+        s1 = Hash__aesenc(s1, vld1q_u8(cur + 16));
+        s2 = Hash__aesenc(s2, vld1q_u8(cur + 32));
+        s3 = Hash__aesenc(s3, vld1q_u8(cur + 48));
+        cur += 64;
+        rem -= 64;
+    }
+    s0 = Hash__aesenc(Hash__aesenc(s0, s1), key);
+    s2 = Hash__aesenc(Hash__aesenc(s2, s3), key);
+    s0 = Hash__aesenc(Hash__aesenc(s0, s2), key);
+    *p = cur;
+    *len = rem;
+    let lanes = vreinterpretq_u64_u8(s0);
+    return Hash_mix(vgetq_lane_u64(lanes, 0) ^ Hash_secret_2, vgetq_lane_u64(lanes, 1) ^ seed);
+};
+
+#endif /* Hash__use_aes_arm */
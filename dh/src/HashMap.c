@@ -1,5 +1,6 @@
 #include "dh/HashMap.h"
 #include "dh/meta.h"
+#include "dh/Hash.h"
 
 /*========== SIMD Configuration =============================================*/
 
@@ -117,15 +118,33 @@ fn_((HashMap_Ensured_foundExistingMut(
 
 fn_((HashMap_HashFn_default(u_V$raw val, u_V$raw ctx))(u64)) {
     let_ignore = ctx;
-    // Wyhash-like mixing for general purpose hashing
-    // Uses FNV-1a as a simple but effective default
-    let bytes = slice$P(as$(const u8*)(val.inner), $r(0, val.type.size));
-    var_(hash, u64) = 0xcbf29ce484222325ull; // FNV offset basis
-    for_(($s(bytes))(byte) {
-        hash ^= *byte;
-        hash *= 0x100000001b3ull; // FNV prime
-    });
-    return hash;
+    return Hash_val(val, Hash_seed_default);
+};
+
+fn_((HashMap_HashFn_u8(u_V$raw val, u_V$raw ctx))(u64)) {
+    let_ignore = ctx;
+    return Hash_u8(*as$(const u8*)(val.inner), Hash_seed_default);
+};
+
+fn_((HashMap_HashFn_u16(u_V$raw val, u_V$raw ctx))(u64)) {
+    let_ignore = ctx;
+    return Hash_u16(*as$(const u16*)(val.inner), Hash_seed_default);
+};
+
+fn_((HashMap_HashFn_u32(u_V$raw val, u_V$raw ctx))(u64)) {
+    let_ignore = ctx;
+    return Hash_u32(*as$(const u32*)(val.inner), Hash_seed_default);
+};
+
+fn_((HashMap_HashFn_u64(u_V$raw val, u_V$raw ctx))(u64)) {
+    let_ignore = ctx;
+    return Hash_u64(*as$(const u64*)(val.inner), Hash_seed_default);
+};
+
+fn_((HashMap_HashFn_str(u_V$raw val, u_V$raw ctx))(u64)) {
+    let_ignore = ctx;
+    debug_assert_eqBy(val.type, typeInfo$(S_const$u8), TypeInfo_eq);
+    return Hash_bytes(*as$(const S_const$u8*)(val.inner), Hash_seed_default);
 };
 
 fn_((HashMap_EqlFn_default(u_V$raw lhs, u_V$raw rhs, u_V$raw ctx))(bool)) {
@@ -133,6 +152,31 @@ fn_((HashMap_EqlFn_default(u_V$raw lhs, u_V$raw rhs, u_V$raw ctx))(bool)) {
     return u_eql(lhs, rhs);
 };
 
+fn_((HashMap_EqlFn_u8(u_V$raw lhs, u_V$raw rhs, u_V$raw ctx))(bool)) {
+    let_ignore = ctx;
+    return *as$(const u8*)(lhs.inner) == *as$(const u8*)(rhs.inner);
+};
+
+fn_((HashMap_EqlFn_u16(u_V$raw lhs, u_V$raw rhs, u_V$raw ctx))(bool)) {
+    let_ignore = ctx;
+    return *as$(const u16*)(lhs.inner) == *as$(const u16*)(rhs.inner);
+};
+
+fn_((HashMap_EqlFn_u32(u_V$raw lhs, u_V$raw rhs, u_V$raw ctx))(bool)) {
+    let_ignore = ctx;
+    return *as$(const u32*)(lhs.inner) == *as$(const u32*)(rhs.inner);
+};
+
+fn_((HashMap_EqlFn_u64(u_V$raw lhs, u_V$raw rhs, u_V$raw ctx))(bool)) {
+    let_ignore = ctx;
+    return *as$(const u64*)(lhs.inner) == *as$(const u64*)(rhs.inner);
+};
+
+fn_((HashMap_EqlFn_str(u_V$raw lhs, u_V$raw rhs, u_V$raw ctx))(bool)) {
+    let_ignore = ctx;
+    return mem_eqlBytes(*as$(const S_const$u8*)(lhs.inner), *as$(const S_const$u8*)(rhs.inner));
+};
+
 fn_((HashMap_Ctx_default(void))(P_const$HashMap_Ctx)) {
     $static let_(default_ctx_inner, Void) = {};
     $static let_(default_ctx, HashMap_Ctx) = {
@@ -143,6 +187,32 @@ fn_((HashMap_Ctx_default(void))(P_const$HashMap_Ctx)) {
     return &default_ctx;
 };
 
+fn_((HashMap_Ctx_for(TypeInfo key_ty))(P_const$HashMap_Ctx)) {
+    $static let_(ctx_inner, Void) = {};
+    $static let_(ctxs, A$$(4, HashMap_Ctx)) = A_init({
+        [0] = { .inner = u_anyP(&ctx_inner), .hashFn = HashMap_HashFn_u8, .eqlFn = HashMap_EqlFn_u8 },
+        [1] = { .inner = u_anyP(&ctx_inner), .hashFn = HashMap_HashFn_u16, .eqlFn = HashMap_EqlFn_u16 },
+        [2] = { .inner = u_anyP(&ctx_inner), .hashFn = HashMap_HashFn_u32, .eqlFn = HashMap_EqlFn_u32 },
+        [3] = { .inner = u_anyP(&ctx_inner), .hashFn = HashMap_HashFn_u64, .eqlFn = HashMap_EqlFn_u64 },
+    });
+    /* Only integer-like keys (power-of-two size up to 8 with natural alignment) get
+     * the fixed-width paths; everything else keeps the generic byte-wise context. */
+    if (key_ty.size == 0 || sizeOf$(u64) < key_ty.size) { return HashMap_Ctx_default(); }
+    if ((key_ty.size & (key_ty.size - 1)) != 0) { return HashMap_Ctx_default(); }
+    if (mem_log2ToAlign(key_ty.align) != key_ty.size) { return HashMap_Ctx_default(); }
+    return A_at((ctxs)[mem_trailingZeros64(key_ty.size)]);
+};
+
+fn_((HashMap_Ctx_str(void))(P_const$HashMap_Ctx)) {
+    $static let_(str_ctx_inner, Void) = {};
+    $static let_(str_ctx, HashMap_Ctx) = {
+        .inner = u_anyP(&str_ctx_inner),
+        .hashFn = HashMap_HashFn_str,
+        .eqlFn = HashMap_EqlFn_str,
+    };
+    return &str_ctx;
+};
+
 $static fn_((HashMap__header(HashMap self))(HashMap_Header*)) {
     let metadata_ptr = unwrap_(self.metadata);
     return ptrAlignCast$((HashMap_Header*)((as$(u8*)(metadata_ptr)) - sizeOf$(HashMap_Header)));
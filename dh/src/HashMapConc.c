@@ -0,0 +1,340 @@
+#include "dh/HashMapConc.h"
+#include "dh/Thrd/common.h"
+
+/*========== Internal Declarations ==========================================*/
+
+#define HashMapConc__reader_slot_count /*:usize*/ (128)
+
+/* Announcement slot of one reading thread */
+typedef struct HashMapConc__Reader {
+    var_(_avoid_false_sharing, Void) $align(arch_cache_line_bytes);
+    /// Epoch read when the current lookup began, or 0 between lookups.
+    var_(epoch, atom_V$usize);
+    var_(in_use, atom_V$u32);
+} HashMapConc__Reader;
+/* Shared by every map: bumped each time a table is retired */
+$static var_(HashMapConc__epoch, atom_V$usize) = atom_V_init(1);
+$static var_(HashMapConc__readers, A$$(HashMapConc__reader_slot_count, HashMapConc__Reader)) = A_zero();
+/* Lookups of threads that found every slot taken; any of them holds back reclamation */
+$static var_(HashMapConc__overflow_readers, atom_V$usize) = {};
+$static $Thrd_local var_(HashMapConc__reader, HashMapConc__Reader*) = null;
+$static $Thrd_local var_(HashMapConc__reader_tried, bool) = false;
+$static $Thrd_local var_(HashMapConc__exit_hook, Thrd_ExitHook) = {};
+
+/// Announces the calling thread as a reader; returns its slot (null for overflow).
+$attr($inline_always)
+$static fn_((HashMapConc__enter(void))(HashMapConc__Reader*));
+$attr($inline_always)
+$static fn_((HashMapConc__leave(HashMapConc__Reader* reader))(void));
+$static fn_((HashMapConc__claimReader(void))(HashMapConc__Reader*));
+$static fn_((HashMapConc__releaseReader(void))(void));
+/// Oldest epoch announced by an active reader (`usize_limit_max` with none).
+$static fn_((HashMapConc__oldestEpoch(void))(usize));
+/// Frees the retired tables of `shard` older than every active reader. Caller holds `shard->mtx`.
+$static fn_((HashMapConc__reclaimShard(
+    HashMapConc_Shard* shard, TypeInfo key_ty, TypeInfo val_ty, mem_Allocator gpa
+))(void));
+
+$attr($inline_always)
+$static fn_((HashMapConc__shardFor(HashMapConc self, u_V$raw key))(HashMapConc_Shard*));
+/// Waits out an active writer and returns the even sequence to validate against.
+$attr($inline_always)
+$static fn_((HashMapConc__readBegin(const HashMapConc_Shard* shard))(u32));
+$attr($inline_always)
+$static fn_((HashMapConc__readRetry(const HashMapConc_Shard* shard, u32 seq))(bool));
+$attr($inline_always)
+$static fn_((HashMapConc__writeBegin(HashMapConc_Shard* shard))(void));
+$attr($inline_always)
+$static fn_((HashMapConc__writeEnd(HashMapConc_Shard* shard))(void));
+/// Builds a doubled table for `shard` outside the seqlock window; the old table is retired.
+$attr($must_check)
+$static fn_((HashMapConc__grow(
+    HashMapConc_Shard* shard, TypeInfo key_ty, TypeInfo val_ty, mem_Allocator gpa
+))(mem_Err$void));
+$static fn_((HashMapConc__finiShards(
+    S$HashMapConc_Shard shards, TypeInfo key_ty, TypeInfo val_ty, mem_Allocator gpa
+))(void));
+
+/*========== External Definitions ===========================================*/
+
+fn_((HashMapConc_init(
+    TypeInfo key_ty, TypeInfo val_ty, P_const$HashMap_Ctx ctx, mem_Allocator gpa, u32 shard_count, u32 cap
+))(mem_Err$HashMapConc) $guard) {
+    claim_assert_nonnull(ctx);
+    var_(count, u32) = shard_count == 0 ? HashMapConc_default_shard_count : shard_count;
+    if ((count & (count - 1)) != 0) { count = as$(u32)(1) << (32 - mem_leadingZeros32(count)); }
+
+    let shards = u_castS$((S$HashMapConc_Shard)(try_(mem_Allocator_alloc(gpa, typeInfo$(HashMapConc_Shard), count))));
+    var_(inited, usize) = 0;
+    errdefer_($ignore, mem_Allocator_free(gpa, u_anyS(shards)));
+    errdefer_($ignore, HashMapConc__finiShards(slice$S(shards, $r(0, inited)), key_ty, val_ty, gpa));
+
+    let per_shard = prim_max(cap / count, HashMap_default_min_cap);
+    for_(($s(shards))(shard) {
+        asg_lit((shard)({
+            .seq = atom_V_init(0),
+            .mtx = Thrd_Mtx_init(),
+            .map = try_(HashMap_init(key_ty, val_ty, ctx, gpa, per_shard)),
+            .retired = null,
+            .removed = 0,
+        }));
+        inited++;
+    });
+    return_ok({
+        .shards = shards,
+        .ctx = ctx,
+        debug_only(.key_ty = key_ty, .val_ty = val_ty)
+    });
+} $unguarded_(fn);
+
+fn_((HashMapConc_fini(
+    HashMapConc* self, TypeInfo key_ty, TypeInfo val_ty, mem_Allocator gpa
+))(void)) {
+    claim_assert_nonnull(self);
+    debug_assert_eqBy(self->key_ty, key_ty, TypeInfo_eq);
+    debug_assert_eqBy(self->val_ty, val_ty, TypeInfo_eq);
+    HashMapConc__finiShards(self->shards, key_ty, val_ty, gpa);
+    mem_Allocator_free(gpa, u_anyS(self->shards));
+    self->shards = (S$HashMapConc_Shard){};
+};
+
+fn_((HashMapConc_reclaim(
+    HashMapConc self, TypeInfo key_ty, TypeInfo val_ty, mem_Allocator gpa
+))(void)) {
+    debug_assert_eqBy(self.key_ty, key_ty, TypeInfo_eq);
+    debug_assert_eqBy(self.val_ty, val_ty, TypeInfo_eq);
+    for_(($s(self.shards))(shard) {
+        Thrd_Mtx_lock(&shard->mtx);
+        HashMapConc__reclaimShard(shard, key_ty, val_ty, gpa);
+        Thrd_Mtx_unlock(&shard->mtx);
+    });
+};
+
+fn_((HashMapConc_count(HashMapConc self))(usize)) {
+    var_(total, usize) = 0;
+    for_(($s(self.shards))(shard) {
+        total += atom_load(&shard->map.size, atom_MemOrd_monotonic);
+    });
+    return total;
+};
+
+fn_((HashMapConc_by(HashMapConc self, u_V$raw key, u_V$raw ret_mem))(O$u_V$raw)) {
+    debug_assert_eqBy(self.key_ty, key.type, TypeInfo_eq);
+    debug_assert_eqBy(self.val_ty, ret_mem.type, TypeInfo_eq);
+    let shard = HashMapConc__shardFor(self, key);
+    let reader = HashMapConc__enter();
+    while (true) {
+        let seq = HashMapConc__readBegin(shard);
+        let map = shard->map;
+        let found = HashMap_by(map, key, ret_mem);
+        if (!HashMapConc__readRetry(shard, seq)) {
+            HashMapConc__leave(reader);
+            return found;
+        }
+    }
+};
+
+fn_((HashMapConc_contains(HashMapConc self, TypeInfo val_ty, u_V$raw key))(bool)) {
+    debug_assert_eqBy(self.key_ty, key.type, TypeInfo_eq);
+    debug_assert_eqBy(self.val_ty, val_ty, TypeInfo_eq);
+    let shard = HashMapConc__shardFor(self, key);
+    let reader = HashMapConc__enter();
+    while (true) {
+        let seq = HashMapConc__readBegin(shard);
+        let map = shard->map;
+        let found = HashMap_contains(map, val_ty, key);
+        if (!HashMapConc__readRetry(shard, seq)) {
+            HashMapConc__leave(reader);
+            return found;
+        }
+    }
+};
+
+fn_((HashMapConc_put(HashMapConc self, mem_Allocator gpa, u_V$raw key, u_V$raw val))(mem_Err$void) $guard) {
+    debug_assert_eqBy(self.key_ty, key.type, TypeInfo_eq);
+    debug_assert_eqBy(self.val_ty, val.type, TypeInfo_eq);
+    let shard = HashMapConc__shardFor(self, key);
+    Thrd_Mtx_lock(&shard->mtx);
+    defer_(Thrd_Mtx_unlock(&shard->mtx));
+    if (shard->removed > HashMap_cap(shard->map) / 4) {
+        /* Tombstones lengthen every probe and never free up on their own */
+        HashMapConc__writeBegin(shard);
+        HashMap_rehash(&shard->map, key.type, val.type);
+        HashMapConc__writeEnd(shard);
+        shard->removed = 0;
+    }
+    if (shard->map.available == 0 && !HashMap_contains(shard->map, val.type, key)) {
+        try_(HashMapConc__grow(shard, key.type, val.type, gpa));
+        HashMapConc__reclaimShard(shard, key.type, val.type, gpa);
+    }
+    HashMapConc__writeBegin(shard);
+    HashMap_putWithin(&shard->map, key, val);
+    HashMapConc__writeEnd(shard);
+    return_ok({});
+} $unguarded_(fn);
+
+fn_((HashMapConc_remove(HashMapConc self, TypeInfo val_ty, u_V$raw key))(bool)) {
+    debug_assert_eqBy(self.key_ty, key.type, TypeInfo_eq);
+    debug_assert_eqBy(self.val_ty, val_ty, TypeInfo_eq);
+    let shard = HashMapConc__shardFor(self, key);
+    Thrd_Mtx_lock(&shard->mtx);
+    /* Probe under the lock first so misses never disturb readers */
+    var_(removed, bool) = false;
+    if (HashMap_contains(shard->map, val_ty, key)) {
+        HashMapConc__writeBegin(shard);
+        removed = HashMap_remove(&shard->map, val_ty, key);
+        HashMapConc__writeEnd(shard);
+        shard->removed++;
+    }
+    Thrd_Mtx_unlock(&shard->mtx);
+    return removed;
+};
+
+/*========== Internal Definitions ===========================================*/
+
+$static fn_((HashMapConc__shardFor(HashMapConc self, u_V$raw key))(HashMapConc_Shard*)) {
+    let ctx = self.ctx;
+    let hash = ctx->hashFn(key, u_load(u_deref(ctx->inner)));
+    /* Bits above the slot index and below the 7-bit fingerprint */
+    return self.shards.ptr + ((hash >> 32) & (self.shards.len - 1));
+};
+
+$static fn_((HashMapConc__readBegin(const HashMapConc_Shard* shard))(u32)) {
+    while (true) {
+        let seq = atom_V_load(&shard->seq, atom_MemOrd_acquire);
+        if ((seq & 1) == 0) { return seq; }
+        atom_spinLoopHint();
+    }
+};
+
+$static fn_((HashMapConc__readRetry(const HashMapConc_Shard* shard, u32 seq))(bool)) {
+    atom_fence(atom_MemOrd_acquire);
+    return atom_V_load(&shard->seq, atom_MemOrd_monotonic) != seq;
+};
+
+$static fn_((HashMapConc__writeBegin(HashMapConc_Shard* shard))(void)) {
+    atom_V_fetchAdd(&shard->seq, 1, atom_MemOrd_monotonic);
+    atom_fence(atom_MemOrd_release);
+};
+
+$static fn_((HashMapConc__writeEnd(HashMapConc_Shard* shard))(void)) {
+    atom_V_fetchAdd(&shard->seq, 1, atom_MemOrd_release);
+};
+
+$static fn_((HashMapConc__enter(void))(HashMapConc__Reader*)) {
+    var reader = HashMapConc__reader;
+    if ($branch_unlikely(reader == null)) { reader = HashMapConc__claimReader(); }
+    if ($branch_likely(reader != null)) {
+        /* Acquire: a bumped epoch implies the table retired before it is unpublished */
+        atom_V_store(&reader->epoch, atom_V_load(&HashMapConc__epoch, atom_MemOrd_acquire), atom_MemOrd_monotonic);
+    } else {
+        atom_V_fetchAdd(&HashMapConc__overflow_readers, 1, atom_MemOrd_monotonic);
+    }
+    /* Pairs with the fence in `HashMapConc__oldestEpoch`: either the reclaimer sees
+     * this announcement, or this reader sees the table that replaced the retired one */
+    atom_fence(atom_MemOrd_seq_cst);
+    return reader;
+};
+
+$static fn_((HashMapConc__leave(HashMapConc__Reader* reader))(void)) {
+    if ($branch_likely(reader != null)) {
+        atom_V_store(&reader->epoch, 0, atom_MemOrd_release);
+    } else {
+        atom_V_fetchSub(&HashMapConc__overflow_readers, 1, atom_MemOrd_release);
+    }
+};
+
+$static fn_((HashMapConc__claimReader(void))(HashMapConc__Reader*)) {
+    if (HashMapConc__reader_tried) { return null; }
+    HashMapConc__reader_tried = true;
+    for_(($s(A_ref(HashMapConc__readers)))(slot) {
+        if (atom_V_load(&slot->in_use, atom_MemOrd_monotonic) != 0) { continue; }
+        if (isNone(atom_V_cmpXchgStrong(&slot->in_use, 0, 1, atom_MemOrd_acquire, atom_MemOrd_monotonic))) {
+            HashMapConc__reader = slot;
+            HashMapConc__exit_hook.fn = HashMapConc__releaseReader;
+            Thrd_onExit(&HashMapConc__exit_hook);
+            return slot;
+        }
+    });
+    return null;
+};
+
+$static fn_((HashMapConc__releaseReader(void))(void)) {
+    let reader = HashMapConc__reader;
+    HashMapConc__reader = null;
+    atom_V_store(&reader->in_use, 0, atom_MemOrd_release);
+};
+
+$static fn_((HashMapConc__oldestEpoch(void))(usize)) {
+    atom_fence(atom_MemOrd_seq_cst);
+    if (atom_V_load(&HashMapConc__overflow_readers, atom_MemOrd_acquire) != 0) { return 0; }
+    var_(oldest, usize) = usize_limit_max;
+    for_(($s(A_ref(HashMapConc__readers)))(slot) {
+        let epoch = atom_V_load(&slot->epoch, atom_MemOrd_acquire);
+        if (epoch != 0 && epoch < oldest) { oldest = epoch; }
+    });
+    return oldest;
+};
+
+$static fn_((HashMapConc__reclaimShard(
+    HashMapConc_Shard* shard, TypeInfo key_ty, TypeInfo val_ty, mem_Allocator gpa
+))(void)) {
+    if (shard->retired == null) { return; }
+    let oldest = HashMapConc__oldestEpoch();
+    var_(link, HashMapConc_Retired**) = &shard->retired;
+    while (*link != null) {
+        let node = *link;
+        if (node->epoch >= oldest) {
+            link = &node->next;
+            continue;
+        }
+        *link = node->next;
+        HashMap_fini(&node->map, key_ty, val_ty, gpa);
+        mem_Allocator_destroy(gpa, u_anyP(node));
+    }
+};
+
+$static fn_((HashMapConc__grow(
+    HashMapConc_Shard* shard, TypeInfo key_ty, TypeInfo val_ty, mem_Allocator gpa
+))(mem_Err$void) $guard) {
+    let node = u_castP$((HashMapConc_Retired*)(try_(mem_Allocator_create(gpa, typeInfo$(HashMapConc_Retired)))));
+    errdefer_($ignore, mem_Allocator_destroy(gpa, u_anyP(node)));
+
+    var grown = try_(HashMap_init(key_ty, val_ty, shard->map.ctx, gpa, prim_max(HashMap_count(shard->map) * 2, HashMap_default_min_cap)));
+    var it = HashMap_iter(&shard->map, key_ty, val_ty);
+    while_some(HashMap_Iter_next(&it, key_ty, val_ty), entry) {
+        HashMap_putNoClobberWithin(
+            &grown,
+            u_load(u_deref(HashMap_Entry_key(entry, key_ty))),
+            u_load(u_deref(HashMap_Entry_val(entry, val_ty)))
+        );
+    }
+
+    /* Publishing is a single struct store inside the write window; readers
+     * either validate against the old table or retry onto the new one. */
+    node->map = shard->map;
+    node->next = shard->retired;
+    shard->retired = node;
+    HashMapConc__writeBegin(shard);
+    shard->map = grown;
+    HashMapConc__writeEnd(shard);
+    node->epoch = atom_V_fetchAdd(&HashMapConc__epoch, 1, atom_MemOrd_seq_cst);
+    shard->removed = 0;
+    return_ok({});
+} $unguarded_(fn);
+
+$static fn_((HashMapConc__finiShards(
+    S$HashMapConc_Shard shards, TypeInfo key_ty, TypeInfo val_ty, mem_Allocator gpa
+))(void)) {
+    for_(($s(shards))(shard) {
+        var retired = shard->retired;
+        while (retired != null) {
+            let next = retired->next;
+            HashMap_fini(&retired->map, key_ty, val_ty, gpa);
+            mem_Allocator_destroy(gpa, u_anyP(retired));
+            retired = next;
+        }
+        HashMap_fini(&shard->map, key_ty, val_ty, gpa);
+        Thrd_Mtx_fini(&shard->mtx);
+    });
+};
@@ -89,6 +89,14 @@ fn_((HashSet_Ctx_default(void))(P_const$HashSet_Ctx)) {
     return HashMap_Ctx_default();
 };
 
+fn_((HashSet_Ctx_for(TypeInfo key_ty))(P_const$HashSet_Ctx)) {
+    return HashMap_Ctx_for(key_ty);
+};
+
+fn_((HashSet_Ctx_str(void))(P_const$HashSet_Ctx)) {
+    return HashMap_Ctx_str();
+};
+
 $static fn_((HashSet__header(HashSet self))(HashSet_Header*)) {
     let metadata_ptr = unwrap_(self.metadata);
     return ptrAlignCast$((HashSet_Header*)((as$(u8*)(metadata_ptr)) - sizeOf$(HashSet_Header)));
@@ -0,0 +1,400 @@
+#include "dh/Thrd/Chan.h"
+
+/*========== Internal Declarations ==========================================*/
+
+$attr($inline_always)
+$static fn_((Thrd_Chan__slotAt(const Thrd_Chan* self, usize pos))(u8*));
+$attr($inline_always)
+$static fn_((Thrd_Chan__seqAt(u8* slot))(atom_V$usize*));
+$attr($inline_always)
+$static fn_((Thrd_Chan__elemAt(const Thrd_Chan* self, u8* slot))(u_P$raw));
+
+/* Vyukov MPMC: a slot is free for position `pos` when its sequence equals `pos`,
+ * and holds the value of `pos` when its sequence equals `pos + 1` */
+$static fn_((Thrd_Chan__mpmc_trySend(Thrd_Chan* self, u_P_const$raw item))(bool));
+$static fn_((Thrd_Chan__mpmc_tryRecv(Thrd_Chan* self, u_P$raw ret))(bool));
+$static fn_((Thrd_Chan__mpmc_trySendS(Thrd_Chan* self, u_S_const$raw items))(usize));
+$static fn_((Thrd_Chan__mpmc_tryRecvS(Thrd_Chan* self, u_S$raw buf))(usize));
+/* SPSC: each side owns one index and caches the other */
+$static fn_((Thrd_Chan__spsc_trySendS(Thrd_Chan* self, u_S_const$raw items))(usize));
+$static fn_((Thrd_Chan__spsc_tryRecvS(Thrd_Chan* self, u_S$raw buf))(usize));
+
+$attr($inline_always)
+$static fn_((Thrd_Chan__trySendS(Thrd_Chan* self, u_S_const$raw items))(usize));
+$attr($inline_always)
+$static fn_((Thrd_Chan__tryRecvS(Thrd_Chan* self, u_S$raw buf))(usize));
+/// Wakes up to `count` parked waiters on `seq` if any are registered.
+$attr($inline_always)
+$static fn_((Thrd_Chan__notify(atom_V$u32* seq, atom_V$u32* waiters, u32 count))(void));
+$static fn_((Thrd_Chan__recvUntil(Thrd_Chan* self, u_S$raw buf, O$time_Duration timeout))(Thrd_Chan_Err$usize));
+
+/*========== External Definitions ===========================================*/
+
+fn_((Thrd_Chan_init(TypeInfo elem_ty, mem_Allocator gpa, usize cap, Thrd_Chan_Mode mode))(mem_Err$Thrd_Chan) $scope) {
+    claim_assert(0 < elem_ty.size);
+    var_(slot_count, usize) = prim_max(cap, as$(usize)(2));
+    if ((slot_count & (slot_count - 1)) != 0) {
+        slot_count = as$(usize)(1) << (64 - mem_leadingZeros64(as$(u64)(slot_count)));
+    }
+    let slot_align = mode == Thrd_Chan_Mode_mpmc ? prim_max(elem_ty.align, alignOf$(usize)) : elem_ty.align;
+    let elem_offset = mode == Thrd_Chan_Mode_mpmc ? mem_alignFwdLog2(sizeOf$(usize), elem_ty.align) : 0;
+    let stride = mem_alignFwdLog2(elem_offset + elem_ty.size, slot_align);
+    let byte_count = orelse_((usize_mulChkd(stride, slot_count))(return_err(mem_Err_OutOfMemory())));
+    let mem = orelse_((mem_Allocator_rawAlloc(gpa, byte_count, slot_align))(return_err(mem_Err_OutOfMemory())));
+
+    var chan = lit0$((Thrd_Chan));
+    chan.tail = atom_V_init(0);
+    chan.head_cache = 0;
+    chan.head = atom_V_init(0);
+    chan.tail_cache = 0;
+    chan.recv_seq = atom_V_init(0);
+    chan.recv_waiters = atom_V_init(0);
+    chan.send_seq = atom_V_init(0);
+    chan.send_waiters = atom_V_init(0);
+    chan.is_closed = atom_V_init(0);
+    chan.slots = init$S$((u8)(mem, byte_count));
+    chan.stride = stride;
+    chan.elem_offset = elem_offset;
+    chan.mask = slot_count - 1;
+    chan.elem_ty = elem_ty;
+    chan.mode = mode;
+    if (mode == Thrd_Chan_Mode_mpmc) {
+        for_(($r(0, slot_count))(pos) {
+            atom_V_store(Thrd_Chan__seqAt(Thrd_Chan__slotAt(&chan, pos)), pos, atom_MemOrd_monotonic);
+        });
+    }
+    return_ok(chan);
+} $unscoped_(fn);
+
+fn_((Thrd_Chan_fini(Thrd_Chan* self, TypeInfo elem_ty, mem_Allocator gpa))(void)) {
+    claim_assert_nonnull(self);
+    debug_assert_eqBy(self->elem_ty, elem_ty, TypeInfo_eq);
+    let slot_align = self->mode == Thrd_Chan_Mode_mpmc ? prim_max(elem_ty.align, alignOf$(usize)) : elem_ty.align;
+    mem_Allocator_rawFree(gpa, self->slots, slot_align);
+    self->slots = (S$u8){};
+};
+
+fn_((Thrd_Chan_close(Thrd_Chan* self))(void)) {
+    claim_assert_nonnull(self);
+    atom_V_store(&self->is_closed, 1, atom_MemOrd_seq_cst);
+    atom_V_fetchAdd(&self->recv_seq, 1, atom_MemOrd_release);
+    atom_V_fetchAdd(&self->send_seq, 1, atom_MemOrd_release);
+    Thrd_Ftx_wake(&self->recv_seq, u32_limit_max);
+    Thrd_Ftx_wake(&self->send_seq, u32_limit_max);
+};
+
+fn_((Thrd_Chan_isClosed(const Thrd_Chan* self))(bool)) {
+    return atom_V_load(&self->is_closed, atom_MemOrd_acquire) != 0;
+};
+
+fn_((Thrd_Chan_cap(const Thrd_Chan* self))(usize)) {
+    return self->mask + 1;
+};
+
+fn_((Thrd_Chan_len(const Thrd_Chan* self))(usize)) {
+    let head = atom_V_load(&self->head, atom_MemOrd_acquire);
+    let tail = atom_V_load(&self->tail, atom_MemOrd_acquire);
+    /* Both loads race with the other side; clamp the transient skew */
+    let len = as$(isize)(tail - head);
+    return len <= 0 ? 0 : prim_min(as$(usize)(len), self->mask + 1);
+};
+
+fn_((Thrd_Chan_trySend(Thrd_Chan* self, u_V$raw item))(Thrd_Chan_Err$bool) $scope) {
+    debug_assert_eqBy(self->elem_ty, item.inner_type, TypeInfo_eq);
+    if (Thrd_Chan_isClosed(self)) { return_err(Thrd_Chan_Err_Closed()); }
+    if (self->mode == Thrd_Chan_Mode_mpmc) {
+        if (!Thrd_Chan__mpmc_trySend(self, item.ref.as_const)) { return_ok(false); }
+        Thrd_Chan__notify(&self->recv_seq, &self->recv_waiters, 1);
+        return_ok(true);
+    }
+    let items = (u_S_const$raw){ .ptr = item.inner, .len = 1, .type = item.inner_type };
+    return_ok(Thrd_Chan__spsc_trySendS(self, items) == 1);
+} $unscoped_(fn);
+
+fn_((Thrd_Chan_send(Thrd_Chan* self, u_V$raw item))(Thrd_Chan_Err$void) $scope) {
+    let items = (u_S_const$raw){ .ptr = item.inner, .len = 1, .type = item.inner_type };
+    return_(Thrd_Chan_sendS(self, items));
+} $unscoped_(fn);
+
+fn_((Thrd_Chan_trySendS(Thrd_Chan* self, u_S_const$raw items))(Thrd_Chan_Err$usize) $scope) {
+    debug_assert_eqBy(self->elem_ty, items.type, TypeInfo_eq);
+    if (Thrd_Chan_isClosed(self)) { return_err(Thrd_Chan_Err_Closed()); }
+    return_ok(Thrd_Chan__trySendS(self, items));
+} $unscoped_(fn);
+
+fn_((Thrd_Chan_sendS(Thrd_Chan* self, u_S_const$raw items))(Thrd_Chan_Err$void) $scope) {
+    debug_assert_eqBy(self->elem_ty, items.type, TypeInfo_eq);
+    var_(rest, u_S_const$raw) = items;
+    var_(idle_rounds, u32) = 0;
+    while (true) {
+        if (Thrd_Chan_isClosed(self)) { return_err(Thrd_Chan_Err_Closed()); }
+        let sent = Thrd_Chan__trySendS(self, rest);
+        rest = u_suffixS(rest, sent);
+        if (rest.len == 0) { break; }
+        if (sent != 0) {
+            idle_rounds = 0;
+            continue;
+        }
+        if (idle_rounds < Thrd_Chan_spin_rounds) {
+            idle_rounds++;
+            atom_spinLoopHint();
+            continue;
+        }
+        /* Park: register as waiter, then re-check so a concurrent receive cannot be missed */
+        let seq = atom_V_load(&self->send_seq, atom_MemOrd_acquire);
+        atom_V_fetchAdd(&self->send_waiters, 1, atom_MemOrd_seq_cst);
+        let resent = Thrd_Chan_isClosed(self) ? 0 : Thrd_Chan__trySendS(self, rest);
+        if (resent == 0 && !Thrd_Chan_isClosed(self)) { Thrd_Ftx_wait(&self->send_seq, seq); }
+        atom_V_fetchSub(&self->send_waiters, 1, atom_MemOrd_monotonic);
+        rest = u_suffixS(rest, resent);
+        if (rest.len == 0) { break; }
+        idle_rounds = 0;
+    }
+    return_ok({});
+} $unscoped_(fn);
+
+fn_((Thrd_Chan_tryRecv(Thrd_Chan* self, u_V$raw ret_mem))(O$u_V$raw) $scope) {
+    debug_assert_eqBy(self->elem_ty, ret_mem.inner_type, TypeInfo_eq);
+    if (self->mode == Thrd_Chan_Mode_mpmc) {
+        if (!Thrd_Chan__mpmc_tryRecv(self, ret_mem.ref)) { return_none(); }
+        Thrd_Chan__notify(&self->send_seq, &self->send_waiters, 1);
+        return_some(ret_mem);
+    }
+    let buf = (u_S$raw){ .ptr = ret_mem.inner, .len = 1, .type = ret_mem.inner_type };
+    if (Thrd_Chan__spsc_tryRecvS(self, buf) == 0) { return_none(); }
+    return_some(ret_mem);
+} $unscoped_(fn);
+
+fn_((Thrd_Chan_recv(Thrd_Chan* self, u_V$raw ret_mem))(Thrd_Chan_Err$u_V$raw) $scope) {
+    let buf = (u_S$raw){ .ptr = ret_mem.inner, .len = 1, .type = ret_mem.inner_type };
+    let_ignore = try_(Thrd_Chan__recvUntil(self, buf, none$((O$time_Duration))));
+    return_ok(ret_mem);
+} $unscoped_(fn);
+
+fn_((Thrd_Chan_timedRecv(Thrd_Chan* self, u_V$raw ret_mem, time_Duration timeout))(Thrd_Chan_Err$u_V$raw) $scope) {
+    let buf = (u_S$raw){ .ptr = ret_mem.inner, .len = 1, .type = ret_mem.inner_type };
+    let_ignore = try_(Thrd_Chan__recvUntil(self, buf, some$((O$time_Duration)(timeout))));
+    return_ok(ret_mem);
+} $unscoped_(fn);
+
+fn_((Thrd_Chan_tryRecvS(Thrd_Chan* self, u_S$raw buf))(usize)) {
+    debug_assert_eqBy(self->elem_ty, buf.type, TypeInfo_eq);
+    return Thrd_Chan__tryRecvS(self, buf);
+};
+
+fn_((Thrd_Chan_recvS(Thrd_Chan* self, u_S$raw buf))(Thrd_Chan_Err$usize)) {
+    return Thrd_Chan__recvUntil(self, buf, none$((O$time_Duration)));
+};
+
+/*========== Internal Definitions ===========================================*/
+
+$static fn_((Thrd_Chan__slotAt(const Thrd_Chan* self, usize pos))(u8*)) {
+    return self->slots.ptr + (pos & self->mask) * self->stride;
+};
+
+$static fn_((Thrd_Chan__seqAt(u8* slot))(atom_V$usize*)) {
+    return as$(atom_V$usize*)(slot);
+};
+
+$static fn_((Thrd_Chan__elemAt(const Thrd_Chan* self, u8* slot))(u_P$raw)) {
+    return (u_P$raw){ .raw = slot + self->elem_offset, .type = self->elem_ty };
+};
+
+$static fn_((Thrd_Chan__mpmc_trySend(Thrd_Chan* self, u_P_const$raw item))(bool)) {
+    var pos = atom_V_load(&self->tail, atom_MemOrd_monotonic);
+    var_(slot, u8*) = null;
+    while (true) {
+        slot = Thrd_Chan__slotAt(self, pos);
+        let seq = atom_V_load(Thrd_Chan__seqAt(slot), atom_MemOrd_acquire);
+        let diff = as$(isize)(seq - pos);
+        if (diff == 0) {
+            pos = orelse_((atom_V_cmpXchgWeak(
+                &self->tail, pos, pos + 1, atom_MemOrd_monotonic, atom_MemOrd_monotonic
+            ))(break));
+        } else if (diff < 0) {
+            /* The slot still holds the value from one lap ago */
+            return false;
+        } else {
+            pos = atom_V_load(&self->tail, atom_MemOrd_monotonic);
+        }
+    }
+    u_memcpy(Thrd_Chan__elemAt(self, slot), item);
+    atom_V_store(Thrd_Chan__seqAt(slot), pos + 1, atom_MemOrd_release);
+    return true;
+};
+
+$static fn_((Thrd_Chan__mpmc_tryRecv(Thrd_Chan* self, u_P$raw ret))(bool)) {
+    var pos = atom_V_load(&self->head, atom_MemOrd_monotonic);
+    var_(slot, u8*) = null;
+    while (true) {
+        slot = Thrd_Chan__slotAt(self, pos);
+        let seq = atom_V_load(Thrd_Chan__seqAt(slot), atom_MemOrd_acquire);
+        let diff = as$(isize)(seq - (pos + 1));
+        if (diff == 0) {
+            pos = orelse_((atom_V_cmpXchgWeak(
+                &self->head, pos, pos + 1, atom_MemOrd_monotonic, atom_MemOrd_monotonic
+            ))(break));
+        } else if (diff < 0) {
+            /* Not written yet: empty */
+            return false;
+        } else {
+            pos = atom_V_load(&self->head, atom_MemOrd_monotonic);
+        }
+    }
+    u_memcpy(ret, Thrd_Chan__elemAt(self, slot).as_const);
+    atom_V_store(Thrd_Chan__seqAt(slot), pos + self->mask + 1, atom_MemOrd_release);
+    return true;
+};
+
+$static fn_((Thrd_Chan__mpmc_trySendS(Thrd_Chan* self, u_S_const$raw items))(usize)) {
+    if (items.len == 0) { return 0; }
+    if (items.len == 1) { return Thrd_Chan__mpmc_trySend(self, u_atS(items, 0)) ? 1 : 0; }
+    /* Reserve a run of positions with one CAS. A reserved slot may still be
+     * in the middle of being read by a consumer, so wait on its sequence. */
+    let cap = self->mask + 1;
+    var pos = atom_V_load(&self->tail, atom_MemOrd_monotonic);
+    var_(count, usize) = 0;
+    while (true) {
+        let head = atom_V_load(&self->head, atom_MemOrd_acquire);
+        let used = as$(isize)(pos - head);
+        if (used < 0) {
+            pos = atom_V_load(&self->tail, atom_MemOrd_monotonic);
+            continue;
+        }
+        if (as$(usize)(used) >= cap) { return 0; }
+        count = prim_min(cap - as$(usize)(used), items.len);
+        pos = orelse_((atom_V_cmpXchgWeak(
+            &self->tail, pos, pos + count, atom_MemOrd_monotonic, atom_MemOrd_monotonic
+        ))(break));
+    }
+    for_(($r(0, count))(i) {
+        let slot = Thrd_Chan__slotAt(self, pos + i);
+        let seq = Thrd_Chan__seqAt(slot);
+        while (atom_V_load(seq, atom_MemOrd_acquire) != pos + i) { atom_spinLoopHint(); }
+        u_memcpy(Thrd_Chan__elemAt(self, slot), u_atS(items, i));
+        atom_V_store(seq, pos + i + 1, atom_MemOrd_release);
+    });
+    return count;
+};
+
+$static fn_((Thrd_Chan__mpmc_tryRecvS(Thrd_Chan* self, u_S$raw buf))(usize)) {
+    if (buf.len == 0) { return 0; }
+    if (buf.len == 1) { return Thrd_Chan__mpmc_tryRecv(self, u_atS(buf, 0)) ? 1 : 0; }
+    /* Reserve a run of positions with one CAS; a producer may still be
+     * writing into a reserved slot, so wait on its sequence. */
+    var pos = atom_V_load(&self->head, atom_MemOrd_monotonic);
+    var_(count, usize) = 0;
+    while (true) {
+        let tail = atom_V_load(&self->tail, atom_MemOrd_acquire);
+        let avail = as$(isize)(tail - pos);
+        if (avail < 0) {
+            pos = atom_V_load(&self->head, atom_MemOrd_monotonic);
+            continue;
+        }
+        if (avail == 0) { return 0; }
+        count = prim_min(as$(usize)(avail), buf.len);
+        pos = orelse_((atom_V_cmpXchgWeak(
+            &self->head, pos, pos + count, atom_MemOrd_monotonic, atom_MemOrd_monotonic
+        ))(break));
+    }
+    let cap = self->mask + 1;
+    for_(($r(0, count))(i) {
+        let slot = Thrd_Chan__slotAt(self, pos + i);
+        let seq = Thrd_Chan__seqAt(slot);
+        while (atom_V_load(seq, atom_MemOrd_acquire) != pos + i + 1) { atom_spinLoopHint(); }
+        u_memcpy(u_atS(buf, i), Thrd_Chan__elemAt(self, slot).as_const);
+        atom_V_store(seq, pos + i + cap, atom_MemOrd_release);
+    });
+    return count;
+};
+
+$static fn_((Thrd_Chan__spsc_trySendS(Thrd_Chan* self, u_S_const$raw items))(usize)) {
+    let cap = self->mask + 1;
+    let tail = atom_V_load(&self->tail, atom_MemOrd_monotonic);
+    if (cap - (tail - self->head_cache) < items.len) {
+        self->head_cache = atom_V_load(&self->head, atom_MemOrd_acquire);
+    }
+    let count = prim_min(cap - (tail - self->head_cache), items.len);
+    if (count == 0) { return 0; }
+    for_(($r(0, count))(i) {
+        u_memcpy(Thrd_Chan__elemAt(self, Thrd_Chan__slotAt(self, tail + i)), u_atS(items, i));
+    });
+    atom_V_store(&self->tail, tail + count, atom_MemOrd_release);
+    Thrd_Chan__notify(&self->recv_seq, &self->recv_waiters, 1);
+    return count;
+};
+
+$static fn_((Thrd_Chan__spsc_tryRecvS(Thrd_Chan* self, u_S$raw buf))(usize)) {
+    let head = atom_V_load(&self->head, atom_MemOrd_monotonic);
+    if (self->tail_cache - head < buf.len) {
+        self->tail_cache = atom_V_load(&self->tail, atom_MemOrd_acquire);
+    }
+    let count = prim_min(self->tail_cache - head, buf.len);
+    if (count == 0) { return 0; }
+    for_(($r(0, count))(i) {
+        u_memcpy(u_atS(buf, i), Thrd_Chan__elemAt(self, Thrd_Chan__slotAt(self, head + i)).as_const);
+    });
+    atom_V_store(&self->head, head + count, atom_MemOrd_release);
+    Thrd_Chan__notify(&self->send_seq, &self->send_waiters, 1);
+    return count;
+};
+
+$static fn_((Thrd_Chan__trySendS(Thrd_Chan* self, u_S_const$raw items))(usize)) {
+    if (self->mode == Thrd_Chan_Mode_spsc) { return Thrd_Chan__spsc_trySendS(self, items); }
+    let count = Thrd_Chan__mpmc_trySendS(self, items);
+    if (count != 0) { Thrd_Chan__notify(&self->recv_seq, &self->recv_waiters, intCast$((u32)(count))); }
+    return count;
+};
+
+$static fn_((Thrd_Chan__tryRecvS(Thrd_Chan* self, u_S$raw buf))(usize)) {
+    if (self->mode == Thrd_Chan_Mode_spsc) { return Thrd_Chan__spsc_tryRecvS(self, buf); }
+    let count = Thrd_Chan__mpmc_tryRecvS(self, buf);
+    if (count != 0) { Thrd_Chan__notify(&self->send_seq, &self->send_waiters, intCast$((u32)(count))); }
+    return count;
+};
+
+$static fn_((Thrd_Chan__notify(atom_V$u32* seq, atom_V$u32* waiters, u32 count))(void)) {
+    /* Pairs with the waiter increment before parking: either the parking side
+     * sees our update, or we see it registered and bump `seq`. */
+    atom_fence(atom_MemOrd_seq_cst);
+    if (atom_V_load(waiters, atom_MemOrd_monotonic) == 0) { return; }
+    atom_V_fetchAdd(seq, 1, atom_MemOrd_release);
+    Thrd_Ftx_wake(seq, count);
+};
+
+$static fn_((Thrd_Chan__recvUntil(Thrd_Chan* self, u_S$raw buf, O$time_Duration timeout))(Thrd_Chan_Err$usize) $scope) {
+    debug_assert_eqBy(self->elem_ty, buf.type, TypeInfo_eq);
+    claim_assert(0 < buf.len);
+    var deadline = Thrd_Ftx_Deadline_init(timeout);
+    var_(idle_rounds, u32) = 0;
+    while (true) {
+        /* Load the flag first: values sent before `close` are still drained */
+        let was_closed = Thrd_Chan_isClosed(self);
+        let count = Thrd_Chan__tryRecvS(self, buf);
+        if (count != 0) { return_ok(count); }
+        if (was_closed) { return_err(Thrd_Chan_Err_Closed()); }
+        if (idle_rounds < Thrd_Chan_spin_rounds) {
+            idle_rounds++;
+            atom_spinLoopHint();
+            continue;
+        }
+        /* Park: register as waiter, then re-check so a concurrent send cannot be missed */
+        let seq = atom_V_load(&self->recv_seq, atom_MemOrd_acquire);
+        atom_V_fetchAdd(&self->recv_waiters, 1, atom_MemOrd_seq_cst);
+        let recounted = Thrd_Chan__tryRecvS(self, buf);
+        var_(timed_out, bool) = false;
+        if (recounted == 0 && !Thrd_Chan_isClosed(self)) {
+            timed_out = isErr(Thrd_Ftx_Deadline_wait(&deadline, &self->recv_seq, seq));
+        }
+        atom_V_fetchSub(&self->recv_waiters, 1, atom_MemOrd_monotonic);
+        if (recounted != 0) { return_ok(recounted); }
+        if (!timed_out) {
+            idle_rounds = 0;
+            continue;
+        }
+        /* Timed out: one last attempt so a value that raced the timeout is not left behind */
+        let late = Thrd_Chan__tryRecvS(self, buf);
+        if (late != 0) { return_ok(late); }
+        return_err(Thrd_Chan_Err_Timeout());
+    }
+} $unscoped_(fn);
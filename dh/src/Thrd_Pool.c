@@ -0,0 +1,346 @@
+#include "dh/Thrd/Pool.h"
+#include "Thrd_internal_steal.h"
+
+/*========== Internal Declarations ==========================================*/
+
+/// Worker of the pool the current thread belongs to (null on non-worker threads).
+$static $Thrd_local var_(Thrd_Pool__tls_worker, Thrd_Pool_Worker*) = null;
+
+$attr($inline_always)
+$static fn_((Thrd_Pool__currentWorker(const Thrd_Pool* self))(Thrd_Pool_Worker*));
+$static fn_((Thrd_Pool__submit(Thrd_Pool* self, Thrd_Pool_Task task))(void));
+$static fn_((Thrd_Pool__findTask(Thrd_Pool* self, Thrd_Pool_Worker* worker))(O$Thrd_Pool_Task));
+$attr($inline_always)
+$static fn_((Thrd_Pool__run(Thrd_Pool_Task task))(void));
+
+/* Chase-Lev deque on `Thrd__Deque` indices */
+$static fn_((Thrd_Pool__pushBottom(Thrd_Pool_Worker* worker, Thrd_Pool_Task task))(bool));
+$static fn_((Thrd_Pool__popBottom(Thrd_Pool_Worker* worker))(O$Thrd_Pool_Task));
+$static fn_((Thrd_Pool__stealTop(Thrd_Pool_Worker* victim))(O$Thrd_Pool_Task));
+$attr($inline_always)
+$static fn_((Thrd_Pool__loadSlot(const Thrd_Pool_Task* slot))(Thrd_Pool_Task));
+$attr($inline_always)
+$static fn_((Thrd_Pool__storeSlot(Thrd_Pool_Task* slot, Thrd_Pool_Task task))(void));
+
+$static fn_((Thrd_Pool__injectorPush(Thrd_Pool* self, Thrd_Pool_Task task))(bool));
+$static fn_((Thrd_Pool__injectorPop(Thrd_Pool* self))(O$Thrd_Pool_Task));
+
+$static fn_((Thrd_Pool__freeDeques(Thrd_Pool* self, usize allocated))(void));
+$static fn_((Thrd_Pool__stopWorkers(Thrd_Pool* self, usize spawned))(void));
+$static Thrd_fn_(Thrd_Pool__workerMain, ({ Thrd_Pool_Worker* worker; }, Void));
+$static Thrd_fn_(Thrd_Pool__forSplit, ({ Thrd_Pool* pool; R range; usize grain; Thrd_Pool_ForFn fn; }, Void));
+$static fn_((Thrd_Pool__forRange(Thrd_Pool* pool, R range, usize grain, Thrd_Pool_ForFn fn))(void));
+
+/*========== External Definitions ===========================================*/
+
+fn_((Thrd_Pool_init(Thrd_Pool* self, mem_Allocator gpa, Thrd_Pool_Cfg cfg))(E$void) $guard) {
+    claim_assert_nonnull(self);
+    let thrd_count = cfg.thrd_count != 0
+        ? as$(usize)(cfg.thrd_count)
+        : prim_max(catch_((Thrd_cpuCount())($ignore, 1)), as$(usize)(1));
+    var_(deque_cap, u32) = prim_max(cfg.deque_cap, as$(u32)(2));
+    if ((deque_cap & (deque_cap - 1)) != 0) { deque_cap = as$(u32)(1) << (32 - mem_leadingZeros32(deque_cap)); }
+
+    *self = (Thrd_Pool){
+        .gpa = gpa,
+        .workers = u_castS$((S$Thrd_Pool_Worker)(try_(mem_Allocator_alloc(gpa, typeInfo$(Thrd_Pool_Worker), thrd_count)))),
+        .injector = {
+            .mtx = Thrd_Mtx_init(),
+            .tasks = {},
+            .head = 0,
+            .len = 0,
+            .queued = atom_V_init(0),
+        },
+        .sleepers = atom_V_init(0),
+        .wake_seq = atom_V_init(0),
+        .is_shutdown = atom_V_init(0),
+    };
+    errdefer_($ignore, mem_Allocator_free(gpa, u_anyS(self->workers)));
+    self->injector.tasks = u_castS$((S$Thrd_Pool_Task)(try_(mem_Allocator_alloc(
+        gpa, typeInfo$(Thrd_Pool_Task), prim_max(as$(usize)(cfg.injector_cap), as$(usize)(1))
+    ))));
+    errdefer_($ignore, mem_Allocator_free(gpa, u_anyS(self->injector.tasks)));
+
+    /* Deques first: a worker may steal from any other as soon as it starts */
+    var_(allocated, usize) = 0;
+    errdefer_($ignore, Thrd_Pool__freeDeques(self, allocated));
+    for_(($s(self->workers))(worker) {
+        asg_lit((worker)({
+            .top = atom_V_init(0),
+            .bottom = atom_V_init(0),
+            .tasks = u_castS$((S$Thrd_Pool_Task)(try_(mem_Allocator_alloc(gpa, typeInfo$(Thrd_Pool_Task), deque_cap)))),
+            .pool = self,
+            .thrd = {},
+            .rng = 0x9e3779b97f4a7c15ull * (allocated + 1),
+            .idx = intCast$((u32)(allocated)),
+        }));
+        allocated++;
+    });
+
+    var_(spawned, usize) = 0;
+    errdefer_($ignore, Thrd_Pool__stopWorkers(self, spawned));
+    let spawn_cfg = (Thrd_SpawnCfg){ .allocator = none(), .stack_size = cfg.stack_size };
+    for_(($s(self->workers))(worker) {
+        let ctx = u_castP$((Thrd_FnCtx$(Thrd_Pool__workerMain)*)(try_(mem_Allocator_create(
+            gpa, typeInfo$(Thrd_FnCtx$(Thrd_Pool__workerMain))
+        ))));
+        *ctx = Thrd_FnCtx_from$((Thrd_Pool__workerMain)(worker));
+        worker->thrd = catch_((Thrd_spawn(spawn_cfg, ctx->as_raw))(err, {
+            mem_Allocator_destroy(gpa, u_anyP(ctx));
+            return_err(err);
+        }));
+        spawned++;
+    });
+    return_ok({});
+} $unguarded_(fn);
+
+fn_((Thrd_Pool_fini(Thrd_Pool* self))(void)) {
+    claim_assert_nonnull(self);
+    claim_assert(Thrd_Pool__currentWorker(self) == null);
+    Thrd_Pool__stopWorkers(self, self->workers.len);
+    Thrd_Pool__freeDeques(self, self->workers.len);
+    mem_Allocator_free(self->gpa, u_anyS(self->injector.tasks));
+    mem_Allocator_free(self->gpa, u_anyS(self->workers));
+    Thrd_Mtx_fini(&self->injector.mtx);
+    self->workers = (S$Thrd_Pool_Worker){};
+};
+
+fn_((Thrd_Pool_thrdCount(const Thrd_Pool* self))(usize)) {
+    return self->workers.len;
+};
+
+fn_((Thrd_Pool_currentIdx(const Thrd_Pool* self))(O$usize) $scope) {
+    let worker = Thrd_Pool__currentWorker(self);
+    if (worker == null) { return_none(); }
+    return_some(worker->idx);
+} $unscoped_(fn);
+
+fn_((Thrd_Pool_spawn(Thrd_Pool* self, Thrd_FnCtx* fn_ctx))(void)) {
+    claim_assert_nonnull(fn_ctx);
+    Thrd_Pool__submit(self, (Thrd_Pool_Task){ .fn_ctx = fn_ctx, .scope = null });
+};
+
+fn_((Thrd_Pool_Scope_init(Thrd_Pool* pool))(Thrd_Pool_Scope)) {
+    claim_assert_nonnull(pool);
+    return (Thrd_Pool_Scope){
+        .pool = pool,
+        .pending = atom_V_init(0),
+        .is_joined = false,
+    };
+};
+
+fn_((Thrd_Pool_Scope_spawn(Thrd_Pool_Scope* self, Thrd_FnCtx* fn_ctx))(void)) {
+    claim_assert_nonnull(fn_ctx);
+    atom_V_fetchAdd(&self->pending, 1, atom_MemOrd_monotonic);
+    Thrd_Pool__submit(self->pool, (Thrd_Pool_Task){ .fn_ctx = fn_ctx, .scope = self });
+};
+
+fn_((Thrd_Pool_Scope_wait(Thrd_Pool_Scope* self))(void)) {
+    let pool = self->pool;
+    let worker = Thrd_Pool__currentWorker(pool);
+    while (true) {
+        let pending = atom_V_load(&self->pending, atom_MemOrd_acquire);
+        if (pending == 0) { break; }
+        if_some((Thrd_Pool__findTask(pool, worker))(task)) {
+            Thrd_Pool__run(task);
+            continue;
+        }
+        /* Nothing left to help with: the remaining tasks are running elsewhere */
+        Thrd_Ftx_wait(&self->pending, pending);
+    }
+    self->is_joined = true;
+};
+
+fn_((Thrd_Pool_parallelFor(Thrd_Pool* self, R range, usize grain, Thrd_Pool_ForFn fn))(void)) {
+    let len = R_len(range);
+    if (len == 0) { return; }
+    let chunk = grain != 0 ? grain : prim_max(len / (self->workers.len * 8), as$(usize)(1));
+    Thrd_Pool__forRange(self, range, chunk, fn);
+};
+
+/*========== Internal Definitions ===========================================*/
+
+$static fn_((Thrd_Pool__currentWorker(const Thrd_Pool* self))(Thrd_Pool_Worker*)) {
+    let worker = Thrd_Pool__tls_worker;
+    return worker != null && worker->pool == self ? worker : null;
+};
+
+$static fn_((Thrd_Pool__submit(Thrd_Pool* self, Thrd_Pool_Task task))(void)) {
+    let worker = Thrd_Pool__currentWorker(self);
+    if (worker != null && Thrd_Pool__pushBottom(worker, task)) {
+        Thrd__Park_notify(&self->sleepers, &self->wake_seq);
+        return;
+    }
+    if (Thrd_Pool__injectorPush(self, task)) {
+        Thrd__Park_notify(&self->sleepers, &self->wake_seq);
+        return;
+    }
+    /* Both queues are full: apply back-pressure by running the task here */
+    Thrd_Pool__run(task);
+};
+
+$static fn_((Thrd_Pool__findTask(Thrd_Pool* self, Thrd_Pool_Worker* worker))(O$Thrd_Pool_Task) $scope) {
+    if (worker != null) {
+        if_some((Thrd_Pool__popBottom(worker))(task)) { return_some(task); }
+    }
+    if_some((Thrd_Pool__injectorPop(self))(task)) { return_some(task); }
+
+    let count = self->workers.len;
+    var_(start, usize) = 0;
+    if (worker != null) {
+        /* xorshift64 */
+        var_(x, u64) = worker->rng;
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        worker->rng = x;
+        start = as$(usize)(x % count);
+    }
+    for_(($r(0, count))(i) {
+        let victim = S_at((self->workers)[(start + i) % count]);
+        if (victim == worker) { continue; }
+        if_some((Thrd_Pool__stealTop(victim))(task)) { return_some(task); }
+    });
+    return_none();
+} $unscoped_(fn);
+
+$static fn_((Thrd_Pool__run(Thrd_Pool_Task task))(void)) {
+    let_ignore = task.fn_ctx->fn(task.fn_ctx);
+    let scope = task.scope;
+    if (scope == null) { return; }
+    if (atom_V_fetchSub(&scope->pending, 1, atom_MemOrd_acq_rel) == 1) {
+        Thrd_Ftx_wake(&scope->pending, u32_limit_max);
+    }
+};
+
+$static fn_((Thrd_Pool__loadSlot(const Thrd_Pool_Task* slot))(Thrd_Pool_Task)) {
+    return (Thrd_Pool_Task){
+        .fn_ctx = atom_load(&slot->fn_ctx, atom_MemOrd_monotonic),
+        .scope = atom_load(&slot->scope, atom_MemOrd_monotonic),
+    };
+};
+
+$static fn_((Thrd_Pool__storeSlot(Thrd_Pool_Task* slot, Thrd_Pool_Task task))(void)) {
+    atom_store(&slot->fn_ctx, task.fn_ctx, atom_MemOrd_monotonic);
+    atom_store(&slot->scope, task.scope, atom_MemOrd_monotonic);
+};
+
+$static fn_((Thrd_Pool__pushBottom(Thrd_Pool_Worker* worker, Thrd_Pool_Task task))(bool)) {
+    let idx = orelse_((Thrd__Deque_reserve(&worker->top, &worker->bottom, worker->tasks.len))(return false));
+    Thrd_Pool__storeSlot(S_at((worker->tasks)[Thrd__Deque_slot(idx, worker->tasks.len)]), task);
+    Thrd__Deque_publish(&worker->bottom, idx);
+    return true;
+};
+
+$static fn_((Thrd_Pool__popBottom(Thrd_Pool_Worker* worker))(O$Thrd_Pool_Task) $scope) {
+    let idx = orelse_((Thrd__Deque_take(&worker->top, &worker->bottom))(return_none()));
+    return_some(Thrd_Pool__loadSlot(S_at((worker->tasks)[Thrd__Deque_slot(idx, worker->tasks.len)])));
+} $unscoped_(fn);
+
+$static fn_((Thrd_Pool__stealTop(Thrd_Pool_Worker* victim))(O$Thrd_Pool_Task) $scope) {
+    let idx = orelse_((Thrd__Deque_peek(&victim->top, &victim->bottom))(return_none()));
+    let task = Thrd_Pool__loadSlot(S_at((victim->tasks)[Thrd__Deque_slot(idx, victim->tasks.len)]));
+    if (!Thrd__Deque_claim(&victim->top, idx)) { return_none(); }
+    return_some(task);
+} $unscoped_(fn);
+
+$static fn_((Thrd_Pool__injectorPush(Thrd_Pool* self, Thrd_Pool_Task task))(bool)) {
+    let inj = &self->injector;
+    Thrd_Mtx_lock(&inj->mtx);
+    let cap = inj->tasks.len;
+    let pushed = inj->len < cap;
+    if (pushed) {
+        *S_at((inj->tasks)[(inj->head + inj->len) % cap]) = task;
+        inj->len++;
+        atom_V_store(&inj->queued, inj->len, atom_MemOrd_release);
+    }
+    Thrd_Mtx_unlock(&inj->mtx);
+    return pushed;
+};
+
+$static fn_((Thrd_Pool__injectorPop(Thrd_Pool* self))(O$Thrd_Pool_Task) $scope) {
+    let inj = &self->injector;
+    if (atom_V_load(&inj->queued, atom_MemOrd_acquire) == 0) { return_none(); }
+    Thrd_Mtx_lock(&inj->mtx);
+    if (inj->len == 0) {
+        Thrd_Mtx_unlock(&inj->mtx);
+        return_none();
+    }
+    let task = *S_at((inj->tasks)[inj->head]);
+    inj->head = (inj->head + 1) % inj->tasks.len;
+    inj->len--;
+    atom_V_store(&inj->queued, inj->len, atom_MemOrd_release);
+    Thrd_Mtx_unlock(&inj->mtx);
+    return_some(task);
+} $unscoped_(fn);
+
+$static fn_((Thrd_Pool__freeDeques(Thrd_Pool* self, usize allocated))(void)) {
+    for_(($s(slice$S(self->workers, $r(0, allocated))))(worker) {
+        mem_Allocator_free(self->gpa, u_anyS(worker->tasks));
+    });
+};
+
+$static fn_((Thrd_Pool__stopWorkers(Thrd_Pool* self, usize spawned))(void)) {
+    Thrd__Park_shutdown(&self->is_shutdown, &self->wake_seq);
+    for_(($s(slice$S(self->workers, $r(0, spawned))))(worker) {
+        let ctx = Thrd_join(worker->thrd);
+        mem_Allocator_destroy(self->gpa, u_anyP(as$(Thrd_FnCtx$(Thrd_Pool__workerMain)*)(ctx)));
+    });
+};
+
+Thrd_fn_(Thrd_Pool__workerMain, ($ignore, args)$scope) {
+    let worker = args->worker;
+    let pool = worker->pool;
+    Thrd_Pool__tls_worker = worker;
+    var_(idle_rounds, u32) = 0;
+    while (true) {
+        if_some((Thrd_Pool__findTask(pool, worker))(task)) {
+            Thrd_Pool__run(task);
+            idle_rounds = 0;
+            continue;
+        }
+        if (idle_rounds < Thrd_Pool_spin_rounds) {
+            idle_rounds++;
+            atom_spinLoopHint();
+            continue;
+        }
+        /* Park: register as sleeper, then re-check so a concurrent push cannot be missed */
+        let seq = Thrd__Park_begin(&pool->sleepers, &pool->wake_seq);
+        if_some((Thrd_Pool__findTask(pool, worker))(task)) {
+            Thrd__Park_cancel(&pool->sleepers);
+            Thrd_Pool__run(task);
+            idle_rounds = 0;
+            continue;
+        }
+        if (atom_V_load(&pool->is_shutdown, atom_MemOrd_acquire) != 0) {
+            Thrd__Park_cancel(&pool->sleepers);
+            break;
+        }
+        Thrd__Park_wait(&pool->sleepers, &pool->wake_seq, seq);
+        idle_rounds = 0;
+    }
+    Thrd_Pool__tls_worker = null;
+    return_({});
+} $unscoped_(Thrd_fn);
+
+Thrd_fn_(Thrd_Pool__forSplit, ($ignore, args)$scope) {
+    Thrd_Pool__forRange(args->pool, args->range, args->grain, args->fn);
+    return_({});
+} $unscoped_(Thrd_fn);
+
+$static fn_((Thrd_Pool__forRange(Thrd_Pool* pool, R range, usize grain, Thrd_Pool_ForFn fn))(void)) {
+    /* Each halving spawns the upper half; at most one split per bit of the length */
+    var_(splits, A$$(usize_bits, Thrd_FnCtx$(Thrd_Pool__forSplit))) = A_zero();
+    var_(split_count, usize) = 0;
+    var scope = Thrd_Pool_Scope_init(pool);
+    var_(rest, R) = range;
+    while (R_len(rest) > grain) {
+        let mid = rest.begin + R_len(rest) / 2;
+        let split = A_at((splits)[split_count++]);
+        *split = Thrd_FnCtx_from$((Thrd_Pool__forSplit)(pool, R_from(mid, rest.end), grain, fn));
+        Thrd_Pool_Scope_spawn(&scope, split->as_raw);
+        rest = R_from(rest.begin, mid);
+    }
+    invoke(fn, rest);
+    Thrd_Pool_Scope_wait(&scope);
+};
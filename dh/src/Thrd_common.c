@@ -213,6 +213,10 @@ $static let Thrd__join = pp_if_(Thrd_use_pthread)(
         ))
     )));
 
+$static $Thrd_local var_(Thrd__exit_hooks, Thrd_ExitHook*) = null;
+/// Runs the calling thread's exit hooks; called by every spawn entry after the user function
+$static fn_((Thrd__runExitHooks(void))(void));
+
 /*========== External Definitions ===========================================*/
 
 fn_((Thrd_sleep(time_Duration duration))(void)) {
@@ -255,8 +259,24 @@ fn_((Thrd_join(Thrd self))(Thrd_FnCtx*)) {
     return Thrd__join(self);
 };
 
+fn_((Thrd_onExit(Thrd_ExitHook* hook))(void)) {
+    claim_assert_nonnull(hook);
+    claim_assert_nonnull(hook->fn);
+    hook->next = Thrd__exit_hooks;
+    Thrd__exit_hooks = hook;
+};
+
 /*========== Internal Definitions ===========================================*/
 
+fn_((Thrd__runExitHooks(void))(void)) {
+    /* A hook may register further hooks; they run in the same pass */
+    while (Thrd__exit_hooks != null) {
+        let hook = Thrd__exit_hooks;
+        Thrd__exit_hooks = hook->next;
+        hook->fn();
+    }
+};
+
 /* --- Unsupported --- */
 
 fn_((Thrd__unsupported_handle(Thrd self))(Thrd_Handle)) {
@@ -375,7 +395,9 @@ fn_((Thrd__pthread_spawn(Thrd_SpawnCfg cfg, Thrd_FnCtx* fn_ctx))(E$Thrd) $guard)
 
 fn_((Thrd__pthread_entry(P$raw arg))(P$raw)) {
     let ctx = ensureNonnull(as$(Thrd_FnCtx*)(arg));
-    return call((ctx->fn)(ctx));
+    let ret = call((ctx->fn)(ctx));
+    Thrd__runExitHooks();
+    return ret;
 };
 
 fn_((Thrd__pthread_detach(Thrd self))(void)) {
@@ -445,6 +467,7 @@ fn_((Thrd__windows_spawn(Thrd_SpawnCfg cfg, Thrd_FnCtx* fn_ctx))(E$Thrd) $scope)
 fn_((Thrd__windows_entry(LPVOID lpParameter))(DWORD)) {
     let ctx = ensureNonnull(as$(Thrd_FnCtx*)(lpParameter));
     let_ignore = call((ctx->fn)(ctx));
+    Thrd__runExitHooks();
     return 0;
 };
 
@@ -663,6 +686,7 @@ fn_((Thrd__linux_entry(P$raw arg))(i32)) {
     let fn_ctx = ensureNonnull(meta->fn_ctx);
     // Execute user function
     let_ignore = call((fn_ctx->fn)(fn_ctx));
+    Thrd__runExitHooks();
     // Atomic state transition
     let prev = atom_V_fetchXchg(&meta->completion, Thrd__linux_Completion_completed, memory_order_seq_cst);
     switch (prev) {
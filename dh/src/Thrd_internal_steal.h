@@ -0,0 +1,148 @@
+/**
+ * @copyright Copyright (c) 2026 Gyeongtae Kim
+ * @license   MIT License - see LICENSE file for details
+ *
+ * @file    Thrd_internal_steal.h
+ * @author  Gyeongtae Kim (dev-dasae) <codingpelican@gmail.com>
+ * @date    2026-10-17 (date of creation)
+ * @updated 2026-10-17 (date of last update)
+ * @version v0.1-alpha
+ * @ingroup dasae-headers(dh)/Thrd/internal
+ * @prefix  Thrd
+ *
+ * @brief   Internal work-stealing pieces shared by `Thrd_Pool` and `Co_Sched`
+ * @details Index arithmetic of a Chase-Lev deque and the sleeper/`wake_seq` parking
+ *          protocol. The caller owns the ring and copies slots itself, so any task
+ *          type fits:
+ *          - push (owner): `Thrd__Deque_reserve`, store the slot, `Thrd__Deque_publish`.
+ *          - pop (owner): `Thrd__Deque_take`, then load the slot it returned.
+ *          - steal: `Thrd__Deque_peek`, load the slot, then `Thrd__Deque_claim`.
+ *          Not part of public API.
+ */
+#ifndef Thrd_internal_steal__included
+#define Thrd_internal_steal__included 1
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/*========== Includes =======================================================*/
+
+#include "dh/Thrd/Ftx.h"
+
+/*========== Macros and Declarations ========================================*/
+
+/* --- Chase-Lev deque: the owner pushes/pops at `bottom`, thieves take from `top` --- */
+
+/// Ring slot of deque index `idx`; `cap` is a power of two.
+$attr($inline_always)
+$static fn_((Thrd__Deque_slot(isize idx, usize cap))(usize));
+/// Index the owner may store its next task at, or none while the ring is full.
+$attr($inline_always)
+$static fn_((Thrd__Deque_reserve(atom_V$isize* top, atom_V$isize* bottom, usize cap))(O$isize));
+/// Makes the task stored at the reserved index `idx` visible to thieves.
+$attr($inline_always)
+$static fn_((Thrd__Deque_publish(atom_V$isize* bottom, isize idx))(void));
+/// Index of the newest task, now held by the owner alone; none when empty or lost to a thief.
+$static fn_((Thrd__Deque_take(atom_V$isize* top, atom_V$isize* bottom))(O$isize));
+/// Index of the oldest task for a thief to copy, or none when empty.
+$static fn_((Thrd__Deque_peek(atom_V$isize* top, atom_V$isize* bottom))(O$isize));
+/// Whether the task copied from `idx` (from `Thrd__Deque_peek`) is the thief's to run.
+$attr($inline_always)
+$static fn_((Thrd__Deque_claim(atom_V$isize* top, isize idx))(bool));
+
+/* --- Parking: idle workers sleep on `wake_seq` while `sleepers` counts them --- */
+
+/// Wakes one parked worker, if any; call after queueing a task.
+$static fn_((Thrd__Park_notify(atom_V$u32* sleepers, atom_V$u32* wake_seq))(void));
+/// Registers the caller as a sleeper and returns the sequence to wait on.
+/// Look for work once more afterwards; on finding some, call `Thrd__Park_cancel`.
+$static fn_((Thrd__Park_begin(atom_V$u32* sleepers, atom_V$u32* wake_seq))(u32));
+$attr($inline_always)
+$static fn_((Thrd__Park_cancel(atom_V$u32* sleepers))(void));
+/// Sleeps until a notify after `Thrd__Park_begin`, then unregisters the caller.
+$static fn_((Thrd__Park_wait(atom_V$u32* sleepers, atom_V$u32* wake_seq, u32 seq))(void));
+/// Raises `is_shutdown` and wakes every parked worker.
+$static fn_((Thrd__Park_shutdown(atom_V$u32* is_shutdown, atom_V$u32* wake_seq))(void));
+
+/*========== Macros and Definitions =========================================*/
+
+fn_((Thrd__Deque_slot(isize idx, usize cap))(usize)) {
+    return as$(usize)(idx & (as$(isize)(cap) - 1));
+};
+
+fn_((Thrd__Deque_reserve(atom_V$isize* top, atom_V$isize* bottom, usize cap))(O$isize) $scope) {
+    let b = atom_V_load(bottom, atom_MemOrd_monotonic);
+    let t = atom_V_load(top, atom_MemOrd_acquire);
+    /* A stale `t` only under-reports free space, so a slot is never reused while a thief may read it */
+    if (b - t > as$(isize)(cap) - 1) { return_none(); }
+    return_some(b);
+} $unscoped_(fn);
+
+fn_((Thrd__Deque_publish(atom_V$isize* bottom, isize idx))(void)) {
+    atom_fence(atom_MemOrd_release);
+    atom_V_store(bottom, idx + 1, atom_MemOrd_monotonic);
+};
+
+fn_((Thrd__Deque_take(atom_V$isize* top, atom_V$isize* bottom))(O$isize) $scope) {
+    let b = atom_V_load(bottom, atom_MemOrd_monotonic) - 1;
+    atom_V_store(bottom, b, atom_MemOrd_monotonic);
+    atom_fence(atom_MemOrd_seq_cst);
+    let t = atom_V_load(top, atom_MemOrd_monotonic);
+    if (b < t) {
+        atom_V_store(bottom, b + 1, atom_MemOrd_monotonic);
+        return_none();
+    }
+    if (b > t) { return_some(b); }
+    /* Last task: race thieves for it through `top`; only the owner ever rewrites the slot */
+    let won = isNone(atom_V_cmpXchgStrong(top, t, t + 1, atom_MemOrd_seq_cst, atom_MemOrd_monotonic));
+    atom_V_store(bottom, b + 1, atom_MemOrd_monotonic);
+    if (!won) { return_none(); }
+    return_some(b);
+} $unscoped_(fn);
+
+fn_((Thrd__Deque_peek(atom_V$isize* top, atom_V$isize* bottom))(O$isize) $scope) {
+    let t = atom_V_load(top, atom_MemOrd_acquire);
+    atom_fence(atom_MemOrd_seq_cst);
+    let b = atom_V_load(bottom, atom_MemOrd_acquire);
+    if (b <= t) { return_none(); }
+    return_some(t);
+} $unscoped_(fn);
+
+fn_((Thrd__Deque_claim(atom_V$isize* top, isize idx))(bool)) {
+    return isNone(atom_V_cmpXchgStrong(top, idx, idx + 1, atom_MemOrd_seq_cst, atom_MemOrd_monotonic));
+};
+
+fn_((Thrd__Park_notify(atom_V$u32* sleepers, atom_V$u32* wake_seq))(void)) {
+    /* Pairs with the sleeper increment in `Thrd__Park_begin`: either the parking worker
+     * sees the queued task, or we see it registered as a sleeper and bump `wake_seq`. */
+    atom_fence(atom_MemOrd_seq_cst);
+    if (atom_V_load(sleepers, atom_MemOrd_monotonic) == 0) { return; }
+    atom_V_fetchAdd(wake_seq, 1, atom_MemOrd_release);
+    Thrd_Ftx_wake(wake_seq, 1);
+};
+
+fn_((Thrd__Park_begin(atom_V$u32* sleepers, atom_V$u32* wake_seq))(u32)) {
+    let seq = atom_V_load(wake_seq, atom_MemOrd_acquire);
+    atom_V_fetchAdd(sleepers, 1, atom_MemOrd_seq_cst);
+    return seq;
+};
+
+fn_((Thrd__Park_cancel(atom_V$u32* sleepers))(void)) {
+    atom_V_fetchSub(sleepers, 1, atom_MemOrd_monotonic);
+};
+
+fn_((Thrd__Park_wait(atom_V$u32* sleepers, atom_V$u32* wake_seq, u32 seq))(void)) {
+    Thrd_Ftx_wait(wake_seq, seq);
+    atom_V_fetchSub(sleepers, 1, atom_MemOrd_monotonic);
+};
+
+fn_((Thrd__Park_shutdown(atom_V$u32* is_shutdown, atom_V$u32* wake_seq))(void)) {
+    atom_V_store(is_shutdown, 1, atom_MemOrd_seq_cst);
+    atom_V_fetchAdd(wake_seq, 1, atom_MemOrd_release);
+    Thrd_Ftx_wake(wake_seq, u32_limit_max);
+};
+
+#if defined(__cplusplus)
+} /* extern "C" */
+#endif /* defined(__cplusplus) */
+#endif /* Thrd_internal_steal__included */
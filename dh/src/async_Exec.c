@@ -0,0 +1,398 @@
+#include "dh/async/Exec.h"
+#include "dh/mem/common.h"
+#include "dh/time/common.h"
+
+T_use$((Co_Ctx)(P));
+T_use$((P$Co_Ctx)(S));
+
+/// Bucket indices of the due and parked lists, past the last wheel slot
+#define Co_Exec__bucket_due (Co_Exec_wheel_levels * Co_Exec_wheel_slots)
+#define Co_Exec__bucket_parked (Co_Exec__bucket_due + 1)
+#define Co_Exec__slot_mask (as$(u64)(Co_Exec_wheel_slots - 1))
+#define Co_Exec__span_bits (Co_Exec_wheel_bits * Co_Exec_wheel_levels)
+
+// ============================================================================
+// Intrusive Lists
+// ============================================================================
+
+$attr($inline_always)
+$static fn_((List_init(Co_Timer_Link* head))(void)) {
+    head->prev = head;
+    head->next = head;
+};
+
+$attr($inline_always)
+$static fn_((List_isEmpty(const Co_Timer_Link* head))(bool)) {
+    return head->next == head;
+};
+
+$attr($inline_always)
+$static fn_((List_append(Co_Timer_Link* head, Co_Timer_Link* node))(void)) {
+    node->prev = head->prev;
+    node->next = head;
+    head->prev->next = node;
+    head->prev = node;
+};
+
+$attr($inline_always)
+$static fn_((List_unlink(Co_Timer_Link* node))(void)) {
+    node->prev->next = node->next;
+    node->next->prev = node->prev;
+    node->prev = null;
+    node->next = null;
+};
+
+/// Moves every node of `src` to the end of `dst`, leaving `src` empty
+$attr($inline_always)
+$static fn_((List_splice(Co_Timer_Link* dst, Co_Timer_Link* src))(void)) {
+    if (List_isEmpty(src)) { return; }
+    src->next->prev = dst->prev;
+    dst->prev->next = src->next;
+    src->prev->next = dst;
+    dst->prev = src->prev;
+    List_init(src);
+};
+
+$attr($inline_always)
+$static fn_((List_timer(Co_Timer_Link* node))(Co_Timer*)) {
+    return as$(Co_Timer*)(node);
+};
+
+// ============================================================================
+// Wheel
+// ============================================================================
+
+$attr($inline_always)
+$static fn_((nanosOf(time_Duration dur))(u64)) {
+    return u64_addSat(u64_mulSat(dur.secs, time_nanos_per_sec), dur.nanos);
+};
+
+/// Ticks from `origin` to `at`, rounded down; instants before `origin` map to zero
+$static fn_((ticksAt(const Co_Exec* self, time_Instant at))(u64)) {
+    let since = orelse_((time_Instant_durationSinceChkd(at, self->origin))(time_Duration_zero));
+    return nanosOf(since) / self->tick_ns;
+};
+
+$attr($inline_always)
+$static fn_((bucketAt(Co_Exec* self, u32 bucket))(Co_Timer_Link*)) {
+    return A_at((self->buckets)[bucket]);
+};
+
+/// Links `timer` under its deadline: the due list if it has passed, otherwise the slot of
+/// the highest tick digit that differs from the clock (the top level when it is a later lap)
+$static fn_((insert(Co_Exec* self, Co_Timer* timer))(void)) {
+    if (timer->deadline <= self->now) {
+        List_append(&self->due, &timer->link);
+        timer->bucket = Co_Exec__bucket_due;
+        self->due_len++;
+        return;
+    }
+    // Beyond the span, park at the farthest reachable slot and re-park from there
+    let span_last = (lit_n$(u64)(1) << Co_Exec__span_bits) - 1;
+    let target = timer->deadline - self->now <= span_last ? timer->deadline : self->now + span_last;
+    let differs = (63 - mem_leadingZeros64(target ^ self->now)) / Co_Exec_wheel_bits;
+    let level = prim_min(differs, Co_Exec_wheel_levels - 1);
+    let slot = as$(u32)((target >> (level * Co_Exec_wheel_bits)) & Co_Exec__slot_mask);
+    let bucket = level * Co_Exec_wheel_slots + slot;
+    List_append(bucketAt(self, bucket), &timer->link);
+    timer->bucket = as$(u16)(bucket);
+    *A_at((self->occupied)[level]) |= lit_n$(u64)(1) << slot;
+};
+
+$static fn_((unlink(Co_Exec* self, Co_Timer* timer))(void)) {
+    List_unlink(&timer->link);
+    self->pending--;
+    if (timer->bucket == Co_Exec__bucket_due) {
+        self->due_len--;
+        return;
+    }
+    if (timer->bucket == Co_Exec__bucket_parked) { return; }
+    if (List_isEmpty(bucketAt(self, timer->bucket))) {
+        let level = timer->bucket / Co_Exec_wheel_slots;
+        let slot = timer->bucket % Co_Exec_wheel_slots;
+        *A_at((self->occupied)[level]) &= ~(lit_n$(u64)(1) << slot);
+    }
+};
+
+/// First tick after the clock at which some occupied slot has to be visited
+$static fn_((nextTick(const Co_Exec* self))(u64)) {
+    var_(next, u64) = u64_limit_max;
+    for (u32 level = 0; level < Co_Exec_wheel_levels; ++level) {
+        let occupied = *A_at((self->occupied)[level]);
+        if (occupied == 0) { continue; }
+        let shift = level * Co_Exec_wheel_bits;
+        let lap = lit_n$(u64)(1) << (shift + Co_Exec_wheel_bits);
+        let base = self->now & ~(lap - 1);
+        let cur = as$(u32)((self->now >> shift) & Co_Exec__slot_mask);
+        let ahead = cur == Co_Exec__slot_mask ? 0 : occupied & (u64_limit_max << (cur + 1));
+        let tick = ahead != 0
+                     ? base + (as$(u64)(mem_trailingZeros64(ahead)) << shift)
+                     : base + lap + (as$(u64)(mem_trailingZeros64(occupied)) << shift);
+        next = prim_min(next, tick);
+    }
+    return next;
+};
+
+/// Visits every slot the clock has just reached; level 0 expires as a whole, higher ones cascade down
+$static fn_((expireNow(Co_Exec* self))(void)) {
+    for (u32 level = Co_Exec_wheel_levels; level-- > 0;) {
+        let shift = level * Co_Exec_wheel_bits;
+        if ((self->now & ((lit_n$(u64)(1) << shift) - 1)) != 0) { continue; }
+        let slot = as$(u32)((self->now >> shift) & Co_Exec__slot_mask);
+        let bit = lit_n$(u64)(1) << slot;
+        if ((*A_at((self->occupied)[level]) & bit) == 0) { continue; }
+        *A_at((self->occupied)[level]) &= ~bit;
+        let head = bucketAt(self, level * Co_Exec_wheel_slots + slot);
+        if (level == 0) {
+            // Every timer in a level-0 slot has exactly this deadline
+            for (var node = head->next; node != head; node = node->next) {
+                List_timer(node)->bucket = Co_Exec__bucket_due;
+                self->due_len++;
+            }
+            List_splice(&self->due, head);
+            continue;
+        }
+        var_(cascade, Co_Timer_Link) = {};
+        List_init(&cascade);
+        List_splice(&cascade, head);
+        while (!List_isEmpty(&cascade)) {
+            let timer = List_timer(cascade.next);
+            List_unlink(&timer->link);
+            insert(self, timer);
+        }
+    }
+};
+
+/// Grows the ready ring to hold `additional` more frames, unwrapping it in the new buffer
+$static fn_((reserveReady(Co_Exec* self, usize additional))(mem_Err$void) $scope) {
+    let needed = self->ready_len + additional;
+    if (needed <= self->ready_cap) { return_ok({}); }
+    var new_cap = prim_max(self->ready_cap, arch_cache_line_bytes / sizeOf$(Co_Ctx*));
+    while (new_cap < needed) {
+        if (usize_limit_max / 2 < new_cap) { return_err(mem_Err_OutOfMemory()); }
+        new_cap *= 2;
+    }
+    let new_ready = u_castS$((S$P$Co_Ctx)(try_(mem_Allocator_alloc(self->gpa, typeInfo$(P$Co_Ctx), new_cap))));
+    if (self->ready_cap != 0) {
+        let mask = self->ready_cap - 1;
+        for (usize i = 0; i < self->ready_len; ++i) {
+            *S_at((new_ready)[i]) = self->ready[(self->ready_head + i) & mask];
+        }
+        mem_Allocator_free(self->gpa, u_anyS((S$P$Co_Ctx){ .ptr = self->ready, .len = self->ready_cap }));
+    }
+    self->ready = new_ready.ptr;
+    self->ready_head = 0;
+    self->ready_cap = new_cap;
+    return_ok({});
+} $unscoped_(fn);
+
+$attr($inline_always)
+$static fn_((pushReady(Co_Exec* self, Co_Ctx* frame))(void)) {
+    claim_assert(self->ready_len < self->ready_cap);
+    self->ready[(self->ready_head + self->ready_len) & (self->ready_cap - 1)] = frame;
+    self->ready_len++;
+};
+
+// ============================================================================
+// Timer
+// ============================================================================
+
+fn_((Co_Timer_isPending(const Co_Timer* self))(bool)) {
+    claim_assert_nonnull(self);
+    return self->link.next != null;
+};
+
+fn_((Co_Timer_isExpired(const Co_Timer* self))(bool)) {
+    claim_assert_nonnull(self);
+    return self->state == Co_Timer_State_expired;
+};
+
+// ============================================================================
+// Executor
+// ============================================================================
+
+fn_((Co_Exec_init(Co_Exec* self, mem_Allocator gpa, time_Duration tick))(void)) {
+    claim_assert_nonnull(self);
+    let tick_ns = nanosOf(tick);
+    claim_assert(tick_ns != 0);
+    *self = (Co_Exec){
+        .gpa = gpa,
+        .origin = time_Instant_now(),
+        .tick_ns = tick_ns,
+        .now = 0,
+        .pending = 0,
+        .occupied = A_zero(),
+        .due_len = 0,
+        .ready = null,
+        .ready_head = 0,
+        .ready_len = 0,
+        .ready_cap = 0,
+    };
+    for (u32 bucket = 0; bucket < Co_Exec__bucket_due; ++bucket) { List_init(bucketAt(self, bucket)); }
+    List_init(&self->parked);
+    List_init(&self->due);
+};
+
+fn_((Co_Exec_fini(Co_Exec* self))(void)) {
+    claim_assert_nonnull(self);
+    if (self->ready_cap != 0) {
+        mem_Allocator_free(self->gpa, u_anyS((S$P$Co_Ctx){ .ptr = self->ready, .len = self->ready_cap }));
+    }
+    self->ready = null;
+    self->ready_len = 0;
+    self->ready_cap = 0;
+};
+
+fn_((Co_Exec_now(const Co_Exec* self))(time_Instant)) {
+    claim_assert_nonnull(self);
+    return time_Instant_addDuration(self->origin, time_Duration_fromNanos(u64_mulSat(self->now, self->tick_ns)));
+};
+
+fn_((Co_Exec_untilNext(const Co_Exec* self))(O$time_Duration) $scope) {
+    claim_assert_nonnull(self);
+    if (self->ready_len != 0 || self->due_len != 0) { return_some(time_Duration_zero); }
+    let tick = nextTick(self);
+    if (tick == u64_limit_max) { return_none(); }
+    let next = time_Instant_addDuration(self->origin, time_Duration_fromNanos(u64_mulSat(tick, self->tick_ns)));
+    return_some(orelse_((time_Instant_durationSinceChkd(next, time_Instant_now()))(time_Duration_zero)));
+} $unscoped_(fn);
+
+fn_((Co_Exec_isIdle(const Co_Exec* self))(bool)) {
+    claim_assert_nonnull(self);
+    return self->ready_len == 0 && self->pending == 0;
+};
+
+fn_((Co_Exec_readyLen(const Co_Exec* self))(usize)) {
+    claim_assert_nonnull(self);
+    return self->ready_len;
+};
+
+fn_((Co_Exec_pendingLen(const Co_Exec* self))(usize)) {
+    claim_assert_nonnull(self);
+    return self->pending;
+};
+
+fn_((Co_Exec_arm(Co_Exec* self, Co_Timer* timer, Co_Ctx* frame, time_Duration after))(void)) {
+    claim_assert_nonnull(self);
+    claim_assert_nonnull(timer);
+    claim_assert_nonnull(frame);
+    if (Co_Timer_isPending(timer)) { unlink(self, timer); }
+    // Round up so a timer never expires before `after` has passed on the wheel clock
+    let nanos = nanosOf(after);
+    let ticks = nanos / self->tick_ns + (nanos % self->tick_ns != 0);
+    timer->deadline = u64_addSat(self->now, ticks);
+    timer->frame = frame;
+    timer->state = Co_Timer_State_armed;
+    self->pending++;
+    insert(self, timer);
+};
+
+fn_((Co_Exec_armAt(Co_Exec* self, Co_Timer* timer, Co_Ctx* frame, time_Instant deadline))(void)) {
+    claim_assert_nonnull(self);
+    let since = orelse_((time_Instant_durationSinceChkd(deadline, Co_Exec_now(self)))(time_Duration_zero));
+    Co_Exec_arm(self, timer, frame, since);
+};
+
+fn_((Co_Exec_park(Co_Exec* self, Co_Timer* timer, Co_Ctx* frame))(void)) {
+    claim_assert_nonnull(self);
+    claim_assert_nonnull(timer);
+    claim_assert_nonnull(frame);
+    if (Co_Timer_isPending(timer)) { unlink(self, timer); }
+    timer->deadline = u64_limit_max;
+    timer->frame = frame;
+    timer->state = Co_Timer_State_armed;
+    timer->bucket = Co_Exec__bucket_parked;
+    self->pending++;
+    List_append(&self->parked, &timer->link);
+};
+
+fn_((Co_Exec_cancel(Co_Exec* self, Co_Timer* timer))(bool)) {
+    claim_assert_nonnull(self);
+    claim_assert_nonnull(timer);
+    if (!Co_Timer_isPending(timer)) { return false; }
+    unlink(self, timer);
+    if (timer->state == Co_Timer_State_armed) { timer->state = Co_Timer_State_idle; }
+    return true;
+};
+
+fn_((Co_Exec_wake(Co_Exec* self, Co_Timer* timer))(bool)) {
+    claim_assert_nonnull(self);
+    claim_assert_nonnull(timer);
+    if (!Co_Timer_isPending(timer)) { return false; }
+    if (timer->bucket != Co_Exec__bucket_due) {
+        unlink(self, timer);
+        self->pending++;
+        timer->deadline = self->now;
+        insert(self, timer);
+    }
+    timer->state = Co_Timer_State_notified;
+    return true;
+};
+
+fn_((Co_Exec_spawn(Co_Exec* self, Co_Ctx* frame))(mem_Err$void) $scope) {
+    claim_assert_nonnull(self);
+    claim_assert_nonnull(frame);
+    try_(reserveReady(self, 1));
+    pushReady(self, frame);
+    return_ok({});
+} $unscoped_(fn);
+
+fn_((Co_Exec_advanceTo(Co_Exec* self, time_Instant until))(void)) {
+    claim_assert_nonnull(self);
+    let target = ticksAt(self, until);
+    while (self->now < target) {
+        let next = nextTick(self);
+        if (target < next) {
+            self->now = target;
+            break;
+        }
+        self->now = next;
+        expireNow(self);
+    }
+};
+
+fn_((Co_Exec_drain(Co_Exec* self))(mem_Err$void) $scope) {
+    claim_assert_nonnull(self);
+    // Reserve first so a failed allocation leaves every timer in the due list
+    try_(reserveReady(self, self->due_len));
+    while (!List_isEmpty(&self->due)) {
+        let timer = List_timer(self->due.next);
+        unlink(self, timer);
+        if (timer->state == Co_Timer_State_armed) { timer->state = Co_Timer_State_expired; }
+        pushReady(self, timer->frame);
+    }
+    return_ok({});
+} $unscoped_(fn);
+
+fn_((Co_Exec_runReady(Co_Exec* self))(usize)) {
+    claim_assert_nonnull(self);
+    var_(resumed, usize) = 0;
+    for (usize batch = self->ready_len; batch != 0; --batch) {
+        let frame = self->ready[self->ready_head];
+        self->ready_head = (self->ready_head + 1) & (self->ready_cap - 1);
+        self->ready_len--;
+        // A frame queued twice may have returned on its first resume
+        if (frame->state == Co_State_ready) { continue; }
+        resume_(frame);
+        resumed++;
+    }
+    return resumed;
+};
+
+fn_((Co_Exec_poll(Co_Exec* self))(mem_Err$void) $scope) {
+    claim_assert_nonnull(self);
+    Co_Exec_advanceTo(self, time_Instant_now());
+    try_(Co_Exec_drain(self));
+    let_ignore = Co_Exec_runReady(self);
+    return_ok({});
+} $unscoped_(fn);
+
+fn_((Co_Exec_run(Co_Exec* self))(mem_Err$void) $scope) {
+    claim_assert_nonnull(self);
+    while (true) {
+        try_(Co_Exec_poll(self));
+        let wait = orelse_((Co_Exec_untilNext(self))(break));
+        if (!time_Duration_isZero(wait)) { time_sleep(wait); }
+    }
+    return_ok({});
+} $unscoped_(fn);
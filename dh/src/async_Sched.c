@@ -0,0 +1,379 @@
+#include "dh/async/Sched.h"
+#include "dh/mem/common.h"
+#include "Thrd_internal_steal.h"
+
+T_use$((Co_Task)(P));
+T_use$((P$Co_Task)(S));
+
+/*========== Internal Declarations ==========================================*/
+
+/// Worker of the scheduler the current thread belongs to (null on non-worker threads).
+$static $Thrd_local var_(Co_Sched__tls_worker, Co_Sched_Worker*) = null;
+/// Task whose frame the current thread is resuming.
+$static $Thrd_local var_(Co_Sched__tls_task, Co_Task*) = null;
+
+$attr($inline_always)
+$static fn_((Co_Sched__currentWorker(const Co_Sched* self))(Co_Sched_Worker*));
+$static fn_((Co_Sched__submit(Co_Sched* self, Co_Task* task))(void));
+$static fn_((Co_Sched__findTask(Co_Sched* self, Co_Sched_Worker* worker))(Co_Task*));
+$static fn_((Co_Sched__run(Co_Sched_Worker* worker, Co_Task* task))(void));
+
+/* Chase-Lev deque on `Thrd__Deque` indices */
+$static fn_((Co_Sched__pushBottom(Co_Sched_Worker* worker, Co_Task* task))(bool));
+$static fn_((Co_Sched__popBottom(Co_Sched_Worker* worker))(Co_Task*));
+$static fn_((Co_Sched__stealTop(Co_Sched_Worker* victim))(Co_Task*));
+
+$static fn_((Co_Sched__injectorPush(Co_Sched* self, Co_Task* task))(void));
+$static fn_((Co_Sched__injectorPop(Co_Sched* self))(Co_Task*));
+
+$static fn_((Co_Mailbox__push(Co_Mailbox* self, Co_Mailbox_Node* node))(void));
+
+$static fn_((Co_Sched__freeDeques(Co_Sched* self, usize allocated))(void));
+$static fn_((Co_Sched__stopWorkers(Co_Sched* self, usize spawned))(void));
+$static Thrd_fn_(Co_Sched__workerMain, ({ Co_Sched_Worker* worker; }, Void));
+
+/*========== External Definitions ===========================================*/
+
+fn_((Co_Sched_init(Co_Sched* self, mem_Allocator gpa, Co_Sched_Cfg cfg))(E$void) $guard) {
+    claim_assert_nonnull(self);
+    let thrd_count = cfg.thrd_count != 0
+        ? as$(usize)(cfg.thrd_count)
+        : prim_max(catch_((Thrd_cpuCount())($ignore, 1)), as$(usize)(1));
+    var_(deque_cap, u32) = prim_max(cfg.deque_cap, as$(u32)(2));
+    if ((deque_cap & (deque_cap - 1)) != 0) { deque_cap = as$(u32)(1) << (32 - mem_leadingZeros32(deque_cap)); }
+
+    *self = (Co_Sched){
+        .gpa = gpa,
+        .workers = u_castS$((S$Co_Sched_Worker)(try_(mem_Allocator_alloc(gpa, typeInfo$(Co_Sched_Worker), thrd_count)))),
+        .injector = {
+            .mtx = Thrd_Mtx_init(),
+            .head = null,
+            .tail = null,
+            .queued = atom_V_init(0),
+        },
+        .live = atom_V_init(0),
+        .sleepers = atom_V_init(0),
+        .wake_seq = atom_V_init(0),
+        .is_shutdown = atom_V_init(0),
+    };
+    errdefer_($ignore, mem_Allocator_free(gpa, u_anyS(self->workers)));
+
+    /* Deques first: a worker may steal from any other as soon as it starts */
+    var_(allocated, usize) = 0;
+    errdefer_($ignore, Co_Sched__freeDeques(self, allocated));
+    for_(($s(self->workers))(worker) {
+        let tasks = u_castS$((S$P$Co_Task)(try_(mem_Allocator_alloc(gpa, typeInfo$(P$Co_Task), deque_cap))));
+        asg_lit((worker)({
+            .top = atom_V_init(0),
+            .bottom = atom_V_init(0),
+            .tasks = tasks.ptr,
+            .cap = tasks.len,
+            .sched = self,
+            .thrd = {},
+            .rng = 0x9e3779b97f4a7c15ull * (allocated + 1),
+            .resumed = 0,
+            .idx = intCast$((u32)(allocated)),
+        }));
+        allocated++;
+    });
+
+    var_(spawned, usize) = 0;
+    errdefer_($ignore, Co_Sched__stopWorkers(self, spawned));
+    let spawn_cfg = (Thrd_SpawnCfg){ .allocator = none(), .stack_size = cfg.stack_size };
+    for_(($s(self->workers))(worker) {
+        let ctx = u_castP$((Thrd_FnCtx$(Co_Sched__workerMain)*)(try_(mem_Allocator_create(
+            gpa, typeInfo$(Thrd_FnCtx$(Co_Sched__workerMain))
+        ))));
+        *ctx = Thrd_FnCtx_from$((Co_Sched__workerMain)(worker));
+        worker->thrd = catch_((Thrd_spawn(spawn_cfg, ctx->as_raw))(err, {
+            mem_Allocator_destroy(gpa, u_anyP(ctx));
+            return_err(err);
+        }));
+        spawned++;
+    });
+    return_ok({});
+} $unguarded_(fn);
+
+fn_((Co_Sched_fini(Co_Sched* self))(void)) {
+    claim_assert_nonnull(self);
+    claim_assert(Co_Sched__currentWorker(self) == null);
+    Co_Sched_wait(self);
+    Co_Sched__stopWorkers(self, self->workers.len);
+    Co_Sched__freeDeques(self, self->workers.len);
+    mem_Allocator_free(self->gpa, u_anyS(self->workers));
+    Thrd_Mtx_fini(&self->injector.mtx);
+    self->workers = (S$Co_Sched_Worker){};
+};
+
+fn_((Co_Sched_thrdCount(const Co_Sched* self))(usize)) {
+    return self->workers.len;
+};
+
+fn_((Co_Sched_spawn(Co_Sched* self, Co_Task* task, Co_Ctx* frame))(void)) {
+    claim_assert_nonnull(self);
+    claim_assert_nonnull(task);
+    claim_assert_nonnull(frame);
+    task->frame = frame;
+    task->sched = self;
+    task->next = null;
+    /* A wake landing before this store sees `unspawned` and is dropped */
+    atom_V_store(&task->state, Co_Task_State_scheduled, atom_MemOrd_release);
+    atom_V_fetchAdd(&self->live, 1, atom_MemOrd_monotonic);
+    Co_Sched__submit(self, task);
+};
+
+fn_((Co_Sched_wait(Co_Sched* self))(void)) {
+    claim_assert_nonnull(self);
+    claim_assert(Co_Sched__currentWorker(self) == null);
+    while (true) {
+        let live = atom_V_load(&self->live, atom_MemOrd_acquire);
+        if (live == 0) { break; }
+        Thrd_Ftx_wait(&self->live, live);
+    }
+};
+
+fn_((Co_Sched_currentTask(void))(Co_Task*)) {
+    return Co_Sched__tls_task;
+};
+
+fn_((Co_Task_wake(Co_Task* self))(void)) {
+    claim_assert_nonnull(self);
+    var state = atom_V_load(&self->state, atom_MemOrd_acquire);
+    while (true) {
+        switch (state) {
+        case Co_Task_State_idle:
+            if (isNone(atom_V_cmpXchgStrong(&self->state, state, Co_Task_State_scheduled, atom_MemOrd_acq_rel, atom_MemOrd_acquire))) {
+                Co_Sched__submit(self->sched, self);
+                return;
+            }
+            break;
+        case Co_Task_State_running:
+            if (isNone(atom_V_cmpXchgStrong(&self->state, state, Co_Task_State_notified, atom_MemOrd_acq_rel, atom_MemOrd_acquire))) {
+                return;
+            }
+            break;
+        default:
+            /* Not spawned, already queued, already marked, or finished */
+            return;
+        }
+        state = atom_V_load(&self->state, atom_MemOrd_acquire);
+    }
+};
+
+fn_((Co_Task_isDone(const Co_Task* self))(bool)) {
+    claim_assert_nonnull(self);
+    return atom_V_load(&self->state, atom_MemOrd_acquire) == Co_Task_State_done;
+};
+
+fn_((Co_Mailbox_init(Co_Mailbox* self, Co_Task* owner))(void)) {
+    claim_assert_nonnull(self);
+    self->stub.next = null;
+    self->in = &self->stub;
+    self->out = &self->stub;
+    self->owner = owner;
+};
+
+fn_((Co_Mailbox_send(Co_Mailbox* self, Co_Mailbox_Node* node))(void)) {
+    claim_assert_nonnull(self);
+    claim_assert_nonnull(node);
+    Co_Mailbox__push(self, node);
+    if (self->owner != null) { Co_Task_wake(self->owner); }
+};
+
+fn_((Co_Mailbox_tryRecv(Co_Mailbox* self))(O$P$Co_Mailbox_Node) $scope) {
+    claim_assert_nonnull(self);
+    var out = self->out;
+    var next = atom_load(&out->next, atom_MemOrd_acquire);
+    if (out == &self->stub) {
+        if (next == null) { return_none(); }
+        self->out = next;
+        out = next;
+        next = atom_load(&out->next, atom_MemOrd_acquire);
+    }
+    if (next != null) {
+        self->out = next;
+        return_some(out);
+    }
+    /* `out` is the last node linked so far; a sender may be between its swap and its link */
+    if (out != atom_load(&self->in, atom_MemOrd_acquire)) { return_none(); }
+    /* Re-append the stub so `out` gains a successor and can be handed out */
+    Co_Mailbox__push(self, &self->stub);
+    next = atom_load(&out->next, atom_MemOrd_acquire);
+    if (next == null) { return_none(); }
+    self->out = next;
+    return_some(out);
+} $unscoped_(fn);
+
+/*========== Internal Definitions ===========================================*/
+
+$static fn_((Co_Sched__currentWorker(const Co_Sched* self))(Co_Sched_Worker*)) {
+    let worker = Co_Sched__tls_worker;
+    return worker != null && worker->sched == self ? worker : null;
+};
+
+$static fn_((Co_Sched__submit(Co_Sched* self, Co_Task* task))(void)) {
+    let worker = Co_Sched__currentWorker(self);
+    if (worker == null || !Co_Sched__pushBottom(worker, task)) { Co_Sched__injectorPush(self, task); }
+    Thrd__Park_notify(&self->sleepers, &self->wake_seq);
+};
+
+$static fn_((Co_Sched__findTask(Co_Sched* self, Co_Sched_Worker* worker))(Co_Task*)) {
+    if (worker != null) {
+        let task = Co_Sched__popBottom(worker);
+        if (task != null) { return task; }
+    }
+    let injected = Co_Sched__injectorPop(self);
+    if (injected != null) { return injected; }
+
+    let count = self->workers.len;
+    var_(start, usize) = 0;
+    if (worker != null) {
+        /* xorshift64 */
+        var_(x, u64) = worker->rng;
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        worker->rng = x;
+        start = as$(usize)(x % count);
+    }
+    for (usize i = 0; i < count; ++i) {
+        let victim = S_at((self->workers)[(start + i) % count]);
+        if (victim == worker) { continue; }
+        let task = Co_Sched__stealTop(victim);
+        if (task != null) { return task; }
+    }
+    return null;
+};
+
+$static fn_((Co_Sched__run(Co_Sched_Worker* worker, Co_Task* task))(void)) {
+    /* Only the holder of a scheduled task gets here, so a plain store claims it */
+    atom_V_store(&task->state, Co_Task_State_running, atom_MemOrd_monotonic);
+    Co_Sched__tls_task = task;
+    let frame = task->frame;
+    let_ignore = resume_(frame);
+    Co_Sched__tls_task = null;
+    worker->resumed++;
+
+    if (frame->state == Co_State_ready) {
+        let sched = task->sched;
+        atom_V_store(&task->state, Co_Task_State_done, atom_MemOrd_release);
+        if (atom_V_fetchSub(&sched->live, 1, atom_MemOrd_acq_rel) == 1) {
+            Thrd_Ftx_wake(&sched->live, u32_limit_max);
+        }
+        return;
+    }
+    if (isNone(atom_V_cmpXchgStrong(&task->state, Co_Task_State_running, Co_Task_State_idle, atom_MemOrd_acq_rel, atom_MemOrd_acquire))) {
+        return;
+    }
+    /* Woken while it ran: the wake left queueing to us. Requeue behind every other
+     * queued task; the LIFO deque would hand a yielding task straight back. */
+    let sched = task->sched;
+    atom_V_store(&task->state, Co_Task_State_scheduled, atom_MemOrd_monotonic);
+    Co_Sched__injectorPush(sched, task);
+    Thrd__Park_notify(&sched->sleepers, &sched->wake_seq);
+};
+
+$static fn_((Co_Sched__pushBottom(Co_Sched_Worker* worker, Co_Task* task))(bool)) {
+    let idx = orelse_((Thrd__Deque_reserve(&worker->top, &worker->bottom, worker->cap))(return false));
+    atom_store(&worker->tasks[Thrd__Deque_slot(idx, worker->cap)], task, atom_MemOrd_monotonic);
+    Thrd__Deque_publish(&worker->bottom, idx);
+    return true;
+};
+
+$static fn_((Co_Sched__popBottom(Co_Sched_Worker* worker))(Co_Task*)) {
+    let idx = orelse_((Thrd__Deque_take(&worker->top, &worker->bottom))(return null));
+    return atom_load(&worker->tasks[Thrd__Deque_slot(idx, worker->cap)], atom_MemOrd_monotonic);
+};
+
+$static fn_((Co_Sched__stealTop(Co_Sched_Worker* victim))(Co_Task*)) {
+    let idx = orelse_((Thrd__Deque_peek(&victim->top, &victim->bottom))(return null));
+    let task = atom_load(&victim->tasks[Thrd__Deque_slot(idx, victim->cap)], atom_MemOrd_monotonic);
+    return Thrd__Deque_claim(&victim->top, idx) ? task : null;
+};
+
+$static fn_((Co_Sched__injectorPush(Co_Sched* self, Co_Task* task))(void)) {
+    let inj = &self->injector;
+    task->next = null;
+    Thrd_Mtx_lock(&inj->mtx);
+    if (inj->tail != null) {
+        inj->tail->next = task;
+    } else {
+        inj->head = task;
+    }
+    inj->tail = task;
+    atom_V_fetchAdd(&inj->queued, 1, atom_MemOrd_release);
+    Thrd_Mtx_unlock(&inj->mtx);
+};
+
+$static fn_((Co_Sched__injectorPop(Co_Sched* self))(Co_Task*)) {
+    let inj = &self->injector;
+    if (atom_V_load(&inj->queued, atom_MemOrd_acquire) == 0) { return null; }
+    Thrd_Mtx_lock(&inj->mtx);
+    let task = inj->head;
+    if (task != null) {
+        inj->head = task->next;
+        if (inj->head == null) { inj->tail = null; }
+        atom_V_fetchSub(&inj->queued, 1, atom_MemOrd_release);
+    }
+    Thrd_Mtx_unlock(&inj->mtx);
+    return task;
+};
+
+$static fn_((Co_Mailbox__push(Co_Mailbox* self, Co_Mailbox_Node* node))(void)) {
+    atom_store(&node->next, null, atom_MemOrd_monotonic);
+    let prev = atom_fetchXchg(&self->in, node, atom_MemOrd_acq_rel);
+    /* Until this store the receiver sees the list cut at `prev` */
+    atom_store(&prev->next, node, atom_MemOrd_release);
+};
+
+$static fn_((Co_Sched__freeDeques(Co_Sched* self, usize allocated))(void)) {
+    let type = typeInfo$(P$Co_Task);
+    for_(($s(slice$S(self->workers, $r(0, allocated))))(worker) {
+        mem_Allocator_free(self->gpa, u_init$S((type)(worker->tasks, worker->cap)));
+    });
+};
+
+$static fn_((Co_Sched__stopWorkers(Co_Sched* self, usize spawned))(void)) {
+    Thrd__Park_shutdown(&self->is_shutdown, &self->wake_seq);
+    for_(($s(slice$S(self->workers, $r(0, spawned))))(worker) {
+        let ctx = Thrd_join(worker->thrd);
+        mem_Allocator_destroy(self->gpa, u_anyP(as$(Thrd_FnCtx$(Co_Sched__workerMain)*)(ctx)));
+    });
+};
+
+Thrd_fn_(Co_Sched__workerMain, ($ignore, args)$scope) {
+    let worker = args->worker;
+    let sched = worker->sched;
+    Co_Sched__tls_worker = worker;
+    var_(idle_rounds, u32) = 0;
+    while (true) {
+        var task = Co_Sched__findTask(sched, worker);
+        if (task != null) {
+            Co_Sched__run(worker, task);
+            idle_rounds = 0;
+            continue;
+        }
+        if (idle_rounds < Co_Sched_spin_rounds) {
+            idle_rounds++;
+            atom_spinLoopHint();
+            continue;
+        }
+        /* Park: register as sleeper, then re-check so a concurrent push cannot be missed */
+        let seq = Thrd__Park_begin(&sched->sleepers, &sched->wake_seq);
+        task = Co_Sched__findTask(sched, worker);
+        if (task != null) {
+            Thrd__Park_cancel(&sched->sleepers);
+            Co_Sched__run(worker, task);
+            idle_rounds = 0;
+            continue;
+        }
+        if (atom_V_load(&sched->is_shutdown, atom_MemOrd_acquire) != 0) {
+            Thrd__Park_cancel(&sched->sleepers);
+            break;
+        }
+        Thrd__Park_wait(&sched->sleepers, &sched->wake_seq, seq);
+        idle_rounds = 0;
+    }
+    Co_Sched__tls_worker = null;
+    return_({});
+} $unscoped_(Thrd_fn);
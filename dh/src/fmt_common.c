@@ -7,6 +7,12 @@ $attr($inline_always)
 $static fn_((fmt__digitToInt(u8 c))(u8));
 $attr($inline_always)
 $static fn_((fmt__skipWhitespace(S_const$u8 str))(S_const$u8));
+/// `str` without its trailing whitespace
+$attr($inline_always)
+$static fn_((fmt__trimTrailingWhitespace(S_const$u8 str))(S_const$u8));
+/// Value of a bare digit run in `base`, 8 digits per step for base 10
+$attr($must_check)
+$static fn_((fmt__parseDigits(S_const$u8 digits, u8 base))(E$u64));
 
 $attr($must_check)
 $static fn_((fmt__parseU8(S_const$u8 str))(E$u8));
@@ -100,6 +106,13 @@ $static fn_((fmt__parseFormatSpecOnce(S_const$u8 fmt))(E$fmt__ParsedFormatSpec))
 // Write literal text handling escaped braces
 $attr($must_check)
 $static fn_((fmt__writeLiteralChunk(io_Writer writer, S_const$u8 fmt, usize start, usize len))(E$void));
+// Write a compiled literal run, collapsing escaped braces only when it has any
+$attr($must_check)
+$static fn_((fmt__writeLiteral(io_Writer writer, S_const$u8 literal, bool escaped))(E$void));
+$static fn_((fmt__hasBrace(S_const$u8 literal))(bool));
+// `fmt_CompiledSite.state` before `fmt_CompiledSite_ready`
+#define fmt__CompiledSite_empty (0u)
+#define fmt__CompiledSite_claimed (1u)
 $static fn_((fmt__ArgValue_Tag_isInt(fmt__ArgValue_Tag tag))(bool));
 $static fn_((fmt__ArgValue_Tag_getIntSize(fmt__ArgValue_Tag tag))(u8));
 // Helper: Get most general compatible type
@@ -141,73 +154,122 @@ fn_((fmt_format(io_Writer writer, S_const$u8 fmt, ...))(E$void) $guard) {
     return_ok(try_(fmt_formatVaArgs(writer, fmt, va_args)));
 } $unguarded_(fn);
 
-/* TODO: Refactor this */
 fn_((fmt_formatVaArgs(io_Writer writer, S_const$u8 fmt, va_list va_args))(E$void) $scope) {
-    // Parse format string ONCE
-    let parsed = try_(fmt__parseFormatSpecOnce(fmt));
+    let compiled = try_(fmt_compile(fmt));
+    return_ok(try_(fmt_formatCompiledVaArgs(writer, &compiled, va_args)));
+} $unscoped_(fn);
+
+/* --- Compiled Formats --- */
 
-    // STEP 1: Determine the most general type needed for each argument
-    // by examining ALL occurrences that use that argument
-    var_(arg_general_types, A$$(fmt_max_args, O$fmt__ArgValue_Tag)) = A_zero();
+fn_((fmt_compile(S_const$u8 fmt))(E$fmt_Compiled) $scope) {
+    let parsed = try_(fmt__parseFormatSpecOnce(fmt));
+    var_(compiled, fmt_Compiled) = {};
+    for (u8 i = 0; i < fmt_max_args; ++i) {
+        *A_at((compiled.arg_tags)[i]) = fmt_Compiled_arg_unused;
+    }
+    var_(seen_args, u32) = 0;
     for (usize i = 0; i < parsed.occurrence_count; ++i) {
         let occurrence = A_at((parsed.occurrences)[i]);
         let arg_idx = occurrence->arg_index;
+        let literal = S_slice((fmt)$r(occurrence->literal_start, occurrence->literal_start + occurrence->literal_len));
+        asg_lit((A_at((compiled.specs)[compiled.spec_count++]))({
+            .spec = occurrence->spec,
+            .arg_index = arg_idx,
+            .literal_escaped = fmt__hasBrace(literal),
+            .literal = literal,
+        }));
+        // The first occurrence of an argument decides its wrapper
+        if ((seen_args & (1u << arg_idx)) == 0) {
+            seen_args |= 1u << arg_idx;
+            *A_at((compiled.arg_wrappers)[arg_idx]) = occurrence->spec.type_prefix;
+        }
+        // Reused arguments are read as the most general type of all their occurrences
         let tag = catch_((fmt__specToArgTag(occurrence->spec.type, occurrence->spec.size))($ignore, continue));
-        if_none((*A_at((arg_general_types)[arg_idx]))) {
-            // First occurrence of this arg - use its type
-            asg_lit((A_at((arg_general_types)[arg_idx]))(some(tag)));
-        } else_some((existing_tag)) {
-            // Argument reused - pick most general compatible type
-            let general_tag = fmt__ArgValue_Tag_getMostGeneralType(existing_tag, tag);
-            asg_lit((A_at((arg_general_types)[arg_idx]))(some(general_tag)));
-        }
+        let existing_tag = *A_at((compiled.arg_tags)[arg_idx]);
+        *A_at((compiled.arg_tags)[arg_idx]) = existing_tag == fmt_Compiled_arg_unused
+                                                ? as$(u8)(tag)
+                                                : as$(u8)(fmt__ArgValue_Tag_getMostGeneralType(existing_tag, tag));
     }
+    compiled.arg_count = parsed.occurrence_count == 0 ? 0 : as$(u8)(parsed.max_arg_index + 1);
+    compiled.trailing = S_slice((fmt)$r(parsed.trailing_literal_start, parsed.trailing_literal_start + parsed.trailing_literal_len));
+    compiled.trailing_escaped = fmt__hasBrace(compiled.trailing);
+    return_ok(compiled);
+} $unscoped_(fn);
 
-    // STEP 2: Build collection info using general types
-    var_(arg_collection_info, A$$(fmt_max_args, O$fmt__ArgInfo)) = A_zero();
-    for (usize i = 0; i < parsed.occurrence_count; ++i) {
-        let occurrence = A_at((parsed.occurrences)[i]);
-        let arg_idx = occurrence->arg_index;
-        // Skip if already have collection info for this arg
-        if_some((*A_at((arg_collection_info)[arg_idx]))(info)) {
-            let_ignore = info;
-        } else if_some((*A_at((arg_general_types)[arg_idx]))(general_tag)) {
-            asg_lit((A_at((arg_collection_info)[arg_idx]))(some({
-                .index = arg_idx,
-                .wrapper = occurrence->spec.type_prefix, // Use first occurrence's wrapper
-                .tag = general_tag // Use general type
-            })));
-        }
+fn_((fmt_formatCompiled(io_Writer writer, const fmt_Compiled* compiled, ...))(E$void) $guard) {
+    va_list va_args = null;
+    va_start(va_args, compiled);
+    defer_(va_end(va_args));
+    return_ok(try_(fmt_formatCompiledVaArgs(writer, compiled, va_args)));
+} $unguarded_(fn);
+
+fn_((fmt_formatCompiledVaArgs(io_Writer writer, const fmt_Compiled* compiled, va_list va_args))(E$void) $scope) {
+    claim_assert_nonnull(compiled);
+    if (writer.writeVec != null) {
+        // Unbuffered system sink: stage the literal chunks and argument output so the
+        // whole call costs one write (or one gather write when it overflows the stage)
+        var_(stage_buf, A$$(fmt__stage_len, u8)) = A_zero();
+        var stage = io_Buf_Writer_init(writer, A_ref$((S$u8)(stage_buf)));
+        try_(fmt_formatCompiledVaArgs(io_Buf_writer(&stage), compiled, va_args));
+        try_(io_Buf_Writer_flush(&stage));
+        return_ok({});
     }
 
-    // STEP 3: Collect all arguments from va_list in sequential order
-    var_(collected_args, A$$(fmt_max_args, O$fmt__ArgType)) = A_zero();
-    for (u8 i = 0; i <= parsed.max_arg_index && i < fmt_max_args; ++i) {
-        if_some((*A_at((arg_collection_info)[i]))(info)) {
-            let arg = fmt__collectArg(&va_args, info.wrapper, info.tag);
-            asg_lit((A_at((collected_args)[i]))(some(arg)));
-        } else_none {
+    // Collect all arguments from va_list in sequential order
+    var_(collected_args, A$$(fmt_max_args, fmt__ArgType)) = A_zero();
+    for (u8 i = 0; i < compiled->arg_count; ++i) {
+        let tag = *A_at((compiled->arg_tags)[i]);
+        if (tag == fmt_Compiled_arg_unused) {
             // Unused arg index - consume dummy
             let dummy = va_arg(va_args, Void);
             let_ignore = dummy;
+            continue;
         }
+        *A_at((collected_args)[i]) = fmt__collectArg(&va_args, *A_at((compiled->arg_wrappers)[i]), tag);
     }
 
-    // STEP 4: Format using per-occurrence specs
-    for (usize i = 0; i < parsed.occurrence_count; ++i) {
-        let occurrence = A_at((parsed.occurrences)[i]);
-        try_(fmt__writeLiteralChunk(writer, fmt, occurrence->literal_start, occurrence->literal_len));
-        let arg_idx = occurrence->arg_index;
-        if_some((*A_at((collected_args)[arg_idx]))(arg)) {
-            // Each occurrence has its own spec - no deduplication
-            try_(fmt__formatArg(writer, arg, occurrence->spec));
-        }
+    // Format using per-occurrence specs
+    for (u8 i = 0; i < compiled->spec_count; ++i) {
+        let spec = A_at((compiled->specs)[i]);
+        try_(fmt__writeLiteral(writer, spec->literal, spec->literal_escaped));
+        if (*A_at((compiled->arg_tags)[spec->arg_index]) == fmt_Compiled_arg_unused) { continue; }
+        try_(fmt__formatArg(writer, *A_at((collected_args)[spec->arg_index]), spec->spec));
     }
-
-    try_(fmt__writeLiteralChunk(writer, fmt, parsed.trailing_literal_start, parsed.trailing_literal_len));
+    try_(fmt__writeLiteral(writer, compiled->trailing, compiled->trailing_escaped));
     return_ok({});
 } $unscoped_(fn);
 
+fn_((fmt_formatSite(io_Writer writer, fmt_CompiledSite* site, S_const$u8 fmt, ...))(E$void) $guard) {
+    va_list va_args = null;
+    va_start(va_args, fmt);
+    defer_(va_end(va_args));
+    return_ok(try_(fmt_formatSiteVaArgs(writer, site, fmt, va_args)));
+} $unguarded_(fn);
+
+fn_((fmt_formatSiteVaArgs(io_Writer writer, fmt_CompiledSite* site, S_const$u8 fmt, va_list va_args))(E$void) $scope) {
+    claim_assert_nonnull(site);
+    if (atom_load(&site->state, atom_MemOrd_acquire) == fmt_CompiledSite_ready) {
+        if (site->fmt.ptr == fmt.ptr && site->fmt.len == fmt.len) {
+            return_ok(try_(fmt_formatCompiledVaArgs(writer, &site->compiled, va_args)));
+        }
+        // The site formats more than one string: the cached one stays, this one is parsed per call
+        let compiled = try_(fmt_compile(fmt));
+        return_ok(try_(fmt_formatCompiledVaArgs(writer, &compiled, va_args)));
+    }
+    // First use (or another thread is still publishing): compile locally, and
+    // publish it if no other thread has claimed the site yet
+    let compiled = try_(fmt_compile(fmt));
+    if_none((atom_cmpXchgStrong(
+        &site->state, fmt__CompiledSite_empty, fmt__CompiledSite_claimed,
+        atom_MemOrd_acquire, atom_MemOrd_monotonic
+    ))) {
+        site->fmt = fmt;
+        site->compiled = compiled;
+        atom_store(&site->state, fmt_CompiledSite_ready, atom_MemOrd_release);
+    }
+    return_ok(try_(fmt_formatCompiledVaArgs(writer, &compiled, va_args)));
+} $unscoped_(fn);
+
 /* --- Direct Type Formatting APIs --- */
 
 fn_((fmt_formatBool(io_Writer writer, bool val, fmt_Spec spec))(E$void)) {
@@ -505,67 +567,25 @@ fn_((fmt_format$S$u8(io_Writer writer, S_const$u8 str, fmt_Spec spec))(E$void))
 
 fn_((fmt_parseBool(S_const$u8 str))(E$bool) $scope) {
     str = fmt__skipWhitespace(str);
-    if (mem_eqlBytes(str, mem_asBytes(&u8_c('1')).as_const) || mem_eqlBytes(str, u8_l("true"))) { return_ok(true); }
-    if (mem_eqlBytes(str, mem_asBytes(&u8_c('0')).as_const) || mem_eqlBytes(str, u8_l("false"))) { return_ok(false); }
+    if (mem_eqlBytes(str, mem_asBytes(&u8_c('1')).as_const) || ascii_eqlIgnoreCase(str, u8_l("true"))) { return_ok(true); }
+    if (mem_eqlBytes(str, mem_asBytes(&u8_c('0')).as_const) || ascii_eqlIgnoreCase(str, u8_l("false"))) { return_ok(false); }
     return_err(fmt_Err_InvalidBoolFormat());
 } $unscoped_(fn);
 fn_((fmt_parse$bool(S_const$u8 str))(E$bool)) {
     return fmt_parseBool(str);
 };
 
-/* TODO: Refactor this */
 fn_((fmt_parseUInt(S_const$u8 str, u8 base))(E$u64) $scope) {
     str = fmt__skipWhitespace(str);
-    if (str.len == 0) {
-        return_err(fmt_Err_InvalidUIntFormat());
-    }
-    if (base < 2 || 36 < base) {
-        return_err(fmt_Err_InvalidUIntFormat());
-    }
-    u64 result = 0;
-    for (usize i = 0; i < str.len; ++i) {
-        u8 ch = str.ptr[i];
-        if (ascii_isWhitespace(ch)) {
-            break;
-        }
-        u8 digit_val = 0;
-        if (ascii_isDigit(ch)) {
-            digit_val = ch - u8_c('0');
-        } else if (u8_c('a') <= ch && ch <= u8_c('z')) {
-            digit_val = u8_add(10, ch - u8_c('a'));
-        } else if (u8_c('A') <= ch && ch <= u8_c('Z')) {
-            digit_val = u8_add(10, ch - u8_c('A'));
-        } else {
-            if (i == 0) {
-                return_err(fmt_Err_InvalidUIntFormat());
-            }
-            break;
-        }
-        if (digit_val >= base) {
-            if (i == 0) {
-                return_err(fmt_Err_InvalidUIntFormat());
-            }
-            break;
-        }
-        // Check for overflow using checked arithmetic
-        let mul_result = u64_mulChkd(result, base);
-        if (isNone(mul_result)) {
-            return_err(fmt_Err_InvalidUIntFormat());
-        }
-        let add_result = u64_addChkd(unwrap_(mul_result), digit_val);
-        if (isNone(add_result)) {
-            return_err(fmt_Err_InvalidUIntFormat());
-        }
-        result = unwrap_(add_result);
-    }
-    return_ok(result);
+    if (0 < str.len && *S_at((str)[0]) == u8_c('+')) { str = S_suffix((str)(1)); }
+    return fmt__parseDigits(fmt__trimTrailingWhitespace(str), base);
 } $unscoped_(fn);
 fn_((fmt_parse$usize(S_const$u8 str, u8 base))(E$usize) $scope) {
     let result = try_(fmt_parseUInt(str, base));
     if (result > usize_limit_max) {
         return_err(fmt_Err_InvalidUIntFormat());
     }
-    return_ok(as$(usize)(try_(fmt_parseUInt(str, base))));
+    return_ok(as$(usize)(result));
 } $unscoped_(fn);
 fn_((fmt_parse$u64(S_const$u8 str, u8 base))(E$u64)) {
     return fmt_parseUInt(str, base);
@@ -592,7 +612,6 @@ fn_((fmt_parse$u8(S_const$u8 str, u8 base))(E$u8) $scope) {
     return_ok(as$(u8)(result));
 } $unscoped_(fn);
 
-/* TODO: Refactor this */
 fn_((fmt_parseIInt(S_const$u8 str, u8 base))(E$i64) $scope) {
     str = fmt__skipWhitespace(str);
     if (str.len == 0) {
@@ -607,7 +626,7 @@ fn_((fmt_parseIInt(S_const$u8 str, u8 base))(E$i64) $scope) {
         str.ptr++;
         str.len--;
     }
-    let unsigned_result = try_(fmt_parseUInt(str, base));
+    let unsigned_result = try_(fmt__parseDigits(fmt__trimTrailingWhitespace(str), base));
     return_ok(expr_(i64 $scope)(if (negative) {
         let max_neg = as$(u64)(i64_limit_max) + 1;
         if (max_neg < unsigned_result) {
@@ -653,77 +672,9 @@ fn_((fmt_parse$i8(S_const$u8 str, u8 base))(E$i8) $scope) {
     return_ok(as$(i8)(result));
 } $unscoped_(fn);
 
-/* TODO: Refactor this */
-fn_((fmt_parseFlt(S_const$u8 str))(E$f64) $scope) {
-    str = fmt__skipWhitespace(str);
-    if (str.len == 0) {
-        return_err(fmt_Err_InvalidFltFormat());
-    }
-    usize pos = 0;
-    f64 sign = 1.0;
-    f64 result = 0.0;
-    bool has_int_part = false;
-    // Check for sign
-    if (pos < str.len && str.ptr[pos] == u8_c('+')) {
-        pos++;
-    } else if (pos < str.len && str.ptr[pos] == u8_c('-')) {
-        sign = -1.0;
-        pos++;
-    }
-    // Parse integer part
-    while (pos < str.len && ascii_isDigit(str.ptr[pos])) {
-        result = (result * 10.0) + (str.ptr[pos] - u8_c('0'));
-        has_int_part = true;
-        pos++;
-    }
-    // Parse fractional part
-    if (pos < str.len && str.ptr[pos] == u8_c('.')) {
-        pos++;
-        f64 power = 0.1;
-        bool has_frac_part = false;
-        while (pos < str.len && ascii_isDigit(str.ptr[pos])) {
-            result += (str.ptr[pos] - u8_c('0')) * power;
-            power *= 0.1;
-            has_frac_part = true;
-            pos++;
-        }
-        if (!has_int_part && !has_frac_part) {
-            return_err(fmt_Err_InvalidFltFormat());
-        }
-    } else {
-        if (!has_int_part) {
-            return_err(fmt_Err_InvalidFltFormat());
-        }
-    }
-    // Parse exponent part
-    if (pos < str.len && (str.ptr[pos] == u8_c('e') || str.ptr[pos] == u8_c('E'))) {
-        pos++;
-        f64 exp_sign = 1.0;
-        i32 exp_val = 0;
-        bool has_exp = false;
-
-        if (pos < str.len && str.ptr[pos] == u8_c('+')) {
-            pos++;
-        } else if (pos < str.len && str.ptr[pos] == u8_c('-')) {
-            exp_sign = -1.0;
-            pos++;
-        }
-        while (pos < str.len && ascii_isDigit(str.ptr[pos])) {
-            exp_val = (exp_val * 10) + (str.ptr[pos] - u8_c('0'));
-            has_exp = true;
-            pos++;
-        }
-        if (!has_exp) {
-            return_err(fmt_Err_InvalidFltFormat());
-        }
-        result *= __builtin_pow(10.0, exp_val * exp_sign);
-    }
-    // Check that we consumed all input
-    if (pos != str.len) {
-        return_err(fmt_Err_InvalidFltFormat());
-    }
-    return_ok(result * sign);
-} $unscoped_(fn);
+fn_((fmt_parseFlt(S_const$u8 str))(E$f64)) {
+    return fmt__parseFltImpl(fmt__skipWhitespace(str));
+};
 fn_((fmt_parse$f64(S_const$u8 str))(E$f64)) {
     return fmt_parseFlt(str);
 };
@@ -776,6 +727,57 @@ fn_((fmt__skipWhitespace(S_const$u8 str))(S_const$u8)) {
     return str;
 };
 
+fn_((fmt__trimTrailingWhitespace(S_const$u8 str))(S_const$u8)) {
+    var_(len, usize) = str.len;
+    while (0 < len && ascii_isWhitespace(*S_at((str)[len - 1]))) { len--; }
+    return S_prefix((str)(len));
+};
+
+fn_((fmt__parseDigits(S_const$u8 digits, u8 base))(E$u64) $scope) {
+    if (digits.len == 0 || base < 2 || 36 < base) {
+        return_err(fmt_Err_InvalidUIntFormat());
+    }
+    var_(result, u64) = 0;
+    var_(idx, usize) = 0;
+    if (base == 10) {
+        /* 19 digits always fit in u64, so the first two chunks need no overflow check */
+        while (idx + 8 <= digits.len && fmt__isEightDigits(fmt__loadEightBytes(digits.ptr + idx))) {
+            let chunk = fmt__parseEightDigits(fmt__loadEightBytes(digits.ptr + idx));
+            if (idx + 8 <= 19) {
+                result = result * 100000000ull + chunk;
+            } else {
+                let scaled = orelse_((u64_mulChkd(result, 100000000ull))(
+                    return_err(fmt_Err_InvalidUIntFormat())
+                ));
+                result = orelse_((u64_addChkd(scaled, chunk))(
+                    return_err(fmt_Err_InvalidUIntFormat())
+                ));
+            }
+            idx += 8;
+        }
+    }
+    for (; idx < digits.len; ++idx) {
+        let ch = *S_at((digits)[idx]);
+        let digit_val = expr_(u8 $scope)(if (ascii_isDigit(ch)) {
+            $break_(ch - u8_c('0'));
+        } else if (ascii_isAlpha(ch)) {
+            $break_(ascii_toLower(ch) - u8_c('a') + 10);
+        } else {
+            $break_(u8_limit_max);
+        }) $unscoped_(expr);
+        if (digit_val >= base) {
+            return_err(fmt_Err_InvalidUIntFormat());
+        }
+        let scaled = orelse_((u64_mulChkd(result, base))(
+            return_err(fmt_Err_InvalidUIntFormat())
+        ));
+        result = orelse_((u64_addChkd(scaled, digit_val))(
+            return_err(fmt_Err_InvalidUIntFormat())
+        ));
+    }
+    return_ok(result);
+} $unscoped_(fn);
+
 fn_((fmt__parseU8(S_const$u8 str))(E$u8) $scope) {
     // printf("--- debug print: fmt__parseU8 ---\n");
     if (str.len == 0 || !ascii_isDigit(*S_at((str)[0]))) {
@@ -1650,24 +1652,36 @@ fn_((fmt__parseFormatSpecOnce(S_const$u8 fmt))(E$fmt__ParsedFormatSpec) $scope)
 fn_((fmt__writeLiteralChunk(io_Writer writer, S_const$u8 fmt, usize start, usize len))(E$void) $scope) {
     if (len == 0) { return_ok({}); }
     let chunk = S_slice((fmt)$r(start, start + len));
+    // Write each run up to an escaped brace at once, keeping one brace of the pair
+    var_(run_start, usize) = 0;
     var_(pos, usize) = 0;
     while (pos < chunk.len) {
         let ch = *S_at((chunk)[pos]);
         // Check for escaped braces
-        if (ch == u8_c('{') && pos + 1 < chunk.len && *S_at((chunk)[pos + 1]) == u8_c('{')) {
-            try_(io_Writer_writeByte(writer, u8_c('{')));
-            pos += 2;
-        } else if (ch == u8_c('}') && pos + 1 < chunk.len && *S_at((chunk)[pos + 1]) == u8_c('}')) {
-            try_(io_Writer_writeByte(writer, u8_c('}')));
+        if ((ch == u8_c('{') || ch == u8_c('}')) && pos + 1 < chunk.len && *S_at((chunk)[pos + 1]) == ch) {
+            try_(io_Writer_writeBytes(writer, S_slice((chunk)$r(run_start, pos + 1))));
             pos += 2;
+            run_start = pos;
         } else {
-            try_(io_Writer_writeByte(writer, ch));
             pos++;
         }
     }
+    if (run_start < chunk.len) {
+        try_(io_Writer_writeBytes(writer, S_suffix((chunk)(run_start))));
+    }
     return_ok({});
 } $unscoped_(fn);
 
+fn_((fmt__writeLiteral(io_Writer writer, S_const$u8 literal, bool escaped))(E$void) $scope) {
+    if (escaped) { return_ok(try_(fmt__writeLiteralChunk(writer, literal, 0, literal.len))); }
+    if (literal.len == 0) { return_ok({}); }
+    return_ok(try_(io_Writer_writeBytes(writer, literal)));
+} $unscoped_(fn);
+
+fn_((fmt__hasBrace(S_const$u8 literal))(bool)) {
+    return isSome(mem_idxByte(literal, u8_c('{'))) || isSome(mem_idxByte(literal, u8_c('}')));
+};
+
 fn_((fmt__ArgValue_Tag_isInt(fmt__ArgValue_Tag tag))(bool)) {
     return (fmt__ArgValue_u8 <= tag && tag <= fmt__ArgValue_usize)
         || (fmt__ArgValue_i8 <= tag && tag <= fmt__ArgValue_isize);
@@ -26,9 +26,13 @@ extern "C" {
 #include "dh/mem/common.h"
 #include "dh/ascii.h"
 #include "dh/utf8.h"
+#include "dh/io/Buf.h"
 
 /*========== Macros and Declarations ========================================*/
 
+/// Stack buffer `fmt_formatVaArgs` gathers output into before an unbuffered sink
+#define fmt__stage_len (256u)
+
 /// Write content with padding according to format spec
 $attr($must_check)
 $extern fn_((fmt__writePadded(io_Writer writer, S_const$u8 content, fmt_Spec spec))(E$void));
@@ -37,6 +41,44 @@ $extern fn_((fmt__writePadded(io_Writer writer, S_const$u8 content, fmt_Spec spe
 $attr($must_check)
 $extern fn_((fmt__formatFltImpl(io_Writer writer, f64 val, fmt_Spec spec))(E$void));
 
+/// Parse a decimal or `0x` hexadecimal float, `inf` or `nan`; the whole of `str` must be consumed
+$attr($must_check)
+$extern fn_((fmt__parseFltImpl(S_const$u8 str))(E$f64));
+
+/// Load 8 bytes as a little-endian u64
+$attr($inline_always)
+$static fn_((fmt__loadEightBytes(const u8* p))(u64));
+/// Whether all 8 bytes of `chunk` are ASCII digits
+$attr($inline_always)
+$static fn_((fmt__isEightDigits(u64 chunk))(bool));
+/// Value of 8 ASCII digits, first digit in the lowest byte
+$attr($inline_always)
+$static fn_((fmt__parseEightDigits(u64 chunk))(u32));
+
+/*========== Macros and Definitions =========================================*/
+
+fn_((fmt__loadEightBytes(const u8* p))(u64)) {
+    var_(chunk, u64) = 0;
+    __builtin_memcpy(&chunk, p, sizeOf$(u64));
+    return mem_littleToNative64(chunk);
+};
+
+fn_((fmt__isEightDigits(u64 chunk))(bool)) {
+    /* '0'..'9' is 0x30..0x39: the high nibble must be 3 both before and after adding 6 */
+    return ((chunk & 0xF0F0F0F0F0F0F0F0ull) | (((chunk + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4)) == 0x3333333333333333ull;
+};
+
+fn_((fmt__parseEightDigits(u64 chunk))(u32)) {
+    chunk -= 0x3030303030303030ull;
+    /* pairs of digits, then pairs of pairs, then the two halves */
+    chunk = (chunk * 10) + (chunk >> 8);
+    return as$(u32)(
+        (((chunk & 0x000000FF000000FFull) * 0x000F424000000064ull)
+         + (((chunk >> 16) & 0x000000FF000000FFull) * 0x0000271000000001ull))
+        >> 32
+    );
+};
+
 #if defined(__cplusplus)
 } /* extern "C" */
 #endif /* defined(__cplusplus) */
@@ -1,5 +1,6 @@
 #include "fmt_internal.h"
 #include "fmt_internal_ryu.h"
+#include "fmt_internal_lemire.h"
 
 /*========== Constants ======================================================*/
 
@@ -445,3 +446,372 @@ fn_((fmt__formatFltImpl(io_Writer writer, f64 val, fmt_Spec spec))(E$void)) {
     S_const$u8 content = { .ptr = ptr$A(final_buf), .len = final_pos };
     return fmt__writePadded(writer, content, spec);
 };
+
+/*========== Parsing ========================================================*/
+
+/// Significant digits the Eisel-Lemire path reads; more are truncated and resolved by `roundDigits`
+#define fmt__parse_fast_digits (19u)
+/// Significant digits compared exactly; any digit past these only breaks ties
+#define fmt__parse_max_digits (768u)
+/// Exponent magnitude past which every finite input is already zero or infinity
+#define fmt__parse_exp_limit (0x10000)
+/// u32 limbs of the exact comparison; both sides stay below 2700 bits for any finite result
+#define fmt__parse_big_limbs (128u)
+
+/// Decimal input split into its digit runs
+typedef struct FltDigits {
+    S_const$u8 int_part;
+    S_const$u8 frac_part;
+    i64 exp_number;
+    /// First `fmt__parse_fast_digits` significant digits
+    u64 mantissa;
+    /// Decimal exponent of the last digit in `mantissa`
+    i64 exponent;
+    bool truncated;
+} FltDigits;
+
+/// Rounded binary64 as its biased exponent and 52-bit fraction
+typedef struct FltBinary {
+    u64 mantissa;
+    i32 power2;
+} FltBinary;
+
+typedef struct FltBig {
+    A$$(fmt__parse_big_limbs, u32) limbs;
+    usize len;
+} FltBig;
+
+/// Exactly representable powers of 10 for the Clinger fast path
+$static let_(fmt__parse_pow10, A$$(23, f64)) = A_init({
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+});
+
+/// Digit `idx` of the integer and fraction runs taken as one sequence
+$attr($inline_always)
+$static fn_((FltDigits_at(const FltDigits* self, usize idx))(u8)) {
+    return idx < self->int_part.len
+             ? *S_at((self->int_part)[idx])
+             : *S_at((self->frac_part)[idx - self->int_part.len]);
+};
+
+/// Accumulate a run of digits, 8 at a time while they last; wraps past 19 digits
+$static fn_((accumulateDigits(S_const$u8 digits, u64 value))(u64)) {
+    var_(idx, usize) = 0;
+    while (idx + 8 <= digits.len) {
+        value = value * 100000000ull + fmt__parseEightDigits(fmt__loadEightBytes(digits.ptr + idx));
+        idx += 8;
+    }
+    for (; idx < digits.len; ++idx) { value = value * 10 + (*S_at((digits)[idx]) - u8_c('0')); }
+    return value;
+};
+
+/// Length of the digit run at the front of `str`
+$static fn_((digitRunLen(S_const$u8 str))(usize)) {
+    var_(len, usize) = 0;
+    while (len + 8 <= str.len && fmt__isEightDigits(fmt__loadEightBytes(str.ptr + len))) { len += 8; }
+    while (len < str.len && ascii_isDigit(*S_at((str)[len]))) { len++; }
+    return len;
+};
+
+/// Parse `[eEpP][+-]digits` at the front of `str`; the marker is already checked
+$static fn_((parseExponent(S_const$u8 str, usize* pos, i64* exp))(bool)) {
+    var idx = *pos + 1;
+    var negative = false;
+    if (idx < str.len && (*S_at((str)[idx]) == u8_c('+') || *S_at((str)[idx]) == u8_c('-'))) {
+        negative = *S_at((str)[idx]) == u8_c('-');
+        idx++;
+    }
+    if (idx == str.len || !ascii_isDigit(*S_at((str)[idx]))) { return false; }
+    var_(value, i64) = 0;
+    for (; idx < str.len && ascii_isDigit(*S_at((str)[idx])); ++idx) {
+        if (value < fmt__parse_exp_limit) { value = value * 10 + (*S_at((str)[idx]) - u8_c('0')); }
+    }
+    *pos = idx;
+    *exp = negative ? -value : value;
+    return true;
+};
+
+/// Eisel-Lemire: w * 10^q correctly rounded, for w holding at most 19 digits
+$static fn_((computeFloat(i64 q, u64 w))(FltBinary)) {
+    if (w == 0 || q < fmt__lemire_min_exp10) { return (FltBinary){ .mantissa = 0, .power2 = 0 }; }
+    if (fmt__lemire_max_exp10 < q) { return (FltBinary){ .mantissa = 0, .power2 = 0x7FF }; }
+    let lz = as$(i32)(mem_leadingZeros64(w));
+    w <<= lz;
+    let pow5 = fmt__lemire_pow5(as$(i32)(q));
+    var product = fmt__lemire_mulFull(w, *A_at((pow5)[1]));
+    /* 55 bits are needed; widen with the low half of 5^q only when they may be off by one */
+    if ((*A_at((product)[1]) & 0x1FF) == 0x1FF) {
+        let second = fmt__lemire_mulFull(w, *A_at((pow5)[0]));
+        *A_at((product)[0]) += *A_at((second)[1]);
+        if (*A_at((second)[1]) > *A_at((product)[0])) { *A_at((product)[1]) += 1; }
+    }
+    let hi = *A_at((product)[1]);
+    let upper_bit = as$(i32)(hi >> 63);
+    let shift = upper_bit + 9;
+    var_(result, FltBinary) = {
+        .mantissa = hi >> shift,
+        .power2 = fmt__lemire_power(as$(i32)(q)) + upper_bit - lz + 1023,
+    };
+    if (result.power2 <= 0) {
+        /* subnormal */
+        if (64 <= -result.power2 + 1) { return (FltBinary){ .mantissa = 0, .power2 = 0 }; }
+        result.mantissa >>= -result.power2 + 1;
+        result.mantissa += result.mantissa & 1;
+        result.mantissa >>= 1;
+        result.power2 = result.mantissa < (1ull << 52) ? 0 : 1;
+        return result;
+    }
+    /* an exact halfway product can only happen for small q; round it to even */
+    if (*A_at((product)[0]) <= 1 && -4 <= q && q <= 23 && (result.mantissa & 3) == 1
+        && (result.mantissa << shift) == hi) {
+        result.mantissa &= ~1ull;
+    }
+    result.mantissa += result.mantissa & 1;
+    result.mantissa >>= 1;
+    if ((2ull << 52) <= result.mantissa) {
+        result.mantissa = 1ull << 52;
+        result.power2++;
+    }
+    result.mantissa &= ~(1ull << 52);
+    if (0x7FF <= result.power2) { return (FltBinary){ .mantissa = 0, .power2 = 0x7FF }; }
+    return result;
+};
+
+$static fn_((FltBig_mulAdd(FltBig* self, u32 mul, u32 add))(void)) {
+    var_(carry, u64) = add;
+    for (usize i = 0; i < self->len; ++i) {
+        let t = as$(u64)(*A_at((self->limbs)[i])) * mul + carry;
+        *A_at((self->limbs)[i]) = as$(u32)(t);
+        carry = t >> 32;
+    }
+    if (carry != 0) { *A_at((self->limbs)[self->len++]) = as$(u32)(carry); }
+};
+
+$static fn_((FltBig_mulPow5(FltBig* self, u32 exp))(void)) {
+    for (; 13 <= exp; exp -= 13) { FltBig_mulAdd(self, 1220703125u, 0); }
+    var_(pow5, u32) = 1;
+    for (; exp != 0; --exp) { pow5 *= 5; }
+    FltBig_mulAdd(self, pow5, 0);
+};
+
+$static fn_((FltBig_shl(FltBig* self, u32 bits))(void)) {
+    if (self->len == 0) { return; }
+    let words = bits / 32;
+    let rem = bits % 32;
+    if (rem != 0) {
+        var_(carry, u32) = 0;
+        for (usize i = 0; i < self->len; ++i) {
+            let limb = *A_at((self->limbs)[i]);
+            *A_at((self->limbs)[i]) = (limb << rem) | carry;
+            carry = limb >> (32 - rem);
+        }
+        if (carry != 0) { *A_at((self->limbs)[self->len++]) = carry; }
+    }
+    if (words != 0) {
+        for (usize i = self->len; 0 < i--;) { *A_at((self->limbs)[i + words]) = *A_at((self->limbs)[i]); }
+        for (usize i = 0; i < words; ++i) { *A_at((self->limbs)[i]) = 0; }
+        self->len += words;
+    }
+};
+
+$static fn_((FltBig_cmp(const FltBig* lhs, const FltBig* rhs))(i32)) {
+    if (lhs->len != rhs->len) { return lhs->len < rhs->len ? -1 : 1; }
+    for (usize i = lhs->len; 0 < i--;) {
+        let l = *A_at((lhs->limbs)[i]);
+        let r = *A_at((rhs->limbs)[i]);
+        if (l != r) { return l < r ? -1 : 1; }
+    }
+    return 0;
+};
+
+/// Choose between `lo_bits` and its successor by comparing every digit against their midpoint
+$static fn_((roundDigits(const FltDigits* digits, u64 lo_bits))(u64)) {
+    var_(exact, FltBig) = { .len = 0 };
+    let total = digits->int_part.len + digits->frac_part.len;
+    var_(kept, usize) = 0;
+    var_(last, usize) = 0;
+    var_(sticky, bool) = false;
+    var_(chunk, u32) = 0;
+    var_(chunk_pow10, u32) = 1;
+    for (usize idx = 0; idx < total; ++idx) {
+        let digit = FltDigits_at(digits, idx) - u8_c('0');
+        if (kept == 0 && digit == 0) { continue; }
+        if (kept == fmt__parse_max_digits) {
+            sticky |= digit != 0;
+            continue;
+        }
+        chunk = chunk * 10 + digit;
+        chunk_pow10 *= 10;
+        kept++;
+        last = idx;
+        if (chunk_pow10 == 1000000000u) {
+            FltBig_mulAdd(&exact, chunk_pow10, chunk);
+            chunk = 0;
+            chunk_pow10 = 1;
+        }
+    }
+    if (chunk_pow10 != 1) { FltBig_mulAdd(&exact, chunk_pow10, chunk); }
+    let exp10 = digits->exp_number - as$(i64)(digits->frac_part.len) + as$(i64)(total - 1 - last);
+
+    /* midpoint (2m + 1) * 2^(e2 - 1) of `lo_bits` and the next float up */
+    let biased = as$(i64)(lo_bits >> 52);
+    let m = (lo_bits & ((1ull << 52) - 1)) | (biased == 0 ? 0 : 1ull << 52);
+    let e2 = biased == 0 ? -1074 : biased - 1075;
+    let half = 2 * m + 1;
+    var_(midpoint, FltBig) = { .len = 0 };
+    *A_at((midpoint.limbs)[0]) = as$(u32)(half);
+    *A_at((midpoint.limbs)[1]) = as$(u32)(half >> 32);
+    midpoint.len = (half >> 32) == 0 ? 1 : 2;
+
+    if (0 <= exp10) {
+        FltBig_mulPow5(&exact, as$(u32)(exp10));
+    } else {
+        FltBig_mulPow5(&midpoint, as$(u32)(-exp10));
+    }
+    let shift = exp10 - (e2 - 1);
+    if (0 <= shift) {
+        FltBig_shl(&exact, as$(u32)(shift));
+    } else {
+        FltBig_shl(&midpoint, as$(u32)(-shift));
+    }
+    let order = FltBig_cmp(&exact, &midpoint);
+    if (0 < order || (order == 0 && (sticky || (lo_bits & 1) != 0))) { return lo_bits + 1; }
+    return lo_bits;
+};
+
+/// Round m * 2^e2 to binary64 bits, ties to even; `sticky` marks nonzero bits below `m`
+$static fn_((roundBinary(u64 m, i64 e2, bool sticky))(u64)) {
+    if (m == 0) { return 0; }
+    let lz = mem_leadingZeros64(m);
+    m <<= lz;
+    e2 -= lz;
+    var biased = e2 + 63 + 1023;
+    if (2046 < biased) { return 0x7FFull << 52; }
+    let shift = 1 <= biased ? 11 : 12 - biased;
+    if (64 < shift) { return 0; }
+    var_(mantissa, u64) = shift == 64 ? 0 : m >> shift;
+    let rem = shift == 64 ? m : m & ((1ull << shift) - 1);
+    let half = 1ull << (shift - 1);
+    if (half < rem || (rem == half && (sticky || (mantissa & 1) != 0))) { mantissa++; }
+    /* a subnormal rounding up to 2^52 lands on the smallest normal by itself */
+    if (biased < 1) { return mantissa; }
+    if (mantissa == (1ull << 53)) {
+        mantissa >>= 1;
+        biased++;
+    }
+    if (2046 < biased) { return 0x7FFull << 52; }
+    return (as$(u64)(biased) << 52) | (mantissa & ((1ull << 52) - 1));
+};
+
+/// `0x` prefix already skipped; hex digits with an optional `.` and `p` exponent
+$static fn_((parseHex(S_const$u8 str, u64* bits))(bool)) {
+    var_(m, u64) = 0;
+    var_(e2, i64) = 0;
+    var_(significant, u32) = 0;
+    var_(any, bool) = false;
+    var_(sticky, bool) = false;
+    var_(dot, bool) = false;
+    var_(pos, usize) = 0;
+    for (; pos < str.len; ++pos) {
+        let ch = *S_at((str)[pos]);
+        if (ch == u8_c('.') && !dot) {
+            dot = true;
+            continue;
+        }
+        if (!ascii_isHex(ch)) { break; }
+        let nibble = ascii_isDigit(ch) ? ch - u8_c('0') : ascii_toLower(ch) - u8_c('a') + 10;
+        any = true;
+        if (significant < 16) {
+            m = (m << 4) | nibble;
+            if (m != 0) { significant++; }
+            if (dot) { e2 -= 4; }
+        } else {
+            sticky |= nibble != 0;
+            if (!dot) { e2 += 4; }
+        }
+    }
+    if (!any) { return false; }
+    if (pos < str.len && ascii_toLower(*S_at((str)[pos])) == u8_c('p')) {
+        var_(exp, i64) = 0;
+        if (!parseExponent(str, &pos, &exp)) { return false; }
+        e2 += exp;
+    }
+    if (pos != str.len) { return false; }
+    *bits = roundBinary(m, e2, sticky);
+    return true;
+};
+
+/// Split decimal input into its runs and the first 19 significant digits
+$static fn_((parseDecimal(S_const$u8 str, FltDigits* digits))(bool)) {
+    var_(pos, usize) = digitRunLen(str);
+    digits->int_part = S_prefix((str)(pos));
+    digits->frac_part = S_slice((str)$r(pos, pos));
+    if (pos < str.len && *S_at((str)[pos]) == u8_c('.')) {
+        pos++;
+        let frac_len = digitRunLen(S_suffix((str)(pos)));
+        digits->frac_part = S_slice((str)$r(pos, pos + frac_len));
+        pos += frac_len;
+    }
+    let total = digits->int_part.len + digits->frac_part.len;
+    if (total == 0) { return false; }
+    digits->exp_number = 0;
+    if (pos < str.len && ascii_toLower(*S_at((str)[pos])) == u8_c('e')) {
+        if (!parseExponent(str, &pos, &digits->exp_number)) { return false; }
+    }
+    if (pos != str.len) { return false; }
+
+    digits->mantissa = accumulateDigits(digits->frac_part, accumulateDigits(digits->int_part, 0));
+    digits->exponent = digits->exp_number - as$(i64)(digits->frac_part.len);
+    digits->truncated = false;
+    if (fmt__parse_fast_digits < total) {
+        var_(first, usize) = 0;
+        while (first < total && FltDigits_at(digits, first) == u8_c('0')) { first++; }
+        if (fmt__parse_fast_digits < total - first) {
+            let end = first + fmt__parse_fast_digits;
+            digits->mantissa = 0;
+            for (usize idx = first; idx < end; ++idx) {
+                digits->mantissa = digits->mantissa * 10 + (FltDigits_at(digits, idx) - u8_c('0'));
+            }
+            digits->exponent += as$(i64)(total - end);
+            digits->truncated = true;
+        }
+    }
+    return true;
+};
+
+fn_((fmt__parseFltImpl(S_const$u8 str))(E$f64) $scope) {
+    var negative = false;
+    if (0 < str.len && (*S_at((str)[0]) == u8_c('+') || *S_at((str)[0]) == u8_c('-'))) {
+        negative = *S_at((str)[0]) == u8_c('-');
+        str = S_suffix((str)(1));
+    }
+    var_(bits, u64) = 0;
+    if (ascii_eqlIgnoreCase(str, u8_l("inf")) || ascii_eqlIgnoreCase(str, u8_l("infinity"))) {
+        bits = 0x7FFull << 52;
+    } else if (ascii_eqlIgnoreCase(str, u8_l("nan"))) {
+        bits = 0x7FF8ull << 48;
+    } else if (2 < str.len && *S_at((str)[0]) == u8_c('0') && ascii_toLower(*S_at((str)[1])) == u8_c('x')) {
+        if (!parseHex(S_suffix((str)(2)), &bits)) { return_err(fmt_Err_InvalidFltFormat()); }
+    } else {
+        var_(digits, FltDigits) = cleared();
+        if (!parseDecimal(str, &digits)) { return_err(fmt_Err_InvalidFltFormat()); }
+        /* Clinger: both operands exact, so one IEEE operation rounds correctly */
+        if (!digits.truncated && -22 <= digits.exponent && digits.exponent <= 22 && digits.mantissa <= (1ull << 53)) {
+            let value = as$(f64)(digits.mantissa);
+            let scaled = digits.exponent < 0
+                           ? value / *A_at((fmt__parse_pow10)[-digits.exponent])
+                           : value * *A_at((fmt__parse_pow10)[digits.exponent]);
+            return_ok(negative ? -scaled : scaled);
+        }
+        let lo = computeFloat(digits.exponent, digits.mantissa);
+        bits = (as$(u64)(lo.power2) << 52) | lo.mantissa;
+        if (digits.truncated) {
+            /* the dropped digits matter only when they could carry into the next float */
+            let hi = computeFloat(digits.exponent, digits.mantissa + 1);
+            if (hi.power2 != lo.power2 || hi.mantissa != lo.mantissa) { bits = roundDigits(&digits, bits); }
+        }
+    }
+    if (negative) { bits |= 1ull << 63; }
+    return_ok(bitCast$((f64)(bits)));
+} $unscoped_(fn);
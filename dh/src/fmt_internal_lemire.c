@@ -0,0 +1,655 @@
+#include "fmt_internal_lemire.h"
+
+let_(fmt__lemire_table_pow5, fmt__lemire_TablePow5) = A_init({
+    A_init({ 1242899115359157055ull, 17218479456385750618ull }), // 5^-342
+    A_init({ 5388497965526861063ull, 10761549660241094136ull }), // 5^-341
+    A_init({ 6735622456908576329ull, 13451937075301367670ull }), // 5^-340
+    A_init({ 17642900107990496220ull, 16814921344126709587ull }), // 5^-339
+    A_init({ 8720969558280366185ull, 10509325840079193492ull }), // 5^-338
+    A_init({ 10901211947850457732ull, 13136657300098991865ull }), // 5^-337
+    A_init({ 18238200953240460069ull, 16420821625123739831ull }), // 5^-336
+    A_init({ 18316404623416369399ull, 10263013515702337394ull }), // 5^-335
+    A_init({ 13672133742415685941ull, 12828766894627921743ull }), // 5^-334
+    A_init({ 12478481159592219522ull, 16035958618284902179ull }), // 5^-333
+    A_init({ 5493207715531443249ull, 10022474136428063862ull }), // 5^-332
+    A_init({ 16089881681269079869ull, 12528092670535079827ull }), // 5^-331
+    A_init({ 15500666083158961933ull, 15660115838168849784ull }), // 5^-330
+    A_init({ 9687916301974351208ull, 9787572398855531115ull }), // 5^-329
+    A_init({ 7498209359040551106ull, 12234465498569413894ull }), // 5^-328
+    A_init({ 149389661945913074ull, 15293081873211767368ull }), // 5^-327
+    A_init({ 93368538716195671ull, 9558176170757354605ull }), // 5^-326
+    A_init({ 4728396691822632493ull, 11947720213446693256ull }), // 5^-325
+    A_init({ 5910495864778290617ull, 14934650266808366570ull }), // 5^-324
+    A_init({ 8305745933913819539ull, 9334156416755229106ull }), // 5^-323
+    A_init({ 1158810380537498616ull, 11667695520944036383ull }), // 5^-322
+    A_init({ 15283571030954036982ull, 14584619401180045478ull }), // 5^-321
+    A_init({ 9881091751837770420ull, 18230774251475056848ull }), // 5^-320
+    A_init({ 6175682344898606512ull, 11394233907171910530ull }), // 5^-319
+    A_init({ 16942974967978033949ull, 14242792383964888162ull }), // 5^-318
+    A_init({ 11955346673117766628ull, 17803490479956110203ull }), // 5^-317
+    A_init({ 5166248661484910190ull, 11127181549972568877ull }), // 5^-316
+    A_init({ 11069496845283525642ull, 13908976937465711096ull }), // 5^-315
+    A_init({ 13836871056604407053ull, 17386221171832138870ull }), // 5^-314
+    A_init({ 4036358391950366504ull, 10866388232395086794ull }), // 5^-313
+    A_init({ 14268820026792733938ull, 13582985290493858492ull }), // 5^-312
+    A_init({ 17836025033490917422ull, 16978731613117323115ull }), // 5^-311
+    A_init({ 8841672636718129437ull, 10611707258198326947ull }), // 5^-310
+    A_init({ 6440404777470273892ull, 13264634072747908684ull }), // 5^-309
+    A_init({ 8050505971837842365ull, 16580792590934885855ull }), // 5^-308
+    A_init({ 11949095260039733334ull, 10362995369334303659ull }), // 5^-307
+    A_init({ 10324683056622278764ull, 12953744211667879574ull }), // 5^-306
+    A_init({ 3682481783923072647ull, 16192180264584849468ull }), // 5^-305
+    A_init({ 11524923151806696212ull, 10120112665365530917ull }), // 5^-304
+    A_init({ 571095884476206553ull, 12650140831706913647ull }), // 5^-303
+    A_init({ 14548927910877421904ull, 15812676039633642058ull }), // 5^-302
+    A_init({ 13704765962725776594ull, 9882922524771026286ull }), // 5^-301
+    A_init({ 7907585416552444934ull, 12353653155963782858ull }), // 5^-300
+    A_init({ 661109733835780360ull, 15442066444954728573ull }), // 5^-299
+    A_init({ 2719036592861056677ull, 9651291528096705358ull }), // 5^-298
+    A_init({ 12622167777931096654ull, 12064114410120881697ull }), // 5^-297
+    A_init({ 1942651667131707105ull, 15080143012651102122ull }), // 5^-296
+    A_init({ 5825843310384704845ull, 9425089382906938826ull }), // 5^-295
+    A_init({ 16505676174835656864ull, 11781361728633673532ull }), // 5^-294
+    A_init({ 2185351144835019464ull, 14726702160792091916ull }), // 5^-293
+    A_init({ 2731688931043774330ull, 18408377700990114895ull }), // 5^-292
+    A_init({ 8624834609543440812ull, 11505236063118821809ull }), // 5^-291
+    A_init({ 15392729280356688919ull, 14381545078898527261ull }), // 5^-290
+    A_init({ 5405853545163697437ull, 17976931348623159077ull }), // 5^-289
+    A_init({ 5684501474941004850ull, 11235582092889474423ull }), // 5^-288
+    A_init({ 2493940825248868159ull, 14044477616111843029ull }), // 5^-287
+    A_init({ 7729112049988473103ull, 17555597020139803786ull }), // 5^-286
+    A_init({ 9442381049670183593ull, 10972248137587377366ull }), // 5^-285
+    A_init({ 2579604275232953683ull, 13715310171984221708ull }), // 5^-284
+    A_init({ 3224505344041192104ull, 17144137714980277135ull }), // 5^-283
+    A_init({ 8932844867666826921ull, 10715086071862673209ull }), // 5^-282
+    A_init({ 15777742103010921555ull, 13393857589828341511ull }), // 5^-281
+    A_init({ 15110491610336264040ull, 16742321987285426889ull }), // 5^-280
+    A_init({ 2526528228819083169ull, 10463951242053391806ull }), // 5^-279
+    A_init({ 12381532322878629770ull, 13079939052566739757ull }), // 5^-278
+    A_init({ 1641857348316123500ull, 16349923815708424697ull }), // 5^-277
+    A_init({ 12555375888766046947ull, 10218702384817765435ull }), // 5^-276
+    A_init({ 11082533842530170780ull, 12773377981022206794ull }), // 5^-275
+    A_init({ 4629795266307937667ull, 15966722476277758493ull }), // 5^-274
+    A_init({ 5199465050656154994ull, 9979201547673599058ull }), // 5^-273
+    A_init({ 15722703350174969551ull, 12474001934591998822ull }), // 5^-272
+    A_init({ 10430007150863936130ull, 15592502418239998528ull }), // 5^-271
+    A_init({ 6518754469289960081ull, 9745314011399999080ull }), // 5^-270
+    A_init({ 8148443086612450102ull, 12181642514249998850ull }), // 5^-269
+    A_init({ 962181821410786819ull, 15227053142812498563ull }), // 5^-268
+    A_init({ 16742264702877599426ull, 9516908214257811601ull }), // 5^-267
+    A_init({ 7092772823314835570ull, 11896135267822264502ull }), // 5^-266
+    A_init({ 18089338065998320271ull, 14870169084777830627ull }), // 5^-265
+    A_init({ 8999993282035256217ull, 9293855677986144142ull }), // 5^-264
+    A_init({ 2026619565689294464ull, 11617319597482680178ull }), // 5^-263
+    A_init({ 11756646493966393888ull, 14521649496853350222ull }), // 5^-262
+    A_init({ 5472436080603216552ull, 18152061871066687778ull }), // 5^-261
+    A_init({ 8031958568804398249ull, 11345038669416679861ull }), // 5^-260
+    A_init({ 14651634229432885715ull, 14181298336770849826ull }), // 5^-259
+    A_init({ 9091170749936331336ull, 17726622920963562283ull }), // 5^-258
+    A_init({ 3376138709496513133ull, 11079139325602226427ull }), // 5^-257
+    A_init({ 18055231442152805128ull, 13848924157002783033ull }), // 5^-256
+    A_init({ 8733981247408842698ull, 17311155196253478792ull }), // 5^-255
+    A_init({ 5458738279630526686ull, 10819471997658424245ull }), // 5^-254
+    A_init({ 11435108867965546262ull, 13524339997073030306ull }), // 5^-253
+    A_init({ 5070514048102157020ull, 16905424996341287883ull }), // 5^-252
+    A_init({ 863228270850154185ull, 10565890622713304927ull }), // 5^-251
+    A_init({ 14914093393844856443ull, 13207363278391631158ull }), // 5^-250
+    A_init({ 9419244705451294746ull, 16509204097989538948ull }), // 5^-249
+    A_init({ 15110399977761835024ull, 10318252561243461842ull }), // 5^-248
+    A_init({ 9664627935347517973ull, 12897815701554327303ull }), // 5^-247
+    A_init({ 7469098900757009562ull, 16122269626942909129ull }), // 5^-246
+    A_init({ 16197401859041600736ull, 10076418516839318205ull }), // 5^-245
+    A_init({ 6411694268519837208ull, 12595523146049147757ull }), // 5^-244
+    A_init({ 12626303854077184414ull, 15744403932561434696ull }), // 5^-243
+    A_init({ 7891439908798240259ull, 9840252457850896685ull }), // 5^-242
+    A_init({ 14475985904425188227ull, 12300315572313620856ull }), // 5^-241
+    A_init({ 18094982380531485284ull, 15375394465392026070ull }), // 5^-240
+    A_init({ 6697677969404790399ull, 9609621540870016294ull }), // 5^-239
+    A_init({ 17595469498610763806ull, 12012026926087520367ull }), // 5^-238
+    A_init({ 17382650854836066854ull, 15015033657609400459ull }), // 5^-237
+    A_init({ 8558313775058847832ull, 9384396036005875287ull }), // 5^-236
+    A_init({ 6086206200396171886ull, 11730495045007344109ull }), // 5^-235
+    A_init({ 12219443768922602761ull, 14663118806259180136ull }), // 5^-234
+    A_init({ 15274304711153253452ull, 18328898507823975170ull }), // 5^-233
+    A_init({ 14158126462898171311ull, 11455561567389984481ull }), // 5^-232
+    A_init({ 3862600023340550427ull, 14319451959237480602ull }), // 5^-231
+    A_init({ 14051622066030463842ull, 17899314949046850752ull }), // 5^-230
+    A_init({ 8782263791269039901ull, 11187071843154281720ull }), // 5^-229
+    A_init({ 10977829739086299876ull, 13983839803942852150ull }), // 5^-228
+    A_init({ 4498915137003099037ull, 17479799754928565188ull }), // 5^-227
+    A_init({ 12035193997481712706ull, 10924874846830353242ull }), // 5^-226
+    A_init({ 5820620459997365075ull, 13656093558537941553ull }), // 5^-225
+    A_init({ 11887461593424094248ull, 17070116948172426941ull }), // 5^-224
+    A_init({ 9735506505103752857ull, 10668823092607766838ull }), // 5^-223
+    A_init({ 2946011094524915263ull, 13336028865759708548ull }), // 5^-222
+    A_init({ 3682513868156144079ull, 16670036082199635685ull }), // 5^-221
+    A_init({ 4607414176811284001ull, 10418772551374772303ull }), // 5^-220
+    A_init({ 1147581702586717097ull, 13023465689218465379ull }), // 5^-219
+    A_init({ 15269535183515560084ull, 16279332111523081723ull }), // 5^-218
+    A_init({ 7237616480483531100ull, 10174582569701926077ull }), // 5^-217
+    A_init({ 13658706619031801779ull, 12718228212127407596ull }), // 5^-216
+    A_init({ 17073383273789752224ull, 15897785265159259495ull }), // 5^-215
+    A_init({ 17588393573759676996ull, 9936115790724537184ull }), // 5^-214
+    A_init({ 3538747893490044629ull, 12420144738405671481ull }), // 5^-213
+    A_init({ 9035120885289943691ull, 15525180923007089351ull }), // 5^-212
+    A_init({ 12564479580947296663ull, 9703238076879430844ull }), // 5^-211
+    A_init({ 15705599476184120828ull, 12129047596099288555ull }), // 5^-210
+    A_init({ 15020313326802763131ull, 15161309495124110694ull }), // 5^-209
+    A_init({ 4776009810824339053ull, 9475818434452569184ull }), // 5^-208
+    A_init({ 5970012263530423816ull, 11844773043065711480ull }), // 5^-207
+    A_init({ 7462515329413029771ull, 14805966303832139350ull }), // 5^-206
+    A_init({ 52386062455755702ull, 9253728939895087094ull }), // 5^-205
+    A_init({ 9288854614924470436ull, 11567161174868858867ull }), // 5^-204
+    A_init({ 6999382250228200141ull, 14458951468586073584ull }), // 5^-203
+    A_init({ 8749227812785250177ull, 18073689335732591980ull }), // 5^-202
+    A_init({ 14691639419845557168ull, 11296055834832869987ull }), // 5^-201
+    A_init({ 13752863256379558556ull, 14120069793541087484ull }), // 5^-200
+    A_init({ 17191079070474448196ull, 17650087241926359355ull }), // 5^-199
+    A_init({ 8438581409832836170ull, 11031304526203974597ull }), // 5^-198
+    A_init({ 15159912780718433117ull, 13789130657754968246ull }), // 5^-197
+    A_init({ 9726518939043265588ull, 17236413322193710308ull }), // 5^-196
+    A_init({ 15302446373756816800ull, 10772758326371068942ull }), // 5^-195
+    A_init({ 9904685930341245193ull, 13465947907963836178ull }), // 5^-194
+    A_init({ 3157485376071780683ull, 16832434884954795223ull }), // 5^-193
+    A_init({ 8890957387685944783ull, 10520271803096747014ull }), // 5^-192
+    A_init({ 1890324697752655170ull, 13150339753870933768ull }), // 5^-191
+    A_init({ 2362905872190818963ull, 16437924692338667210ull }), // 5^-190
+    A_init({ 6088502188546649756ull, 10273702932711667006ull }), // 5^-189
+    A_init({ 16833999772538088003ull, 12842128665889583757ull }), // 5^-188
+    A_init({ 7207441660390446292ull, 16052660832361979697ull }), // 5^-187
+    A_init({ 16033866083812498692ull, 10032913020226237310ull }), // 5^-186
+    A_init({ 10818960567910847557ull, 12541141275282796638ull }), // 5^-185
+    A_init({ 4300328673033783639ull, 15676426594103495798ull }), // 5^-184
+    A_init({ 16522763475928278486ull, 9797766621314684873ull }), // 5^-183
+    A_init({ 6818396289628184396ull, 12247208276643356092ull }), // 5^-182
+    A_init({ 8522995362035230495ull, 15309010345804195115ull }), // 5^-181
+    A_init({ 3021029092058325107ull, 9568131466127621947ull }), // 5^-180
+    A_init({ 17611344420355070096ull, 11960164332659527433ull }), // 5^-179
+    A_init({ 8179122470161673908ull, 14950205415824409292ull }), // 5^-178
+    A_init({ 14335323580705822000ull, 9343878384890255807ull }), // 5^-177
+    A_init({ 13307468457454889596ull, 11679847981112819759ull }), // 5^-176
+    A_init({ 12022649553391224092ull, 14599809976391024699ull }), // 5^-175
+    A_init({ 10416625923311642211ull, 18249762470488780874ull }), // 5^-174
+    A_init({ 11122077220497164286ull, 11406101544055488046ull }), // 5^-173
+    A_init({ 4679224488766679549ull, 14257626930069360058ull }), // 5^-172
+    A_init({ 15072402647813125244ull, 17822033662586700072ull }), // 5^-171
+    A_init({ 9420251654883203278ull, 11138771039116687545ull }), // 5^-170
+    A_init({ 16387000587031392001ull, 13923463798895859431ull }), // 5^-169
+    A_init({ 15872064715361852097ull, 17404329748619824289ull }), // 5^-168
+    A_init({ 3002511419460075705ull, 10877706092887390181ull }), // 5^-167
+    A_init({ 8364825292752482535ull, 13597132616109237726ull }), // 5^-166
+    A_init({ 1232659579085827361ull, 16996415770136547158ull }), // 5^-165
+    A_init({ 14605470292210805812ull, 10622759856335341973ull }), // 5^-164
+    A_init({ 4421779809981343554ull, 13278449820419177467ull }), // 5^-163
+    A_init({ 915538744049291538ull, 16598062275523971834ull }), // 5^-162
+    A_init({ 5183897733458195115ull, 10373788922202482396ull }), // 5^-161
+    A_init({ 6479872166822743894ull, 12967236152753102995ull }), // 5^-160
+    A_init({ 3488154190101041964ull, 16209045190941378744ull }), // 5^-159
+    A_init({ 2180096368813151227ull, 10130653244338361715ull }), // 5^-158
+    A_init({ 16560178516298602746ull, 12663316555422952143ull }), // 5^-157
+    A_init({ 16088537126945865529ull, 15829145694278690179ull }), // 5^-156
+    A_init({ 7749492695127472003ull, 9893216058924181362ull }), // 5^-155
+    A_init({ 463493832054564196ull, 12366520073655226703ull }), // 5^-154
+    A_init({ 14414425345350368957ull, 15458150092069033378ull }), // 5^-153
+    A_init({ 13620701859271368502ull, 9661343807543145861ull }), // 5^-152
+    A_init({ 3190819268807046916ull, 12076679759428932327ull }), // 5^-151
+    A_init({ 17823582141290972357ull, 15095849699286165408ull }), // 5^-150
+    A_init({ 11139738838306857723ull, 9434906062053853380ull }), // 5^-149
+    A_init({ 13924673547883572154ull, 11793632577567316725ull }), // 5^-148
+    A_init({ 3570783879572301480ull, 14742040721959145907ull }), // 5^-147
+    A_init({ 18298537904747540562ull, 18427550902448932383ull }), // 5^-146
+    A_init({ 18354115218108294707ull, 11517219314030582739ull }), // 5^-145
+    A_init({ 18330958004207980480ull, 14396524142538228424ull }), // 5^-144
+    A_init({ 4466953431550423984ull, 17995655178172785531ull }), // 5^-143
+    A_init({ 486002885505321038ull, 11247284486357990957ull }), // 5^-142
+    A_init({ 5219189625309039202ull, 14059105607947488696ull }), // 5^-141
+    A_init({ 6523987031636299002ull, 17573882009934360870ull }), // 5^-140
+    A_init({ 17912549950054850588ull, 10983676256208975543ull }), // 5^-139
+    A_init({ 17779001419141175331ull, 13729595320261219429ull }), // 5^-138
+    A_init({ 8388693718644305452ull, 17161994150326524287ull }), // 5^-137
+    A_init({ 12160462601793772764ull, 10726246343954077679ull }), // 5^-136
+    A_init({ 10588892233814828051ull, 13407807929942597099ull }), // 5^-135
+    A_init({ 8624429273841147159ull, 16759759912428246374ull }), // 5^-134
+    A_init({ 778582277723329070ull, 10474849945267653984ull }), // 5^-133
+    A_init({ 973227847154161338ull, 13093562431584567480ull }), // 5^-132
+    A_init({ 1216534808942701673ull, 16366953039480709350ull }), // 5^-131
+    A_init({ 14595392310871352257ull, 10229345649675443343ull }), // 5^-130
+    A_init({ 13632554370161802418ull, 12786682062094304179ull }), // 5^-129
+    A_init({ 12429006944274865118ull, 15983352577617880224ull }), // 5^-128
+    A_init({ 7768129340171790699ull, 9989595361011175140ull }), // 5^-127
+    A_init({ 9710161675214738374ull, 12486994201263968925ull }), // 5^-126
+    A_init({ 16749388112445810871ull, 15608742751579961156ull }), // 5^-125
+    A_init({ 1244995533423855986ull, 9755464219737475723ull }), // 5^-124
+    A_init({ 15391302472061983695ull, 12194330274671844653ull }), // 5^-123
+    A_init({ 5404070034795315907ull, 15242912843339805817ull }), // 5^-122
+    A_init({ 14906758817815542202ull, 9526820527087378635ull }), // 5^-121
+    A_init({ 14021762503842039848ull, 11908525658859223294ull }), // 5^-120
+    A_init({ 8303831092947774002ull, 14885657073574029118ull }), // 5^-119
+    A_init({ 578208414664970847ull, 9303535670983768199ull }), // 5^-118
+    A_init({ 14557818573613377271ull, 11629419588729710248ull }), // 5^-117
+    A_init({ 18197273217016721589ull, 14536774485912137810ull }), // 5^-116
+    A_init({ 13523219484416126178ull, 18170968107390172263ull }), // 5^-115
+    A_init({ 15369541205401160717ull, 11356855067118857664ull }), // 5^-114
+    A_init({ 765182433041899281ull, 14196068833898572081ull }), // 5^-113
+    A_init({ 5568164059729762005ull, 17745086042373215101ull }), // 5^-112
+    A_init({ 5785945546544795205ull, 11090678776483259438ull }), // 5^-111
+    A_init({ 16455803970035769814ull, 13863348470604074297ull }), // 5^-110
+    A_init({ 6734696907262548556ull, 17329185588255092872ull }), // 5^-109
+    A_init({ 4209185567039092847ull, 10830740992659433045ull }), // 5^-108
+    A_init({ 9873167977226253963ull, 13538426240824291306ull }), // 5^-107
+    A_init({ 3118087934678041646ull, 16923032801030364133ull }), // 5^-106
+    A_init({ 4254647968387469981ull, 10576895500643977583ull }), // 5^-105
+    A_init({ 706623942056949572ull, 13221119375804971979ull }), // 5^-104
+    A_init({ 14718337982853350677ull, 16526399219756214973ull }), // 5^-103
+    A_init({ 11504804248497038125ull, 10328999512347634358ull }), // 5^-102
+    A_init({ 5157633273766521849ull, 12911249390434542948ull }), // 5^-101
+    A_init({ 6447041592208152311ull, 16139061738043178685ull }), // 5^-100
+    A_init({ 6335244004343789146ull, 10086913586276986678ull }), // 5^-99
+    A_init({ 17142427042284512241ull, 12608641982846233347ull }), // 5^-98
+    A_init({ 16816347784428252397ull, 15760802478557791684ull }), // 5^-97
+    A_init({ 1286845328412881940ull, 9850501549098619803ull }), // 5^-96
+    A_init({ 15443614715798266137ull, 12313126936373274753ull }), // 5^-95
+    A_init({ 5469460339465668959ull, 15391408670466593442ull }), // 5^-94
+    A_init({ 8030098730593431003ull, 9619630419041620901ull }), // 5^-93
+    A_init({ 14649309431669176658ull, 12024538023802026126ull }), // 5^-92
+    A_init({ 9088264752731695015ull, 15030672529752532658ull }), // 5^-91
+    A_init({ 10291851488884697288ull, 9394170331095332911ull }), // 5^-90
+    A_init({ 8253128342678483706ull, 11742712913869166139ull }), // 5^-89
+    A_init({ 5704724409920716729ull, 14678391142336457674ull }), // 5^-88
+    A_init({ 16354277549255671720ull, 18347988927920572092ull }), // 5^-87
+    A_init({ 998051431430019017ull, 11467493079950357558ull }), // 5^-86
+    A_init({ 10470936326142299579ull, 14334366349937946947ull }), // 5^-85
+    A_init({ 8476984389250486570ull, 17917957937422433684ull }), // 5^-84
+    A_init({ 14521487280136329914ull, 11198723710889021052ull }), // 5^-83
+    A_init({ 18151859100170412392ull, 13998404638611276315ull }), // 5^-82
+    A_init({ 18078137856785627587ull, 17498005798264095394ull }), // 5^-81
+    A_init({ 15910522178918405146ull, 10936253623915059621ull }), // 5^-80
+    A_init({ 6053094668365842720ull, 13670317029893824527ull }), // 5^-79
+    A_init({ 2954682317029915496ull, 17087896287367280659ull }), // 5^-78
+    A_init({ 17987577512639554849ull, 10679935179604550411ull }), // 5^-77
+    A_init({ 17872785872372055657ull, 13349918974505688014ull }), // 5^-76
+    A_init({ 13117610303610293764ull, 16687398718132110018ull }), // 5^-75
+    A_init({ 12810192458183821506ull, 10429624198832568761ull }), // 5^-74
+    A_init({ 2177682517447613171ull, 13037030248540710952ull }), // 5^-73
+    A_init({ 2722103146809516464ull, 16296287810675888690ull }), // 5^-72
+    A_init({ 6313000485183335694ull, 10185179881672430431ull }), // 5^-71
+    A_init({ 3279564588051781713ull, 12731474852090538039ull }), // 5^-70
+    A_init({ 17934513790346890853ull, 15914343565113172548ull }), // 5^-69
+    A_init({ 1985699082112030975ull, 9946464728195732843ull }), // 5^-68
+    A_init({ 16317181907922202431ull, 12433080910244666053ull }), // 5^-67
+    A_init({ 6561419329620589327ull, 15541351137805832567ull }), // 5^-66
+    A_init({ 11018416108653950185ull, 9713344461128645354ull }), // 5^-65
+    A_init({ 4549648098962661924ull, 12141680576410806693ull }), // 5^-64
+    A_init({ 10298746142130715309ull, 15177100720513508366ull }), // 5^-63
+    A_init({ 1825030320404309164ull, 9485687950320942729ull }), // 5^-62
+    A_init({ 6892973918932774359ull, 11857109937901178411ull }), // 5^-61
+    A_init({ 4004531380238580045ull, 14821387422376473014ull }), // 5^-60
+    A_init({ 16337890167931276240ull, 9263367138985295633ull }), // 5^-59
+    A_init({ 6587304654631931588ull, 11579208923731619542ull }), // 5^-58
+    A_init({ 17457502855144690293ull, 14474011154664524427ull }), // 5^-57
+    A_init({ 17210192550503474962ull, 18092513943330655534ull }), // 5^-56
+    A_init({ 6144684325637283947ull, 11307821214581659709ull }), // 5^-55
+    A_init({ 12292541425473992838ull, 14134776518227074636ull }), // 5^-54
+    A_init({ 15365676781842491048ull, 17668470647783843295ull }), // 5^-53
+    A_init({ 16521077016292638761ull, 11042794154864902059ull }), // 5^-52
+    A_init({ 16039660251938410547ull, 13803492693581127574ull }), // 5^-51
+    A_init({ 10826203278068237376ull, 17254365866976409468ull }), // 5^-50
+    A_init({ 15989749085647424168ull, 10783978666860255917ull }), // 5^-49
+    A_init({ 6152128301777116498ull, 13479973333575319897ull }), // 5^-48
+    A_init({ 12301846395648783526ull, 16849966666969149871ull }), // 5^-47
+    A_init({ 14606183024921571560ull, 10531229166855718669ull }), // 5^-46
+    A_init({ 4422670725869800738ull, 13164036458569648337ull }), // 5^-45
+    A_init({ 10140024425764638826ull, 16455045573212060421ull }), // 5^-44
+    A_init({ 8643358275316593218ull, 10284403483257537763ull }), // 5^-43
+    A_init({ 6192511825718353619ull, 12855504354071922204ull }), // 5^-42
+    A_init({ 7740639782147942024ull, 16069380442589902755ull }), // 5^-41
+    A_init({ 2532056854628769813ull, 10043362776618689222ull }), // 5^-40
+    A_init({ 12388443105140738074ull, 12554203470773361527ull }), // 5^-39
+    A_init({ 10873867862998534689ull, 15692754338466701909ull }), // 5^-38
+    A_init({ 9102010423587778132ull, 9807971461541688693ull }), // 5^-37
+    A_init({ 15989199047912110569ull, 12259964326927110866ull }), // 5^-36
+    A_init({ 10763126773035362404ull, 15324955408658888583ull }), // 5^-35
+    A_init({ 13644483260788183358ull, 9578097130411805364ull }), // 5^-34
+    A_init({ 17055604075985229198ull, 11972621413014756705ull }), // 5^-33
+    A_init({ 7484447039699372786ull, 14965776766268445882ull }), // 5^-32
+    A_init({ 9289465418239495895ull, 9353610478917778676ull }), // 5^-31
+    A_init({ 11611831772799369869ull, 11692013098647223345ull }), // 5^-30
+    A_init({ 679731660717048624ull, 14615016373309029182ull }), // 5^-29
+    A_init({ 10073036612751086588ull, 18268770466636286477ull }), // 5^-28
+    A_init({ 8601490892183123070ull, 11417981541647679048ull }), // 5^-27
+    A_init({ 10751863615228903838ull, 14272476927059598810ull }), // 5^-26
+    A_init({ 4216457482181353989ull, 17840596158824498513ull }), // 5^-25
+    A_init({ 14164500972431816003ull, 11150372599265311570ull }), // 5^-24
+    A_init({ 8482254178684994196ull, 13937965749081639463ull }), // 5^-23
+    A_init({ 5991131704928854841ull, 17422457186352049329ull }), // 5^-22
+    A_init({ 15273672361649004036ull, 10889035741470030830ull }), // 5^-21
+    A_init({ 9868718415206479237ull, 13611294676837538538ull }), // 5^-20
+    A_init({ 3112525982153323238ull, 17014118346046923173ull }), // 5^-19
+    A_init({ 4251171748059520976ull, 10633823966279326983ull }), // 5^-18
+    A_init({ 702278666647013315ull, 13292279957849158729ull }), // 5^-17
+    A_init({ 5489534351736154548ull, 16615349947311448411ull }), // 5^-16
+    A_init({ 1125115960621402641ull, 10384593717069655257ull }), // 5^-15
+    A_init({ 6018080969204141205ull, 12980742146337069071ull }), // 5^-14
+    A_init({ 2910915193077788602ull, 16225927682921336339ull }), // 5^-13
+    A_init({ 17960223060169475540ull, 10141204801825835211ull }), // 5^-12
+    A_init({ 17838592806784456521ull, 12676506002282294014ull }), // 5^-11
+    A_init({ 13074868971625794844ull, 15845632502852867518ull }), // 5^-10
+    A_init({ 3560107088838733873ull, 9903520314283042199ull }), // 5^-9
+    A_init({ 18285191916330581054ull, 12379400392853802748ull }), // 5^-8
+    A_init({ 4409745821703674701ull, 15474250491067253436ull }), // 5^-7
+    A_init({ 11979463175419572496ull, 9671406556917033397ull }), // 5^-6
+    A_init({ 1139270913992301908ull, 12089258196146291747ull }), // 5^-5
+    A_init({ 15259146697772541097ull, 15111572745182864683ull }), // 5^-4
+    A_init({ 7231123676894144234ull, 9444732965739290427ull }), // 5^-3
+    A_init({ 4427218577690292388ull, 11805916207174113034ull }), // 5^-2
+    A_init({ 14757395258967641293ull, 14757395258967641292ull }), // 5^-1
+    A_init({ 0ull, 9223372036854775808ull }), // 5^0
+    A_init({ 0ull, 11529215046068469760ull }), // 5^1
+    A_init({ 0ull, 14411518807585587200ull }), // 5^2
+    A_init({ 0ull, 18014398509481984000ull }), // 5^3
+    A_init({ 0ull, 11258999068426240000ull }), // 5^4
+    A_init({ 0ull, 14073748835532800000ull }), // 5^5
+    A_init({ 0ull, 17592186044416000000ull }), // 5^6
+    A_init({ 0ull, 10995116277760000000ull }), // 5^7
+    A_init({ 0ull, 13743895347200000000ull }), // 5^8
+    A_init({ 0ull, 17179869184000000000ull }), // 5^9
+    A_init({ 0ull, 10737418240000000000ull }), // 5^10
+    A_init({ 0ull, 13421772800000000000ull }), // 5^11
+    A_init({ 0ull, 16777216000000000000ull }), // 5^12
+    A_init({ 0ull, 10485760000000000000ull }), // 5^13
+    A_init({ 0ull, 13107200000000000000ull }), // 5^14
+    A_init({ 0ull, 16384000000000000000ull }), // 5^15
+    A_init({ 0ull, 10240000000000000000ull }), // 5^16
+    A_init({ 0ull, 12800000000000000000ull }), // 5^17
+    A_init({ 0ull, 16000000000000000000ull }), // 5^18
+    A_init({ 0ull, 10000000000000000000ull }), // 5^19
+    A_init({ 0ull, 12500000000000000000ull }), // 5^20
+    A_init({ 0ull, 15625000000000000000ull }), // 5^21
+    A_init({ 0ull, 9765625000000000000ull }), // 5^22
+    A_init({ 0ull, 12207031250000000000ull }), // 5^23
+    A_init({ 0ull, 15258789062500000000ull }), // 5^24
+    A_init({ 0ull, 9536743164062500000ull }), // 5^25
+    A_init({ 0ull, 11920928955078125000ull }), // 5^26
+    A_init({ 0ull, 14901161193847656250ull }), // 5^27
+    A_init({ 4611686018427387904ull, 9313225746154785156ull }), // 5^28
+    A_init({ 5764607523034234880ull, 11641532182693481445ull }), // 5^29
+    A_init({ 11817445422220181504ull, 14551915228366851806ull }), // 5^30
+    A_init({ 5548434740920451072ull, 18189894035458564758ull }), // 5^31
+    A_init({ 17302829768357445632ull, 11368683772161602973ull }), // 5^32
+    A_init({ 7793479155164643328ull, 14210854715202003717ull }), // 5^33
+    A_init({ 14353534962383192064ull, 17763568394002504646ull }), // 5^34
+    A_init({ 4359273333062107136ull, 11102230246251565404ull }), // 5^35
+    A_init({ 5449091666327633920ull, 13877787807814456755ull }), // 5^36
+    A_init({ 2199678564482154496ull, 17347234759768070944ull }), // 5^37
+    A_init({ 1374799102801346560ull, 10842021724855044340ull }), // 5^38
+    A_init({ 1718498878501683200ull, 13552527156068805425ull }), // 5^39
+    A_init({ 6759809616554491904ull, 16940658945086006781ull }), // 5^40
+    A_init({ 6530724019560251392ull, 10587911840678754238ull }), // 5^41
+    A_init({ 17386777061305090048ull, 13234889800848442797ull }), // 5^42
+    A_init({ 7898413271349198848ull, 16543612251060553497ull }), // 5^43
+    A_init({ 16465723340661719040ull, 10339757656912845935ull }), // 5^44
+    A_init({ 15970468157399760896ull, 12924697071141057419ull }), // 5^45
+    A_init({ 15351399178322313216ull, 16155871338926321774ull }), // 5^46
+    A_init({ 4982938468024057856ull, 10097419586828951109ull }), // 5^47
+    A_init({ 10840359103457460224ull, 12621774483536188886ull }), // 5^48
+    A_init({ 4327076842467049472ull, 15777218104420236108ull }), // 5^49
+    A_init({ 11927795063396681728ull, 9860761315262647567ull }), // 5^50
+    A_init({ 10298057810818464256ull, 12325951644078309459ull }), // 5^51
+    A_init({ 8260886245095692416ull, 15407439555097886824ull }), // 5^52
+    A_init({ 5163053903184807760ull, 9629649721936179265ull }), // 5^53
+    A_init({ 11065503397408397604ull, 12037062152420224081ull }), // 5^54
+    A_init({ 18443565265187884909ull, 15046327690525280101ull }), // 5^55
+    A_init({ 13833071299956122020ull, 9403954806578300063ull }), // 5^56
+    A_init({ 12679653106517764621ull, 11754943508222875079ull }), // 5^57
+    A_init({ 11237880364719817872ull, 14693679385278593849ull }), // 5^58
+    A_init({ 212292400617608628ull, 18367099231598242312ull }), // 5^59
+    A_init({ 132682750386005392ull, 11479437019748901445ull }), // 5^60
+    A_init({ 4777539456409894645ull, 14349296274686126806ull }), // 5^61
+    A_init({ 15195296357367144114ull, 17936620343357658507ull }), // 5^62
+    A_init({ 7191217214140771119ull, 11210387714598536567ull }), // 5^63
+    A_init({ 4377335499248575995ull, 14012984643248170709ull }), // 5^64
+    A_init({ 10083355392488107898ull, 17516230804060213386ull }), // 5^65
+    A_init({ 10913783138732455340ull, 10947644252537633366ull }), // 5^66
+    A_init({ 4418856886560793367ull, 13684555315672041708ull }), // 5^67
+    A_init({ 5523571108200991709ull, 17105694144590052135ull }), // 5^68
+    A_init({ 10369760970266701674ull, 10691058840368782584ull }), // 5^69
+    A_init({ 12962201212833377092ull, 13363823550460978230ull }), // 5^70
+    A_init({ 6979379479186945558ull, 16704779438076222788ull }), // 5^71
+    A_init({ 13585484211346616781ull, 10440487148797639242ull }), // 5^72
+    A_init({ 7758483227328495169ull, 13050608935997049053ull }), // 5^73
+    A_init({ 14309790052588006865ull, 16313261169996311316ull }), // 5^74
+    A_init({ 18166990819722280098ull, 10195788231247694572ull }), // 5^75
+    A_init({ 4261994450943298507ull, 12744735289059618216ull }), // 5^76
+    A_init({ 5327493063679123134ull, 15930919111324522770ull }), // 5^77
+    A_init({ 7941369183226839863ull, 9956824444577826731ull }), // 5^78
+    A_init({ 5315025460606161924ull, 12446030555722283414ull }), // 5^79
+    A_init({ 15867153862612478214ull, 15557538194652854267ull }), // 5^80
+    A_init({ 7611128154919104931ull, 9723461371658033917ull }), // 5^81
+    A_init({ 14125596212076269068ull, 12154326714572542396ull }), // 5^82
+    A_init({ 17656995265095336336ull, 15192908393215677995ull }), // 5^83
+    A_init({ 8729779031470891258ull, 9495567745759798747ull }), // 5^84
+    A_init({ 6300537770911226168ull, 11869459682199748434ull }), // 5^85
+    A_init({ 17099044250493808518ull, 14836824602749685542ull }), // 5^86
+    A_init({ 6075216638131242420ull, 9273015376718553464ull }), // 5^87
+    A_init({ 7594020797664053025ull, 11591269220898191830ull }), // 5^88
+    A_init({ 269153960225290473ull, 14489086526122739788ull }), // 5^89
+    A_init({ 336442450281613091ull, 18111358157653424735ull }), // 5^90
+    A_init({ 7127805559067090038ull, 11319598848533390459ull }), // 5^91
+    A_init({ 4298070930406474644ull, 14149498560666738074ull }), // 5^92
+    A_init({ 14595960699862869113ull, 17686873200833422592ull }), // 5^93
+    A_init({ 9122475437414293195ull, 11054295750520889120ull }), // 5^94
+    A_init({ 11403094296767866494ull, 13817869688151111400ull }), // 5^95
+    A_init({ 14253867870959833118ull, 17272337110188889250ull }), // 5^96
+    A_init({ 13520353437777283602ull, 10795210693868055781ull }), // 5^97
+    A_init({ 3065383741939440791ull, 13494013367335069727ull }), // 5^98
+    A_init({ 17666787732706464701ull, 16867516709168837158ull }), // 5^99
+    A_init({ 6430056314514152534ull, 10542197943230523224ull }), // 5^100
+    A_init({ 8037570393142690668ull, 13177747429038154030ull }), // 5^101
+    A_init({ 823590954573587527ull, 16472184286297692538ull }), // 5^102
+    A_init({ 5126430365035880108ull, 10295115178936057836ull }), // 5^103
+    A_init({ 6408037956294850135ull, 12868893973670072295ull }), // 5^104
+    A_init({ 3398361426941174765ull, 16086117467087590369ull }), // 5^105
+    A_init({ 13653190937906703988ull, 10053823416929743980ull }), // 5^106
+    A_init({ 17066488672383379985ull, 12567279271162179975ull }), // 5^107
+    A_init({ 16721424822051837077ull, 15709099088952724969ull }), // 5^108
+    A_init({ 3533361486141316317ull, 9818186930595453106ull }), // 5^109
+    A_init({ 13640073894531421205ull, 12272733663244316382ull }), // 5^110
+    A_init({ 7826720331309500698ull, 15340917079055395478ull }), // 5^111
+    A_init({ 280014188641050032ull, 9588073174409622174ull }), // 5^112
+    A_init({ 9573389772656088348ull, 11985091468012027717ull }), // 5^113
+    A_init({ 16578423234247498339ull, 14981364335015034646ull }), // 5^114
+    A_init({ 5749828502977298558ull, 9363352709384396654ull }), // 5^115
+    A_init({ 16410657665576399005ull, 11704190886730495817ull }), // 5^116
+    A_init({ 6678264026688335045ull, 14630238608413119772ull }), // 5^117
+    A_init({ 8347830033360418806ull, 18287798260516399715ull }), // 5^118
+    A_init({ 2911550761636567802ull, 11429873912822749822ull }), // 5^119
+    A_init({ 12862810488900485560ull, 14287342391028437277ull }), // 5^120
+    A_init({ 2243455055843443238ull, 17859177988785546597ull }), // 5^121
+    A_init({ 3708002419115845976ull, 11161986242990966623ull }), // 5^122
+    A_init({ 23317005467419566ull, 13952482803738708279ull }), // 5^123
+    A_init({ 13864204312116438170ull, 17440603504673385348ull }), // 5^124
+    A_init({ 17888499731927549664ull, 10900377190420865842ull }), // 5^125
+    A_init({ 13137252628054661272ull, 13625471488026082303ull }), // 5^126
+    A_init({ 11809879766640938686ull, 17031839360032602879ull }), // 5^127
+    A_init({ 14298703881791668535ull, 10644899600020376799ull }), // 5^128
+    A_init({ 13261693833812197764ull, 13306124500025470999ull }), // 5^129
+    A_init({ 11965431273837859301ull, 16632655625031838749ull }), // 5^130
+    A_init({ 9784237555362356015ull, 10395409765644899218ull }), // 5^131
+    A_init({ 3006924907348169211ull, 12994262207056124023ull }), // 5^132
+    A_init({ 17593714189467375226ull, 16242827758820155028ull }), // 5^133
+    A_init({ 1772699331562333708ull, 10151767349262596893ull }), // 5^134
+    A_init({ 6827560182880305039ull, 12689709186578246116ull }), // 5^135
+    A_init({ 8534450228600381299ull, 15862136483222807645ull }), // 5^136
+    A_init({ 7639874402088932264ull, 9913835302014254778ull }), // 5^137
+    A_init({ 326470965756389522ull, 12392294127517818473ull }), // 5^138
+    A_init({ 5019774725622874806ull, 15490367659397273091ull }), // 5^139
+    A_init({ 831516194300602802ull, 9681479787123295682ull }), // 5^140
+    A_init({ 10262767279730529310ull, 12101849733904119602ull }), // 5^141
+    A_init({ 3605087062808385830ull, 15127312167380149503ull }), // 5^142
+    A_init({ 9170708441896323000ull, 9454570104612593439ull }), // 5^143
+    A_init({ 6851699533943015846ull, 11818212630765741799ull }), // 5^144
+    A_init({ 3952938399001381903ull, 14772765788457177249ull }), // 5^145
+    A_init({ 13999801545444333449ull, 9232978617785735780ull }), // 5^146
+    A_init({ 17499751931805416812ull, 11541223272232169725ull }), // 5^147
+    A_init({ 8039631859474607303ull, 14426529090290212157ull }), // 5^148
+    A_init({ 14661225842770647033ull, 18033161362862765196ull }), // 5^149
+    A_init({ 18386638188586430203ull, 11270725851789228247ull }), // 5^150
+    A_init({ 18371611717305649850ull, 14088407314736535309ull }), // 5^151
+    A_init({ 9129456591349898601ull, 17610509143420669137ull }), // 5^152
+    A_init({ 17235125415662156385ull, 11006568214637918210ull }), // 5^153
+    A_init({ 12320534732722919674ull, 13758210268297397763ull }), // 5^154
+    A_init({ 10788982397476261688ull, 17197762835371747204ull }), // 5^155
+    A_init({ 15966486035277439363ull, 10748601772107342002ull }), // 5^156
+    A_init({ 10734735507242023396ull, 13435752215134177503ull }), // 5^157
+    A_init({ 8806733365625141341ull, 16794690268917721879ull }), // 5^158
+    A_init({ 12421737381156795194ull, 10496681418073576174ull }), // 5^159
+    A_init({ 6303799689591218185ull, 13120851772591970218ull }), // 5^160
+    A_init({ 17103121648843798539ull, 16401064715739962772ull }), // 5^161
+    A_init({ 1466078993672598279ull, 10250665447337476733ull }), // 5^162
+    A_init({ 6444284760518135752ull, 12813331809171845916ull }), // 5^163
+    A_init({ 8055355950647669691ull, 16016664761464807395ull }), // 5^164
+    A_init({ 2728754459941099604ull, 10010415475915504622ull }), // 5^165
+    A_init({ 12634315111781150314ull, 12513019344894380777ull }), // 5^166
+    A_init({ 1957835834444274180ull, 15641274181117975972ull }), // 5^167
+    A_init({ 10447019433382447170ull, 9775796363198734982ull }), // 5^168
+    A_init({ 3835402254873283155ull, 12219745453998418728ull }), // 5^169
+    A_init({ 4794252818591603944ull, 15274681817498023410ull }), // 5^170
+    A_init({ 7608094030047140369ull, 9546676135936264631ull }), // 5^171
+    A_init({ 4898431519131537557ull, 11933345169920330789ull }), // 5^172
+    A_init({ 10734725417341809851ull, 14916681462400413486ull }), // 5^173
+    A_init({ 2097517367411243253ull, 9322925914000258429ull }), // 5^174
+    A_init({ 7233582727691441970ull, 11653657392500323036ull }), // 5^175
+    A_init({ 9041978409614302462ull, 14567071740625403795ull }), // 5^176
+    A_init({ 6690786993590490174ull, 18208839675781754744ull }), // 5^177
+    A_init({ 4181741870994056359ull, 11380524797363596715ull }), // 5^178
+    A_init({ 615491320315182544ull, 14225655996704495894ull }), // 5^179
+    A_init({ 9992736187248753989ull, 17782069995880619867ull }), // 5^180
+    A_init({ 3939617107816777291ull, 11113793747425387417ull }), // 5^181
+    A_init({ 9536207403198359517ull, 13892242184281734271ull }), // 5^182
+    A_init({ 7308573235570561493ull, 17365302730352167839ull }), // 5^183
+    A_init({ 11485387299872682789ull, 10853314206470104899ull }), // 5^184
+    A_init({ 9745048106413465582ull, 13566642758087631124ull }), // 5^185
+    A_init({ 12181310133016831978ull, 16958303447609538905ull }), // 5^186
+    A_init({ 695789805494438130ull, 10598939654755961816ull }), // 5^187
+    A_init({ 869737256868047663ull, 13248674568444952270ull }), // 5^188
+    A_init({ 10310543607939835386ull, 16560843210556190337ull }), // 5^189
+    A_init({ 17973304801030866876ull, 10350527006597618960ull }), // 5^190
+    A_init({ 4019886927579031980ull, 12938158758247023701ull }), // 5^191
+    A_init({ 9636544677901177879ull, 16172698447808779626ull }), // 5^192
+    A_init({ 10634526442115624078ull, 10107936529880487266ull }), // 5^193
+    A_init({ 4069786015789754290ull, 12634920662350609083ull }), // 5^194
+    A_init({ 475546501309804958ull, 15793650827938261354ull }), // 5^195
+    A_init({ 4908902581746016003ull, 9871031767461413346ull }), // 5^196
+    A_init({ 15359500264037295811ull, 12338789709326766682ull }), // 5^197
+    A_init({ 9976003293191843956ull, 15423487136658458353ull }), // 5^198
+    A_init({ 17764217104313372233ull, 9639679460411536470ull }), // 5^199
+    A_init({ 12981899343536939483ull, 12049599325514420588ull }), // 5^200
+    A_init({ 16227374179421174354ull, 15061999156893025735ull }), // 5^201
+    A_init({ 17059637889779315827ull, 9413749473058141084ull }), // 5^202
+    A_init({ 2877803288514593168ull, 11767186841322676356ull }), // 5^203
+    A_init({ 3597254110643241460ull, 14708983551653345445ull }), // 5^204
+    A_init({ 9108253656731439729ull, 18386229439566681806ull }), // 5^205
+    A_init({ 1080972517029761926ull, 11491393399729176129ull }), // 5^206
+    A_init({ 5962901664714590312ull, 14364241749661470161ull }), // 5^207
+    A_init({ 12065313099320625794ull, 17955302187076837701ull }), // 5^208
+    A_init({ 9846663696289085073ull, 11222063866923023563ull }), // 5^209
+    A_init({ 7696643601933968437ull, 14027579833653779454ull }), // 5^210
+    A_init({ 397432465562684739ull, 17534474792067224318ull }), // 5^211
+    A_init({ 14083453346258841674ull, 10959046745042015198ull }), // 5^212
+    A_init({ 8380944645968776284ull, 13698808431302518998ull }), // 5^213
+    A_init({ 1252808770606194547ull, 17123510539128148748ull }), // 5^214
+    A_init({ 10006377518483647400ull, 10702194086955092967ull }), // 5^215
+    A_init({ 7896285879677171346ull, 13377742608693866209ull }), // 5^216
+    A_init({ 14482043368023852087ull, 16722178260867332761ull }), // 5^217
+    A_init({ 2133748077373825698ull, 10451361413042082976ull }), // 5^218
+    A_init({ 2667185096717282123ull, 13064201766302603720ull }), // 5^219
+    A_init({ 3333981370896602653ull, 16330252207878254650ull }), // 5^220
+    A_init({ 6695424375237764562ull, 10206407629923909156ull }), // 5^221
+    A_init({ 8369280469047205703ull, 12758009537404886445ull }), // 5^222
+    A_init({ 15073286604736395033ull, 15947511921756108056ull }), // 5^223
+    A_init({ 9420804127960246895ull, 9967194951097567535ull }), // 5^224
+    A_init({ 7164319141522920715ull, 12458993688871959419ull }), // 5^225
+    A_init({ 4343712908476262990ull, 15573742111089949274ull }), // 5^226
+    A_init({ 7326506586225052273ull, 9733588819431218296ull }), // 5^227
+    A_init({ 9158133232781315341ull, 12166986024289022870ull }), // 5^228
+    A_init({ 2224294504121868368ull, 15208732530361278588ull }), // 5^229
+    A_init({ 10613556101930943538ull, 9505457831475799117ull }), // 5^230
+    A_init({ 17878631145841067327ull, 11881822289344748896ull }), // 5^231
+    A_init({ 3901544858591782542ull, 14852277861680936121ull }), // 5^232
+    A_init({ 13967680582688333849ull, 9282673663550585075ull }), // 5^233
+    A_init({ 12847914709933029407ull, 11603342079438231344ull }), // 5^234
+    A_init({ 16059893387416286759ull, 14504177599297789180ull }), // 5^235
+    A_init({ 1628122660560806833ull, 18130221999122236476ull }), // 5^236
+    A_init({ 10240948699705280078ull, 11331388749451397797ull }), // 5^237
+    A_init({ 17412871893058988002ull, 14164235936814247246ull }), // 5^238
+    A_init({ 12542717829468959195ull, 17705294921017809058ull }), // 5^239
+    A_init({ 12450884661845487401ull, 11065809325636130661ull }), // 5^240
+    A_init({ 1728547772024695539ull, 13832261657045163327ull }), // 5^241
+    A_init({ 15995742770313033136ull, 17290327071306454158ull }), // 5^242
+    A_init({ 5385653213018257806ull, 10806454419566533849ull }), // 5^243
+    A_init({ 11343752534700210161ull, 13508068024458167311ull }), // 5^244
+    A_init({ 9568004649947874797ull, 16885085030572709139ull }), // 5^245
+    A_init({ 3674159897003727796ull, 10553178144107943212ull }), // 5^246
+    A_init({ 4592699871254659745ull, 13191472680134929015ull }), // 5^247
+    A_init({ 1129188820640936778ull, 16489340850168661269ull }), // 5^248
+    A_init({ 3011586022114279438ull, 10305838031355413293ull }), // 5^249
+    A_init({ 8376168546070237202ull, 12882297539194266616ull }), // 5^250
+    A_init({ 10470210682587796502ull, 16102871923992833270ull }), // 5^251
+    A_init({ 1932195658189984910ull, 10064294952495520794ull }), // 5^252
+    A_init({ 11638616609592256945ull, 12580368690619400992ull }), // 5^253
+    A_init({ 14548270761990321182ull, 15725460863274251240ull }), // 5^254
+    A_init({ 9092669226243950738ull, 9828413039546407025ull }), // 5^255
+    A_init({ 15977522551232326327ull, 12285516299433008781ull }), // 5^256
+    A_init({ 6136845133758244197ull, 15356895374291260977ull }), // 5^257
+    A_init({ 15364743254667372383ull, 9598059608932038110ull }), // 5^258
+    A_init({ 9982557031479439671ull, 11997574511165047638ull }), // 5^259
+    A_init({ 3254824252494523781ull, 14996968138956309548ull }), // 5^260
+    A_init({ 11257637194663853171ull, 9373105086847693467ull }), // 5^261
+    A_init({ 9460360474902428559ull, 11716381358559616834ull }), // 5^262
+    A_init({ 2602078556773259891ull, 14645476698199521043ull }), // 5^263
+    A_init({ 17087656251248738576ull, 18306845872749401303ull }), // 5^264
+    A_init({ 17597314184671543466ull, 11441778670468375814ull }), // 5^265
+    A_init({ 12773270693984653525ull, 14302223338085469768ull }), // 5^266
+    A_init({ 15966588367480816906ull, 17877779172606837210ull }), // 5^267
+    A_init({ 14590803748102898470ull, 11173611982879273256ull }), // 5^268
+    A_init({ 18238504685128623088ull, 13967014978599091570ull }), // 5^269
+    A_init({ 13574758819556003052ull, 17458768723248864463ull }), // 5^270
+    A_init({ 15401753289863583763ull, 10911730452030540289ull }), // 5^271
+    A_init({ 5417133557047315992ull, 13639663065038175362ull }), // 5^272
+    A_init({ 15994788983163920798ull, 17049578831297719202ull }), // 5^273
+    A_init({ 14608429132904838403ull, 10655986769561074501ull }), // 5^274
+    A_init({ 4425478360848884291ull, 13319983461951343127ull }), // 5^275
+    A_init({ 920161932633717460ull, 16649979327439178909ull }), // 5^276
+    A_init({ 2880944217109767365ull, 10406237079649486818ull }), // 5^277
+    A_init({ 12824552308241985014ull, 13007796349561858522ull }), // 5^278
+    A_init({ 6807318348447705459ull, 16259745436952323153ull }), // 5^279
+    A_init({ 15783789013848285672ull, 10162340898095201970ull }), // 5^280
+    A_init({ 10506364230455581282ull, 12702926122619002463ull }), // 5^281
+    A_init({ 8521269269642088699ull, 15878657653273753079ull }), // 5^282
+    A_init({ 12243322321167387293ull, 9924161033296095674ull }), // 5^283
+    A_init({ 6080780864604458308ull, 12405201291620119593ull }), // 5^284
+    A_init({ 12212662099182960789ull, 15506501614525149491ull }), // 5^285
+    A_init({ 5327070802775656541ull, 9691563509078218432ull }), // 5^286
+    A_init({ 6658838503469570676ull, 12114454386347773040ull }), // 5^287
+    A_init({ 8323548129336963345ull, 15143067982934716300ull }), // 5^288
+    A_init({ 14425589617690377899ull, 9464417489334197687ull }), // 5^289
+    A_init({ 13420301003685584469ull, 11830521861667747109ull }), // 5^290
+    A_init({ 2940318199324816875ull, 14788152327084683887ull }), // 5^291
+    A_init({ 8755227902219092403ull, 9242595204427927429ull }), // 5^292
+    A_init({ 15555720896201253407ull, 11553244005534909286ull }), // 5^293
+    A_init({ 10221279083396790951ull, 14441555006918636608ull }), // 5^294
+    A_init({ 12776598854245988689ull, 18051943758648295760ull }), // 5^295
+    A_init({ 7985374283903742931ull, 11282464849155184850ull }), // 5^296
+    A_init({ 758345818024902856ull, 14103081061443981063ull }), // 5^297
+    A_init({ 14782990327813292282ull, 17628851326804976328ull }), // 5^298
+    A_init({ 9239368954883307676ull, 11018032079253110205ull }), // 5^299
+    A_init({ 16160897212031522499ull, 13772540099066387756ull }), // 5^300
+    A_init({ 1754377441329851508ull, 17215675123832984696ull }), // 5^301
+    A_init({ 1096485900831157192ull, 10759796952395615435ull }), // 5^302
+    A_init({ 15205665431321110202ull, 13449746190494519293ull }), // 5^303
+    A_init({ 5172023733869224041ull, 16812182738118149117ull }), // 5^304
+    A_init({ 5538357842881958977ull, 10507614211323843198ull }), // 5^305
+    A_init({ 16146319340457224530ull, 13134517764154803997ull }), // 5^306
+    A_init({ 6347841120289366950ull, 16418147205193504997ull }), // 5^307
+    A_init({ 6273243709394548296ull, 10261342003245940623ull }), // 5^308
+});
@@ -0,0 +1,93 @@
+/**
+ * @copyright Copyright (c) 2025 Gyeongtae Kim
+ * @license   MIT License - see LICENSE file for details
+ *
+ * @file    fmt_internal_lemire.h
+ * @author  Gyeongtae Kim (dev-dasae) <codingpelican@gmail.com>
+ * @date    2026-10-17 (date of creation)
+ * @updated 2026-10-17 (date of last update)
+ * @version v0.1-alpha
+ * @ingroup dasae-headers(dh)/fmt/internal
+ * @prefix  fmt__lemire
+ *
+ * @brief   Eisel-Lemire lookup table for float parsing
+ * @details 128-bit truncated approximations of 5^q for every decimal exponent
+ *          a binary64 can reach, normalized so the top bit is set.
+ *
+ * @see [Lemire (2021), "Number Parsing at a Gigabyte per Second"](https://arxiv.org/abs/2101.11408)
+ * @see [Mushtak & Lemire (2023), "Fast number parsing without fallback"](https://arxiv.org/abs/2212.06644)
+ */
+#ifndef fmt_fmt__lemire__included
+#define fmt_fmt__lemire__included 1
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/*========== Includes =======================================================*/
+
+#include "dh/fmt/cfg.h"
+
+/*========== Macros and Definitions =========================================*/
+
+/* --- Constants --- */
+
+/// Smallest decimal exponent with a table entry; anything below rounds to zero
+#define fmt__lemire_min_exp10 (-342)
+/// Largest decimal exponent with a table entry; anything above overflows to infinity
+#define fmt__lemire_max_exp10 (308)
+/// Direct lookup table size for pow5
+#define fmt__lemire_table_pow5_size (fmt__lemire_max_exp10 - fmt__lemire_min_exp10 + 1)
+
+/* --- Types --- */
+
+/// 128-bit value represented as [low_64bits, high_64bits]
+typedef A$$(2, u64) fmt__lemire_TableEntry;
+typedef A$$(fmt__lemire_table_pow5_size, fmt__lemire_TableEntry) fmt__lemire_TablePow5;
+
+/* --- Tables --- */
+
+/// @brief Power of 5 lookup table
+/// @details Entry `q - fmt__lemire_min_exp10` holds 5^q, q ∈ [-342, 308],
+///          shifted so bit 127 is set and truncated (rounded up for q < 0)
+///          Size: 651 entries × 16 bytes = 10,416 bytes
+$extern let_(fmt__lemire_table_pow5, fmt__lemire_TablePow5);
+
+/* --- Helper Functions --- */
+
+/// Get power of 5 approximation for decimal exponent `q`
+$attr($inline_always)
+$static fn_((fmt__lemire_pow5(i32 q))(fmt__lemire_TableEntry)) {
+    claim_assert(fmt__lemire_min_exp10 <= q && q <= fmt__lemire_max_exp10);
+    return *A_at((fmt__lemire_table_pow5)[as$(usize)(q - fmt__lemire_min_exp10)]);
+};
+
+/// floor(log2(10^q)) + 63
+$attr($inline_always)
+$static fn_((fmt__lemire_power(i32 q))(i32)) {
+    return (((152170 + 65536) * q) >> 16) + 63;
+};
+
+/// Full 128-bit product of two u64 values as [low_64bits, high_64bits]
+$attr($inline_always)
+$static fn_((fmt__lemire_mulFull(u64 lhs, u64 rhs))(fmt__lemire_TableEntry)) {
+#if defined(__SIZEOF_INT128__)
+    let product = as$(unsigned __int128)(lhs) * rhs;
+    return (fmt__lemire_TableEntry)A_init({ as$(u64)(product), as$(u64)(product >> 64) });
+#else  /* !defined(__SIZEOF_INT128__) */
+    let l_lo = lhs & 0xFFFFFFFFull;
+    let l_hi = lhs >> 32;
+    let r_lo = rhs & 0xFFFFFFFFull;
+    let r_hi = rhs >> 32;
+    let t0 = l_lo * r_lo;
+    let t1 = l_hi * r_lo + (t0 >> 32);
+    let t2 = l_lo * r_hi + (t1 & 0xFFFFFFFFull);
+    let lo = (t2 << 32) | (t0 & 0xFFFFFFFFull);
+    let hi = l_hi * r_hi + (t1 >> 32) + (t2 >> 32);
+    return (fmt__lemire_TableEntry)A_init({ lo, hi });
+#endif /* !defined(__SIZEOF_INT128__) */
+};
+
+#if defined(__cplusplus)
+} /* extern "C" */
+#endif /* defined(__cplusplus) */
+#endif /* fmt_fmt__lemire__included */
@@ -1,4 +1,5 @@
 #include "dh/fs/File.h"
+#include "dh/mem/common.h"
 
 #if plat_is_windows
 #include "dh/os/windows/handle.h"
@@ -84,6 +85,7 @@ typedef union Writer {
     struct {
         fs_File ctx;
         fn_(((*write)(P$raw ctx, S_const$u8 bytes))(E$usize)) $must_check;
+        fn_(((*writeVec)(P$raw ctx, S_const$S_const$u8 segs))(E$usize)) $must_check;
     };
 } Writer;
 
@@ -94,10 +96,308 @@ $static fn_((Writer_VT_write(P$raw ctx, S_const$u8 bytes))(E$usize)) {
         pp_else_(/* plat_is_posix */ posix_write))(self->handle, bytes);
 }
 
+$static fn_((Writer_VT_writeVec(P$raw ctx, S_const$S_const$u8 segs))(E$usize)) {
+    let self = ptrCast$((FieldType$(Writer, ctx)*)(&ctx));
+    return fs_File_writev(*self, segs);
+}
+
 $static fn_((Writer_init(fs_File file))(Writer)) {
-    return (Writer){ .ctx = file, .write = Writer_VT_write };
+    return (Writer){ .ctx = file, .write = Writer_VT_write, .writeVec = Writer_VT_writeVec };
 }
 
 fn_((fs_File_writer(fs_File file))(io_Writer)) {
     return Writer_init(file).base;
 }
+
+/* --- Positional and Vectored I/O --- */
+
+#if plat_is_windows
+$static fn_((windows_ReadFileAt(HANDLE handle, S$u8 buf, u64 offset))(E$usize) $scope) {
+    var overlapped = (OVERLAPPED){ .Offset = as$(DWORD)(offset), .OffsetHigh = as$(DWORD)(offset >> 32) };
+    if_(DWORD bytes_read = 0, !ReadFile(handle, buf.ptr, as$(DWORD)(buf.len), &bytes_read, &overlapped)) {
+        if (GetLastError() != ERROR_HANDLE_EOF) { return_err(fs_File_Err_ReadFailed()); }
+        return_ok(0); // EOF
+    } else {
+        return_ok(as$(usize)(bytes_read));
+    }
+    claim_unreachable;
+} $unscoped_(fn);
+$static fn_((windows_WriteFileAt(HANDLE handle, S_const$u8 bytes, u64 offset))(E$usize) $scope) {
+    var overlapped = (OVERLAPPED){ .Offset = as$(DWORD)(offset), .OffsetHigh = as$(DWORD)(offset >> 32) };
+    if_(DWORD bytes_written = 0, !WriteFile(handle, bytes.ptr, as$(DWORD)(bytes.len), &bytes_written, &overlapped)) {
+        return_err(fs_File_Err_WriteFailed());
+    } else {
+        return_ok(as$(usize)(bytes_written));
+    }
+    claim_unreachable;
+} $unscoped_(fn);
+#else /* plat_is_posix */
+#include <sys/uio.h>
+#include <sys/stat.h>
+/// Segments passed to one `readv`/`writev`; callers loop on short transfers anyway
+#define posix__iov_batch (16u)
+#endif
+
+fn_((fs_File_pread(fs_File self, S$u8 buf, u64 offset))(E$usize) $scope) {
+#if plat_is_windows
+    return windows_ReadFileAt(self.handle, buf, offset);
+#else /* plat_is_posix */
+    if_(let bytes_read = pread(self.handle, buf.ptr, buf.len, as$(off_t)(offset)), bytes_read == -1) {
+        return_err(fs_File_Err_ReadFailed());
+    } else {
+        return_ok(as$(usize)(bytes_read));
+    }
+#endif
+    claim_unreachable;
+} $unscoped_(fn);
+
+fn_((fs_File_pwrite(fs_File self, S_const$u8 bytes, u64 offset))(E$usize) $scope) {
+#if plat_is_windows
+    return windows_WriteFileAt(self.handle, bytes, offset);
+#else /* plat_is_posix */
+    if_(let bytes_written = pwrite(self.handle, bytes.ptr, bytes.len, as$(off_t)(offset)), bytes_written == -1) {
+        return_err(fs_File_Err_WriteFailed());
+    } else {
+        return_ok(as$(usize)(bytes_written));
+    }
+#endif
+    claim_unreachable;
+} $unscoped_(fn);
+
+fn_((fs_File_readv(fs_File self, S_const$S$u8 bufs))(E$usize) $scope) {
+#if plat_is_windows
+    // No scatter read for synchronous handles: one ReadFile per buffer
+    var_(total, usize) = 0;
+    for_(($s(bufs))(buf) {
+        let bytes_read = try_(windows_ReadFile(self.handle, *buf));
+        total += bytes_read;
+        if (bytes_read < buf->len) { break; }
+    });
+    return_ok(total);
+#else /* plat_is_posix */
+    var_(iov, A$$(posix__iov_batch, struct iovec)) = A_zero();
+    let count = prim_min(bufs.len, A_len(iov));
+    for_(($r(0, count))(i) {
+        asg_lit((A_at((iov)[i]))({ .iov_base = S_at((bufs)[i])->ptr, .iov_len = S_at((bufs)[i])->len }));
+    });
+    if_(let bytes_read = readv(self.handle, A_ptr(iov), as$(i32)(count)), bytes_read == -1) {
+        return_err(fs_File_Err_ReadFailed());
+    } else {
+        return_ok(as$(usize)(bytes_read));
+    }
+#endif
+    claim_unreachable;
+} $unscoped_(fn);
+
+fn_((fs_File_writev(fs_File self, S_const$S_const$u8 segs))(E$usize) $scope) {
+#if plat_is_windows
+    // No gather write for synchronous handles: one WriteFile per segment
+    var_(total, usize) = 0;
+    for_(($s(segs))(seg) {
+        let bytes_written = try_(windows_WriteFile(self.handle, *seg));
+        total += bytes_written;
+        if (bytes_written < seg->len) { break; }
+    });
+    return_ok(total);
+#else /* plat_is_posix */
+    var_(iov, A$$(posix__iov_batch, struct iovec)) = A_zero();
+    let count = prim_min(segs.len, A_len(iov));
+    for_(($r(0, count))(i) {
+        asg_lit((A_at((iov)[i]))({
+            .iov_base = constCast(S_at((segs)[i])->ptr),
+            .iov_len = S_at((segs)[i])->len,
+        }));
+    });
+    if_(let bytes_written = writev(self.handle, A_ptr(iov), as$(i32)(count)), bytes_written == -1) {
+        return_err(fs_File_Err_WriteFailed());
+    } else {
+        return_ok(as$(usize)(bytes_written));
+    }
+#endif
+    claim_unreachable;
+} $unscoped_(fn);
+
+fn_((fs_File_seek(fs_File self, i64 offset, fs_File_SeekFrom from))(E$u64) $scope) {
+#if plat_is_windows
+    $static const DWORD methods[] = { FILE_BEGIN, FILE_CURRENT, FILE_END };
+    if_(LARGE_INTEGER pos = cleared(), SetFilePointerEx(self.handle, (LARGE_INTEGER){ .QuadPart = offset }, &pos, methods[from])) {
+        return_ok(as$(u64)(pos.QuadPart));
+    }
+#else /* plat_is_posix */
+    $static const i32 whences[] = { SEEK_SET, SEEK_CUR, SEEK_END };
+    if_(let pos = lseek(self.handle, as$(off_t)(offset), whences[from]), pos != -1) {
+        return_ok(as$(u64)(pos));
+    }
+#endif
+    return_err(fs_File_Err_SeekFailed());
+} $unscoped_(fn);
+
+fn_((fs_File_getPos(fs_File self))(E$u64)) {
+    return fs_File_seek(self, 0, fs_File_SeekFrom_current);
+};
+
+fn_((fs_File_getEndPos(fs_File self))(E$u64) $scope) {
+#if plat_is_windows
+    if_(LARGE_INTEGER size = cleared(), GetFileSizeEx(self.handle, &size)) {
+        return_ok(as$(u64)(size.QuadPart));
+    }
+#else /* plat_is_posix */
+    if_(struct stat st = cleared(), fstat(self.handle, &st) == 0) {
+        return_ok(as$(u64)(st.st_size));
+    }
+#endif
+    return_err(fs_File_Err_SeekFailed());
+} $unscoped_(fn);
+
+/* --- Memory-Mapped Files --- */
+
+#if plat_is_windows
+#include "dh/os/windows/mem.h"
+#include "dh/os/windows/sysinfo.h"
+#include "dh/os/windows/proc.h"
+#else /* plat_is_posix */
+#include <sys/mman.h>
+#endif
+
+/// Alignment the OS requires for mapping offsets (page size, or allocation granularity on Windows)
+$static fn_((fs_File__mapGranularity(void))(usize)) {
+#if plat_is_windows
+    SYSTEM_INFO info = cleared();
+    GetSystemInfo(&info);
+    return as$(usize)(info.dwAllocationGranularity);
+#else /* plat_is_posix */
+    return as$(usize)(sysconf(_SC_PAGESIZE));
+#endif
+};
+
+fn_((fs_File_map(fs_File self, fs_File_MapFlags flags))(E$fs_MappedFile) $scope) {
+    claim_assert_fmt(flags.mode != fs_File_OpenMode_write_only, "write-only files cannot be mapped");
+    let is_writable = flags.mode == fs_File_OpenMode_read_write;
+    let file_len = intCast$((usize)(try_(fs_File_getEndPos(self))));
+    if (file_len < flags.offset) { return_err(fs_File_Err_MapFailed()); }
+    let len = flags.len != 0 ? flags.len : file_len - flags.offset;
+    // Touching pages past the end of the file faults, and a mapping never grows the file
+    if (file_len - flags.offset < len) { return_err(fs_File_Err_MapFailed()); }
+    if (len == 0) {
+        return_ok({ .bytes = zero$S(), .region = zero$S(), .file = self, .is_writable = is_writable });
+    }
+
+    let region_offset = mem_alignBwd(flags.offset, fs_File__mapGranularity());
+    let slack = flags.offset - region_offset;
+    let region_len = slack + len;
+#if plat_is_windows
+    let protect = is_writable && !flags.is_private ? PAGE_READWRITE
+                : is_writable                      ? PAGE_WRITECOPY
+                                                   : PAGE_READONLY;
+    let mapping = CreateFileMappingW(self.handle, null, protect, 0, 0, null);
+    if (mapping == null) { return_err(fs_File_Err_MapFailed()); }
+    let access = flags.is_private ? FILE_MAP_COPY
+               : is_writable      ? FILE_MAP_WRITE
+                                  : FILE_MAP_READ;
+    let offset = as$(u64)(region_offset);
+    let addr = MapViewOfFile(mapping, access, as$(DWORD)(offset >> 32), as$(DWORD)(offset & 0xFFFFFFFFu), region_len);
+    if (addr == null) {
+        CloseHandle(mapping);
+        return_err(fs_File_Err_MapFailed());
+    }
+#else /* plat_is_posix */
+    let prot = PROT_READ | (is_writable ? PROT_WRITE : 0);
+    var map_flags = flags.is_private ? MAP_PRIVATE : MAP_SHARED;
+#if defined(MAP_POPULATE)
+    if (flags.populate) { map_flags |= MAP_POPULATE; }
+#endif /* defined(MAP_POPULATE) */
+    let addr = mmap(null, region_len, prot, map_flags, self.handle, as$(off_t)(region_offset));
+    if (addr == MAP_FAILED) { return_err(fs_File_Err_MapFailed()); }
+#endif
+    let region = init$S$((u8)(as$(u8*)(addr), region_len));
+    let mapped = (fs_MappedFile){
+        .bytes = S_suffix((region)(slack)),
+        .region = region,
+        .file = self,
+#if plat_is_windows
+        .mapping = mapping,
+#endif /* plat_is_windows */
+        .is_writable = is_writable,
+    };
+    if (flags.advice != fs_File_MapAdvice_normal) { fs_MappedFile_advise(mapped, flags.advice); }
+#if plat_is_windows || !defined(MAP_POPULATE)
+    // No populate-on-map flag here: ask for read-ahead instead
+    if (flags.populate) { fs_MappedFile_advise(mapped, fs_File_MapAdvice_will_need); }
+#endif
+    return_ok(mapped);
+} $unscoped_(fn);
+
+fn_((fs_MappedFile_unmap(fs_MappedFile* self))(void)) {
+    if (self->region.len != 0) {
+#if plat_is_windows
+        UnmapViewOfFile(self->region.ptr);
+        CloseHandle(self->mapping);
+#else /* plat_is_posix */
+        let_ignore = munmap(self->region.ptr, self->region.len);
+#endif
+    }
+    self->bytes = zero$S();
+    self->region = zero$S();
+};
+
+fn_((fs_MappedFile_advise(fs_MappedFile self, fs_File_MapAdvice advice))(void)) {
+    if (self.region.len == 0) { return; }
+#if plat_is_windows
+    // Only read-ahead has a Windows counterpart
+    if (advice != fs_File_MapAdvice_will_need) { return; }
+    WIN32_MEMORY_RANGE_ENTRY entry = { .VirtualAddress = self.region.ptr, .NumberOfBytes = self.region.len };
+    let_ignore = PrefetchVirtualMemory(GetCurrentProcess(), 1, &entry, 0);
+#else /* plat_is_posix */
+    var_(hint, i32) = POSIX_MADV_NORMAL;
+    switch (advice) {
+    case fs_File_MapAdvice_normal:     hint = POSIX_MADV_NORMAL; break;
+    case fs_File_MapAdvice_sequential: hint = POSIX_MADV_SEQUENTIAL; break;
+    case fs_File_MapAdvice_random:     hint = POSIX_MADV_RANDOM; break;
+    case fs_File_MapAdvice_will_need:  hint = POSIX_MADV_WILLNEED; break;
+    case fs_File_MapAdvice_dont_need:  hint = POSIX_MADV_DONTNEED; break;
+    }
+    // Advice is a hint; failure leaves the mapping usable
+    let_ignore = posix_madvise(self.region.ptr, self.region.len, hint);
+#endif
+};
+
+fn_((fs_MappedFile_sync(fs_MappedFile self, bool waits))(E$void) $scope) {
+    if (self.region.len == 0 || !self.is_writable) { return_ok({}); }
+#if plat_is_windows
+    if (!FlushViewOfFile(self.region.ptr, self.region.len)) { return_err(fs_File_Err_WriteFailed()); }
+    if (waits && !FlushFileBuffers(self.file.handle)) { return_err(fs_File_Err_WriteFailed()); }
+#else /* plat_is_posix */
+    if (msync(self.region.ptr, self.region.len, waits ? MS_SYNC : MS_ASYNC) != 0) {
+        return_err(fs_File_Err_WriteFailed());
+    }
+#endif
+    return_ok({});
+} $unscoped_(fn);
+
+fn_((fs_MappedFile_Reader_init(fs_MappedFile mapped))(fs_MappedFile_Reader)) {
+    return (fs_MappedFile_Reader){ .fixed = io_Fixed_Reader_init(io_Fixed_reading(fs_MappedFile_bytes(mapped))) };
+};
+
+fn_((fs_MappedFile_Reader_rest(fs_MappedFile_Reader self))(S_const$u8)) {
+    return S_suffix((self.fixed.stream.buf)(self.fixed.stream.pos));
+};
+
+fn_((fs_MappedFile_Reader_take(fs_MappedFile_Reader* self, usize n))(S_const$u8)) {
+    let rest = fs_MappedFile_Reader_rest(*self);
+    let taken = S_prefix((rest)(prim_min(n, rest.len)));
+    self->fixed.stream.pos += taken.len;
+    return taken;
+};
+
+fn_((fs_MappedFile_Reader_takeUntilByte(fs_MappedFile_Reader* self, u8 delim))(O$S_const$u8) $scope) {
+    let rest = fs_MappedFile_Reader_rest(*self);
+    if (rest.len == 0) { return_none(); }
+    let len = orelse_((mem_idxByte(rest, delim))(rest.len));
+    // Consume the delimiter too, when there is one
+    self->fixed.stream.pos += prim_min(len + 1, rest.len);
+    return_some(S_prefix((rest)(len)));
+} $unscoped_(fn);
+
+fn_((fs_MappedFile_reader(fs_MappedFile_Reader* self))(io_Reader)) {
+    return io_Fixed_reader(&self->fixed);
+};
@@ -1,4 +1,5 @@
 #include "dh/heap/Arena.h"
+#include "dh/heap/Page.h"
 #include "dh/mem/common.h"
 
 /*========== Internal Declarations ==========================================*/
@@ -17,6 +18,10 @@ $static fn_((heap_Arena__remap(P$raw ctx, S$u8 buf, mem_Align buf_align, usize n
 $static fn_((heap_Arena__free(P$raw ctx, S$u8 buf, mem_Align buf_align))(void));
 $static fn_((heap_Arena__createLink(heap_Arena* self, usize prev_len, usize minimum_size))(O$P$ListSgl_Link$usize));
 
+/// Child allocator of every scratch arena
+$static var_(heap_Arena__scratch_page, heap_Page) = {};
+$static $Thrd_local var_(heap_Arena__scratch_arenas, A$$(heap_Arena_scratch_count, heap_Arena)) = A_zero();
+
 /*========== External Definitions ===========================================*/
 
 fn_((heap_Arena_State_default(void))(heap_Arena_State)) {
@@ -132,6 +137,65 @@ fn_((heap_Arena_reset(heap_Arena* self, heap_Arena_ResetMode mode))(bool)) {
     return true;
 };
 
+fn_((heap_Arena_save(const heap_Arena* self))(heap_Arena_Savepoint)) {
+    claim_assert_nonnull(self);
+    return (heap_Arena_Savepoint){
+        .buf = self->state.buf_list.first,
+        .end_idx = self->state.end_idx,
+    };
+};
+
+fn_((heap_Arena_restore(heap_Arena* self, heap_Arena_Savepoint savepoint))(void)) {
+    claim_assert_nonnull(self);
+    // Buffers added since the savepoint were prepended, so they come first
+    while (true) {
+        let link = orelse_((self->state.buf_list.first)(break));
+        if (isSome(savepoint.buf) && unwrap_(savepoint.buf) == link) { break; }
+        self->state.buf_list.first = link->next;
+        let alloc_buf_len = *ListSgl_Link_data$usize(link);
+        let alloc_buf = init$S$((u8)(as$(u8*)(link), alloc_buf_len));
+        mem_Allocator_rawFree(self->child_allocator, alloc_buf, alignOf$(ListSgl_Adp$usize));
+    }
+    debug_assert_fmt(
+        isNone(savepoint.buf) || isSome(self->state.buf_list.first),
+        "Savepoint does not belong to this arena or was invalidated by a reset"
+    );
+    self->state.end_idx = savepoint.end_idx;
+};
+
+fn_((heap_Arena_scratch(S_const$P$heap_Arena conflicts))(heap_Arena_Scratch)) {
+    var_(arena, heap_Arena*) = null;
+    for_(($s(A_ref(heap_Arena__scratch_arenas)))(candidate) {
+        var_(is_conflicting, bool) = false;
+        for_(($s(conflicts))(conflict) { is_conflicting |= *conflict == candidate; });
+        if (!is_conflicting) {
+            arena = candidate;
+            break;
+        }
+    });
+    if (arena == null) { claim_unreachable_msg("Every scratch arena is in use by the caller"); }
+    if (arena->child_allocator.vt == null) {
+        *arena = heap_Arena_init(heap_Page_allocator(&heap_Arena__scratch_page));
+    }
+    return (heap_Arena_Scratch){
+        .arena = arena,
+        .savepoint = heap_Arena_save(arena),
+    };
+};
+
+fn_((heap_Arena_Scratch_end(heap_Arena_Scratch self))(void)) {
+    claim_assert_nonnull(self.arena);
+    heap_Arena_restore(self.arena, self.savepoint);
+};
+
+fn_((heap_Arena_scratchFini(void))(void)) {
+    for_(($s(A_ref(heap_Arena__scratch_arenas)))(arena) {
+        if (arena->child_allocator.vt == null) { continue; }
+        heap_Arena_fini(*arena);
+        *arena = lit0$((heap_Arena));
+    });
+};
+
 /*========== Internal Definitions ===========================================*/
 
 fn_((heap_Arena__alloc(P$raw ctx, usize len, mem_Align align))(O$P$u8) $scope) {
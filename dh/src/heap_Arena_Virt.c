@@ -0,0 +1,169 @@
+#include "dh/heap/Arena.h"
+#include "dh/mem/common.h"
+
+#if plat_is_windows
+#include "dh/os/windows/mem.h"
+#else /* posix */
+#include <sys/mman.h>
+#endif
+
+/*========== Internal Declarations ==========================================*/
+
+/// Makes `[0, len)` of the reservation accessible
+$static fn_((heap_Arena_Virt__commit(heap_Arena_Virt* self, usize len))(bool));
+/// Returns the pages beyond `len` to the system and makes them inaccessible again
+$static fn_((heap_Arena_Virt__decommit(heap_Arena_Virt* self, usize len))(void));
+
+$static fn_((heap_Arena_Virt__alloc(P$raw ctx, usize len, mem_Align align))(O$P$u8));
+$static fn_((heap_Arena_Virt__resize(P$raw ctx, S$u8 buf, mem_Align buf_align, usize new_len))(bool));
+$static fn_((heap_Arena_Virt__remap(P$raw ctx, S$u8 buf, mem_Align buf_align, usize new_len))(O$P$u8));
+$static fn_((heap_Arena_Virt__free(P$raw ctx, S$u8 buf, mem_Align buf_align))(void));
+
+/*========== External Definitions ===========================================*/
+
+fn_((heap_Arena_Virt_init(usize reserve_len))(mem_Err$heap_Arena_Virt) $scope) {
+    let len = mem_alignFwd(reserve_len, heap_Arena_Virt_commit_granule);
+#if plat_is_windows
+    let ptr = VirtualAlloc(null, len, MEM_RESERVE, PAGE_NOACCESS);
+    if (ptr == null) { return_err(mem_Err_OutOfMemory()); }
+#else /* posix */
+    var_(flags, i32) = MAP_PRIVATE | MAP_ANONYMOUS;
+#if defined(MAP_NORESERVE)
+    flags |= MAP_NORESERVE;
+#endif
+    let ptr = mmap(null, len, PROT_NONE, flags, -1, 0);
+    if (ptr == MAP_FAILED) { return_err(mem_Err_OutOfMemory()); }
+#endif /* posix */
+    return_ok({
+        .reserved = init$S$((u8)(as$(u8*)(ptr), len)),
+        .committed = 0,
+        .end_idx = 0,
+    });
+} $unscoped_(fn);
+
+fn_((heap_Arena_Virt_fini(heap_Arena_Virt* self))(void)) {
+    claim_assert_nonnull(self);
+    if (self->reserved.ptr == null) { return; }
+#if plat_is_windows
+    VirtualFree(self->reserved.ptr, 0, MEM_RELEASE);
+#else /* posix */
+    munmap(self->reserved.ptr, self->reserved.len);
+#endif /* posix */
+    *self = lit0$((heap_Arena_Virt));
+};
+
+fn_((heap_Arena_Virt_allocator(heap_Arena_Virt* self))(mem_Allocator)) {
+    // VTable for virtual-memory arena allocator
+    $static const mem_Allocator_VT vt $like_ref = { {
+        .alloc = heap_Arena_Virt__alloc,
+        .resize = heap_Arena_Virt__resize,
+        .remap = heap_Arena_Virt__remap,
+        .free = heap_Arena_Virt__free,
+    } };
+    return mem_Allocator_ensureValid((mem_Allocator){
+        .ctx = self,
+        .vt = vt,
+    });
+};
+
+fn_((heap_Arena_Virt_save(const heap_Arena_Virt* self))(usize)) {
+    claim_assert_nonnull(self);
+    return self->end_idx;
+};
+
+fn_((heap_Arena_Virt_restore(heap_Arena_Virt* self, usize savepoint))(void)) {
+    claim_assert_nonnull(self);
+    debug_assert_fmt(
+        savepoint <= self->end_idx,
+        "Savepoint is past the end of the arena (savepoint: {:uz}, end: {:uz})",
+        savepoint, self->end_idx
+    );
+    self->end_idx = savepoint;
+};
+
+fn_((heap_Arena_Virt_reset(heap_Arena_Virt* self, usize retain))(void)) {
+    claim_assert_nonnull(self);
+    self->end_idx = 0;
+    heap_Arena_Virt__decommit(self, mem_alignFwd(retain, heap_Arena_Virt_commit_granule));
+};
+
+/*========== Internal Definitions ===========================================*/
+
+fn_((heap_Arena_Virt__commit(heap_Arena_Virt* self, usize len))(bool)) {
+    if (len <= self->committed) { return true; }
+    if (self->reserved.len < len) { return false; }
+    let new_committed = prim_min(mem_alignFwd(len, heap_Arena_Virt_commit_granule), self->reserved.len);
+    let ptr = self->reserved.ptr + self->committed;
+    let grow_len = new_committed - self->committed;
+#if plat_is_windows
+    if (VirtualAlloc(ptr, grow_len, MEM_COMMIT, PAGE_READWRITE) == null) { return false; }
+#else /* posix */
+    if (mprotect(ptr, grow_len, PROT_READ | PROT_WRITE) != 0) { return false; }
+#endif /* posix */
+    self->committed = new_committed;
+    return true;
+};
+
+fn_((heap_Arena_Virt__decommit(heap_Arena_Virt* self, usize len))(void)) {
+    if (self->committed <= len) { return; }
+    let ptr = self->reserved.ptr + len;
+    let shrink_len = self->committed - len;
+#if plat_is_windows
+    VirtualFree(ptr, shrink_len, MEM_DECOMMIT);
+#else /* posix */
+    madvise(ptr, shrink_len, MADV_DONTNEED);
+    mprotect(ptr, shrink_len, PROT_NONE);
+#endif /* posix */
+    self->committed = len;
+};
+
+fn_((heap_Arena_Virt__alloc(P$raw ctx, usize len, mem_Align align))(O$P$u8) $scope) {
+    claim_assert_nonnull(ctx);
+    let self = as$(heap_Arena_Virt*)(ctx);
+    let ptr_align = mem_log2ToAlign(align);
+
+    let addr = ptrToInt(self->reserved.ptr) + self->end_idx;
+    let adjusted_idx = self->end_idx + (mem_alignFwd(addr, ptr_align) - addr);
+    // Check for overflow and for running out of the reservation
+    if (self->reserved.len < adjusted_idx || self->reserved.len - adjusted_idx < len) { return_none(); }
+    let new_end_idx = adjusted_idx + len;
+    if (!heap_Arena_Virt__commit(self, new_end_idx)) { return_none(); }
+    self->end_idx = new_end_idx;
+    return_some(self->reserved.ptr + adjusted_idx);
+} $unscoped_(fn);
+
+fn_((heap_Arena_Virt__resize(P$raw ctx, S$u8 buf, mem_Align buf_align, usize new_len))(bool)) {
+    claim_assert_nonnull(ctx);
+    let self = as$(heap_Arena_Virt*)(ctx);
+    let_ignore = buf_align;
+
+    // Not the most recent allocation, can only shrink
+    let buf_idx = as$(usize)(buf.ptr - self->reserved.ptr);
+    if (buf_idx + buf.len != self->end_idx) {
+        return new_len <= buf.len;
+    }
+    // The last allocation grows up to the end of the reservation without moving
+    if (self->reserved.len - buf_idx < new_len) { return false; }
+    if (!heap_Arena_Virt__commit(self, buf_idx + new_len)) { return false; }
+    self->end_idx = buf_idx + new_len;
+    return true;
+};
+
+fn_((heap_Arena_Virt__remap(P$raw ctx, S$u8 buf, mem_Align buf_align, usize new_len))(O$P$u8) $scope) {
+    claim_assert_nonnull(ctx);
+    if (heap_Arena_Virt__resize(ctx, buf, buf_align, new_len)) {
+        return_some(buf.ptr);
+    }
+    return_none();
+} $unscoped_(fn);
+
+fn_((heap_Arena_Virt__free(P$raw ctx, S$u8 buf, mem_Align buf_align))(void)) {
+    claim_assert_nonnull(ctx);
+    let self = as$(heap_Arena_Virt*)(ctx);
+    let_ignore = buf_align;
+
+    // Only free if it's the most recent allocation
+    if (as$(usize)(buf.ptr - self->reserved.ptr) + buf.len == self->end_idx) {
+        self->end_idx -= buf.len;
+    }
+};
@@ -1,8 +1,15 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+/* mremap and the MAP_HUGETLB/MAP_POPULATE flags */
+#define _GNU_SOURCE
+#endif
 #include "dh/heap/Page.h"
 #include "dh/mem/common.h"
 
 /*========== Internal Declarations ==========================================*/
 
+$attr($inline_always)
+$static fn_((heap_Page__granule(const heap_Page* self))(usize));
+
 $static fn_((heap_Page__alloc(P$raw ctx, usize len, mem_Align align))(O$P$u8));
 $static fn_((heap_Page__resize(P$raw ctx, S$u8 buf, mem_Align buf_align, usize new_len))(bool));
 $static fn_((heap_Page__remap(P$raw ctx, S$u8 buf, mem_Align buf_align, usize new_len))(O$P$u8));
@@ -10,6 +17,10 @@ $static fn_((heap_Page__free(P$raw ctx, S$u8 buf, mem_Align buf_align))(void));
 
 /*========== External Definitions ===========================================*/
 
+fn_((heap_Page_fromCfg(heap_Page_Cfg cfg))(heap_Page)) {
+    return (heap_Page){ .cfg = cfg };
+};
+
 fn_((heap_Page_allocator(heap_Page* self))(mem_Allocator)) {
     // VTable for Page allocator
     $static const mem_Allocator_VT vt $like_ref = { {
@@ -33,8 +44,29 @@ fn_((heap_Page_allocator(heap_Page* self))(mem_Allocator)) {
 #include <unistd.h>
 #endif
 
+fn_((heap_Page__granule(const heap_Page* self))(usize)) {
+#if plat_is_windows
+    let_ignore = self;
+    return mem_page_size;
+#else /* posix */
+    let granule = self->cfg.granule != 0 ? self->cfg.granule
+                : self->cfg.huge != heap_Page_Huge_none ? heap_Page_huge_page_size
+                                                        : mem_page_size;
+    /* `MAP_HUGETLB` lengths and `munmap` of such mappings must be whole huge pages */
+    if (self->cfg.huge == heap_Page_Huge_explicit) { return mem_alignFwd(granule, heap_Page_huge_page_size); }
+    return mem_alignFwd(granule, mem_page_size);
+#endif /* posix */
+};
+
+#if !plat_is_windows
+$static fn_((heap_Page__adviseHuge(P$raw ptr, usize len))(void));
+$static fn_((heap_Page__prefault(heap_Page* self, P$raw ptr, usize len))(void));
+$static fn_((heap_Page__release(heap_Page* self, P$raw ptr, usize len))(void));
+#endif /* !plat_is_windows */
+
 fn_((heap_Page__alloc(P$raw ctx, usize len, mem_Align align))(O$P$u8) $scope) {
-    let_ignore = ctx;
+    claim_assert_nonnull(ctx);
+    let self = as$(heap_Page*)(ctx);
     let ptr_align = mem_log2ToAlign(align);
     // Page allocator guarantees page alignment, which is typically larger than most requested alignments
     // Verify requested alignment is not stricter than page alignment
@@ -44,8 +76,9 @@ fn_((heap_Page__alloc(P$raw ctx, usize len, mem_Align align))(O$P$u8) $scope) {
         ptr_align, mem_page_size
     );
 
-    // Check for overflow when aligning to page size
-    if (usize_limit - (mem_page_size - 1) < len) { return_none(); }
+    // Check for overflow when aligning to the granule
+    let granule = heap_Page__granule(self);
+    if (usize_limit - (granule - 1) < len) { return_none(); }
 
 #if plat_is_windows
     // Windows allocation logic similar to zig's PageAllocator
@@ -94,22 +127,28 @@ fn_((heap_Page__alloc(P$raw ctx, usize len, mem_Align align))(O$P$u8) $scope) {
     }
     return_none();
 #else /* posix */
-    let aligned_len = mem_alignFwd(len, mem_page_size);
+    let aligned_len = mem_alignFwd(len, granule);
     let hint = heap_Page_s_next_mmap_addr_hint;
 
-    let map = mmap(
-        hint,
-        aligned_len,
-        PROT_READ | PROT_WRITE,
-        MAP_PRIVATE | MAP_ANONYMOUS,
-        -1,
-        0
-    );
-    if (map == MAP_FAILED) { return_none(); }
+    var_(flags, i32) = MAP_PRIVATE | MAP_ANONYMOUS;
+#if defined(MAP_POPULATE)
+    if (self->cfg.populate) { flags |= MAP_POPULATE; }
+#endif
+    var_(map, P$raw) = MAP_FAILED;
+#if defined(MAP_HUGETLB)
+    if (self->cfg.huge == heap_Page_Huge_explicit) {
+        map = mmap(hint, aligned_len, PROT_READ | PROT_WRITE, flags | MAP_HUGETLB, -1, 0);
+    }
+#endif
+    if (map == MAP_FAILED) {
+        map = mmap(hint, aligned_len, PROT_READ | PROT_WRITE, flags, -1, 0);
+        if (map == MAP_FAILED) { return_none(); }
+        if (self->cfg.huge != heap_Page_Huge_none) { heap_Page__adviseHuge(map, aligned_len); }
+    }
     debug_assert_fmt(mem_isAligned(ptrToInt(map), mem_page_size));
     debug_assert_fmt(mem_isAligned(ptrToInt(map), ptr_align), "mmap returned misaligned address");
 
-    let new_hint = as$(P$raw)(as$(u8*)((map + aligned_len)));
+    let new_hint = as$(P$raw)(as$(u8*)(map) + aligned_len);
     // Here use atomic operations to update the hint
     atom_cmpXchgWeak(
         &heap_Page_s_next_mmap_addr_hint,
@@ -123,17 +162,20 @@ fn_((heap_Page__alloc(P$raw ctx, usize len, mem_Align align))(O$P$u8) $scope) {
 } $unscoped_(fn);
 
 fn_((heap_Page__resize(P$raw ctx, S$u8 buf, mem_Align buf_align, usize new_len))(bool)) {
-    let_ignore = ctx;
+    claim_assert_nonnull(ctx);
+    let self = as$(heap_Page*)(ctx);
     let ptr_align = mem_log2ToAlign(buf_align);
     debug_assert_fmt(ptr_align <= mem_page_size, "Page allocator only guarantees page alignment");
     debug_assert_fmt(mem_isAligned(ptrToInt(buf.ptr), ptr_align), "Buffer address does not match the specified alignment");
     let_ignore = ptr_align;
 
-    let new_size_aligned = mem_alignFwd(new_len, mem_page_size);
-    let buf_aligned_len = mem_alignFwd(buf.len, mem_page_size);
+    let granule = heap_Page__granule(self);
+    let new_size_aligned = mem_alignFwd(new_len, granule);
+    let buf_aligned_len = mem_alignFwd(buf.len, granule);
 
-    if (new_size_aligned == buf_aligned_len && new_len <= buf.len) {
-        return true; // No resize needed
+    let new_pages_end = mem_alignFwd(new_len, mem_page_size);
+    if (new_len <= buf.len ? new_pages_end == mem_alignFwd(buf.len, mem_page_size) : new_size_aligned == buf_aligned_len) {
+        return true; // No resize needed: same pages, or growth within the last granule
     }
 
 #if plat_is_windows
@@ -157,41 +199,45 @@ fn_((heap_Page__resize(P$raw ctx, S$u8 buf, mem_Align buf_align, usize new_len))
 
 #else /* posix */
 
-    if (new_size_aligned < buf_aligned_len) {
-        let ptr = as$(u8*)(buf.ptr) + new_size_aligned;
-        munmap(ptr, buf_aligned_len - new_size_aligned);
+    if (new_len <= buf.len) {
+        // Whole granules are unmapped; the pages left in the last one are advised
+        if (new_size_aligned < buf_aligned_len) {
+            munmap(buf.ptr + new_size_aligned, buf_aligned_len - new_size_aligned);
+        }
+        if (new_pages_end < new_size_aligned) {
+            heap_Page__release(self, buf.ptr + new_pages_end, new_size_aligned - new_pages_end);
+        }
         return true;
     }
 
-#ifdef MAP_REMAP // Check if mremap is available
-    if (MAP_REMAP != 0) { // MAP_REMAP is defined and not 0, mremap is likely available
-        let new_ptr = mremap(buf.ptr, buf.len, new_len, MREMAP_MAYMOVE);
-        if (new_ptr != MAP_FAILED) {
-            // TODO: if heap_Page_s_next_mmap_addr_hint is within the remapped range, update it if moved.
-            return true; // Assume success for now, further hint update needed if address changes.
-        }
-        // mremap failed, fall back to returning false.
-        return false;
+#if plat_is_linux
+    // Grow in place only: without MREMAP_MAYMOVE the mapping stays where it is or the call fails
+    if (mremap(buf.ptr, buf_aligned_len, new_size_aligned, 0) != MAP_FAILED) {
+        heap_Page__prefault(self, buf.ptr + buf_aligned_len, new_size_aligned - buf_aligned_len);
+        return true;
     }
-#endif
+#endif /* plat_is_linux */
 
-    // mremap is not available or failed, larger resize is not supported in this simple page allocator.
+    // The pages past the mapping belong to someone else
     return false;
 #endif /* posix */
 };
 
 fn_((heap_Page__remap(P$raw ctx, S$u8 buf, mem_Align buf_align, usize new_len))(O$P$u8) $scope) {
-    let_ignore = ctx;
+    claim_assert_nonnull(ctx);
+    let self = as$(heap_Page*)(ctx);
     let ptr_align = mem_log2ToAlign(buf_align);
     debug_assert_fmt(ptr_align <= mem_page_size, "Page allocator only guarantees page alignment");
     debug_assert_fmt(mem_isAligned(ptrToInt(buf.ptr), ptr_align), "Buffer address does not match the specified alignment");
     let_ignore = ptr_align;
 
-    let new_size_aligned = mem_alignFwd(new_len, mem_page_size);
-    let buf_aligned_len = mem_alignFwd(buf.len, mem_page_size);
+    let granule = heap_Page__granule(self);
+    let new_size_aligned = mem_alignFwd(new_len, granule);
+    let buf_aligned_len = mem_alignFwd(buf.len, granule);
 
-    if (new_size_aligned == buf_aligned_len && new_len <= buf.len) {
-        return_some(buf.ptr); // No resize needed
+    let new_pages_end = mem_alignFwd(new_len, mem_page_size);
+    if (new_len <= buf.len ? new_pages_end == mem_alignFwd(buf.len, mem_page_size) : new_size_aligned == buf_aligned_len) {
+        return_some(buf.ptr); // No resize needed: same pages, or growth within the last granule
     }
 
 #if plat_is_windows
@@ -200,38 +246,73 @@ fn_((heap_Page__remap(P$raw ctx, S$u8 buf, mem_Align buf_align, usize new_len))(
 
 #else /* posix */
 
-    if (new_size_aligned < buf_aligned_len) {
-        return_none(); // Indicate remap failure, shrinking via remap not supported
+    if (new_len <= buf.len) {
+        // Shrinking never moves the buffer
+        let_ignore = heap_Page__resize(ctx, buf, buf_align, new_len);
+        return_some(buf.ptr);
     }
 
-#ifdef MAP_REMAP // Check if mremap is available
-    if (MAP_REMAP != 0) { // MAP_REMAP is defined and not 0, mremap is likely available
-        let new_ptr = mremap(buf.ptr, buf.len, new_len, MREMAP_MAYMOVE);
-        if (new_ptr != MAP_FAILED) {
-            // TODO: if heap_Page_s_next_mmap_addr_hint is within the remapped range, update it if moved.
-            return_some(new_ptr); // Assume success for now, further hint update needed if address changes.
-        }
-        // mremap failed, fall back to returning none.
-        return_none();
+#if plat_is_linux
+    // The kernel moves the page table entries instead of copying the contents
+    let new_ptr = mremap(buf.ptr, buf_aligned_len, new_size_aligned, MREMAP_MAYMOVE);
+    if (new_ptr != MAP_FAILED) {
+        heap_Page__prefault(self, as$(u8*)(new_ptr) + buf_aligned_len, new_size_aligned - buf_aligned_len);
+        return_some(new_ptr);
     }
-#endif
+#endif /* plat_is_linux */
 
-    // mremap is not available or failed, larger resize is not supported in this simple page allocator.
+    // Without mremap the caller falls back to alloc, copy and free
     return_none();
 #endif /* posix */
 } $unscoped_(fn);
 
 fn_((heap_Page__free(P$raw ctx, S$u8 buf, mem_Align buf_align))(void)) {
-    let_ignore = ctx;
+    claim_assert_nonnull(ctx);
+    let self = as$(heap_Page*)(ctx);
     let ptr_align = mem_log2ToAlign(buf_align);
     debug_assert_fmt(ptr_align <= mem_page_size, "Page allocator only guarantees page alignment");
     debug_assert_fmt(mem_isAligned(ptrToInt(buf.ptr), ptr_align), "Buffer address does not match the specified alignment");
     let_ignore = ptr_align;
 
 #if plat_is_windows
+    let_ignore = self;
     VirtualFree(buf.ptr, 0, MEM_RELEASE);
 #else /* posix */
-    let buf_aligned_len = mem_alignFwd(buf.len, mem_page_size);
+    let buf_aligned_len = mem_alignFwd(buf.len, heap_Page__granule(self));
     munmap(buf.ptr, buf_aligned_len);
 #endif /* posix */
 };
+
+#if !plat_is_windows
+fn_((heap_Page__adviseHuge(P$raw ptr, usize len))(void)) {
+#if defined(MADV_HUGEPAGE)
+    // Best effort: THP may be disabled system-wide
+    let_ignore = madvise(ptr, len, MADV_HUGEPAGE);
+#else
+    let_ignore = ptr;
+    let_ignore = len;
+#endif
+};
+
+fn_((heap_Page__prefault(heap_Page* self, P$raw ptr, usize len))(void)) {
+    // mremap does not honor MAP_POPULATE for the pages it adds
+#if defined(MADV_POPULATE_WRITE)
+    if (self->cfg.populate && len != 0) { let_ignore = madvise(ptr, len, MADV_POPULATE_WRITE); }
+#else
+    let_ignore = self;
+    let_ignore = ptr;
+    let_ignore = len;
+#endif
+};
+
+fn_((heap_Page__release(heap_Page* self, P$raw ptr, usize len))(void)) {
+#if defined(MADV_FREE)
+    if (self->cfg.shrink == heap_Page_Shrink_free) {
+        // Older kernels reject MADV_FREE; fall through to the eager release then
+        if (madvise(ptr, len, MADV_FREE) == 0) { return; }
+    }
+#endif
+    let_ignore = self;
+    let_ignore = madvise(ptr, len, MADV_DONTNEED);
+};
+#endif /* !plat_is_windows */
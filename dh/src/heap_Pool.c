@@ -0,0 +1,255 @@
+#include "dh/heap/Pool.h"
+#include "dh/mem/common.h"
+
+/*========== Internal Declarations ==========================================*/
+
+/// Precedes every element in its slot.
+typedef struct heap_Pool__Hdr {
+    var_(idx, u32);
+    var_(gen, u32);
+} heap_Pool__Hdr;
+T_use_P$(heap_Pool__Hdr);
+T_use_E$($set(mem_Err)(P$heap_Pool__Hdr));
+
+$attr($inline_always)
+$static fn_((heap_Pool__slotAlign(const heap_Pool* self))(mem_Align));
+$attr($inline_always)
+$static fn_((heap_Pool__hdrAt(const heap_Pool* self, u32 idx))(heap_Pool__Hdr*));
+$attr($inline_always)
+$static fn_((heap_Pool__elemOf(const heap_Pool* self, heap_Pool__Hdr* hdr))(P$u8));
+$attr($inline_always)
+$static fn_((heap_Pool__hdrOf(const heap_Pool* self, P_const$raw elem))(heap_Pool__Hdr*));
+$static fn_((heap_Pool__grow(heap_Pool* self))(mem_Err$void));
+$static fn_((heap_Pool__take(heap_Pool* self))(mem_Err$P$heap_Pool__Hdr));
+$static fn_((heap_Pool__give(heap_Pool* self, heap_Pool__Hdr* hdr))(void));
+$static fn_((heap_Pool__lock(heap_Pool* self))(void));
+$static fn_((heap_Pool__unlock(heap_Pool* self))(void));
+
+$static fn_((heap_Pool__alloc(P$raw ctx, usize len, mem_Align align))(O$P$u8));
+$static fn_((heap_Pool__resize(P$raw ctx, S$u8 buf, mem_Align buf_align, usize new_len))(bool));
+$static fn_((heap_Pool__remap(P$raw ctx, S$u8 buf, mem_Align buf_align, usize new_len))(O$P$u8));
+$static fn_((heap_Pool__free(P$raw ctx, S$u8 buf, mem_Align buf_align))(void));
+
+/*========== External Definitions ===========================================*/
+
+fn_((heap_Pool_init(TypeInfo elem_ty, mem_Allocator child_allocator, heap_Pool_Cfg cfg))(heap_Pool)) {
+    let first_len = cfg.first_chunk_len == 0 ? heap_Pool_Cfg_default_first_chunk_len : cfg.first_chunk_len;
+    let first_log2 = uint_log2(first_len) + (int_isPow2(first_len) ? 0u : 1u);
+    /* the free list keeps the next index in the element itself */
+    let elem_size = prim_max(as$(usize)(elem_ty.size), sizeOf$(u32));
+    let elem_align = mem_log2ToAlign(elem_ty.align);
+    let elem_offset = mem_alignFwd(sizeOf$(heap_Pool__Hdr), elem_align);
+    let slot_align = prim_max(elem_align, alignOf$(heap_Pool__Hdr));
+    return (heap_Pool){
+        .child_allocator = child_allocator,
+        .chunks = A_zero(),
+        .chunk_count = 0,
+        .first_chunk_log2 = as$(u32)(first_log2),
+        .free_head = heap_Pool_nil_idx,
+        .bump_idx = 0,
+        .cap = 0,
+        .len = 0,
+        .stride = mem_alignFwd(elem_offset + elem_size, slot_align),
+        .elem_offset = elem_offset,
+        .elem_ty = elem_ty,
+        .is_thrd_safe = cfg.is_thrd_safe,
+        .mtx = cfg.is_thrd_safe ? Thrd_Mtx_init() : lit0$((Thrd_Mtx)),
+    };
+};
+
+fn_((heap_Pool_fini(heap_Pool* self, TypeInfo elem_ty))(void)) {
+    claim_assert_nonnull(self);
+    debug_assert_eqBy(self->elem_ty, elem_ty, TypeInfo_eq);
+    for_(($r(0, self->chunk_count))(k) {
+        let chunk_len = as$(usize)(1) << (self->first_chunk_log2 + k);
+        mem_Allocator_rawFree(
+            self->child_allocator,
+            init$S$((u8)(*A_at((self->chunks)[k]), chunk_len * self->stride)),
+            heap_Pool__slotAlign(self)
+        );
+    });
+    if (self->is_thrd_safe) { Thrd_Mtx_fini(&self->mtx); }
+    *self = lit0$((heap_Pool));
+};
+
+fn_((heap_Pool_len(const heap_Pool* self))(usize)) {
+    claim_assert_nonnull(self);
+    return atom_load(&self->len, atom_MemOrd_unordered);
+};
+
+fn_((heap_Pool_cap(const heap_Pool* self))(usize)) {
+    claim_assert_nonnull(self);
+    /* Pairs with the release store in `heap_Pool__grow`: an index below `cap` has its chunk published */
+    return atom_load(&self->cap, atom_MemOrd_acquire);
+};
+
+fn_((heap_Pool_create(heap_Pool* self, TypeInfo elem_ty))(mem_Err$u_P$raw) $scope) {
+    claim_assert_nonnull(self);
+    debug_assert_eqBy(self->elem_ty, elem_ty, TypeInfo_eq);
+    let hdr = try_(heap_Pool__take(self));
+    return_ok({ .raw = heap_Pool__elemOf(self, hdr), .type = elem_ty });
+} $unscoped_(fn);
+
+fn_((heap_Pool_destroy(heap_Pool* self, u_P$raw obj))(void)) {
+    claim_assert_nonnull(self);
+    claim_assert_nonnull(obj.raw);
+    debug_assert_eqBy(self->elem_ty, obj.type, TypeInfo_eq);
+    let hdr = heap_Pool__hdrOf(self, obj.raw);
+    debug_assert_fmt(hdr->gen & 1u, "Object destroyed twice or not created by this pool");
+    heap_Pool__give(self, hdr);
+};
+
+fn_((heap_Pool_createHdl(heap_Pool* self, TypeInfo elem_ty))(mem_Err$heap_Pool_Hdl) $scope) {
+    claim_assert_nonnull(self);
+    debug_assert_eqBy(self->elem_ty, elem_ty, TypeInfo_eq);
+    let hdr = try_(heap_Pool__take(self));
+    return_ok({ .idx = hdr->idx, .gen = hdr->gen });
+} $unscoped_(fn);
+
+fn_((heap_Pool_destroyHdl(heap_Pool* self, heap_Pool_Hdl hdl))(bool)) {
+    claim_assert_nonnull(self);
+    if (!heap_Pool_isLive(self, hdl)) { return false; }
+    heap_Pool__give(self, heap_Pool__hdrAt(self, hdl.idx));
+    return true;
+};
+
+fn_((heap_Pool_isLive(const heap_Pool* self, heap_Pool_Hdl hdl))(bool)) {
+    claim_assert_nonnull(self);
+    /* live generations are odd, so a zeroed or nil handle never matches */
+    if ((hdl.gen & 1u) == 0 || heap_Pool_cap(self) <= hdl.idx) { return false; }
+    return atom_load(&heap_Pool__hdrAt(self, hdl.idx)->gen, atom_MemOrd_acquire) == hdl.gen;
+};
+
+fn_((heap_Pool_at(const heap_Pool* self, TypeInfo elem_ty, heap_Pool_Hdl hdl))(O$u_P$raw) $scope) {
+    claim_assert_nonnull(self);
+    debug_assert_eqBy(self->elem_ty, elem_ty, TypeInfo_eq);
+    if (!heap_Pool_isLive(self, hdl)) { return_none(); }
+    return_some({ .raw = heap_Pool__elemOf(self, heap_Pool__hdrAt(self, hdl.idx)), .type = elem_ty });
+} $unscoped_(fn);
+
+fn_((heap_Pool_hdlOf(const heap_Pool* self, u_P_const$raw obj))(heap_Pool_Hdl)) {
+    claim_assert_nonnull(self);
+    claim_assert_nonnull(obj.raw);
+    let hdr = heap_Pool__hdrOf(self, obj.raw);
+    return (heap_Pool_Hdl){ .idx = hdr->idx, .gen = atom_load(&hdr->gen, atom_MemOrd_acquire) };
+};
+
+fn_((heap_Pool_allocator(heap_Pool* self))(mem_Allocator)) {
+    // VTable for Pool allocator
+    $static const mem_Allocator_VT vt $like_ref = { {
+        .alloc = heap_Pool__alloc,
+        .resize = heap_Pool__resize,
+        .remap = heap_Pool__remap,
+        .free = heap_Pool__free,
+    } };
+    return mem_Allocator_ensureValid((mem_Allocator){
+        .ctx = self,
+        .vt = vt,
+    });
+};
+
+/*========== Internal Definitions ===========================================*/
+
+fn_((heap_Pool__slotAlign(const heap_Pool* self))(mem_Align)) {
+    return prim_max(as$(mem_Align)(self->elem_ty.align), alignOf$(heap_Pool__Hdr));
+};
+
+fn_((heap_Pool__hdrAt(const heap_Pool* self, u32 idx))(heap_Pool__Hdr*)) {
+    /* chunk `k` starts at slot `(2^k - 1) << first_chunk_log2` */
+    let k = uint_log2((idx >> self->first_chunk_log2) + 1u);
+    let first = ((as$(u32)(1) << k) - 1u) << self->first_chunk_log2;
+    let chunk = *A_at((self->chunks)[k]);
+    return ptrAlignCast$((heap_Pool__Hdr*)(chunk + as$(usize)(idx - first) * self->stride));
+};
+
+fn_((heap_Pool__elemOf(const heap_Pool* self, heap_Pool__Hdr* hdr))(P$u8)) {
+    return ptrAlignCast$((u8*)(hdr)) + self->elem_offset;
+};
+
+fn_((heap_Pool__hdrOf(const heap_Pool* self, P_const$raw elem))(heap_Pool__Hdr*)) {
+    return ptrAlignCast$((heap_Pool__Hdr*)(intToPtr$((u8*)(ptrToInt(elem) - self->elem_offset))));
+};
+
+fn_((heap_Pool__grow(heap_Pool* self))(mem_Err$void) $scope) {
+    let k = self->chunk_count;
+    let chunk_len = as$(u64)(1) << (self->first_chunk_log2 + k);
+    /* the nil index must stay out of range */
+    if (heap_Pool_max_chunks <= k || heap_Pool_nil_idx <= as$(u64)(self->cap) + chunk_len) {
+        return_err(mem_Err_OutOfMemory());
+    }
+    let chunk = orelse_((mem_Allocator_rawAlloc(
+        self->child_allocator, as$(usize)(chunk_len) * self->stride, heap_Pool__slotAlign(self)
+    ))(return_err(mem_Err_OutOfMemory())));
+    *A_at((self->chunks)[k]) = chunk;
+    self->chunk_count = k + 1;
+    atom_store(&self->cap, as$(u32)(self->cap + chunk_len), atom_MemOrd_release);
+    return_ok({});
+} $unscoped_(fn);
+
+fn_((heap_Pool__take(heap_Pool* self))(mem_Err$P$heap_Pool__Hdr) $guard) {
+    heap_Pool__lock(self);
+    defer_(heap_Pool__unlock(self));
+    var_(hdr, heap_Pool__Hdr*) = null;
+    if (self->free_head != heap_Pool_nil_idx) {
+        hdr = heap_Pool__hdrAt(self, self->free_head);
+        self->free_head = *ptrAlignCast$((u32*)(heap_Pool__elemOf(self, hdr)));
+    } else {
+        if (self->bump_idx == self->cap) { try_(heap_Pool__grow(self)); }
+        let idx = self->bump_idx++;
+        hdr = heap_Pool__hdrAt(self, idx);
+        asg_lit((hdr)({ .idx = idx, .gen = 0 }));
+    }
+    atom_store(&hdr->gen, hdr->gen + 1u, atom_MemOrd_release);
+    self->len++;
+    return_ok(hdr);
+} $unguarded_(fn);
+
+fn_((heap_Pool__give(heap_Pool* self, heap_Pool__Hdr* hdr))(void) $guard) {
+    heap_Pool__lock(self);
+    defer_(heap_Pool__unlock(self));
+    atom_store(&hdr->gen, hdr->gen + 1u, atom_MemOrd_release);
+    *ptrAlignCast$((u32*)(heap_Pool__elemOf(self, hdr))) = self->free_head;
+    self->free_head = hdr->idx;
+    self->len--;
+} $unguarded_(fn);
+
+fn_((heap_Pool__lock(heap_Pool* self))(void)) {
+    if (self->is_thrd_safe) { Thrd_Mtx_lock(&self->mtx); }
+};
+
+fn_((heap_Pool__unlock(heap_Pool* self))(void)) {
+    if (self->is_thrd_safe) { Thrd_Mtx_unlock(&self->mtx); }
+};
+
+fn_((heap_Pool__alloc(P$raw ctx, usize len, mem_Align align))(O$P$u8) $scope) {
+    claim_assert_nonnull(ctx);
+    let self = as$(heap_Pool*)(ctx);
+    if (self->elem_ty.size < len || self->elem_ty.align < align) { return_none(); }
+    let hdr = catch_((heap_Pool__take(self))($ignore, return_none()));
+    return_some(heap_Pool__elemOf(self, hdr));
+} $unscoped_(fn);
+
+fn_((heap_Pool__resize(P$raw ctx, S$u8 buf, mem_Align buf_align, usize new_len))(bool)) {
+    claim_assert_nonnull(ctx);
+    let self = as$(heap_Pool*)(ctx);
+    let_ignore = buf;
+    let_ignore = buf_align;
+    return new_len <= self->elem_ty.size;
+};
+
+fn_((heap_Pool__remap(P$raw ctx, S$u8 buf, mem_Align buf_align, usize new_len))(O$P$u8) $scope) {
+    claim_assert_nonnull(ctx);
+    if (heap_Pool__resize(ctx, buf, buf_align, new_len)) {
+        return_some(buf.ptr);
+    }
+    return_none();
+} $unscoped_(fn);
+
+fn_((heap_Pool__free(P$raw ctx, S$u8 buf, mem_Align buf_align))(void)) {
+    claim_assert_nonnull(ctx);
+    let self = as$(heap_Pool*)(ctx);
+    let_ignore = buf_align;
+    let hdr = heap_Pool__hdrOf(self, buf.ptr);
+    debug_assert_fmt(hdr->gen & 1u, "Buffer freed twice or not allocated by this pool");
+    heap_Pool__give(self, hdr);
+};
@@ -1,31 +1,98 @@
 #include "dh/heap/Smp.h"
 #include "dh/meta.h"
+#include "dh/Thrd/Mtx.h"
 
 /*========== Internal Declarations ==========================================*/
 
-$static fn_((heap_Smp__cpuCount(heap_Smp* self))(u32));
+#define heap_Smp__purge_req_decay /*:u32*/ (1u << 0)
+#define heap_Smp__purge_req_all /*:u32*/ (1u << 1)
+/* Tag in `heap_Smp_Slab.remote_head`: the slab is queued on its owner's `remote_slabs` */
+#define heap_Smp__remote_queued /*:usize*/ (as$(usize)(1))
 
 typedef struct heap_Smp__CacheEntry {
-    var_(inst_addr, usize); /// Key: allocator instance address
-    var_(slot_idx, u32); /// Value: last successful slot index
+    var_(inst_id, usize); /// Key: allocator instance id (0 for an unused entry)
+    var_(meta, heap_Smp_ThrdMeta*); /// Value: the meta this thread owns in that instance
     var_(lru_age, u32); /// LRU(Least Recently Used) age
 } heap_Smp__CacheEntry;
 #define heap_Smp__cache_size /*:usize*/ (arch_cache_line_bytes / sizeOf$(heap_Smp__CacheEntry))
 $static $Thrd_local var_(heap_Smp__cache, A$$(heap_Smp__cache_size, heap_Smp__CacheEntry)) = A_zero();
+/* Its address identifies the running thread */
+$static $Thrd_local var_(heap_Smp__thrd_token, u8) = 0;
+$static var_(heap_Smp__last_id, atom_V$usize) = {};
+/* Instances some thread has claimed a meta from; recursive since detaching may
+ * free into another instance that registers itself */
+$static var_(heap_Smp__live_mtx, Thrd_Mtx_Recur) = {};
+$static var_(heap_Smp__live_head, heap_Smp*) = null;
+$static $Thrd_local var_(heap_Smp__exit_hook, Thrd_ExitHook) = {};
 
-typedef struct heap_Smp__Locked {
-    var_(meta, heap_Smp_ThrdMeta*);
-    var_(idx, u32);
-} heap_Smp__Locked;
-$static fn_((heap_Smp__lockThrdMeta(heap_Smp* self))(heap_Smp__Locked));
-$static fn_((heap_Smp__updateCache(usize addr, u32 idx))(void));
+$static fn_((heap_Smp__nextId(void))(usize));
+$static fn_((heap_Smp__thrdToken(void))(usize));
+$static fn_((heap_Smp__initMetas(heap_Smp* self))(void));
+$static fn_((heap_Smp__register(heap_Smp* self))(void));
+$static fn_((heap_Smp__detachExiting(void))(void));
+$static fn_((heap_Smp__nextMeta(heap_Smp* self, heap_Smp_ThrdMeta* meta))(heap_Smp_ThrdMeta*));
+$static fn_((heap_Smp__cachedMeta(heap_Smp* self))(heap_Smp_ThrdMeta*));
+$static fn_((heap_Smp__ownMeta(heap_Smp* self))(heap_Smp_ThrdMeta*));
+$static fn_((heap_Smp__claimMeta(heap_Smp* self))(heap_Smp_ThrdMeta*));
+$static fn_((heap_Smp__updateCache(usize id, heap_Smp_ThrdMeta* meta))(void));
+$static fn_((heap_Smp__dropCache(usize id))(void));
+$static fn_((heap_Smp__maintain(heap_Smp* self, bool all))(usize));
 
 $static fn_((heap_Smp__alloc(P$raw ctx, usize len, mem_Align align))(O$P$u8));
 $static fn_((heap_Smp__resize(P$raw ctx, S$u8 buf, mem_Align buf_align, usize new_len))(bool));
 $static fn_((heap_Smp__remap(P$raw ctx, S$u8 buf, mem_Align buf_align, usize new_len))(O$P$u8));
 $static fn_((heap_Smp__free(P$raw ctx, S$u8 buf, mem_Align buf_align))(void));
 
-$static fn_((heap_Smp__sizeClassIdx(usize len, mem_Align align))(usize));
+struct heap_Smp_Slab {
+    /// Links in `partials[class_idx]` or in the empty list of the owner.
+    var_(prev, heap_Smp_Slab*);
+    var_(next, heap_Smp_Slab*);
+    /// Intrusive list of slots freed by the owner.
+    var_(free_head, usize);
+    /// Number of slots handed out and not yet taken back by the owner.
+    var_(used, u32);
+    /// Slots at and after this index have never been handed out.
+    var_(bump_idx, u32);
+    var_(cap, u32);
+    var_(class_idx, u32);
+    /// Thread meta whose owner is the only thread touching the fields above.
+    var_(owner, heap_Smp_ThrdMeta*);
+    var_(emptied_at, time_Instant);
+    /// Start of the `heap_Smp__slab_block_len` backing block the slab was carved from.
+    var_(block_base, usize);
+    var_(_avoid_false_sharing, Void) $align(arch_cache_line_bytes);
+    /// Intrusive list of slots freed by other threads, tagged with
+    /// `heap_Smp__remote_queued` while the slab sits in `owner->remote_slabs`.
+    var_(remote_head, atom_V$usize);
+    /// Requested bytes the owner still has to subtract for those frees.
+    var_(remote_requested, atom_V$usize);
+    /// Link in `owner->remote_slabs`.
+    var_(remote_next, usize);
+};
+#define heap_Smp__slab_hdr_len /*:usize*/ \
+    ((sizeOf$(heap_Smp_Slab) + arch_cache_line_bytes - 1) / arch_cache_line_bytes * arch_cache_line_bytes)
+/* Backing allocators need not honor a `heap_Smp_slab_len` alignment (heap_Page only
+ * guarantees pages), so each slab is carved out of a block twice its size */
+#define heap_Smp__slab_block_len /*:usize*/ \
+    (2 * heap_Smp_slab_len)
+
+$static fn_((heap_Smp__slabOf(usize addr))(heap_Smp_Slab*));
+$static fn_((heap_Smp__slabBase(heap_Smp_Slab* slab))(usize));
+$static fn_((heap_Smp__pushFront(heap_Smp_Slab** head, heap_Smp_Slab* slab))(void));
+$static fn_((heap_Smp__unlink(heap_Smp_Slab** head, heap_Smp_Slab** tail, heap_Smp_Slab* slab))(void));
+$static fn_((heap_Smp__formatSlab(heap_Smp_ThrdMeta* meta, usize base, usize block_base, usize class_idx))(heap_Smp_Slab*));
+$static fn_((heap_Smp__allocFrom(heap_Smp* self, heap_Smp_ThrdMeta* meta, usize class_idx, usize len))(O$P$u8));
+$static fn_((heap_Smp__reclaimSlots(heap_Smp* self, heap_Smp_Slab* slab, u32 count, usize requested))(void));
+$static fn_((heap_Smp__freeRemote(heap_Smp_Slab* slab, usize addr, usize len))(void));
+$static fn_((heap_Smp__queueSlab(heap_Smp_Slab* slab))(void));
+$static fn_((heap_Smp__collectRemote(heap_Smp* self, heap_Smp_ThrdMeta* meta))(void));
+$static fn_((heap_Smp__serveOwner(heap_Smp* self, heap_Smp_ThrdMeta* meta))(void));
+$static fn_((heap_Smp__retireSlab(heap_Smp* self, heap_Smp_ThrdMeta* meta, heap_Smp_Slab* slab))(void));
+$static fn_((heap_Smp__releaseEmpties(heap_Smp* self, heap_Smp_ThrdMeta* meta, bool all))(usize));
+$static fn_((heap_Smp__adjustRequested(heap_Smp* self, S$u8 buf, usize new_len))(void));
+
+$static fn_((heap_Smp__sizeClassIdx(heap_Smp* self, usize len, mem_Align align))(usize));
+$static fn_((heap_Smp__quarterIdx(usize size))(usize));
 $static fn_((heap_Smp__slotSize(usize class_idx))(usize));
 
 /*========== External Definitions ===========================================*/
@@ -46,17 +113,30 @@ fn_((heap_Smp_allocator(heap_Smp* self))(mem_Allocator)) {
 };
 
 fn_((heap_Smp_from(mem_Allocator backing_allocator, S$heap_Smp_ThrdMeta thrd_metas))(heap_Smp)) {
+    return heap_Smp_fromCfg(backing_allocator, thrd_metas, heap_Smp_Cfg_default);
+};
+
+fn_((heap_Smp_fromCfg(mem_Allocator backing_allocator, S$heap_Smp_ThrdMeta thrd_metas, heap_Smp_Cfg cfg))(heap_Smp)) {
     backing_allocator = mem_Allocator_ensureValid(backing_allocator);
     claim_assert_nonnullS(thrd_metas);
-    claim_assert(thrd_metas.len <= heap_Smp_max_thrd_count);
-    return (heap_Smp){
+    var self = (heap_Smp){
         .backing_allocator = backing_allocator,
         .thrd_metas = thrd_metas,
-        .cpu_count = 0,
+        .spilled_metas = {},
+        .id = heap_Smp__nextId(),
+        .cfg = cfg,
+        .live_next = null,
+        .is_live = {},
     };
+    heap_Smp__initMetas(&self);
+    return self;
+};
+
+fn_((heap_Smp_createOnHeap(mem_Allocator backing_allocator, usize thrd_meta_count))(mem_Err$P$heap_Smp)) {
+    return heap_Smp_createOnHeapCfg(backing_allocator, thrd_meta_count, heap_Smp_Cfg_default);
 };
 
-fn_((heap_Smp_createOnHeap(mem_Allocator backing_allocator, usize thrd_meta_count))(mem_Err$P$heap_Smp) $scope) {
+fn_((heap_Smp_createOnHeapCfg(mem_Allocator backing_allocator, usize thrd_meta_count, heap_Smp_Cfg cfg))(mem_Err$P$heap_Smp) $scope) {
     let thrd_meta_arr_type = u_typeInfoA(thrd_meta_count, typeInfo$(heap_Smp_ThrdMeta));
     let record_field_types = typeInfosFrom(typeInfo$(heap_Smp), thrd_meta_arr_type);
     let record = try_(mem_Allocator_create(backing_allocator, u_typeInfoRecord(record_field_types)));
@@ -64,72 +144,214 @@ fn_((heap_Smp_createOnHeap(mem_Allocator backing_allocator, usize thrd_meta_coun
     let smp = u_castP$((P$heap_Smp)(*S_at((record_fields)[0])));
     smp->backing_allocator = backing_allocator;
     smp->thrd_metas = u_castS$((S$heap_Smp_ThrdMeta)(u_prefixP(*S_at((record_fields)[1]), thrd_meta_count)));
-    smp->cpu_count = 0;
+    atom_V_store(&smp->spilled_metas, 0, atom_MemOrd_monotonic);
+    smp->id = heap_Smp__nextId();
+    smp->cfg = cfg;
+    smp->live_next = null;
+    atom_V_store(&smp->is_live, 0, atom_MemOrd_monotonic);
+    heap_Smp__initMetas(smp);
     return_ok(smp);
 } $unscoped_(fn);
 
 fn_((heap_Smp_destroyOnHeap(P$heap_Smp* self))(void)) {
+    heap_Smp_fini(*self);
     let thrd_meta_arr_type = u_typeInfoA((*self)->thrd_metas.len, typeInfo$(heap_Smp_ThrdMeta));
     let record_field_types = typeInfosFrom(typeInfo$(heap_Smp), thrd_meta_arr_type);
     let record = u_recordPtrMut(u_anyP(*self), record_field_types, 0);
     *self = (mem_Allocator_destroy((*self)->backing_allocator, record), null);
 };
 
+fn_((heap_Smp_fini(heap_Smp* self))(void)) {
+    if (atom_V_load(&self->is_live, atom_MemOrd_acquire) != 0) {
+        /* Unlink first so no exiting thread detaches from a dying instance */
+        Thrd_Mtx_Recur_lock(&heap_Smp__live_mtx);
+        for (heap_Smp** link = &heap_Smp__live_head; *link != null; link = &(*link)->live_next) {
+            if (*link != self) { continue; }
+            *link = self->live_next;
+            break;
+        }
+        atom_V_store(&self->is_live, 0, atom_MemOrd_monotonic);
+        Thrd_Mtx_Recur_unlock(&heap_Smp__live_mtx);
+    }
+    for (heap_Smp_ThrdMeta* meta = heap_Smp__nextMeta(self, null); meta != null; meta = heap_Smp__nextMeta(self, meta)) {
+        heap_Smp__collectRemote(self, meta);
+        let_ignore = heap_Smp__releaseEmpties(self, meta, true);
+    }
+    var spilled = atom_V_fetchXchg(&self->spilled_metas, 0, atom_MemOrd_acquire);
+    while (spilled != 0) {
+        let meta = intToPtr$((heap_Smp_ThrdMeta*)(spilled));
+        spilled = ptrToInt(meta->next_spilled);
+        mem_Allocator_rawFree(
+            self->backing_allocator,
+            init$S$((u8)(as$(u8*)(meta), sizeOf$(heap_Smp_ThrdMeta))),
+            alignOf$(heap_Smp_ThrdMeta)
+        );
+    }
+    heap_Smp__dropCache(self->id);
+};
+
+fn_((heap_Smp_detachThrd(heap_Smp* self))(void)) {
+    let token = heap_Smp__thrdToken();
+    for (heap_Smp_ThrdMeta* meta = heap_Smp__nextMeta(self, null); meta != null; meta = heap_Smp__nextMeta(self, meta)) {
+        if (atom_V_load(&meta->owner, atom_MemOrd_monotonic) != token) { continue; }
+        heap_Smp__collectRemote(self, meta);
+        atom_V_store(&meta->owner, 0, atom_MemOrd_release);
+    }
+    heap_Smp__dropCache(self->id);
+};
+
+fn_((heap_Smp_stats(heap_Smp* self))(heap_Smp_Stats)) {
+    var stats = lit0$((heap_Smp_Stats));
+    for (heap_Smp_ThrdMeta* meta = heap_Smp__nextMeta(self, null); meta != null; meta = heap_Smp__nextMeta(self, meta)) {
+        for_(($s(A_ref(meta->counts)), $rf(0))(counts, class_idx) {
+            let cls = A_at((stats.classes)[class_idx]);
+            cls->slab_count += atom_load(&counts->slab_count, atom_MemOrd_unordered);
+            cls->active += atom_load(&counts->slot_count, atom_MemOrd_unordered) * heap_Smp__slotSize(class_idx);
+            cls->requested += atom_load(&counts->requested, atom_MemOrd_unordered);
+        });
+        stats.cached += atom_load(&meta->empty_count, atom_MemOrd_unordered) * heap_Smp_slab_len;
+    }
+    for_(($s(A_ref(stats.classes)), $rf(0))(cls, class_idx) {
+        cls->slot_size = heap_Smp__slotSize(class_idx);
+        cls->resident = cls->slab_count * heap_Smp_slab_len;
+        cls->fragmented = cls->resident - cls->requested;
+        stats.resident += cls->resident;
+        stats.active += cls->active;
+        stats.requested += cls->requested;
+        stats.fragmented += cls->fragmented;
+    });
+    return stats;
+};
+
+fn_((heap_Smp_decay(heap_Smp* self))(usize)) {
+    return heap_Smp__maintain(self, false);
+};
+
+fn_((heap_Smp_purge(heap_Smp* self))(usize)) {
+    return heap_Smp__maintain(self, true);
+};
+
 /*========== Internal Definitions ===========================================*/
 
-fn_((heap_Smp__cpuCount(heap_Smp* self))(u32)) {
-    let cpu_count = atom_load(&self->cpu_count, atom_MemOrd_unordered);
-    if (cpu_count != 0) { return cpu_count; }
-    let max_count = heap_Smp_max_thrd_count;
-    let n = int_min(intCast$((u32)catch_((Thrd_cpuCount())($ignore, max_count))), max_count);
-    return expr_(u32 $scope)(if_some((atom_cmpXchgStrong(
-        &self->cpu_count, 0, n, atom_MemOrd_monotonic, atom_MemOrd_monotonic
-    ))(other)) {
-        $break_(other);
-    } else_none {
-        $break_(n);
-    }) $unscoped_(expr);
-};
-
-fn_((heap_Smp__lockThrdMeta(heap_Smp* self))(heap_Smp__Locked) $scope) {
-    let self_addr = ptrToInt(self);
+fn_((heap_Smp__nextId(void))(usize)) {
+    return atom_V_fetchAdd(&heap_Smp__last_id, 1, atom_MemOrd_monotonic) + 1;
+};
+
+fn_((heap_Smp__thrdToken(void))(usize)) {
+    return ptrToInt(&heap_Smp__thrd_token);
+};
+
+fn_((heap_Smp__initMetas(heap_Smp* self))(void)) {
+    for_(($s(self->thrd_metas))(meta) {
+        *meta = lit0$((heap_Smp_ThrdMeta));
+    });
+};
+
+$attr($on_load)
+$static fn_((heap_Smp__initLive(void))(void)) {
+    heap_Smp__live_mtx = Thrd_Mtx_Recur_init();
+};
+
+$attr($on_exit)
+$static fn_((heap_Smp__finiLive(void))(void)) {
+    Thrd_Mtx_Recur_fini(&heap_Smp__live_mtx);
+};
+
+fn_((heap_Smp__register(heap_Smp* self))(void)) {
+    if (heap_Smp__exit_hook.fn == null) {
+        heap_Smp__exit_hook.fn = heap_Smp__detachExiting;
+        Thrd_onExit(&heap_Smp__exit_hook);
+    }
+    if (atom_V_load(&self->is_live, atom_MemOrd_acquire) != 0) { return; }
+    Thrd_Mtx_Recur_lock(&heap_Smp__live_mtx);
+    if (atom_V_load(&self->is_live, atom_MemOrd_monotonic) == 0) {
+        self->live_next = heap_Smp__live_head;
+        heap_Smp__live_head = self;
+        atom_V_store(&self->is_live, 1, atom_MemOrd_release);
+    }
+    Thrd_Mtx_Recur_unlock(&heap_Smp__live_mtx);
+};
+
+fn_((heap_Smp__detachExiting(void))(void)) {
+    /* Holding the lock keeps `heap_Smp_fini` from tearing an instance down under us */
+    Thrd_Mtx_Recur_lock(&heap_Smp__live_mtx);
+    for (heap_Smp* inst = heap_Smp__live_head; inst != null; inst = inst->live_next) {
+        heap_Smp_detachThrd(inst);
+    }
+    Thrd_Mtx_Recur_unlock(&heap_Smp__live_mtx);
+};
+
+fn_((heap_Smp__nextMeta(heap_Smp* self, heap_Smp_ThrdMeta* meta))(heap_Smp_ThrdMeta*)) {
+    /* Preallocated metas first, then the spilled ones */
+    let first = self->thrd_metas.ptr;
+    let last = first + self->thrd_metas.len;
+    if (meta == null) {
+        if (first != last) { return first; }
+    } else if (first <= meta && meta < last) {
+        if (meta + 1 != last) { return meta + 1; }
+    } else {
+        return meta->next_spilled;
+    }
+    return intToPtr$((heap_Smp_ThrdMeta*)(atom_V_load(&self->spilled_metas, atom_MemOrd_acquire)));
+};
+
+fn_((heap_Smp__cachedMeta(heap_Smp* self))(heap_Smp_ThrdMeta*)) {
     for_(($s(A_ref(heap_Smp__cache)))(entry) {
-        if (entry->inst_addr == self_addr) {
-            let idx = entry->slot_idx;
-            let meta = S_at((self->thrd_metas)[idx]);
+        if (entry->inst_id == self->id) {
             entry->lru_age = 0;
-            if (Thrd_Mtx_tryLock(&meta->mtx)) {
-                return_({
-                    .meta = meta,
-                    .idx = idx,
-                });
-            }
-            break;
+            return entry->meta;
         }
         entry->lru_age = u32_addSat(entry->lru_age, 1);
     });
-    var_(idx, u32) = 0;
-    let cpu_count = heap_Smp__cpuCount(self);
-    while (true) {
-        let meta = S_at((self->thrd_metas)[idx]);
-        if (Thrd_Mtx_tryLock(&meta->mtx)) {
-            heap_Smp__updateCache(self_addr, idx);
-            return_({
-                .meta = meta,
-                .idx = idx,
-            });
+    return null;
+};
+
+fn_((heap_Smp__ownMeta(heap_Smp* self))(heap_Smp_ThrdMeta*)) {
+    let cached = heap_Smp__cachedMeta(self);
+    if ($branch_likely(cached != null)) { return cached; }
+    let meta = heap_Smp__claimMeta(self);
+    if (meta != null) { heap_Smp__updateCache(self->id, meta); }
+    return meta;
+};
+
+fn_((heap_Smp__claimMeta(heap_Smp* self))(heap_Smp_ThrdMeta*)) {
+    let token = heap_Smp__thrdToken();
+    heap_Smp__register(self);
+    /* A meta this thread already owns: evicted from the cache, or left behind by
+     * an exited thread whose thread-local storage this one reuses */
+    for (heap_Smp_ThrdMeta* meta = heap_Smp__nextMeta(self, null); meta != null; meta = heap_Smp__nextMeta(self, meta)) {
+        if (atom_V_load(&meta->owner, atom_MemOrd_acquire) == token) { return meta; }
+    }
+    for (heap_Smp_ThrdMeta* meta = heap_Smp__nextMeta(self, null); meta != null; meta = heap_Smp__nextMeta(self, meta)) {
+        if (atom_V_load(&meta->owner, atom_MemOrd_monotonic) != 0) { continue; }
+        if (isNone(atom_V_cmpXchgStrong(&meta->owner, 0, token, atom_MemOrd_acquire, atom_MemOrd_monotonic))) {
+            return meta;
         }
-        idx = (idx + 1) % cpu_count;
     }
-} $unscoped_(fn);
+    /* Every meta is owned: spill a new one instead of sharing */
+    let mem = orelse_((mem_Allocator_rawAlloc(
+        self->backing_allocator, sizeOf$(heap_Smp_ThrdMeta), alignOf$(heap_Smp_ThrdMeta)
+    ))(return null));
+    let meta = ptrAlignCast$((heap_Smp_ThrdMeta*)(mem));
+    *meta = lit0$((heap_Smp_ThrdMeta));
+    atom_V_store(&meta->owner, token, atom_MemOrd_monotonic);
+    var head = atom_V_load(&self->spilled_metas, atom_MemOrd_monotonic);
+    while (true) {
+        meta->next_spilled = intToPtr$((heap_Smp_ThrdMeta*)(head));
+        head = orelse_((atom_V_cmpXchgWeak(
+            &self->spilled_metas, head, ptrToInt(meta), atom_MemOrd_release, atom_MemOrd_monotonic
+        ))(break));
+    }
+    return meta;
+};
 
-fn_((heap_Smp__updateCache(usize addr, u32 idx))(void)) {
+fn_((heap_Smp__updateCache(usize id, heap_Smp_ThrdMeta* meta))(void)) {
     var_(oldest_idx, usize) = 0;
     var_(max_age, u32) = 0;
     for_(($s(A_ref(heap_Smp__cache)), $rf(0))(entry, i) {
-        if (entry->inst_addr == 0 || entry->inst_addr == addr) {
-            entry->inst_addr = addr;
-            entry->slot_idx = idx;
+        if (entry->inst_id == 0 || entry->inst_id == id) {
+            entry->inst_id = id;
+            entry->meta = meta;
             entry->lru_age = 0;
             return;
         }
@@ -139,113 +361,330 @@ fn_((heap_Smp__updateCache(usize addr, u32 idx))(void)) {
         }
     });
     asg_lit((A_at((heap_Smp__cache)[oldest_idx]))({
-        .inst_addr = addr,
-        .slot_idx = idx,
+        .inst_id = id,
+        .meta = meta,
         .lru_age = 0,
     }));
 };
 
-fn_((heap_Smp__alloc(P$raw ctx, usize len, mem_Align align))(O$P$u8) $guard) {
+fn_((heap_Smp__dropCache(usize id))(void)) {
+    for_(($s(A_ref(heap_Smp__cache)))(entry) {
+        if (entry->inst_id == id) { entry->inst_id = 0; }
+    });
+};
+
+fn_((heap_Smp__maintain(heap_Smp* self, bool all))(usize)) {
+    let token = heap_Smp__thrdToken();
+    var_(released, usize) = 0;
+    for (heap_Smp_ThrdMeta* meta = heap_Smp__nextMeta(self, null); meta != null; meta = heap_Smp__nextMeta(self, meta)) {
+        let owner = atom_V_load(&meta->owner, atom_MemOrd_acquire);
+        if (owner == 0 && isNone(atom_V_cmpXchgStrong(&meta->owner, 0, token, atom_MemOrd_acquire, atom_MemOrd_monotonic))) {
+            /* Abandoned: serve it, then leave it to the next thread that claims it */
+            heap_Smp__collectRemote(self, meta);
+            released += heap_Smp__releaseEmpties(self, meta, all);
+            atom_V_store(&meta->owner, 0, atom_MemOrd_release);
+        } else if (owner == token) {
+            heap_Smp__collectRemote(self, meta);
+            released += heap_Smp__releaseEmpties(self, meta, all);
+        } else {
+            let_ignore = atom_V_fetchOr(&meta->purge_req, all ? heap_Smp__purge_req_all : heap_Smp__purge_req_decay, atom_MemOrd_monotonic);
+        }
+    }
+    return released;
+};
+
+fn_((heap_Smp__alloc(P$raw ctx, usize len, mem_Align align))(O$P$u8) $scope) {
     let self = ptrAlignCast$((heap_Smp*)(ctx));
-    let class_idx = heap_Smp__sizeClassIdx(len, align);
+    let class_idx = heap_Smp__sizeClassIdx(self, len, align);
     if ($branch_unlikely(class_idx >= heap_Smp_size_class_count)) {
         return_some(orelse_((mem_Allocator_rawAlloc(self->backing_allocator, len, align))(return_none())));
     }
-    let slot_size = heap_Smp__slotSize(class_idx);
-    claim_assert(heap_Smp_slab_len % slot_size == 0);
-    var_(search_count, u8) = 0;
-    let locked = heap_Smp__lockThrdMeta(self);
-    var locked_meta = locked.meta;
-    var locked_idx = locked.idx;
-outer:
-    while (true) {
-        let top_free_ptr = *A_at((locked_meta->frees)[class_idx]);
-        if ($branch_likely(top_free_ptr != 0)) blk_defer({
-            defer_(Thrd_Mtx_unlock(&locked_meta->mtx));
-            let node = intToPtr$((usize*)(top_free_ptr));
-            *node = *A_at((locked_meta->frees)[class_idx]);
-            *A_at((locked_meta->frees)[class_idx]) = ptrToInt(node);
-            return_some(intToPtr$((u8*)(top_free_ptr)));
-        }) blk_deferral;
-
-        let next_addr = *A_at((locked_meta->next_addrs)[class_idx]);
-        if ($branch_likely((next_addr % heap_Smp_slab_len) != 0)) blk_defer({
-            defer_(Thrd_Mtx_unlock(&locked_meta->mtx));
-            *A_at((locked_meta->next_addrs)[class_idx]) = next_addr + slot_size;
-            return_some(intToPtr$((u8*)(next_addr)));
-        }) blk_deferral;
-
-        if ($branch_likely(search_count >= heap_Smp_max_alloc_search)) blk_defer({
-            defer_(Thrd_Mtx_unlock(&locked_meta->mtx));
-            let ptr = orelse_((mem_Allocator_rawAlloc(
-                self->backing_allocator,
-                heap_Smp_slab_len,
-                mem_alignToLog2(heap_Smp_slab_len)
-            ))(return_none()));
-            *A_at((locked_meta->next_addrs)[class_idx]) = ptrToInt(ptr) + slot_size;
-            return_some(ptr);
-        }) blk_deferral;
-
-        Thrd_Mtx_unlock(&locked_meta->mtx);
-        let cpu_count = heap_Smp__cpuCount(self);
-        claim_assert(cpu_count != 0);
-        var_(idx, u32) = locked_idx;
-        while (true) {
-            idx = (idx + 1) % cpu_count;
-            locked_meta = S_at((self->thrd_metas)[idx]);
-            if (Thrd_Mtx_tryLock(&locked_meta->mtx)) {
-                locked_idx = idx;
-                search_count += 1;
-                goto outer;
-            }
-        }
+    let meta = heap_Smp__ownMeta(self);
+    if ($branch_unlikely(meta == null)) { return_none(); }
+    if ($branch_unlikely(*A_at((meta->partials)[class_idx]) == null)) {
+        /* Take back the slots other threads freed before reaching for another slab */
+        heap_Smp__serveOwner(self, meta);
     }
-} $unguarded_(fn);
+    return heap_Smp__allocFrom(self, meta, class_idx, len);
+} $unscoped_(fn);
 
 fn_((heap_Smp__resize(P$raw ctx, S$u8 buf, mem_Align buf_align, usize new_len))(bool)) {
     let self = ptrAlignCast$((heap_Smp*)(ctx));
-    let old_class_idx = heap_Smp__sizeClassIdx(buf.len, buf_align);
-    let new_class_idx = heap_Smp__sizeClassIdx(new_len, buf_align);
+    let old_class_idx = heap_Smp__sizeClassIdx(self, buf.len, buf_align);
+    let new_class_idx = heap_Smp__sizeClassIdx(self, new_len, buf_align);
     if (heap_Smp_size_class_count <= old_class_idx) {
         if (new_class_idx < heap_Smp_size_class_count) { return false; }
         return mem_Allocator_rawResize(self->backing_allocator, buf, buf_align, new_len);
     }
-    return old_class_idx == new_class_idx;
+    if (old_class_idx != new_class_idx) { return false; }
+    heap_Smp__adjustRequested(self, buf, new_len);
+    return true;
 };
 
 fn_((heap_Smp__remap(P$raw ctx, S$u8 buf, mem_Align buf_align, usize new_len))(O$P$u8) $scope) {
     let self = ptrAlignCast$((heap_Smp*)(ctx));
-    let old_class_idx = heap_Smp__sizeClassIdx(buf.len, buf_align);
-    let new_class_idx = heap_Smp__sizeClassIdx(new_len, buf_align);
+    let old_class_idx = heap_Smp__sizeClassIdx(self, buf.len, buf_align);
+    let new_class_idx = heap_Smp__sizeClassIdx(self, new_len, buf_align);
     if (heap_Smp_size_class_count <= old_class_idx) {
         if (new_class_idx < heap_Smp_size_class_count) { return_none(); }
         return mem_Allocator_rawRemap(self->backing_allocator, buf, buf_align, new_len);
     }
-    return_(expr_(O$P$u8 $scope)(
-        old_class_idx == new_class_idx
-            ? $break_(some(buf.ptr))
-            : $break_(none())
-    ) $unscoped_(expr));
+    if (old_class_idx != new_class_idx) { return_none(); }
+    heap_Smp__adjustRequested(self, buf, new_len);
+    return_some(buf.ptr);
 } $unscoped_(fn);
 
-fn_((heap_Smp__free(P$raw ctx, S$u8 buf, mem_Align buf_align))(void) $guard) {
+fn_((heap_Smp__free(P$raw ctx, S$u8 buf, mem_Align buf_align))(void) $scope) {
     let self = ptrAlignCast$((heap_Smp*)(ctx));
-    let class_idx = heap_Smp__sizeClassIdx(buf.len, buf_align);
+    let class_idx = heap_Smp__sizeClassIdx(self, buf.len, buf_align);
     if ($branch_unlikely(class_idx >= heap_Smp_size_class_count)) {
         return_void(mem_Allocator_rawFree(self->backing_allocator, buf, buf_align));
     }
+    let slab = heap_Smp__slabOf(ptrToInt(buf.ptr));
+    claim_assert(slab->class_idx == class_idx);
+    if ($branch_unlikely(slab->owner != heap_Smp__cachedMeta(self))) {
+        return_void(heap_Smp__freeRemote(slab, ptrToInt(buf.ptr), buf.len));
+    }
     let node = ptrAlignCast$((usize*)(buf.ptr));
-    let locked = heap_Smp__lockThrdMeta(self);
-    let locked_meta = locked.meta;
-    defer_(Thrd_Mtx_unlock(&locked_meta->mtx));
-    *node = *A_at((locked_meta->frees)[class_idx]);
-    *A_at((locked_meta->frees)[class_idx]) = ptrToInt(node);
-} $unguarded_(fn);
+    *node = slab->free_head;
+    slab->free_head = ptrToInt(node);
+    heap_Smp__reclaimSlots(self, slab, 1, buf.len);
+} $unscoped_(fn);
+
+fn_((heap_Smp__slabOf(usize addr))(heap_Smp_Slab*)) {
+    let base = addr & ~(as$(usize)(heap_Smp_slab_len) - 1);
+    return intToPtr$((heap_Smp_Slab*)(base + heap_Smp_slab_len - heap_Smp__slab_hdr_len));
+};
+
+fn_((heap_Smp__slabBase(heap_Smp_Slab* slab))(usize)) {
+    return ptrToInt(slab) + heap_Smp__slab_hdr_len - heap_Smp_slab_len;
+};
+
+fn_((heap_Smp__pushFront(heap_Smp_Slab** head, heap_Smp_Slab* slab))(void)) {
+    slab->prev = null;
+    slab->next = *head;
+    if (*head != null) { (*head)->prev = slab; }
+    *head = slab;
+};
+
+fn_((heap_Smp__unlink(heap_Smp_Slab** head, heap_Smp_Slab** tail, heap_Smp_Slab* slab))(void)) {
+    if (slab->prev != null) {
+        slab->prev->next = slab->next;
+    } else {
+        *head = slab->next;
+    }
+    if (slab->next != null) {
+        slab->next->prev = slab->prev;
+    } else if (tail != null) {
+        *tail = slab->prev;
+    }
+    slab->prev = null;
+    slab->next = null;
+};
+
+fn_((heap_Smp__formatSlab(heap_Smp_ThrdMeta* meta, usize base, usize block_base, usize class_idx))(heap_Smp_Slab*)) {
+    let slab = intToPtr$((heap_Smp_Slab*)(base + heap_Smp_slab_len - heap_Smp__slab_hdr_len));
+    asg_lit((slab)({
+        .prev = null,
+        .next = null,
+        .free_head = 0,
+        .used = 0,
+        .bump_idx = 0,
+        .cap = intCast$((u32)((heap_Smp_slab_len - heap_Smp__slab_hdr_len) / heap_Smp__slotSize(class_idx))),
+        .class_idx = intCast$((u32)(class_idx)),
+        .owner = meta,
+        .block_base = block_base,
+    }));
+    heap_Smp__pushFront(A_at((meta->partials)[class_idx]), slab);
+    A_at((meta->counts)[class_idx])->slab_count += 1;
+    return slab;
+};
+
+fn_((heap_Smp__allocFrom(heap_Smp* self, heap_Smp_ThrdMeta* meta, usize class_idx, usize len))(O$P$u8) $scope) {
+    var slab = *A_at((meta->partials)[class_idx]);
+    if (slab == null) {
+        /* Reuse the most recently emptied slab (any class) before asking the backing allocator */
+        if (meta->empties_head != null) {
+            let empty = meta->empties_head;
+            heap_Smp__unlink(&meta->empties_head, &meta->empties_tail, empty);
+            meta->empty_count -= 1;
+            slab = heap_Smp__formatSlab(meta, heap_Smp__slabBase(empty), empty->block_base, class_idx);
+        } else {
+            let block = orelse_((mem_Allocator_rawAlloc(
+                self->backing_allocator,
+                heap_Smp__slab_block_len,
+                alignOf$(heap_Smp_Slab)
+            ))(return_none()));
+            let base = mem_alignFwd(ptrToInt(block), heap_Smp_slab_len);
+            slab = heap_Smp__formatSlab(meta, base, ptrToInt(block), class_idx);
+        }
+    }
+    var_(addr, usize) = slab->free_head;
+    if (addr != 0) {
+        slab->free_head = *intToPtr$((usize*)(addr));
+    } else {
+        addr = heap_Smp__slabBase(slab) + as$(usize)(slab->bump_idx) * heap_Smp__slotSize(class_idx);
+        slab->bump_idx += 1;
+    }
+    slab->used += 1;
+    if (slab->used == slab->cap) {
+        heap_Smp__unlink(A_at((meta->partials)[class_idx]), null, slab);
+    }
+    let counts = A_at((meta->counts)[class_idx]);
+    counts->slot_count += 1;
+    counts->requested += len;
+    return_some(intToPtr$((u8*)(addr)));
+} $unscoped_(fn);
+
+fn_((heap_Smp__reclaimSlots(heap_Smp* self, heap_Smp_Slab* slab, u32 count, usize requested))(void)) {
+    let meta = slab->owner;
+    let counts = A_at((meta->counts)[slab->class_idx]);
+    counts->slot_count -= count;
+    counts->requested -= requested;
+    if (count != 0 && slab->used == slab->cap) {
+        heap_Smp__pushFront(A_at((meta->partials)[slab->class_idx]), slab);
+    }
+    slab->used -= count;
+    /* A queued slab is retired when the owner pops it, never while a remote
+     * thread may still reach it through `remote_slabs` */
+    if (slab->used == 0 && atom_V_load(&slab->remote_head, atom_MemOrd_acquire) == 0) {
+        heap_Smp__retireSlab(self, meta, slab);
+    }
+};
+
+fn_((heap_Smp__freeRemote(heap_Smp_Slab* slab, usize addr, usize len))(void)) {
+    /* The slab cannot be released before the node below is pushed, because the
+     * slot stays in `used` until the owner takes it back; after that push this
+     * thread touches the slab no more */
+    let_ignore = atom_V_fetchAdd(&slab->remote_requested, len, atom_MemOrd_monotonic);
+    let node = intToPtr$((usize*)(addr));
+    var head = atom_V_load(&slab->remote_head, atom_MemOrd_monotonic);
+    while (true) {
+        if ((head & heap_Smp__remote_queued) == 0) {
+            if_some((atom_V_cmpXchgWeak(
+                &slab->remote_head, head, head | heap_Smp__remote_queued, atom_MemOrd_monotonic, atom_MemOrd_monotonic
+            ))(actual)) {
+                head = actual;
+            } else_none {
+                /* First remote free since the owner last collected the slab: it was tagged, now queue it */
+                heap_Smp__queueSlab(slab);
+                head |= heap_Smp__remote_queued;
+            }
+            continue;
+        }
+        *node = head & ~heap_Smp__remote_queued;
+        head = orelse_((atom_V_cmpXchgWeak(
+            &slab->remote_head, head, addr | heap_Smp__remote_queued, atom_MemOrd_release, atom_MemOrd_monotonic
+        ))(break));
+    }
+};
+
+fn_((heap_Smp__queueSlab(heap_Smp_Slab* slab))(void)) {
+    let meta = slab->owner;
+    var top = atom_V_load(&meta->remote_slabs, atom_MemOrd_monotonic);
+    while (true) {
+        slab->remote_next = top;
+        top = orelse_((atom_V_cmpXchgWeak(
+            &meta->remote_slabs, top, ptrToInt(slab), atom_MemOrd_release, atom_MemOrd_monotonic
+        ))(break));
+    }
+};
+
+fn_((heap_Smp__collectRemote(heap_Smp* self, heap_Smp_ThrdMeta* meta))(void)) {
+    if (atom_V_load(&meta->remote_slabs, atom_MemOrd_monotonic) == 0) { return; }
+    var slabs = atom_V_fetchXchg(&meta->remote_slabs, 0, atom_MemOrd_acquire);
+    while (slabs != 0) {
+        let slab = intToPtr$((heap_Smp_Slab*)(slabs));
+        /* Read the link first: once the tag is cleared below, a remote free may queue the slab again */
+        slabs = slab->remote_next;
+        var node = atom_V_fetchXchg(&slab->remote_head, 0, atom_MemOrd_acquire) & ~heap_Smp__remote_queued;
+        var_(count, u32) = 0;
+        while (node != 0) {
+            let link = intToPtr$((usize*)(node));
+            let next = *link;
+            *link = slab->free_head;
+            slab->free_head = node;
+            node = next;
+            count += 1;
+        }
+        let requested = atom_V_fetchXchg(&slab->remote_requested, 0, atom_MemOrd_monotonic);
+        heap_Smp__reclaimSlots(self, slab, count, requested);
+    }
+};
+
+fn_((heap_Smp__serveOwner(heap_Smp* self, heap_Smp_ThrdMeta* meta))(void)) {
+    heap_Smp__collectRemote(self, meta);
+    if ($branch_likely(atom_V_load(&meta->purge_req, atom_MemOrd_monotonic) == 0)) { return; }
+    let req = atom_V_fetchXchg(&meta->purge_req, 0, atom_MemOrd_monotonic);
+    let_ignore = heap_Smp__releaseEmpties(self, meta, (req & heap_Smp__purge_req_all) != 0);
+};
+
+fn_((heap_Smp__retireSlab(heap_Smp* self, heap_Smp_ThrdMeta* meta, heap_Smp_Slab* slab))(void)) {
+    heap_Smp__unlink(A_at((meta->partials)[slab->class_idx]), null, slab);
+    A_at((meta->counts)[slab->class_idx])->slab_count -= 1;
+    slab->emptied_at = time_Instant_now();
+    heap_Smp__pushFront(&meta->empties_head, slab);
+    if (meta->empties_tail == null) { meta->empties_tail = slab; }
+    meta->empty_count += 1;
+    let_ignore = heap_Smp__releaseEmpties(self, meta, false);
+};
+
+fn_((heap_Smp__releaseEmpties(heap_Smp* self, heap_Smp_ThrdMeta* meta, bool all))(usize)) {
+    let now = time_Instant_now();
+    var_(released, usize) = 0;
+    /* The tail holds the slab emptied longest ago */
+    while (meta->empties_tail != null) {
+        let slab = meta->empties_tail;
+        if (!all && time_Duration_lt(time_Instant_durationSince(now, slab->emptied_at), self->cfg.decay)) { break; }
+        heap_Smp__unlink(&meta->empties_head, &meta->empties_tail, slab);
+        meta->empty_count -= 1;
+        mem_Allocator_rawFree(
+            self->backing_allocator,
+            init$S$((u8)(intToPtr$((u8*)(slab->block_base)), heap_Smp__slab_block_len)),
+            alignOf$(heap_Smp_Slab)
+        );
+        released += heap_Smp_slab_len;
+    }
+    return released;
+};
+
+fn_((heap_Smp__adjustRequested(heap_Smp* self, S$u8 buf, usize new_len))(void)) {
+    let slab = heap_Smp__slabOf(ptrToInt(buf.ptr));
+    if (slab->owner == heap_Smp__cachedMeta(self)) {
+        let counts = A_at((slab->owner->counts)[slab->class_idx]);
+        counts->requested = counts->requested - buf.len + new_len;
+        return;
+    }
+    /* Settled by the owner together with the remote frees (wrapping subtraction) */
+    let_ignore = atom_V_fetchAdd(&slab->remote_requested, buf.len - new_len, atom_MemOrd_monotonic);
+};
+
+fn_((heap_Smp__sizeClassIdx(heap_Smp* self, usize len, mem_Align align))(usize)) {
+    let align_bytes = mem_log2ToAlign(align);
+    var size = int_max(int_max(len, align_bytes), as$(usize)(1));
+    if (size > heap_Smp_slab_len / 2) { return heap_Smp_size_class_count; }
+    if (self->cfg.size_classes == heap_Smp_SizeClasses_pow2) {
+        size = as$(usize)(1) << (int_bits$(usize) - int_leadingZeros(size - 1));
+    }
+    /* Classes that are not powers of two are only aligned to their lowest set bit */
+    var class_idx = heap_Smp__quarterIdx(size);
+    while (class_idx < heap_Smp_size_class_count && heap_Smp__slotSize(class_idx) % align_bytes != 0) {
+        class_idx += 1;
+    }
+    return class_idx;
+};
 
-fn_((heap_Smp__sizeClassIdx(usize len, mem_Align align))(usize)) {
-    return int_max(int_max(int_bits$(usize) - int_leadingZeros(len - 1), align), heap_Smp_min_size_class) - heap_Smp_min_size_class;
+fn_((heap_Smp__quarterIdx(usize size))(usize)) {
+    /* 4 classes spaced by the minimum size, then 4 classes per power of two */
+    let min_log2 = as$(usize)(heap_Smp_min_size_class);
+    if (size <= (as$(usize)(4) << min_log2)) { return (size - 1) >> min_log2; }
+    let group_log2 = as$(usize)(int_bits$(usize) - 1 - int_leadingZeros(size - 1));
+    return 4 * (group_log2 - min_log2 - 1) + ((size - 1 - (as$(usize)(1) << group_log2)) >> (group_log2 - 2));
 };
 
 fn_((heap_Smp__slotSize(usize class_idx))(usize)) {
-    return as$(usize)(1) << (class_idx + heap_Smp_min_size_class);
+    let min_log2 = as$(usize)(heap_Smp_min_size_class);
+    if (class_idx < 4) { return (class_idx + 1) << min_log2; }
+    let group = as$(usize)(1) << (class_idx / 4 + min_log2 + 1);
+    return group + (class_idx % 4 + 1) * (group >> 2);
 };
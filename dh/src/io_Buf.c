@@ -61,23 +61,20 @@ fn_((io_Buf_Reader_readUntilByte(io_Buf_Reader* self, u8 delim, S$u8 out_buf))(E
             }
         }
         // Search for delimiter in current buf
-        let search_end = self->end;
-        for_(($r(self->start, search_end))(i) {
-            if (*S_at((self->buf)[i]) == delim) {
-                // Found delimiter
-                let copy_len = i - self->start;
-                let total_len = written + copy_len;
-                if (out_buf.len < total_len) {
-                    return_err(io_Err_BufferTooSmall());
-                }
-                prim_memcpyS(
-                    S_prefix((S_suffix((out_buf)(written)))(copy_len)),
-                    S_prefix((S_suffix((self->buf)(self->start)))(copy_len)).as_const
-                );
-                self->start = i + 1; // Skip delimiter
-                return_ok(S_slice((out_buf)$r(0, total_len)));
+        let buffered = S_slice((self->buf)$r(self->start, self->end)).as_const;
+        if_some((mem_idxByte(buffered, delim))(copy_len)) {
+            // Found delimiter
+            let total_len = written + copy_len;
+            if (out_buf.len < total_len) {
+                return_err(io_Err_BufferTooSmall());
             }
-        });
+            prim_memcpyS(
+                S_prefix((S_suffix((out_buf)(written)))(copy_len)),
+                S_prefix((buffered)(copy_len))
+            );
+            self->start += copy_len + 1; // Skip delimiter
+            return_ok(S_slice((out_buf)$r(0, total_len)));
+        }
         // Delimiter not found, copy all available data
         let copy_len = self->end - self->start;
         let total_len = written + copy_len;
@@ -104,12 +101,10 @@ fn_((io_Buf_Reader_skipUntilByte(io_Buf_Reader* self, u8 delim))(E$void) $scope)
             }
         }
         // Search for delimiter in current buf
-        for_(($r(self->start, self->end))(i) {
-            if (*S_at((self->buf)[i]) == delim) {
-                self->start = i + 1; // Skip delimiter
-                return_ok({});
-            }
-        });
+        if_some((mem_idxByte(S_slice((self->buf)$r(self->start, self->end)).as_const, delim))(idx)) {
+            self->start += idx + 1; // Skip delimiter
+            return_ok({});
+        }
         // Delimiter not found, skip all buffered data
         self->start = self->end;
     }
@@ -209,6 +204,13 @@ $static fn_((Writer_VT_write(P$raw ctx, S_const$u8 bytes))(E$usize) $scope) {
         self->used += bytes.len;
         return_ok(bytes.len);
     }
+    // Unbuffered system sink: send the buffered bytes and `bytes` in one gather write
+    if (self->inner.writeVec != null && self->used != 0) {
+        let_(segs, A$$(2, S_const$u8)) = A_init({ S_prefix((self->buf)(self->used)).as_const, bytes });
+        try_(io_Writer_writeVecAll(self->inner, A_ref$((S_const$S_const$u8)(segs))));
+        self->used = 0;
+        return_ok(bytes.len);
+    }
     // Buffer is full or will be full - flush first
     try_(io_Buf_Writer_flush(self));
     // If bytes are larger than buf, write directly
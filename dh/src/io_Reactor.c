@@ -0,0 +1,639 @@
+#include "dh/io/Reactor.h"
+#include "dh/mem/common.h"
+#include "dh/time/common.h"
+
+#if plat_is_linux
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <poll.h>
+#if io_Reactor_use_uring
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#else /* !io_Reactor_use_uring */
+#include <sys/epoll.h>
+#endif /* !io_Reactor_use_uring */
+#endif /* plat_is_linux */
+
+// ============================================================================
+// Operations
+// ============================================================================
+
+$static fn_((io_Reactor_Op__init(fs_File_Handle handle, io_Reactor_OpKind kind, S$u8 buf))(io_Reactor_Op)) {
+    return lit$((io_Reactor_Op){
+        .timer = Co_Timer_init(),
+        .handle = handle,
+        .kind = kind,
+        .state = io_Reactor_OpState_idle,
+        .timed_out = false,
+        .has_timeout = false,
+        .buf = buf,
+        .timeout = time_Duration_zero,
+        .deadline = lit0$((time_Instant)),
+        .result = 0,
+    });
+};
+
+fn_((io_Reactor_Op_readable(fs_File_Handle handle))(io_Reactor_Op)) {
+    return io_Reactor_Op__init(handle, io_Reactor_OpKind_readable, lit$((S$u8){ .ptr = null, .len = 0 }));
+};
+
+fn_((io_Reactor_Op_writable(fs_File_Handle handle))(io_Reactor_Op)) {
+    return io_Reactor_Op__init(handle, io_Reactor_OpKind_writable, lit$((S$u8){ .ptr = null, .len = 0 }));
+};
+
+fn_((io_Reactor_Op_read(fs_File_Handle handle, S$u8 buf))(io_Reactor_Op)) {
+    return io_Reactor_Op__init(handle, io_Reactor_OpKind_read, buf);
+};
+
+fn_((io_Reactor_Op_write(fs_File_Handle handle, S_const$u8 bytes))(io_Reactor_Op)) {
+    // Only ever read from; the slice is shared with reads to keep the op one shape
+    return io_Reactor_Op__init(handle, io_Reactor_OpKind_write, lit$((S$u8){ .ptr = as$(u8*)(bytes.ptr), .len = bytes.len }));
+};
+
+fn_((io_Reactor_Op_withTimeout(io_Reactor_Op self, time_Duration timeout))(io_Reactor_Op)) {
+    self.has_timeout = true;
+    self.timeout = timeout;
+    return self;
+};
+
+fn_((io_Reactor_Op_result(const io_Reactor_Op* self))(E$usize) $scope) {
+    claim_assert_nonnull(self);
+    claim_assert(self->state == io_Reactor_OpState_done);
+    if (self->timed_out) { return_err(io_Reactor_Err_Timeout()); }
+    if (self->result >= 0) { return_ok(as$(usize)(self->result)); }
+#if plat_is_linux
+    if (self->result == -ENOMEM) { return_err(mem_Err_OutOfMemory()); }
+#endif /* plat_is_linux */
+    switch (self->kind) {
+    case io_Reactor_OpKind_read:
+        return_err(fs_File_Err_ReadFailed());
+    case io_Reactor_OpKind_write:
+        return_err(fs_File_Err_WriteFailed());
+    default:
+        return_err(io_Reactor_Err_WaitFailed());
+    }
+} $unscoped_(fn);
+
+#if plat_is_linux
+
+/// Parks the op's timer for `frame`, bounded by the op's deadline when it has one
+$static fn_((io_Reactor__park(io_Reactor* self, io_Reactor_Op* op, Co_Ctx* frame))(void)) {
+    if (op->has_timeout && op->state != io_Reactor_OpState_cancelling) {
+        Co_Exec_armAt(self->exec, &op->timer, frame, op->deadline);
+    } else {
+        Co_Exec_park(self->exec, &op->timer, frame);
+    }
+};
+
+/// Milliseconds for a kernel wait, rounded up so a timer is never polled early; -1 waits forever
+$static fn_((io_Reactor__timeoutMillis(O$time_Duration timeout))(i32)) {
+    let dur = orelse_((timeout)(return -1));
+    let millis = dur.secs * 1000 + (dur.nanos + 999999) / 1000000;
+    return millis < as$(u64)(i32_limit_max) ? as$(i32)(millis) : i32_limit_max;
+};
+
+#if io_Reactor_use_uring
+
+// ============================================================================
+// io_uring Backend
+// ============================================================================
+
+typedef struct io_uring_sqe Sqe;
+typedef struct io_uring_cqe Cqe;
+typedef struct io_uring_getevents_arg EventsArg;
+
+$static fn_((io_Reactor__enter(io_Reactor* self, u32 min_complete, u32 flags, P$raw arg, usize arg_size))(i64)) {
+    let submit = self->ring.unsubmitted;
+    let res = syscall(__NR_io_uring_enter, self->fd, submit, min_complete, flags, arg, arg_size);
+    // Whatever the kernel did not consume stays queued for the next enter
+    self->ring.unsubmitted = *self->ring.sq_tail - atom_load(self->ring.sq_head, atom_MemOrd_acquire);
+    return res < 0 ? -as$(i64)(errno) : as$(i64)(res);
+};
+
+/// Next free submission entry, zeroed; flushes the queue to the kernel when it is full.
+/// Null when the kernel took none of a full queue, e.g. while its completion queue overflows.
+$static fn_((io_Reactor__sqe(io_Reactor* self))(Sqe*)) {
+    let ring = &self->ring;
+    let tail = *ring->sq_tail;
+    if (tail - atom_load(ring->sq_head, atom_MemOrd_acquire) == ring->sq_entries) {
+        let_ignore = io_Reactor__enter(self, 0, 0, null, 0);
+        if (tail - atom_load(ring->sq_head, atom_MemOrd_acquire) == ring->sq_entries) { return null; }
+    }
+    let idx = tail & ring->sq_mask;
+    let sqe = as$(Sqe*)(ring->sqes) + idx;
+    prim_memset(sqe, 0, sizeOf$(Sqe));
+    ring->sq_array[idx] = idx;
+    return sqe;
+};
+
+/// Publishes the entry returned by the last `io_Reactor__sqe`
+$static fn_((io_Reactor__commit(io_Reactor* self))(void)) {
+    atom_store(self->ring.sq_tail, *self->ring.sq_tail + 1, atom_MemOrd_release);
+    self->ring.unsubmitted++;
+};
+
+/// Queues the transfer or poll of `op`; a negated errno when the submission queue stays full
+$static fn_((io_Reactor__submit(io_Reactor* self, io_Reactor_Op* op))(i64)) {
+    let sqe = io_Reactor__sqe(self);
+    if (sqe == null) { return -EBUSY; }
+    sqe->fd = op->handle;
+    sqe->user_data = as$(u64)(as$(usize)(op));
+    switch (op->kind) {
+    case io_Reactor_OpKind_readable:
+        sqe->opcode = IORING_OP_POLL_ADD;
+        sqe->poll32_events = POLLIN;
+        break;
+    case io_Reactor_OpKind_writable:
+        sqe->opcode = IORING_OP_POLL_ADD;
+        sqe->poll32_events = POLLOUT;
+        break;
+    case io_Reactor_OpKind_read:
+        sqe->opcode = IORING_OP_READ;
+        sqe->addr = as$(u64)(as$(usize)(op->buf.ptr));
+        sqe->len = as$(u32)(prim_min(op->buf.len, as$(usize)(u32_limit_max)));
+        sqe->off = as$(u64)(-1);
+        break;
+    case io_Reactor_OpKind_write:
+        sqe->opcode = IORING_OP_WRITE;
+        sqe->addr = as$(u64)(as$(usize)(op->buf.ptr));
+        sqe->len = as$(u32)(prim_min(op->buf.len, as$(usize)(u32_limit_max)));
+        sqe->off = as$(u64)(-1);
+        break;
+    }
+    io_Reactor__commit(self);
+    return 0;
+};
+
+/// Asks the kernel to drop `op`; its own completion still arrives, carrying `-ECANCELED` if it did.
+/// False when the submission queue stays full and nothing was asked.
+$static fn_((io_Reactor__cancel(io_Reactor* self, io_Reactor_Op* op))(bool)) {
+    let sqe = io_Reactor__sqe(self);
+    if (sqe == null) { return false; }
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->fd = -1;
+    sqe->addr = as$(u64)(as$(usize)(op));
+    sqe->user_data = 0;
+    io_Reactor__commit(self);
+    return true;
+};
+
+$static fn_((io_Reactor__unmap(io_Reactor_Ring* ring))(void)) {
+    if (ring->sqe_map.ptr != null) { munmap(ring->sqe_map.ptr, ring->sqe_map.len); }
+    if (ring->cq_map.ptr != null) { munmap(ring->cq_map.ptr, ring->cq_map.len); }
+    if (ring->sq_map.ptr != null) { munmap(ring->sq_map.ptr, ring->sq_map.len); }
+};
+
+$static fn_((io_Reactor__mmap(i32 fd, usize len, u64 offset))(S$u8)) {
+    let ptr = mmap(null, len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, as$(off_t)(offset));
+    if (ptr == MAP_FAILED) { return lit$((S$u8){ .ptr = null, .len = 0 }); }
+    return lit$((S$u8){ .ptr = as$(u8*)(ptr), .len = len });
+};
+
+$static fn_((io_Reactor__setup(io_Reactor* self, u32 entries))(E$void) $guard) {
+    var_(params, struct io_uring_params) = {};
+    let fd = as$(i32)(syscall(__NR_io_uring_setup, entries, &params));
+    if (fd < 0) {
+        if (errno == ENOSYS) { return_err(io_Reactor_Err_Unsupported()); }
+        return_err(io_Reactor_Err_SetupFailed());
+    }
+    errdefer_($ignore, close(fd));
+    // Timed waits go through `io_uring_getevents_arg` (Linux 5.11)
+    if (!(params.features & IORING_FEAT_EXT_ARG)) { return_err(io_Reactor_Err_Unsupported()); }
+
+    let ring = &self->ring;
+    errdefer_($ignore, io_Reactor__unmap(ring));
+    var sq_len = params.sq_off.array + params.sq_entries * sizeOf$(u32);
+    var cq_len = params.cq_off.cqes + params.cq_entries * sizeOf$(Cqe);
+    let single = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single) { sq_len = cq_len = prim_max(sq_len, cq_len); }
+    ring->sq_map = io_Reactor__mmap(fd, sq_len, IORING_OFF_SQ_RING);
+    if (ring->sq_map.ptr == null) { return_err(io_Reactor_Err_SetupFailed()); }
+    if (!single) {
+        ring->cq_map = io_Reactor__mmap(fd, cq_len, IORING_OFF_CQ_RING);
+        if (ring->cq_map.ptr == null) { return_err(io_Reactor_Err_SetupFailed()); }
+    }
+    ring->sqe_map = io_Reactor__mmap(fd, params.sq_entries * sizeOf$(Sqe), IORING_OFF_SQES);
+    if (ring->sqe_map.ptr == null) { return_err(io_Reactor_Err_SetupFailed()); }
+
+    let sq = ring->sq_map.ptr;
+    let cq = single ? sq : ring->cq_map.ptr;
+    ring->sq_head = as$(u32*)(sq + params.sq_off.head);
+    ring->sq_tail = as$(u32*)(sq + params.sq_off.tail);
+    ring->sq_mask = *as$(u32*)(sq + params.sq_off.ring_mask);
+    ring->sq_entries = *as$(u32*)(sq + params.sq_off.ring_entries);
+    ring->sq_array = as$(u32*)(sq + params.sq_off.array);
+    ring->sqes = ring->sqe_map.ptr;
+    ring->cq_head = as$(u32*)(cq + params.cq_off.head);
+    ring->cq_tail = as$(u32*)(cq + params.cq_off.tail);
+    ring->cq_mask = *as$(u32*)(cq + params.cq_off.ring_mask);
+    ring->cqes = cq + params.cq_off.cqes;
+    ring->unsubmitted = 0;
+    self->fd = fd;
+    return_ok({});
+} $unguarded_(fn);
+
+/// Finishes the ops of all posted completions and wakes their frames
+$static fn_((io_Reactor__reap(io_Reactor* self))(usize)) {
+    let ring = &self->ring;
+    var head = *ring->cq_head;
+    let tail = atom_load(ring->cq_tail, atom_MemOrd_acquire);
+    var_(finished, usize) = 0;
+    for (; head != tail; ++head) {
+        let cqe = as$(const Cqe*)(ring->cqes) + (head & ring->cq_mask);
+        if (cqe->user_data == 0) { continue; }
+        let op = as$(io_Reactor_Op*)(as$(usize)(cqe->user_data));
+        // A transfer that beat its cancellation still counts
+        if (op->state == io_Reactor_OpState_cancelling && cqe->res != -ECANCELED && cqe->res != -EINTR) {
+            op->timed_out = false;
+        }
+        op->result = cqe->res;
+        op->state = io_Reactor_OpState_done;
+        let_ignore = Co_Exec_wake(self->exec, &op->timer);
+        self->in_flight--;
+        finished++;
+    }
+    atom_store(ring->cq_head, head, atom_MemOrd_release);
+    return finished;
+};
+
+fn_((io_Reactor_init(Co_Exec* exec, u32 entries))(E$io_Reactor) $scope) {
+    claim_assert_nonnull(exec);
+    claim_assert(entries != 0);
+    var reactor = lit0$((io_Reactor));
+    reactor.exec = exec;
+    reactor.fd = -1;
+    try_(io_Reactor__setup(&reactor, entries));
+    return_ok(reactor);
+} $unscoped_(fn);
+
+fn_((io_Reactor_fini(io_Reactor* self))(void)) {
+    claim_assert_nonnull(self);
+    claim_assert(self->in_flight == 0);
+    io_Reactor__unmap(&self->ring);
+    close(self->fd);
+    self->fd = -1;
+};
+
+fn_((io_Reactor_deregister(io_Reactor* self, fs_File_Handle handle))(void)) {
+    // Nothing is registered per handle; each operation names its own
+    claim_assert_nonnull(self);
+    let_ignore = handle;
+};
+
+fn_((io_Reactor_step(io_Reactor* self, io_Reactor_Op* op, Co_Ctx* frame))(bool)) {
+    claim_assert_nonnull(self);
+    claim_assert_nonnull(op);
+    claim_assert_nonnull(frame);
+    if (Co_Timer_isPending(&op->timer)) { return true; }
+    switch (op->state) {
+    case io_Reactor_OpState_idle:
+        if (op->has_timeout) { op->deadline = time_Instant_addDuration(Co_Exec_now(self->exec), op->timeout); }
+        let err = io_Reactor__submit(self, op);
+        if (err != 0) {
+            op->result = err;
+            op->state = io_Reactor_OpState_done;
+            return false;
+        }
+        self->in_flight++;
+        io_Reactor__park(self, op, frame);
+        op->state = io_Reactor_OpState_waiting;
+        return true;
+    case io_Reactor_OpState_waiting:
+        // Only the deadline releases a waiting op before its completion arrives
+        claim_assert(Co_Timer_isExpired(&op->timer));
+        if (!io_Reactor__cancel(self, op)) {
+            // Retry on the next tick; the completion may arrive first and finish the op
+            Co_Exec_arm(self->exec, &op->timer, frame, time_Duration_zero);
+            return true;
+        }
+        op->timed_out = true;
+        op->state = io_Reactor_OpState_cancelling;
+        io_Reactor__park(self, op, frame);
+        return true;
+    case io_Reactor_OpState_cancelling:
+        io_Reactor__park(self, op, frame);
+        return true;
+    case io_Reactor_OpState_done:
+        return false;
+    }
+    claim_unreachable;
+};
+
+fn_((io_Reactor_poll(io_Reactor* self, O$time_Duration timeout))(E$usize) $scope) {
+    claim_assert_nonnull(self);
+    if (self->in_flight == 0) {
+        if_some((timeout)(dur)) {
+            if (!time_Duration_isZero(dur)) { time_sleep(dur); }
+        }
+        return_ok(0);
+    }
+    var res = i64_limit_max;
+    if_some((timeout)(dur)) {
+        var_(ts, struct __kernel_timespec) = { .tv_sec = as$(i64)(dur.secs), .tv_nsec = dur.nanos };
+        var_(arg, EventsArg) = { .ts = as$(u64)(as$(usize)(&ts)) };
+        res = io_Reactor__enter(self, 1, IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg, sizeOf$(EventsArg));
+    } else_none {
+        res = io_Reactor__enter(self, 1, IORING_ENTER_GETEVENTS, null, 0);
+    }
+    if (res < 0 && res != -ETIME && res != -EINTR && res != -EBUSY && res != -EAGAIN) {
+        return_err(io_Reactor_Err_WaitFailed());
+    }
+    return_ok(io_Reactor__reap(self));
+} $unscoped_(fn);
+
+#else /* !io_Reactor_use_uring */
+
+// ============================================================================
+// epoll Backend
+// ============================================================================
+
+typedef struct epoll_event Event;
+T_use$((Event)(S));
+T_use$((io_Reactor_Slot)(S));
+
+/// Not yet handed to epoll
+#define io_Reactor__mode_unregistered (0)
+/// Registered edge-triggered; `ready` follows the events
+#define io_Reactor__mode_polled (1)
+/// Rejected by epoll (regular files): always ready, transfers finish in place
+#define io_Reactor__mode_always (2)
+
+$static fn_((io_Reactor__ensureSlots(io_Reactor* self, usize len))(mem_Err$void) $scope) {
+    if (len <= self->slots_len) { return_ok({}); }
+    let gpa = self->exec->gpa;
+    let new_len = prim_max(len, prim_max(self->slots_len * 2, as$(usize)(64)));
+    let new_slots = u_castS$((S$io_Reactor_Slot)(try_(mem_Allocator_alloc(gpa, typeInfo$(io_Reactor_Slot), new_len))));
+    if (self->slots_len != 0) {
+        let type = typeInfo$(io_Reactor_Slot);
+        prim_memcpy(new_slots.ptr, self->slots, self->slots_len * sizeOf$(io_Reactor_Slot));
+        mem_Allocator_free(gpa, u_init$S((type)(self->slots, self->slots_len)));
+    }
+    prim_memset(new_slots.ptr + self->slots_len, 0, (new_len - self->slots_len) * sizeOf$(io_Reactor_Slot));
+    self->slots = new_slots.ptr;
+    self->slots_len = new_len;
+    return_ok({});
+} $unscoped_(fn);
+
+/// Registers `handle` on first use; a negated errno on failure
+$static fn_((io_Reactor__register(io_Reactor* self, io_Reactor_Slot* slot, fs_File_Handle handle))(i64)) {
+    if (slot->mode != io_Reactor__mode_unregistered) { return 0; }
+    var_(event, Event) = { .events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET, .data = { .fd = handle } };
+    if (epoll_ctl(self->fd, EPOLL_CTL_ADD, handle, &event) == 0) {
+        let flags = fcntl(handle, F_GETFL);
+        if (flags < 0 || (!(flags & O_NONBLOCK) && fcntl(handle, F_SETFL, flags | O_NONBLOCK) < 0)) {
+            let err = errno;
+            epoll_ctl(self->fd, EPOLL_CTL_DEL, handle, null);
+            return -as$(i64)(err);
+        }
+        // The first edge reports what is already pending
+        slot->flags = flags;
+        slot->mode = io_Reactor__mode_polled;
+        slot->ready = 0;
+        return 0;
+    }
+    if (errno != EPERM) { return -as$(i64)(errno); }
+    slot->mode = io_Reactor__mode_always;
+    slot->ready = EPOLLIN | EPOLLOUT;
+    return 0;
+};
+
+/// Tries `op` once; false if it would block, clearing the direction's ready bit
+$static fn_((io_Reactor__attempt(io_Reactor_Slot* slot, io_Reactor_Op* op))(bool)) {
+    switch (op->kind) {
+    case io_Reactor_OpKind_readable:
+        if (!(slot->ready & EPOLLIN)) { return false; }
+        op->result = EPOLLIN;
+        return true;
+    case io_Reactor_OpKind_writable:
+        if (!(slot->ready & EPOLLOUT)) { return false; }
+        op->result = EPOLLOUT;
+        return true;
+    case io_Reactor_OpKind_read:
+    case io_Reactor_OpKind_write: {
+        let reading = op->kind == io_Reactor_OpKind_read;
+        let dir = reading ? as$(u32)(EPOLLIN) : as$(u32)(EPOLLOUT);
+        if (!(slot->ready & dir)) { return false; }
+        while (true) {
+            let n = reading
+                      ? read(op->handle, op->buf.ptr, op->buf.len)
+                      : write(op->handle, op->buf.ptr, op->buf.len);
+            if (n >= 0) {
+                op->result = n;
+                return true;
+            }
+            if (errno == EINTR) { continue; }
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                slot->ready &= ~dir;
+                return false;
+            }
+            op->result = -as$(i64)(errno);
+            return true;
+        }
+    }
+    }
+    claim_unreachable;
+};
+
+$attr($inline_always)
+$static fn_((io_Reactor__waiter(io_Reactor_Slot* slot, const io_Reactor_Op* op))(io_Reactor_Op**)) {
+    let reading = op->kind == io_Reactor_OpKind_readable || op->kind == io_Reactor_OpKind_read;
+    return reading ? &slot->reader : &slot->writer;
+};
+
+fn_((io_Reactor_init(Co_Exec* exec, u32 entries))(E$io_Reactor) $guard) {
+    claim_assert_nonnull(exec);
+    claim_assert(entries != 0);
+    let fd = epoll_create1(EPOLL_CLOEXEC);
+    if (fd < 0) { return_err(io_Reactor_Err_SetupFailed()); }
+    errdefer_($ignore, close(fd));
+    let events = try_(mem_Allocator_alloc(exec->gpa, typeInfo$(Event), entries));
+    var reactor = lit0$((io_Reactor));
+    reactor.exec = exec;
+    reactor.fd = fd;
+    reactor.events = events.ptr;
+    reactor.events_cap = entries;
+    reactor.slots = null;
+    reactor.slots_len = 0;
+    return_ok(reactor);
+} $unguarded_(fn);
+
+fn_((io_Reactor_fini(io_Reactor* self))(void)) {
+    claim_assert_nonnull(self);
+    claim_assert(self->in_flight == 0);
+    let gpa = self->exec->gpa;
+    let event_type = typeInfo$(Event);
+    let slot_type = typeInfo$(io_Reactor_Slot);
+    mem_Allocator_free(gpa, u_init$S((event_type)(self->events, self->events_cap)));
+    if (self->slots_len != 0) { mem_Allocator_free(gpa, u_init$S((slot_type)(self->slots, self->slots_len))); }
+    close(self->fd);
+    self->fd = -1;
+};
+
+fn_((io_Reactor_deregister(io_Reactor* self, fs_File_Handle handle))(void)) {
+    claim_assert_nonnull(self);
+    if (handle < 0 || as$(usize)(handle) >= self->slots_len) { return; }
+    let slot = &self->slots[handle];
+    claim_assert(slot->reader == null && slot->writer == null);
+    if (slot->mode == io_Reactor__mode_polled) {
+        epoll_ctl(self->fd, EPOLL_CTL_DEL, handle, null);
+        if (!(slot->flags & O_NONBLOCK)) { let_ignore = fcntl(handle, F_SETFL, slot->flags); }
+    }
+    *slot = lit0$((io_Reactor_Slot));
+};
+
+fn_((io_Reactor_step(io_Reactor* self, io_Reactor_Op* op, Co_Ctx* frame))(bool)) {
+    claim_assert_nonnull(self);
+    claim_assert_nonnull(op);
+    claim_assert_nonnull(frame);
+    if (Co_Timer_isPending(&op->timer)) { return true; }
+    switch (op->state) {
+    case io_Reactor_OpState_done:
+        return false;
+    case io_Reactor_OpState_idle:
+        if (op->has_timeout) { op->deadline = time_Instant_addDuration(Co_Exec_now(self->exec), op->timeout); }
+        break;
+    case io_Reactor_OpState_waiting:
+    case io_Reactor_OpState_cancelling:
+        if (Co_Timer_isExpired(&op->timer)) {
+            let waiter = io_Reactor__waiter(&self->slots[op->handle], op);
+            if (*waiter == op) {
+                *waiter = null;
+                self->in_flight--;
+            }
+            op->timed_out = true;
+            op->state = io_Reactor_OpState_done;
+            return false;
+        }
+        break;
+    }
+
+    if (op->handle < 0) {
+        op->result = -EBADF;
+        op->state = io_Reactor_OpState_done;
+        return false;
+    }
+    if (isErr(io_Reactor__ensureSlots(self, as$(usize)(op->handle) + 1))) {
+        op->result = -ENOMEM;
+        op->state = io_Reactor_OpState_done;
+        return false;
+    }
+    let slot = &self->slots[op->handle];
+    let err = io_Reactor__register(self, slot, op->handle);
+    if (err != 0) {
+        op->result = err;
+        op->state = io_Reactor_OpState_done;
+        return false;
+    }
+    let waiter = io_Reactor__waiter(slot, op);
+    if (*waiter != null && *waiter != op) {
+        // One op per direction of a handle: a second one would take the first one's wakeup
+        op->result = -EBUSY;
+        op->state = io_Reactor_OpState_done;
+        return false;
+    }
+    if (io_Reactor__attempt(slot, op)) {
+        op->state = io_Reactor_OpState_done;
+        return false;
+    }
+    *waiter = op;
+    self->in_flight++;
+    op->state = io_Reactor_OpState_waiting;
+    io_Reactor__park(self, op, frame);
+    return true;
+};
+
+fn_((io_Reactor_poll(io_Reactor* self, O$time_Duration timeout))(E$usize) $scope) {
+    claim_assert_nonnull(self);
+    if (self->in_flight == 0) {
+        if_some((timeout)(dur)) {
+            if (!time_Duration_isZero(dur)) { time_sleep(dur); }
+        }
+        return_ok(0);
+    }
+    let events = as$(Event*)(self->events);
+    let count = epoll_wait(self->fd, events, as$(i32)(self->events_cap), io_Reactor__timeoutMillis(timeout));
+    if (count < 0) {
+        if (errno == EINTR) { return_ok(0); }
+        return_err(io_Reactor_Err_WaitFailed());
+    }
+    var_(woken, usize) = 0;
+    for (i32 i = 0; i < count; ++i) {
+        let event = &events[i];
+        let fd = event->data.fd;
+        if (fd < 0 || as$(usize)(fd) >= self->slots_len) { continue; }
+        let slot = &self->slots[fd];
+        if (slot->mode != io_Reactor__mode_polled) { continue; }
+        // Hang-ups and errors end both directions; the retried transfer reports them
+        if (event->events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) { slot->ready |= EPOLLIN; }
+        if (event->events & (EPOLLOUT | EPOLLHUP | EPOLLERR)) { slot->ready |= EPOLLOUT; }
+        if (slot->reader != null && (slot->ready & EPOLLIN)) {
+            let_ignore = Co_Exec_wake(self->exec, &slot->reader->timer);
+            slot->reader = null;
+            self->in_flight--;
+            woken++;
+        }
+        if (slot->writer != null && (slot->ready & EPOLLOUT)) {
+            let_ignore = Co_Exec_wake(self->exec, &slot->writer->timer);
+            slot->writer = null;
+            self->in_flight--;
+            woken++;
+        }
+    }
+    return_ok(woken);
+} $unscoped_(fn);
+
+#endif /* !io_Reactor_use_uring */
+
+fn_((io_Reactor_run(io_Reactor* self))(E$void) $scope) {
+    claim_assert_nonnull(self);
+    while (true) {
+        try_(Co_Exec_poll(self->exec));
+        if (Co_Exec_isIdle(self->exec)) { break; }
+        let timeout = Co_Exec_untilNext(self->exec);
+        // Frames parked with nothing in flight could never be woken from here
+        if (self->in_flight == 0 && isNone(timeout)) { break; }
+        let_ignore = try_(io_Reactor_poll(self, timeout));
+    }
+    return_ok({});
+} $unscoped_(fn);
+
+#else /* !plat_is_linux */
+
+fn_((io_Reactor_init(Co_Exec* exec, u32 entries))(E$io_Reactor) $scope) {
+    let_ignore = exec;
+    let_ignore = entries;
+    return_err(io_Reactor_Err_Unsupported());
+} $unscoped_(fn);
+
+fn_((io_Reactor_fini(io_Reactor* self))(void)) {
+    let_ignore = self;
+    claim_unreachable;
+};
+
+fn_((io_Reactor_deregister(io_Reactor* self, fs_File_Handle handle))(void)) {
+    let_ignore = self;
+    let_ignore = handle;
+    claim_unreachable;
+};
+
+fn_((io_Reactor_step(io_Reactor* self, io_Reactor_Op* op, Co_Ctx* frame))(bool)) {
+    let_ignore = self;
+    let_ignore = op;
+    let_ignore = frame;
+    claim_unreachable;
+};
+
+fn_((io_Reactor_poll(io_Reactor* self, O$time_Duration timeout))(E$usize) $scope) {
+    let_ignore = self;
+    let_ignore = timeout;
+    claim_unreachable;
+} $unscoped_(fn);
+
+fn_((io_Reactor_run(io_Reactor* self))(E$void) $scope) {
+    let_ignore = self;
+    claim_unreachable;
+} $unscoped_(fn);
+
+#endif /* !plat_is_linux */
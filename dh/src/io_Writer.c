@@ -17,6 +17,42 @@ fn_((io_Writer_writeBytes(io_Writer self, S_const$u8 bytes))(E$void) $scope) {
     return_ok({});
 } $unscoped_(fn);
 
+fn_((io_Writer_writeVec(io_Writer self, S_const$S_const$u8 segs))(E$usize) $scope) {
+    claim_assert_nonnull(self.ctx);
+    claim_assert_nonnull(self.write);
+    if (self.writeVec != null) { return self.writeVec(self.ctx, segs); }
+    var_(total, usize) = 0;
+    for_(($s(segs))(seg) {
+        if (seg->len == 0) { continue; }
+        let written = try_(io_Writer_write(self, *seg));
+        total += written;
+        if (written < seg->len) { break; }
+    });
+    return_ok(total);
+} $unscoped_(fn);
+
+fn_((io_Writer_writeVecAll(io_Writer self, S_const$S_const$u8 segs))(E$void) $scope) {
+    // Segments handed to one gather write; the first may be the rest of a partially written one
+    var_(batch, A$$(16, S_const$u8)) = A_zero();
+    var_(idx, usize) = 0;
+    var_(head, usize) = 0;
+    while (idx < segs.len) {
+        var_(count, usize) = 0;
+        for (usize i = idx; i < segs.len && count < A_len(batch); ++i, ++count) {
+            *A_at((batch)[count]) = i == idx ? S_suffix((*S_at((segs)[i]))(head)) : *S_at((segs)[i]);
+        }
+        var_(written, usize) = try_(io_Writer_writeVec(self, A_prefix$((S_const$S_const$u8)(batch)(count))));
+        // Advance past what was written, keeping the offset into a partially written segment
+        while (idx < segs.len && head + written >= S_at((segs)[idx])->len) {
+            written -= S_at((segs)[idx])->len - head;
+            head = 0;
+            idx++;
+        }
+        head += written;
+    }
+    return_ok({});
+} $unscoped_(fn);
+
 fn_((io_Writer_writeBytesN(io_Writer self, S_const$u8 bytes, usize n))(E$void) $scope) {
     for (usize index = 0; index < n; ++index) {
         try_(io_Writer_writeBytes(self, bytes));
@@ -65,6 +101,22 @@ fn_((io_Writer_printlnVaArgs(io_Writer self, S_const$u8 fmt, va_list va_args))(E
     return_ok({});
 } $unscoped_(fn);
 
+fn_((io_Writer_printSite(io_Writer self, fmt_CompiledSite* site, S_const$u8 fmt, ...))(E$void) $guard) {
+    va_list va_args = {};
+    va_start(va_args, fmt);
+    defer_(va_end(va_args));
+    return_ok(try_(fmt_formatSiteVaArgs(self, site, fmt, va_args)));
+} $unguarded_(fn);
+
+fn_((io_Writer_printlnSite(io_Writer self, fmt_CompiledSite* site, S_const$u8 fmt, ...))(E$void) $guard) {
+    va_list va_args = {};
+    va_start(va_args, fmt);
+    defer_(va_end(va_args));
+    try_(fmt_formatSiteVaArgs(self, site, fmt, va_args));
+    try_(io_Writer_nl(self));
+    return_ok({});
+} $unguarded_(fn);
+
 fn_((io_Writer_nl(io_Writer self))(E$void) $scope) {
     $static let pp_if_(plat_is_windows)(
         pp_then_(s_crlf = u8_l("\r\n")),
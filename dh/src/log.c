@@ -1,5 +1,10 @@
 #include "dh/log.h"
 #include "dh/fs/Dir.h"
+#include "dh/Thrd/Chan.h"
+#include "dh/Thrd/Mtx.h"
+#include "dh/io/Buf.h"
+#include "dh/fmt/common.h"
+#include "dh/time/Instant.h"
 #include <stdarg.h>
 #include <time.h>
 
@@ -13,6 +18,94 @@ $static var_(log__config, log_Config) = {
     .shows_function = true // Show function name by default
 };
 
+/* --- Async mode state --- */
+
+// Bytes of message text kept per record (a record spans four cache lines)
+#define log__text_cap (208u)
+// Records the drain thread takes from one ring at a time
+#define log__drain_batch (32u)
+
+// One log call, captured on the calling thread
+typedef struct log__Record {
+    var_(at, time_Instant);
+    var_(file, const char*);
+    var_(func, const char*);
+    var_(line, u32);
+    var_(len, u16);
+    var_(level, u8);
+    var_(text, A$$(log__text_cap, u8));
+} log__Record;
+T_use_S$(log__Record);
+T_use$((log__Record)(
+    Thrd_Chan,
+    Thrd_Chan_init,
+    Thrd_Chan_fini,
+    Thrd_Chan_trySend,
+    Thrd_Chan_send,
+    Thrd_Chan_tryRecvS
+));
+
+// Per-thread SPSC ring: the owning thread produces, the drain thread consumes.
+// A ring outlives its thread: at exit it is released for the next new thread to adopt.
+typedef struct log__Ring log__Ring;
+struct log__Ring {
+    var_(chan, Thrd_Chan$log__Record);
+    var_(next, log__Ring*);
+    // 1 while a thread produces into the ring
+    var_(owned, atom_V$u32);
+};
+
+// Local time text of the last second the drain thread formatted
+typedef struct log__Stamp {
+    var_(secs, time_t);
+    var_(text, A$$(16, u8));
+    var_(len, usize);
+} log__Stamp;
+
+$static Thrd_fn_(log__drainMain, ({ u32 generation; }, Void));
+
+typedef struct log__Async {
+    var_(gpa, mem_Allocator);
+    var_(config, log_AsyncConfig);
+    // Serializes ring registration (once per thread)
+    var_(mtx, Thrd_Mtx);
+    // Push-only list, walked by the drain thread without the lock
+    var_(rings, log__Ring*);
+    // Generation of the running async session; 0 in synchronous mode
+    var_(active, atom_V$u32);
+    var_(last_generation, u32);
+    var_(dropped, atom_V$usize);
+    var_(reported_dropped, usize);
+    var_(wake_seq, atom_V$u32);
+    var_(flush_req, atom_V$u32);
+    var_(flush_done, atom_V$u32);
+    var_(is_stopping, atom_V$u32);
+    var_(drainer, Thrd);
+    var_(drain_ctx, Thrd_FnCtx$(log__drainMain));
+    var_(out_buf, S$u8);
+    // Wall clock at `base_at`, used to turn record instants into local time
+    var_(base_at, time_Instant);
+    var_(base_wall, time_t);
+} log__Async;
+$static var_(log__async, log__Async) = {};
+
+$static $Thrd_local var_(log__tls_ring, log__Ring*) = null;
+$static $Thrd_local var_(log__tls_generation, u32) = 0;
+$static $Thrd_local var_(log__tls_exit_hook, Thrd_ExitHook) = {};
+
+$static fn_((log__levelName(log_Level level))(const char*));
+$static fn_((log__ringOfThread(u32 generation))(log__Ring*));
+/// Thread exit hook: hands the thread's ring back for reuse
+$static fn_((log__releaseRing(void))(void));
+$static fn_((log__enqueue(
+    u32 generation, log_Level level, const char* file, int line, const char* func, const char* fmt, va_list args
+))(void));
+$static fn_((log__wakeDrain(void))(void));
+$static fn_((log__fileWrite(P$raw ctx, S_const$u8 bytes))(E$usize));
+$static fn_((log__drainRings(io_Writer writer, log__Stamp* stamp))(usize));
+$static fn_((log__writeRecord(io_Writer writer, const log__Record* record, log__Stamp* stamp))(E$void));
+$static fn_((log__freeRings(void))(void));
+
 fn_((log_init(const char* filename))(fs_File_Err$void) $guard) {
     // Extract directory path
     var_(dir_path, A$$(256, u8)) = A_zero();
@@ -50,6 +143,62 @@ fn_((log_fini(void))(void)) {
     }
 };
 
+fn_((log_initAsync(mem_Allocator gpa, log_AsyncConfig config))(E$void) $guard) {
+    claim_assert(atom_V_load(&log__async.active, atom_MemOrd_acquire) == 0);
+    log__async.gpa = gpa;
+    log__async.config = config;
+    log__async.config.ring_cap = prim_max(config.ring_cap, as$(usize)(2));
+    log__async.config.buf_size = prim_max(config.buf_size, as$(usize)(log__text_cap * 2));
+    log__async.out_buf = u_castS$((S$u8)(try_(mem_Allocator_alloc(gpa, typeInfo$(u8), log__async.config.buf_size))));
+    errdefer_($ignore, mem_Allocator_free(gpa, u_anyS(log__async.out_buf)));
+
+    log__async.mtx = Thrd_Mtx_init();
+    log__async.rings = null;
+    log__async.last_generation = log__async.last_generation == u32_limit_max ? 1 : log__async.last_generation + 1;
+    atom_V_store(&log__async.dropped, 0, atom_MemOrd_monotonic);
+    log__async.reported_dropped = 0;
+    atom_V_store(&log__async.flush_req, 0, atom_MemOrd_monotonic);
+    atom_V_store(&log__async.flush_done, 0, atom_MemOrd_monotonic);
+    atom_V_store(&log__async.is_stopping, 0, atom_MemOrd_monotonic);
+    log__async.base_at = time_Instant_now();
+    log__async.base_wall = time(null);
+
+    log__async.drain_ctx = Thrd_FnCtx_from$((log__drainMain)(log__async.last_generation));
+    log__async.drainer = try_(Thrd_spawn(Thrd_SpawnCfg_default, log__async.drain_ctx.as_raw));
+    atom_V_store(&log__async.active, log__async.last_generation, atom_MemOrd_release);
+    return_ok({});
+} $unguarded_(fn);
+
+fn_((log_finiAsync(void))(void)) {
+    if (atom_V_load(&log__async.active, atom_MemOrd_acquire) == 0) { return; }
+    atom_V_store(&log__async.active, 0, atom_MemOrd_release);
+    atom_V_store(&log__async.is_stopping, 1, atom_MemOrd_release);
+    log__wakeDrain();
+    let_ignore = Thrd_join(log__async.drainer);
+    log__freeRings();
+    mem_Allocator_free(log__async.gpa, u_anyS(log__async.out_buf));
+    Thrd_Mtx_fini(&log__async.mtx);
+};
+
+fn_((log_flush(void))(void)) {
+    if (atom_V_load(&log__async.active, atom_MemOrd_acquire) == 0) {
+        let_ignore = fflush(log_getOutputFile());
+        return;
+    }
+    let ticket = atom_V_fetchAdd(&log__async.flush_req, 1, atom_MemOrd_release) + 1;
+    log__wakeDrain();
+    while (true) {
+        let done = atom_V_load(&log__async.flush_done, atom_MemOrd_acquire);
+        /* Wrapping comparison: `done` has caught up with `ticket` */
+        if (as$(i32)(done - ticket) >= 0) { break; }
+        Thrd_Ftx_wait(&log__async.flush_done, done);
+    }
+};
+
+fn_((log_droppedCount(void))(usize)) {
+    return atom_V_load(&log__async.dropped, atom_MemOrd_monotonic);
+};
+
 fn_((log_setLevel(log_Level level))(void)) {
     log__config.min_level = level;
 };
@@ -81,6 +230,15 @@ fn_((log_getOutputFile(void))(FILE*)) {
 fn_((log_message(log_Level level, const char* file, int line, const char* func, const char* fmt, ...))(void)) {
     if (level < log__config.min_level) { return; }
 
+    // Async mode: capture the record and leave formatting and I/O to the drain thread
+    let generation = atom_V_load(&log__async.active, atom_MemOrd_acquire);
+    if (generation != 0) {
+        using_(va_list args = null) using_fini_(va_start(args, fmt), va_end(args)) {
+            log__enqueue(generation, level, file, line, func, fmt, args);
+        }
+        return;
+    }
+
     let output = log_getOutputFile();
 
     // Get current time if needed
@@ -94,15 +252,7 @@ fn_((log_message(log_Level level, const char* file, int line, const char* func,
 
     // Add level if needed
     if (log__config.shows_level) {
-        const char* level_str = "????";
-        switch (level) {
-        case log_Level_debug: level_str = "DEBUG"; break;
-        case log_Level_info:  level_str = "INFO"; break;
-        case log_Level_warn:  level_str = "WARN"; break;
-        case log_Level_error: level_str = "ERROR"; break;
-        case log_Level_count: claim_unreachable;
-        }
-        let_ignore = fprintf(output, "[%s]", level_str);
+        let_ignore = fprintf(output, "[%s]", log__levelName(level));
     }
 
     // Add location if needed
@@ -132,3 +282,201 @@ fn_((log_message(log_Level level, const char* file, int line, const char* func,
     let_ignore = fprintf(output, "\n");
     let_ignore = fflush(output);
 };
+
+$static fn_((log__levelName(log_Level level))(const char*)) {
+    switch (level) {
+    case log_Level_debug: return "DEBUG";
+    case log_Level_info:  return "INFO";
+    case log_Level_warn:  return "WARN";
+    case log_Level_error: return "ERROR";
+    case log_Level_count: claim_unreachable;
+    }
+    return "????";
+};
+
+$static fn_((log__ringOfThread(u32 generation))(log__Ring*)) {
+    if (log__tls_generation == generation) { return log__tls_ring; }
+    // First call on this thread in this session: adopt a ring released by an exited thread, else register a new one
+    if (log__tls_exit_hook.fn == null) {
+        log__tls_exit_hook.fn = log__releaseRing;
+        Thrd_onExit(&log__tls_exit_hook);
+    }
+    for (var ring = atom_load(&log__async.rings, atom_MemOrd_acquire); ring != null; ring = ring->next) {
+        if (atom_V_load(&ring->owned, atom_MemOrd_monotonic) == 0
+            && isNone(atom_V_cmpXchgStrong(&ring->owned, 0, 1, atom_MemOrd_acquire, atom_MemOrd_monotonic))) {
+            log__tls_ring = ring;
+            log__tls_generation = generation;
+            return ring;
+        }
+    }
+    let gpa = log__async.gpa;
+    let ring = u_castP$((log__Ring*)(catch_((mem_Allocator_create(gpa, typeInfo$(log__Ring)))($ignore, return null))));
+    ring->chan = catch_((Thrd_Chan_init$log__Record(gpa, log__async.config.ring_cap, Thrd_Chan_Mode_spsc))($ignore, {
+        mem_Allocator_destroy(gpa, u_anyP(ring));
+        return null;
+    }));
+    atom_V_store(&ring->owned, 1, atom_MemOrd_monotonic);
+    Thrd_Mtx_lock(&log__async.mtx);
+    ring->next = log__async.rings;
+    atom_store(&log__async.rings, ring, atom_MemOrd_release);
+    Thrd_Mtx_unlock(&log__async.mtx);
+    log__tls_ring = ring;
+    log__tls_generation = generation;
+    return ring;
+};
+
+$static fn_((log__releaseRing(void))(void)) {
+    let ring = log__tls_ring;
+    log__tls_ring = null;
+    // A ring from an earlier session was freed by `log_finiAsync`
+    if (ring == null || log__tls_generation != atom_V_load(&log__async.active, atom_MemOrd_acquire)) { return; }
+    log__tls_generation = 0;
+    // Records still queued stay in the ring; the drain thread writes them as usual
+    atom_V_store(&ring->owned, 0, atom_MemOrd_release);
+    log__wakeDrain();
+};
+
+$static fn_((log__enqueue(
+    u32 generation, log_Level level, const char* file, int line, const char* func, const char* fmt, va_list args
+))(void)) {
+    let ring = log__ringOfThread(generation);
+    if (ring == null) {
+        atom_V_fetchAdd(&log__async.dropped, 1, atom_MemOrd_monotonic);
+        return;
+    }
+    var record = (log__Record){
+        .at = time_Instant_now(),
+        .file = file,
+        .func = func,
+        .line = intCast$((u32)(line)),
+        .len = 0,
+        .level = intCast$((u8)(level)),
+        .text = A_zero(),
+    };
+    let written = vsnprintf(ptrCast$((char*)(A_ptr(record.text))), A_len(record.text), fmt, args);
+    record.len = intCast$((u16)(written < 0 ? 0 : prim_min(as$(usize)(written), A_len(record.text) - 1)));
+
+    if (log__async.config.overflow == log_Overflow_block) {
+        // The rings are never closed, so a blocking send only returns once the record is queued
+        let_ignore = Thrd_Chan_send$log__Record(&ring->chan, record);
+    } else {
+        let sent = catch_((Thrd_Chan_trySend$log__Record(&ring->chan, record))($ignore, false));
+        if (!sent) {
+            atom_V_fetchAdd(&log__async.dropped, 1, atom_MemOrd_monotonic);
+            log__wakeDrain();
+            return;
+        }
+    }
+    // The drain thread also wakes on its own every `flush_interval_ms`; only hurry it when half full
+    if (Thrd_Chan_len(ring->chan.as_raw) * 2 >= Thrd_Chan_cap(ring->chan.as_raw)) { log__wakeDrain(); }
+};
+
+$static fn_((log__wakeDrain(void))(void)) {
+    atom_V_fetchAdd(&log__async.wake_seq, 1, atom_MemOrd_release);
+    Thrd_Ftx_wake(&log__async.wake_seq, 1);
+};
+
+$static fn_((log__fileWrite(P$raw ctx, S_const$u8 bytes))(E$usize) $scope) {
+    let written = fwrite(bytes.ptr, 1, bytes.len, as$(FILE*)(ctx));
+    if (written != bytes.len) { return_err(fs_File_Err_WriteFailed()); }
+    return_ok(written);
+} $unscoped_(fn);
+
+$static fn_((log__drainRings(io_Writer writer, log__Stamp* stamp))(usize)) {
+    var_(batch, A$$(log__drain_batch, log__Record)) = A_zero();
+    var_(total, usize) = 0;
+    for (var ring = atom_load(&log__async.rings, atom_MemOrd_acquire); ring != null; ring = ring->next) {
+        while (true) {
+            let count = Thrd_Chan_tryRecvS$log__Record(&ring->chan, A_ref$((S$log__Record)(batch)));
+            for_(($r(0, count))(i) { let_ignore = log__writeRecord(writer, A_at((batch)[i]), stamp); });
+            total += count;
+            if (count < A_len(batch)) { break; }
+        }
+    }
+    return total;
+};
+
+$static fn_((log__writeRecord(io_Writer writer, const log__Record* record, log__Stamp* stamp))(E$void) $scope) {
+    if (log__config.shows_timestamp) {
+        let since = orelse_((time_Instant_durationSinceChkd(record->at, log__async.base_at))(time_Duration_zero));
+        let secs = log__async.base_wall + as$(time_t)(time_Duration_asSecs(since));
+        // Records arrive in bursts from the same second: format the clock once per second
+        if (stamp->len == 0 || stamp->secs != secs) {
+            struct tm* lt = localtime(&secs);
+            stamp->secs = secs;
+            stamp->len = strftime(ptrCast$((char*)(A_ptr(stamp->text))), A_len(stamp->text), "%H:%M:%S", lt);
+        }
+        try_(fmt_format(writer, u8_l("[{:s}]"), A_prefix$((S_const$u8)(stamp->text)(stamp->len))));
+    }
+    if (log__config.shows_level) {
+        try_(fmt_format(writer, u8_l("[{:z}]"), as$(const u8*)(log__levelName(as$(log_Level)(record->level)))));
+    }
+    if (log__config.shows_location) {
+        try_(fmt_format(writer, u8_l("[{:z}:{:u}]"), as$(const u8*)(record->file), record->line));
+    }
+    if (log__config.shows_function) {
+        try_(fmt_format(writer, u8_l("[{:z}]"), as$(const u8*)(record->func)));
+    }
+    if (log__config.shows_timestamp
+        || log__config.shows_level
+        || log__config.shows_location
+        || log__config.shows_function) {
+        try_(io_Writer_writeByte(writer, ' '));
+    }
+    try_(io_Writer_writeBytes(writer, A_prefix$((S_const$u8)(record->text)(record->len))));
+    try_(io_Writer_writeByte(writer, '\n'));
+    return_ok({});
+} $unscoped_(fn);
+
+$static fn_((log__freeRings(void))(void)) {
+    let gpa = log__async.gpa;
+    var ring = log__async.rings;
+    while (ring != null) {
+        let next = ring->next;
+        Thrd_Chan_fini$log__Record(&ring->chan, gpa);
+        mem_Allocator_destroy(gpa, u_anyP(ring));
+        ring = next;
+    }
+    log__async.rings = null;
+};
+
+Thrd_fn_(log__drainMain, ($ignore, args)$scope) {
+    let_ignore = args;
+    let output = log_getOutputFile();
+    var file_writer = (io_Writer){ .ctx = ptrCast$((P$raw)(output)), .write = log__fileWrite };
+    var buf_writer = io_Buf_Writer_init(file_writer, log__async.out_buf);
+    let writer = io_Buf_writer(&buf_writer);
+    var stamp = (log__Stamp){ .secs = 0, .text = A_zero(), .len = 0 };
+    let interval = time_Duration_fromMillis(log__async.config.flush_interval_ms);
+
+    while (true) {
+        /* Load both before draining: records queued before a flush request or
+         * before stopping are visible once these are observed */
+        let seq = atom_V_load(&log__async.wake_seq, atom_MemOrd_acquire);
+        let flush_req = atom_V_load(&log__async.flush_req, atom_MemOrd_acquire);
+        let is_stopping = atom_V_load(&log__async.is_stopping, atom_MemOrd_acquire) != 0;
+
+        let written = log__drainRings(writer, &stamp);
+        if (log__async.config.overflow == log_Overflow_count) {
+            let dropped = atom_V_load(&log__async.dropped, atom_MemOrd_monotonic);
+            if (dropped != log__async.reported_dropped) {
+                let_ignore = fmt_format(
+                    writer, u8_l("[log] {:uz} messages dropped (ring full)\n"), dropped - log__async.reported_dropped
+                );
+                log__async.reported_dropped = dropped;
+            }
+        }
+        // One write per batch
+        let_ignore = io_Buf_Writer_flush(&buf_writer);
+        if (written != 0) { let_ignore = fflush(output); }
+        if (atom_V_load(&log__async.flush_done, atom_MemOrd_monotonic) != flush_req) {
+            atom_V_store(&log__async.flush_done, flush_req, atom_MemOrd_release);
+            Thrd_Ftx_wake(&log__async.flush_done, u32_limit_max);
+        }
+
+        if (written != 0) { continue; }
+        if (is_stopping) { break; }
+        let_ignore = Thrd_Ftx_timedWait(&log__async.wake_seq, seq, interval);
+    }
+    return_({});
+} $unscoped_(Thrd_fn);
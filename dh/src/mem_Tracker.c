@@ -1,8 +1,6 @@
 #include "dh/mem/Tracker.h"
 #if defined(MEM_NO_TRACE_ALLOC_AND_FREE) || !debug_comp_enabled
 #else
-#include "dh/ArrList.h"
-#include "dh/heap/Classic.h"
 #include "dh/mem/common.h"
 #include "dh/fs/Dir.h"
 #include "dh/io.h"
@@ -13,28 +11,55 @@
 /*========== Constants and Default Configuration ===========================*/
 
 static const S_const$u8 mem_Tracker_default_log_file = u8_l(".log/mem.log");
+/// Initial slots of the live table; it doubles past 3/4 load
+#define mem_Tracker__lives_min_cap (1024u)
+/// Site index of allocations whose call site did not fit the site table
+#define mem_Tracker__no_site u32_limit_max
+/// Counters of the filter that lets frees of unsampled allocations skip the lock
+#define mem_Tracker__filter_len (4096u)
 
-/*========== Tracker Leak Report Types =====================================*/
+/*========== Tracker Record Types ==========================================*/
 
-/// Individual allocation record
-typedef struct mem_Allocation {
+/// Tracked allocation, one slot of the live table (`ptr == null` when the slot is empty)
+typedef struct mem_Tracker__Live {
     P$raw ptr; /* Allocated pointer */
     usize size; /* Allocation size */
-    SrcLoc src_loc; /* Source location*/
+    usize weight; /* Bytes this record stands for; `size` unless sampled */
+    u32 site_idx; /* Index into the site table */
+    SrcLoc src_loc; /* Source location */
     time_Instant timestamp; /* Allocation time */
-    struct mem_Allocation* next;
-} mem_Allocation;
-
-/// Leak site for aggregated reporting
-typedef struct LeakSite {
+} mem_Tracker__Live;
+
+typedef enum mem_Tracker__SiteState {
+    mem_Tracker__SiteState_empty = 0,
+    /// A thread is writing `src_loc`
+    mem_Tracker__SiteState_claimed,
+    mem_Tracker__SiteState_ready,
+} mem_Tracker__SiteState;
+
+/// Per-site counters; every field but `src_loc` is only accessed atomically
+typedef struct mem_Tracker__Site {
+    u32 state;
     SrcLoc src_loc;
-    usize count;
-    usize total_bytes;
-} LeakSite;
+    usize alloc_bytes;
+    usize alloc_count;
+    usize free_bytes;
+    usize free_count;
+} mem_Tracker__Site;
+claim_assert_static(int_isPow2(mem_Tracker_max_sites));
 
 /*========== Singleton Instance ============================================*/
 
 $static mem_Tracker mem_Tracker_s_instance = cleared();
+/// Open-addressed by call site; slots are claimed lock-free and never released
+$static var_(mem_Tracker_s_sites, A$$(mem_Tracker_max_sites, mem_Tracker__Site)) = A_zero();
+/// Bytes the calling thread still allocates before its next sample
+$static $Thrd_local var_(mem_Tracker_s_until_sample, isize) = 0;
+$static $Thrd_local var_(mem_Tracker_s_is_sampling, bool) = false;
+$static $Thrd_local var_(mem_Tracker_s_rng, u64) = 0;
+/// Tracked allocations per pointer hash; zero means the pointer is certainly not in the
+/// live table. Changed under the lock, read without it.
+$static var_(mem_Tracker_s_filter, A$$(mem_Tracker__filter_len, u32)) = A_zero();
 
 /// Automatic initialization at program start
 $attr($on_load)
@@ -53,6 +78,35 @@ $static fn_((mem_Tracker__fini(void))(void)) {
     mem_Tracker_finiAndGenerateReport();
 };
 
+/*========== Internal Declarations =========================================*/
+
+/// Whether to track an allocation of `size` bytes, and how many bytes it then stands for
+$static fn_((mem_Tracker__sample(usize size, usize* weight))(bool));
+$static fn_((mem_Tracker__sampleWeight(usize size, usize interval))(usize));
+$static fn_((mem_Tracker__nextSampleGap(usize interval))(isize));
+
+$static fn_((mem_Tracker__siteIdx(SrcLoc src_loc))(u32));
+$static fn_((mem_Tracker__eqlSrcLoc(SrcLoc lhs, SrcLoc rhs))(bool));
+$static fn_((mem_Tracker__countAlloc(u32 site_idx, usize size, usize weight))(void));
+$static fn_((mem_Tracker__countFree(u32 site_idx, usize size, usize weight))(void));
+$static fn_((mem_Tracker__loadSite(const mem_Tracker__Site* site))(mem_Tracker_Site));
+$static fn_((mem_Tracker__liveBytes(mem_Tracker_Site site))(usize));
+
+/* Live table; the caller holds the mutex */
+$attr($inline_always)
+$static fn_((mem_Tracker__filterAt(P$raw ptr))(u32*));
+$static fn_((mem_Tracker__findLive(P$raw ptr))(mem_Tracker__Live*));
+$static fn_((mem_Tracker__insertLive(mem_Tracker__Live live))(bool));
+$static fn_((mem_Tracker__removeLive(mem_Tracker__Live* slot))(void));
+
+/// Records a sampled allocation
+$static fn_((mem_Tracker__track(P$raw ptr, usize size, usize weight, SrcLoc src_loc))(void));
+/// Forgets an allocation; returns its size, or 0 if it was not tracked
+$static fn_((mem_Tracker__untrack(P$raw ptr, SrcLoc src_loc, bool reports_invalid))(usize));
+$static fn_((mem_Tracker__writeSnapshot(mem_Tracker* self))(void));
+/// `mem_Tracker_sites` for a caller already holding the lock
+$static fn_((mem_Tracker__topSites(S$mem_Tracker_Site buf))(usize));
+
 /*========== Implementation ================================================*/
 
 fn_((mem_Tracker_initWithPath(S_const$u8 log_path))(E$void) $guard) {
@@ -76,12 +130,12 @@ fn_((mem_Tracker_initWithPath(S_const$u8 log_path))(E$void) $guard) {
 
     // Set up the tracker instance
     mem_Tracker_s_instance.log_file = log_file;
-    mem_Tracker_s_instance.allocations = null;
-    mem_Tracker_s_instance.total_allocated = 0;
-    mem_Tracker_s_instance.active_allocs = 0;
-
-    static heap_Classic s_heap_ctx = cleared();
-    mem_Tracker_s_instance.gpa = heap_Classic_allocator(&s_heap_ctx);
+    if (!mem_Tracker_s_instance.lives) {
+        mem_Tracker_s_instance.cfg = mem_Tracker_Cfg_default;
+        mem_Tracker_s_instance.mtx = Thrd_Mtx_init();
+    }
+    mem_Tracker_s_instance.started_at = time_Instant_now();
+    mem_Tracker_s_instance.last_snapshot = mem_Tracker_s_instance.started_at;
 
     // clang-format off
     // Write header
@@ -93,240 +147,474 @@ fn_((mem_Tracker_initWithPath(S_const$u8 log_path))(E$void) $guard) {
     return_ok({});
 } $unguarded_(fn);
 
-T_use$((LeakSite)(P, S, O));
-T_use_E$($set(mem_Err)(P$LeakSite));
-T_use$((LeakSite)(ArrList, ArrList_init, ArrList_fini, ArrList_addBack));
-
-fn_((mem_Tracker_finiAndGenerateReport(void))(void) $guard) {
-    if (!mem_Tracker_s_instance.log_file) { return; }
+fn_((mem_Tracker_finiAndGenerateReport(void))(void)) {
+    let self = &mem_Tracker_s_instance;
+    if (!self->log_file) { return; }
+    Thrd_Mtx_lock(&self->mtx);
+    let stats = mem_Tracker_stats();
+    let is_sampled = self->cfg.sample_interval != 0;
 
     // clang-format off
-    let_ignore = fprintf(mem_Tracker_s_instance.log_file, "\nMemory Leak Report\n");
-    let_ignore = fprintf(mem_Tracker_s_instance.log_file, "=====================================\n");
-    let_ignore = fprintf(mem_Tracker_s_instance.log_file, "Total allocations: %zu bytes\n",
-        mem_Tracker_s_instance.total_allocated
+    let_ignore = fprintf(self->log_file, "\nMemory Leak Report\n");
+    let_ignore = fprintf(self->log_file, "=====================================\n");
+    if (is_sampled) {
+        let_ignore = fprintf(self->log_file, "Sampled every %zu bytes on average; figures are estimates\n",
+            self->cfg.sample_interval
+        );
+    }
+    let_ignore = fprintf(self->log_file, "Total allocations: %zu (%zu bytes)\n",
+        stats.alloc_count, stats.alloc_bytes
     );
-    let_ignore = fprintf(mem_Tracker_s_instance.log_file, "Active allocations: %zu\n",
-        mem_Tracker_s_instance.active_allocs
+    let_ignore = fprintf(self->log_file, "Active allocations: %zu (%zu bytes)\n",
+        stats.live_count, stats.live_bytes
     );
     // clang-format on
 
-    if (mem_Tracker_s_instance.active_allocs > 0) {
-        let_ignore = fprintf(mem_Tracker_s_instance.log_file, "\nDetected Memory Leaks:\n");
-        let_ignore = fprintf(mem_Tracker_s_instance.log_file, "=====================================\n");
+    if (self->lives_len > 0) {
+        let_ignore = fprintf(self->log_file, "\nDetected Memory Leaks:\n");
+        let_ignore = fprintf(self->log_file, "=====================================\n");
 
         // Get current time for age calculations
-        time_Instant now = time_Instant_now();
-
-        // Track all leaks
-        mem_Allocation* curr = mem_Tracker_s_instance.allocations;
+        let now = time_Instant_now();
         usize leak_count = 0;
         usize total_leaked = 0;
-
-        // Create a dynamic array for leak sites
-        var sites = catch_((ArrList_init$LeakSite(mem_Tracker_s_instance.gpa, 0))($ignore, claim_unreachable));
-        defer_(ArrList_fini$LeakSite(&sites, mem_Tracker_s_instance.gpa));
-
-        // Process each leak
-        while (curr) {
+        for (usize i = 0; i < self->lives_cap; ++i) {
+            let live = &self->lives[i];
+            if (!live->ptr) { continue; }
             leak_count++;
-            total_leaked += curr->size;
+            total_leaked += live->weight;
 
             // Calculate age of leak
-            time_Duration age = time_Instant_durationSince(now, curr->timestamp);
-            f64 age_secs = time_Duration_asSecs$f64(age);
+            let age_secs = time_Duration_asSecs$f64(time_Instant_durationSince(now, live->timestamp));
 
             // Log individual leak
-            let_ignore = fprintf(mem_Tracker_s_instance.log_file, "Leak #%zu:\n", leak_count);
-            let_ignore = fprintf(mem_Tracker_s_instance.log_file, "  Address: %p\n", curr->ptr);
-            let_ignore = fprintf(mem_Tracker_s_instance.log_file, "  Size: %zu bytes\n", curr->size);
-            let_ignore = fprintf(mem_Tracker_s_instance.log_file, "  Location: %s:%d\n", curr->src_loc.file_name, curr->src_loc.line);
-            let_ignore = fprintf(mem_Tracker_s_instance.log_file, "  Function: %s\n", curr->src_loc.fn_name);
-            let_ignore = fprintf(mem_Tracker_s_instance.log_file, "  Age: %.2f seconds\n", age_secs);
-
-            // Find or add to leak sites
-            eval_(void $scope)(for_(($s(sites.items))(site) {
-                let site_file_name = mem_spanZ0$u8(ptrCast$((const u8*)(site->src_loc.file_name)));
-                let site_fn_name = mem_spanZ0$u8(ptrCast$((const u8*)(site->src_loc.fn_name)));
-                let curr_file_name = mem_spanZ0$u8(ptrCast$((const u8*)(curr->src_loc.file_name)));
-                let curr_fn_name = mem_spanZ0$u8(ptrCast$((const u8*)(curr->src_loc.fn_name)));
-                // Check if it's the same location
-                if (mem_eqlBytes(site_file_name, curr_file_name)
-                    && site->src_loc.line == curr->src_loc.line
-                    && mem_eqlBytes(site_fn_name, curr_fn_name)) {
-                    site->count++;
-                    site->total_bytes += curr->size;
-                    $break_void();
-                }
-            })) eval_(else)({
-                // Add new leak site
-                let site = catch_((ArrList_addBack$LeakSite(&sites, mem_Tracker_s_instance.gpa))($ignore, claim_unreachable));
-                site->src_loc = curr->src_loc;
-                site->count = 1;
-                site->total_bytes = curr->size;
-            }) $unscoped_(eval);
-            curr = curr->next;
+            let_ignore = fprintf(self->log_file, "Leak #%zu:\n", leak_count);
+            let_ignore = fprintf(self->log_file, "  Address: %p\n", live->ptr);
+            let_ignore = fprintf(self->log_file, "  Size: %zu bytes\n", live->size);
+            let_ignore = fprintf(self->log_file, "  Location: %s:%d\n", live->src_loc.file_name, live->src_loc.line);
+            let_ignore = fprintf(self->log_file, "  Function: %s\n", live->src_loc.fn_name);
+            let_ignore = fprintf(self->log_file, "  Age: %.2f seconds\n", age_secs);
         }
 
         // Print leak summary by allocation site
-        let_ignore = fprintf(mem_Tracker_s_instance.log_file, "\nLeak Summary by Location:\n");
-        let_ignore = fprintf(mem_Tracker_s_instance.log_file, "=====================================\n");
+        let_ignore = fprintf(self->log_file, "\nLeak Summary by Location:\n");
+        let_ignore = fprintf(self->log_file, "=====================================\n");
 
-        for_(($s(sites.items))(site) {
+        for_(($s(A_ref(mem_Tracker_s_sites)))(slot) {
+            if (atom_load(&slot->state, atom_MemOrd_acquire) != mem_Tracker__SiteState_ready) { continue; }
+            let site = mem_Tracker__loadSite(slot);
+            if (site.alloc_count <= site.free_count) { continue; }
             let_ignore = fprintf(
-                mem_Tracker_s_instance.log_file,
+                self->log_file,
                 "Location: %s:%d in %s\n"
                 "  Count: %zu leaks\n"
                 "  Total bytes: %zu\n\n",
-                site->src_loc.file_name,
-                site->src_loc.line,
-                site->src_loc.fn_name,
-                site->count,
-                site->total_bytes
+                site.src_loc.file_name,
+                site.src_loc.line,
+                site.src_loc.fn_name,
+                site.alloc_count - site.free_count,
+                mem_Tracker__liveBytes(site)
             );
         });
 
-        let_ignore = fprintf(mem_Tracker_s_instance.log_file, "\nTotal leaked memory: %zu bytes\n", total_leaked);
+        let_ignore = fprintf(self->log_file, "\nTotal leaked memory: %zu bytes\n", total_leaked);
     }
 
-    // Cleanup the tracker's linked list of allocations
-    mem_Allocation* curr = mem_Tracker_s_instance.allocations;
-    while (curr) {
-        mem_Allocation* next = curr->next;
-        free(curr);
-        curr = next;
-    }
+    // Release the live table
+    for_(($s(A_ref(mem_Tracker_s_filter)))(count) { atom_store(count, 0, atom_MemOrd_monotonic); });
+    free(self->lives);
+    self->lives = null;
+    self->lives_cap = 0;
+    self->lives_len = 0;
 
-    let_ignore = fclose(mem_Tracker_s_instance.log_file);
-    mem_Tracker_s_instance.log_file = null;
-    mem_Tracker_s_instance.allocations = null;
-    return_void();
-} $unguarded_(fn);
+    let_ignore = fclose(self->log_file);
+    self->log_file = null;
+    Thrd_Mtx_unlock(&self->mtx);
+};
+
+fn_((mem_Tracker_configure(mem_Tracker_Cfg cfg))(void)) {
+    let self = &mem_Tracker_s_instance;
+    Thrd_Mtx_lock(&self->mtx);
+    // Field by field: `sample_interval` is read without the lock, so only the atomic store may write it
+    self->cfg.logs_events = cfg.logs_events;
+    self->cfg.snapshot_interval = cfg.snapshot_interval;
+    self->cfg.snapshot_sites = cfg.snapshot_sites;
+    atom_store(&self->cfg.sample_interval, cfg.sample_interval, atom_MemOrd_release);
+    self->last_snapshot = time_Instant_now();
+    Thrd_Mtx_unlock(&self->mtx);
+};
 
 fn_((mem_Tracker_registerAlloc(P$raw ptr, usize size, SrcLoc src_loc))(void)) {
-    if (!ptr || !mem_Tracker_s_instance.log_file) { return; }
+    // Zero-sized allocations all share one address and are never freed
+    if (!ptr || size == 0 || !mem_Tracker_s_instance.log_file) { return; }
+    var_(weight, usize) = 0;
+    if (!mem_Tracker__sample(size, &weight)) { return; }
+    mem_Tracker__track(ptr, size, weight, src_loc);
+};
 
-    // Create new allocation record
-    let alloc = as$(mem_Allocation*)((malloc(sizeof(mem_Allocation))));
-    if (!alloc) {
+fn_((mem_Tracker_registerRemap(P$raw old_ptr, P$raw new_ptr, usize new_size, SrcLoc src_loc))(void)) {
+    let self = &mem_Tracker_s_instance;
+    if (!self->log_file) { return; }
+
+    // A tracked allocation stays tracked across the remap, and an untracked one untracked
+    let old_size = old_ptr ? mem_Tracker__untrack(old_ptr, src_loc, false) : 0;
+    if (self->cfg.logs_events) {
         // clang-format off
-        let_ignore = fprintf(mem_Tracker_s_instance.log_file, "Failed to allocate memory for tracker at %s:%d\n",
-            src_loc.file_name, src_loc.line
+        Thrd_Mtx_lock(&self->mtx);
+        let_ignore = fprintf(self->log_file, "REMAP: %p (%zu bytes) -> %p (%zu bytes) at %s:%d in %s\n",
+            old_ptr, old_size, new_ptr, new_size, src_loc.file_name, src_loc.line, src_loc.fn_name
         );
+        Thrd_Mtx_unlock(&self->mtx);
         // clang-format on
-        return;
     }
+    if (!new_ptr || new_size == 0) { return; }
+    if (old_size == 0) { return mem_Tracker_registerAlloc(new_ptr, new_size, src_loc); }
+    let interval = atom_load(&self->cfg.sample_interval, atom_MemOrd_acquire);
+    mem_Tracker__track(new_ptr, new_size, mem_Tracker__sampleWeight(new_size, interval), src_loc);
+};
+
+fn_((mem_Tracker_registerFree(P$raw ptr, SrcLoc src_loc))(bool)) {
+    if (!ptr || !mem_Tracker_s_instance.log_file) { return false; }
+    return 0 < mem_Tracker__untrack(ptr, src_loc, true);
+};
 
-    // Fill allocation info
-    alloc->ptr = ptr;
-    alloc->size = size;
-    alloc->src_loc = src_loc;
-    alloc->timestamp = time_Instant_now();
+fn_((mem_Tracker_stats(void))(mem_Tracker_Stats)) {
+    let stats = &mem_Tracker_s_instance.stats;
+    return (mem_Tracker_Stats){
+        .live_bytes = atom_load(&stats->live_bytes, atom_MemOrd_monotonic),
+        .live_count = atom_load(&stats->live_count, atom_MemOrd_monotonic),
+        .alloc_bytes = atom_load(&stats->alloc_bytes, atom_MemOrd_monotonic),
+        .alloc_count = atom_load(&stats->alloc_count, atom_MemOrd_monotonic),
+    };
+};
 
-    // Add to linked list
-    alloc->next = mem_Tracker_s_instance.allocations;
-    mem_Tracker_s_instance.allocations = alloc;
+fn_((mem_Tracker_sites(S$mem_Tracker_Site buf))(usize)) {
+    let self = &mem_Tracker_s_instance;
+    Thrd_Mtx_lock(&self->mtx);
+    let len = mem_Tracker__topSites(buf);
+    Thrd_Mtx_unlock(&self->mtx);
+    return len;
+};
 
-    // Update stats
-    mem_Tracker_s_instance.total_allocated += size;
-    mem_Tracker_s_instance.active_allocs++;
+fn_((mem_Tracker__topSites(S$mem_Tracker_Site buf))(usize)) {
+    var_(len, usize) = 0;
+    for_(($s(A_ref(mem_Tracker_s_sites)))(slot) {
+        if (atom_load(&slot->state, atom_MemOrd_acquire) != mem_Tracker__SiteState_ready) { continue; }
+        let site = mem_Tracker__loadSite(slot);
+        let live_bytes = mem_Tracker__liveBytes(site);
+        // Insertion into the top `buf.len`, largest live bytes first
+        var_(pos, usize) = len;
+        while (0 < pos && mem_Tracker__liveBytes(*S_at((buf)[pos - 1])) < live_bytes) { --pos; }
+        if (buf.len <= pos) { continue; }
+        if (len < buf.len) { ++len; }
+        for (usize i = len - 1; pos < i; --i) { *S_at((buf)[i]) = *S_at((buf)[i - 1]); }
+        *S_at((buf)[pos]) = site;
+    });
+    return len;
+};
 
-    // clang-format off
-    // Log allocation with total bytes
-    let_ignore = fprintf(mem_Tracker_s_instance.log_file, "ALLOC: %p (%zu bytes) at %s:%d in %s (Total: %zu bytes)\n",
-        ptr, size, src_loc.file_name, src_loc.line, src_loc.fn_name, mem_Tracker_s_instance.total_allocated
-    );
-    // clang-format on
+fn_((mem_Tracker_dumpSnapshot(void))(void)) {
+    let self = &mem_Tracker_s_instance;
+    if (!self->log_file) { return; }
+    Thrd_Mtx_lock(&self->mtx);
+    mem_Tracker__writeSnapshot(self);
+    Thrd_Mtx_unlock(&self->mtx);
 };
 
-fn_((mem_Tracker_registerRemap(P$raw old_ptr, P$raw new_ptr, usize new_size, SrcLoc src_loc))(void)) {
-    if (!mem_Tracker_s_instance.log_file) { return; }
-
-    // First, find the old allocation
-    usize old_size = 0;
-    if (old_ptr) {
-        mem_Allocation* curr = mem_Tracker_s_instance.allocations;
-        while (curr) {
-            if (curr->ptr == old_ptr) {
-                old_size = curr->size;
-                break;
+fn_((mem_Tracker_instance(void))(mem_Tracker*)) {
+    return &mem_Tracker_s_instance;
+};
+
+/*========== Internal Definitions ==========================================*/
+
+fn_((mem_Tracker__sample(usize size, usize* weight))(bool)) {
+    let interval = atom_load(&mem_Tracker_s_instance.cfg.sample_interval, atom_MemOrd_acquire);
+    if (interval == 0) {
+        *weight = size;
+        return true;
+    }
+    if (!mem_Tracker_s_is_sampling) {
+        mem_Tracker_s_until_sample = mem_Tracker__nextSampleGap(interval);
+        mem_Tracker_s_is_sampling = true;
+    }
+    mem_Tracker_s_until_sample -= as$(isize)(size);
+    if (0 < mem_Tracker_s_until_sample) { return false; }
+    mem_Tracker_s_until_sample = mem_Tracker__nextSampleGap(interval);
+    *weight = mem_Tracker__sampleWeight(size, interval);
+    return true;
+};
+
+fn_((mem_Tracker__sampleWeight(usize size, usize interval))(usize)) {
+    if (interval == 0) { return size; }
+    // An allocation of `size` bytes is sampled with probability 1 - e^(-size/interval)
+    let probability = 1.0 - flt_exp(-as$(f64)(size) / as$(f64)(interval));
+    return as$(usize)(as$(f64)(size) / probability);
+};
+
+fn_((mem_Tracker__nextSampleGap(usize interval))(isize)) {
+    if (mem_Tracker_s_rng == 0) { mem_Tracker_s_rng = ptrToInt(&mem_Tracker_s_rng) | 1; }
+    // splitmix64
+    var_(z, u64) = (mem_Tracker_s_rng += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    z ^= z >> 31;
+    // Exponential gap with mean `interval`, from a uniform in (0, 1]
+    let uniform = as$(f64)((z >> 11) + 1) * 0x1.0p-53;
+    return as$(isize)(-flt_ln(uniform) * as$(f64)(interval)) + 1;
+};
+
+fn_((mem_Tracker__siteIdx(SrcLoc src_loc))(u32)) {
+    // FNV-1a over file name and line: the same name may live at different addresses per translation unit
+    var_(hash, u64) = 0xcbf29ce484222325ull;
+    for (const char* c = src_loc.file_name; c && *c; ++c) { hash = (hash ^ as$(u8)(*c)) * 0x100000001b3ull; }
+    hash = (hash ^ src_loc.line) * 0x100000001b3ull;
+
+    for (u32 probe = 0; probe < mem_Tracker_max_sites; ++probe) {
+        let idx = as$(u32)((hash + probe) & (mem_Tracker_max_sites - 1));
+        let slot = A_at((mem_Tracker_s_sites)[idx]);
+        var state = atom_load(&slot->state, atom_MemOrd_acquire);
+        if (state == mem_Tracker__SiteState_empty) {
+            if_some((atom_cmpXchgStrong(
+                &slot->state, mem_Tracker__SiteState_empty, mem_Tracker__SiteState_claimed,
+                atom_MemOrd_acquire, atom_MemOrd_acquire
+            ))(actual)) {
+                state = actual;
+            } else_none {
+                slot->src_loc = src_loc;
+                atom_store(&slot->state, mem_Tracker__SiteState_ready, atom_MemOrd_release);
+                return idx;
             }
-            curr = curr->next;
         }
+        // Another thread is publishing this slot
+        while (state == mem_Tracker__SiteState_claimed) { state = atom_load(&slot->state, atom_MemOrd_acquire); }
+        if (mem_Tracker__eqlSrcLoc(slot->src_loc, src_loc)) { return idx; }
     }
+    return mem_Tracker__no_site;
+};
 
-    // clang-format off
-    // Log the remap operation
-    let_ignore = fprintf(mem_Tracker_s_instance.log_file, "REMAP: %p (%zu bytes) -> %p (%zu bytes) at %s:%d in %s\n",
-        old_ptr, old_size, new_ptr, new_size, src_loc.file_name, src_loc.line, src_loc.fn_name
-    );
-    // clang-format on
+fn_((mem_Tracker__eqlSrcLoc(SrcLoc lhs, SrcLoc rhs))(bool)) {
+    if (lhs.line != rhs.line) { return false; }
+    if (lhs.file_name == rhs.file_name && lhs.fn_name == rhs.fn_name) { return true; }
+    return mem_eqlBytes(mem_spanZ0$u8(ptrCast$((const u8*)(lhs.file_name))), mem_spanZ0$u8(ptrCast$((const u8*)(rhs.file_name))))
+        && mem_eqlBytes(mem_spanZ0$u8(ptrCast$((const u8*)(lhs.fn_name))), mem_spanZ0$u8(ptrCast$((const u8*)(rhs.fn_name))));
+};
+
+fn_((mem_Tracker__countAlloc(u32 site_idx, usize size, usize weight))(void)) {
+    let stats = &mem_Tracker_s_instance.stats;
+    let count = weight / size;
+    atom_fetchAdd(&stats->live_bytes, weight, atom_MemOrd_monotonic);
+    atom_fetchAdd(&stats->live_count, count, atom_MemOrd_monotonic);
+    atom_fetchAdd(&stats->alloc_bytes, weight, atom_MemOrd_monotonic);
+    atom_fetchAdd(&stats->alloc_count, count, atom_MemOrd_monotonic);
+    if (site_idx == mem_Tracker__no_site) { return; }
+    let site = A_at((mem_Tracker_s_sites)[site_idx]);
+    atom_fetchAdd(&site->alloc_bytes, weight, atom_MemOrd_monotonic);
+    atom_fetchAdd(&site->alloc_count, count, atom_MemOrd_monotonic);
+};
+
+fn_((mem_Tracker__countFree(u32 site_idx, usize size, usize weight))(void)) {
+    let stats = &mem_Tracker_s_instance.stats;
+    let count = weight / size;
+    atom_fetchSub(&stats->live_bytes, weight, atom_MemOrd_monotonic);
+    atom_fetchSub(&stats->live_count, count, atom_MemOrd_monotonic);
+    if (site_idx == mem_Tracker__no_site) { return; }
+    let site = A_at((mem_Tracker_s_sites)[site_idx]);
+    atom_fetchAdd(&site->free_bytes, weight, atom_MemOrd_monotonic);
+    atom_fetchAdd(&site->free_count, count, atom_MemOrd_monotonic);
+};
+
+fn_((mem_Tracker__loadSite(const mem_Tracker__Site* site))(mem_Tracker_Site)) {
+    return (mem_Tracker_Site){
+        .src_loc = site->src_loc,
+        .alloc_bytes = atom_load(&site->alloc_bytes, atom_MemOrd_monotonic),
+        .alloc_count = atom_load(&site->alloc_count, atom_MemOrd_monotonic),
+        .free_bytes = atom_load(&site->free_bytes, atom_MemOrd_monotonic),
+        .free_count = atom_load(&site->free_count, atom_MemOrd_monotonic),
+    };
+};
+
+fn_((mem_Tracker__liveBytes(mem_Tracker_Site site))(usize)) {
+    // Counters are read one by one, so frees may briefly run ahead of allocs
+    return site.free_bytes < site.alloc_bytes ? site.alloc_bytes - site.free_bytes : 0;
+};
+
+$attr($inline_always)
+$static fn_((mem_Tracker__liveHome(P$raw ptr, usize cap))(usize)) {
+    return as$(usize)((ptrToInt(ptr) >> 4) * 0x9e3779b97f4a7c15ull) & (cap - 1);
+};
+
+fn_((mem_Tracker__filterAt(P$raw ptr))(u32*)) {
+    return A_at((mem_Tracker_s_filter)[mem_Tracker__liveHome(ptr, mem_Tracker__filter_len)]);
+};
 
-    // If we found the old allocation, update it
-    if (0 < old_size) {
-        // For remap, remove the old allocation and add a new one
-        mem_Tracker_registerFree(old_ptr, src_loc);
+fn_((mem_Tracker__findLive(P$raw ptr))(mem_Tracker__Live*)) {
+    let self = &mem_Tracker_s_instance;
+    if (self->lives_cap == 0) { return null; }
+    for (usize idx = mem_Tracker__liveHome(ptr, self->lives_cap);; idx = (idx + 1) & (self->lives_cap - 1)) {
+        let slot = &self->lives[idx];
+        if (!slot->ptr) { return null; }
+        if (slot->ptr == ptr) { return slot; }
     }
+};
 
-    // Register the new allocation if it's valid
-    if (new_ptr) {
-        mem_Tracker_registerAlloc(new_ptr, new_size, src_loc);
+fn_((mem_Tracker__insertLive(mem_Tracker__Live live))(bool)) {
+    let self = &mem_Tracker_s_instance;
+    if (self->lives_cap - self->lives_cap / 4 <= self->lives_len) {
+        // Rehash into a table twice as large
+        let new_cap = prim_max(self->lives_cap * 2, as$(usize)(mem_Tracker__lives_min_cap));
+        let new_lives = as$(mem_Tracker__Live*)(calloc(new_cap, sizeof(mem_Tracker__Live)));
+        if (!new_lives) { return false; }
+        for (usize i = 0; i < self->lives_cap; ++i) {
+            let old = &self->lives[i];
+            if (!old->ptr) { continue; }
+            var idx = mem_Tracker__liveHome(old->ptr, new_cap);
+            while (new_lives[idx].ptr) { idx = (idx + 1) & (new_cap - 1); }
+            new_lives[idx] = *old;
+        }
+        free(self->lives);
+        self->lives = new_lives;
+        self->lives_cap = new_cap;
     }
+    var idx = mem_Tracker__liveHome(live.ptr, self->lives_cap);
+    while (self->lives[idx].ptr) { idx = (idx + 1) & (self->lives_cap - 1); }
+    self->lives[idx] = live;
+    self->lives_len++;
+    return true;
 };
 
-fn_((mem_Tracker_registerFree(P$raw ptr, SrcLoc src_loc))(bool)) {
-    if (!ptr || !mem_Tracker_s_instance.log_file) { return false; }
+fn_((mem_Tracker__removeLive(mem_Tracker__Live* slot))(void)) {
+    let self = &mem_Tracker_s_instance;
+    let mask = self->lives_cap - 1;
+    // Backward-shift deletion keeps probe sequences intact without tombstones
+    var hole = as$(usize)(slot - self->lives);
+    for (usize idx = (hole + 1) & mask; self->lives[idx].ptr; idx = (idx + 1) & mask) {
+        let home = mem_Tracker__liveHome(self->lives[idx].ptr, self->lives_cap);
+        // Move the entry into the hole unless its home lies cyclically within (hole, idx]
+        if (((idx - home) & mask) < ((idx - hole) & mask)) { continue; }
+        self->lives[hole] = self->lives[idx];
+        hole = idx;
+    }
+    self->lives[hole] = lit0$((mem_Tracker__Live));
+    self->lives_len--;
+};
 
-    mem_Allocation** curr = &mem_Tracker_s_instance.allocations;
+fn_((mem_Tracker__track(P$raw ptr, usize size, usize weight, SrcLoc src_loc))(void)) {
+    let self = &mem_Tracker_s_instance;
+    let site_idx = mem_Tracker__siteIdx(src_loc);
+    let now = time_Instant_now();
 
-    // Search for the allocation
-    while (*curr && (*curr)->ptr != ptr) {
-        curr = &(*curr)->next;
+    Thrd_Mtx_lock(&self->mtx);
+    if (!self->log_file) {
+        Thrd_Mtx_unlock(&self->mtx);
+        return;
     }
-
-    if (!*curr) {
+    if (!mem_Tracker__insertLive((mem_Tracker__Live){
+            .ptr = ptr,
+            .size = size,
+            .weight = weight,
+            .site_idx = site_idx,
+            .src_loc = src_loc,
+            .timestamp = now,
+        })) {
         // clang-format off
-        // Double free or invalid free detected
-        let_ignore = fprintf(mem_Tracker_s_instance.log_file, "ERROR: DOUBLE FREE or INVALID FREE of %p at %s:%d in %s\n",
-            ptr, src_loc.file_name, src_loc.line, src_loc.fn_name
+        let_ignore = fprintf(self->log_file, "Failed to allocate memory for tracker at %s:%d\n",
+            src_loc.file_name, src_loc.line
         );
         // clang-format on
-        return false;
+        Thrd_Mtx_unlock(&self->mtx);
+        return;
     }
+    let filter = mem_Tracker__filterAt(ptr);
+    atom_store(filter, *filter + 1, atom_MemOrd_release);
+    mem_Tracker__countAlloc(site_idx, size, weight);
 
-    // Calculate elapsed time since allocation
-    let elapsed = time_Instant_durationSince(time_Instant_now(), (*curr)->timestamp);
-    let elapsed_sec = time_Duration_asSecs$f64(elapsed);
-
-    // Get the original allocation info
-    let orig_size = (*curr)->size;
-    let orig_src_loc = (*curr)->src_loc;
+    if (self->cfg.logs_events) {
+        // clang-format off
+        // Log allocation with total bytes
+        let_ignore = fprintf(self->log_file, "ALLOC: %p (%zu bytes) at %s:%d in %s (Total: %zu bytes)\n",
+            ptr, size, src_loc.file_name, src_loc.line, src_loc.fn_name, self->stats.live_bytes
+        );
+        // clang-format on
+    }
+    if (!time_Duration_isZero(self->cfg.snapshot_interval)
+        && !time_Duration_lt(time_Instant_durationSince(now, self->last_snapshot), self->cfg.snapshot_interval)) {
+        self->last_snapshot = now;
+        mem_Tracker__writeSnapshot(self);
+    }
+    Thrd_Mtx_unlock(&self->mtx);
+};
 
-    // Update stats
-    mem_Tracker_s_instance.total_allocated -= orig_size;
-    mem_Tracker_s_instance.active_allocs--;
+fn_((mem_Tracker__untrack(P$raw ptr, SrcLoc src_loc, bool reports_invalid))(usize)) {
+    let self = &mem_Tracker_s_instance;
+    /* A pointer is tracked before it escapes to the thread freeing it, so a zero
+     * counter proves it untracked. Only sampling can skip the lock: without it
+     * an untracked free is an invalid one that must be reported. */
+    if (atom_load(mem_Tracker__filterAt(ptr), atom_MemOrd_acquire) == 0
+        && atom_load(&self->cfg.sample_interval, atom_MemOrd_acquire) != 0) {
+        return 0;
+    }
+    Thrd_Mtx_lock(&self->mtx);
+    let slot = mem_Tracker__findLive(ptr);
+    if (!slot) {
+        // Unsampled allocations are never in the table
+        if (reports_invalid && self->log_file && self->cfg.sample_interval == 0) {
+            // clang-format off
+            // Double free or invalid free detected
+            let_ignore = fprintf(self->log_file, "ERROR: DOUBLE FREE or INVALID FREE of %p at %s:%d in %s\n",
+                ptr, src_loc.file_name, src_loc.line, src_loc.fn_name
+            );
+            // clang-format on
+        }
+        Thrd_Mtx_unlock(&self->mtx);
+        return 0;
+    }
+    let live = *slot;
+    mem_Tracker__removeLive(slot);
+    let filter = mem_Tracker__filterAt(ptr);
+    atom_store(filter, *filter - 1, atom_MemOrd_monotonic);
+    mem_Tracker__countFree(live.site_idx, live.size, live.weight);
+
+    if (reports_invalid && self->cfg.logs_events) {
+        // Calculate elapsed time since allocation
+        let elapsed_sec = time_Duration_asSecs$f64(time_Instant_durationSince(time_Instant_now(), live.timestamp));
+        // clang-format off
+        // Log deallocation with details
+        let_ignore = fprintf(self->log_file,
+            "FREE: %p (%zu bytes) at %s:%d in %s\n"
+            "      Originally allocated at %s:%d in %s (%.2f seconds ago)\n"
+            "      (Total remaining: %zu bytes)\n",
+            ptr, live.size, src_loc.file_name, src_loc.line, src_loc.fn_name,
+            live.src_loc.file_name, live.src_loc.line, live.src_loc.fn_name, elapsed_sec,
+            self->stats.live_bytes
+        );
+        // clang-format on
+    }
+    Thrd_Mtx_unlock(&self->mtx);
+    return live.size;
+};
 
+fn_((mem_Tracker__writeSnapshot(mem_Tracker* self))(void)) {
+    let stats = mem_Tracker_stats();
     // clang-format off
-    // Log deallocation with details
-    let_ignore = fprintf(mem_Tracker_s_instance.log_file,
-        "FREE: %p (%zu bytes) at %s:%d in %s\n"
-        "      Originally allocated at %s:%d in %s (%.2f seconds ago)\n"
-        "      (Total remaining: %zu bytes)\n",
-        ptr, orig_size, src_loc.file_name, src_loc.line, src_loc.fn_name,
-        orig_src_loc.file_name, orig_src_loc.line, orig_src_loc.fn_name, elapsed_sec,
-        mem_Tracker_s_instance.total_allocated
+    let_ignore = fprintf(self->log_file,
+        "SNAPSHOT at %.3f seconds: %zu bytes live in %zu allocations (%zu bytes in %zu allocations total)\n",
+        time_Duration_asSecs$f64(time_Instant_elapsed(self->started_at)),
+        stats.live_bytes, stats.live_count, stats.alloc_bytes, stats.alloc_count
     );
     // clang-format on
-
-    // Remove from list
-    mem_Allocation* to_free = *curr;
-    *curr = to_free->next;
-    free(to_free);
-    return true;
-};
-
-fn_((mem_Tracker_instance(void))(mem_Tracker*)) {
-    return &mem_Tracker_s_instance;
+    var_(top, A$$(mem_Tracker_Cfg_default_snapshot_sites * 4, mem_Tracker_Site)) = A_zero();
+    let top_sites = A_ref$((S$mem_Tracker_Site)(top));
+    let top_len = mem_Tracker__topSites(S_prefix((top_sites)(prim_min(as$(usize)(self->cfg.snapshot_sites), top_sites.len))));
+    for_(($r(0, top_len))(i) {
+        let site = A_at((top)[i]);
+        // clang-format off
+        let_ignore = fprintf(self->log_file, "  %12zu bytes live, %10zu allocs, %10zu frees  %s:%d in %s\n",
+            mem_Tracker__liveBytes(*site), site->alloc_count, site->free_count,
+            site->src_loc.file_name, site->src_loc.line, site->src_loc.fn_name
+        );
+        // clang-format on
+    });
+    let_ignore = fflush(self->log_file);
 };
 
 #endif /* defined(MEM_NO_TRACE_ALLOC_AND_FREE) || !debug_comp_enabled */
@@ -1,4 +1,5 @@
 #include "dh/mem/common.h"
+#include "dh/simd.h"
 
 fn_((mem_copyBytes(S$u8 dst, S_const$u8 src))(S$u8)) {
     claim_assert_nonnullS(dst);
@@ -15,8 +16,7 @@ fn_((mem_copy(u_S$raw dst, u_S_const$raw src))(u_S$raw)) {
     claim_assert_nonnullS(dst);
     claim_assert_nonnullS(src);
     claim_assert(TypeInfo_eq(dst.type, src.type));
-    for_(($us(u_sliceS(dst, $r(0, src.len))), $us(src))(d, s) { u_memcpy(d, s); });
-    return dst;
+    return u_memcpyS(u_sliceS(dst, $r(0, src.len)), src), dst;
 };
 
 fn_((mem_moveBytes(S$u8 dst, S_const$u8 src))(S$u8)) {
@@ -34,8 +34,7 @@ fn_((mem_move(u_S$raw dst, u_S_const$raw src))(u_S$raw)) {
     claim_assert_nonnullS(dst);
     claim_assert_nonnullS(src);
     claim_assert(TypeInfo_eq(dst.type, src.type));
-    for_(($us(u_sliceS(dst, $r(0, src.len))), $us(src))(d, s) { u_memmove(d, s); });
-    return dst;
+    return u_memmoveS(u_sliceS(dst, $r(0, src.len)), src), dst;
 };
 
 fn_((mem_setBytes(S$u8 dst, u8 val))(S$u8)) {
@@ -52,7 +51,15 @@ fn_((mem_set(u_S$raw dst, u_V$raw val))(u_S$raw)) {
     claim_assert_nonnullS(dst);
     claim_assert_nonnull(val.inner);
     claim_assert(TypeInfo_eq(dst.type, val.inner_type));
-    for_(($us(dst))(elem) { u_memset(elem, val); });
+    if (dst.len == 0) { return dst; }
+    u_memset(u_atS(dst, 0), val);
+    // Double the filled prefix with bulk copies: O(log N) memcpy calls
+    var_(filled, usize) = 1;
+    while (filled < dst.len) {
+        let n = prim_min(filled, dst.len - filled);
+        u_memcpyS(u_sliceS(dst, $r(filled, filled + n)), u_prefixS(dst, n).as_const);
+        filled += n;
+    }
     return dst;
 };
 
@@ -281,6 +288,138 @@ fn_((mem_endsWith(u_S_const$raw haystack, u_S_const$raw needle))(bool)) {
     }) $unscoped_(expr);
 };
 
+/* --- Byte Search --- */
+
+typedef Vec$$(mem_search_lanes, u8) mem__Lanes;
+
+$attr($inline_always)
+$static fn_((mem__loadLanes(const u8* ptr))(mem__Lanes)) {
+    var_(lanes, mem__Lanes);
+    prim_memcpy(&lanes, ptr, sizeOf$(mem__Lanes));
+    return lanes;
+};
+
+$attr($inline_always)
+$static fn_((mem__splatLanes(u8 byte))(mem__Lanes)) {
+    return Vec_splat$((mem__Lanes)(byte));
+};
+
+fn_((mem_idxByte(S_const$u8 haystack, u8 byte))(O$usize) $scope) {
+    claim_assert_nonnullS(haystack);
+    let needle = mem__splatLanes(byte);
+    var_(idx, usize) = 0;
+    for (; idx + mem_search_lanes <= haystack.len; idx += mem_search_lanes) {
+        let mask = Vec_moveMaskBytes(Vec_eq(mem__loadLanes(haystack.ptr + idx), needle));
+        if (mask != 0) { return_some(idx + mem_trailingZeros32(mask)); }
+    }
+    for (; idx < haystack.len; ++idx) {
+        if (haystack.ptr[idx] == byte) { return_some(idx); }
+    }
+    return_none();
+} $unscoped_(fn);
+
+fn_((mem_idxLastByte(S_const$u8 haystack, u8 byte))(O$usize) $scope) {
+    claim_assert_nonnullS(haystack);
+    let needle = mem__splatLanes(byte);
+    var_(end, usize) = haystack.len;
+    for (; mem_search_lanes <= end; end -= mem_search_lanes) {
+        let mask = Vec_moveMaskBytes(Vec_eq(mem__loadLanes(haystack.ptr + end - mem_search_lanes), needle));
+        if (mask != 0) { return_some(end - mem_search_lanes + (31 - mem_leadingZeros32(mask))); }
+    }
+    while (0 < end) {
+        if (haystack.ptr[--end] == byte) { return_some(end); }
+    }
+    return_none();
+} $unscoped_(fn);
+
+fn_((mem_idxAnyByte2(S_const$u8 haystack, u8 byte0, u8 byte1))(O$usize) $scope) {
+    claim_assert_nonnullS(haystack);
+    let needle0 = mem__splatLanes(byte0);
+    let needle1 = mem__splatLanes(byte1);
+    var_(idx, usize) = 0;
+    for (; idx + mem_search_lanes <= haystack.len; idx += mem_search_lanes) {
+        let lanes = mem__loadLanes(haystack.ptr + idx);
+        let mask = Vec_moveMaskBytes(Vec_or(Vec_eq(lanes, needle0), Vec_eq(lanes, needle1)));
+        if (mask != 0) { return_some(idx + mem_trailingZeros32(mask)); }
+    }
+    for (; idx < haystack.len; ++idx) {
+        let c = haystack.ptr[idx];
+        if (c == byte0 || c == byte1) { return_some(idx); }
+    }
+    return_none();
+} $unscoped_(fn);
+
+fn_((mem_idxAnyByte3(S_const$u8 haystack, u8 byte0, u8 byte1, u8 byte2))(O$usize) $scope) {
+    claim_assert_nonnullS(haystack);
+    let needle0 = mem__splatLanes(byte0);
+    let needle1 = mem__splatLanes(byte1);
+    let needle2 = mem__splatLanes(byte2);
+    var_(idx, usize) = 0;
+    for (; idx + mem_search_lanes <= haystack.len; idx += mem_search_lanes) {
+        let lanes = mem__loadLanes(haystack.ptr + idx);
+        let mask = Vec_moveMaskBytes(Vec_or(
+            Vec_or(Vec_eq(lanes, needle0), Vec_eq(lanes, needle1)),
+            Vec_eq(lanes, needle2)
+        ));
+        if (mask != 0) { return_some(idx + mem_trailingZeros32(mask)); }
+    }
+    for (; idx < haystack.len; ++idx) {
+        let c = haystack.ptr[idx];
+        if (c == byte0 || c == byte1 || c == byte2) { return_some(idx); }
+    }
+    return_none();
+} $unscoped_(fn);
+
+fn_((mem_idxAnyBytes(S_const$u8 haystack, S_const$u8 set))(O$usize) $scope) {
+    claim_assert_nonnullS(haystack);
+    switch (set.len) {
+    case 0: return_none();
+    case 1: return_(mem_idxByte(haystack, set.ptr[0]));
+    case 2: return_(mem_idxAnyByte2(haystack, set.ptr[0], set.ptr[1]));
+    case 3: return_(mem_idxAnyByte3(haystack, set.ptr[0], set.ptr[1], set.ptr[2]));
+    default: break;
+    }
+    // Larger sets: one membership table lookup per byte
+    var_(is_member, A$$(256, bool)) = A_zero();
+    for_(($s(set))(c) { *A_at((is_member)[*c]) = true; });
+    for_(($s(haystack), $rf(0))(c, idx) {
+        if (*A_at((is_member)[*c])) { return_some(idx); }
+    });
+    return_none();
+} $unscoped_(fn);
+
+fn_((mem_idxBytes(S_const$u8 haystack, S_const$u8 needle))(O$usize) $scope) {
+    claim_assert_nonnullS(haystack);
+    claim_assert_nonnullS(needle);
+    if (needle.len == 0) { return_some(0); }
+    if (haystack.len < needle.len) { return_none(); }
+    if (needle.len == 1) { return_(mem_idxByte(haystack, needle.ptr[0])); }
+    let last_off = needle.len - 1;
+    let first_byte = needle.ptr[0];
+    let last_byte = needle.ptr[last_off];
+    let first = mem__splatLanes(first_byte);
+    let last = mem__splatLanes(last_byte);
+    // Candidate starts are [0, cand_end); vector loads at `idx + last_off` stay in bounds
+    let cand_end = haystack.len - last_off;
+    var_(idx, usize) = 0;
+    for (; idx + mem_search_lanes <= cand_end; idx += mem_search_lanes) {
+        var mask = Vec_moveMaskBytes(Vec_and(
+            Vec_eq(mem__loadLanes(haystack.ptr + idx), first),
+            Vec_eq(mem__loadLanes(haystack.ptr + idx + last_off), last)
+        ));
+        while (mask != 0) {
+            let cand = idx + mem_trailingZeros32(mask);
+            if (prim_memcmp(haystack.ptr + cand + 1, needle.ptr + 1, last_off - 1) == 0) { return_some(cand); }
+            mask &= mask - 1;
+        }
+    }
+    for (; idx < cand_end; ++idx) {
+        if (haystack.ptr[idx] != first_byte || haystack.ptr[idx + last_off] != last_byte) { continue; }
+        if (prim_memcmp(haystack.ptr + idx + 1, needle.ptr + 1, last_off - 1) == 0) { return_some(idx); }
+    }
+    return_none();
+} $unscoped_(fn);
+
 fn_((mem_tokenizeValue(u_S_const$raw buf, u_V$raw value, V$mem_TokenIter$raw ret_mem))(V$mem_TokenIter$raw)) {
     claim_assert_nonnull(ret_mem);
     ret_mem->buf = buf.raw;
@@ -352,6 +491,21 @@ $static fn_((mem_TokenIter__isDelim(mem_TokenIter$raw* self, TypeInfo type, usiz
     }) $unscoped_(expr);
 };
 
+/// Byte-sized elements only: finds the next delimiter at or after `from` with the byte-search kernels
+$static fn_((mem_TokenIter__idxDelimByte(mem_TokenIter$raw* self, usize from))(O$usize) $scope) {
+    claim_assert_nonnull(self);
+    let haystack = (S_const$u8){ .ptr = as$(const u8*)(self->buf.ptr) + from, .len = self->buf.len - from };
+    let found = expr_(O$usize $scope)(switch (self->delim_type) {
+        case mem_delimType_value:
+            $break_(mem_idxByte(haystack, *self->delim.value.inner));
+        case mem_delimType_pattern:
+            $break_(mem_idxBytes(haystack, (S_const$u8){ .ptr = as$(const u8*)(self->delim.pattern.ptr), .len = self->delim.pattern.len }));
+        case mem_delimType_choice:
+            $break_(mem_idxAnyBytes(haystack, (S_const$u8){ .ptr = as$(const u8*)(self->delim.choice.ptr), .len = self->delim.choice.len }));
+    }) $unscoped_(expr);
+    return_some(from + orelse_((found)(return_none())));
+} $unscoped_(fn);
+
 fn_((mem_TokenIter_reset(mem_TokenIter$raw* self))(void)) { claim_assert_nonnull(self), self->idx = 0; };
 
 fn_((mem_TokenIter_next(mem_TokenIter$raw* self, TypeInfo type))(O$u_S_const$raw) $scope) {
@@ -373,7 +527,11 @@ fn_((mem_TokenIter_peek(mem_TokenIter$raw* self, TypeInfo type))(O$u_S_const$raw
     let begin = self->idx;
     if (begin == self->buf.len) return_none();
     var end = begin;
-    while (end < self->buf.len && !mem_TokenIter__isDelim(self, type, end)) end++;
+    if (type.size == 1) {
+        end = orelse_((mem_TokenIter__idxDelimByte(self, begin))(self->buf.len));
+    } else {
+        while (end < self->buf.len && !mem_TokenIter__isDelim(self, type, end)) end++;
+    }
     return_some(u_sliceS(mem_TokenIter__buf(self, type), $r(begin, end)));
 } $unscoped_(fn);
 
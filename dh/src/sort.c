@@ -1,6 +1,7 @@
 #include "dh/sort.h"
 #include "dh/search.h"
 #include "dh/mem/common.h"
+#include "dh/Thrd/Pool.h"
 
 /*========== Internal Declarations & Definitions ============================*/
 
@@ -533,7 +534,7 @@ fn_((sort_blockCtx(u_S$raw seq, sort_OrdCtxFn ordFn, u_P_const$raw ctx))(void))
     var_(cache_buf, A$$(sort_limit_block_cache_stack_bytes, u8)) $align(16) = A_zero();
     let cache_cap = (0 < seq.type.size) ? (sort_limit_block_cache_stack_bytes / seq.type.size) : 0;
     let_(cache, u_S$raw) = u_init$S((seq.type)(A_ptr(cache_buf), cache_cap));
-    $ignore_void sort_blockCtxCache(cache, seq, ordFn, ctx);
+    let_ignore = sort_blockCtxCache(cache, seq, ordFn, ctx);
 };
 
 fn_((sort_blockCache(u_S$raw cache, u_S$raw seq, sort_OrdFn ordFn))(u_S$raw)) {
@@ -719,3 +720,721 @@ fn_((sort_block__mergeExternal(
         );
     }
 };
+
+/*========== External Definitions: Parallel Sort ============================*/
+
+/* --- Internal Declarations --- */
+
+/* Shared by every task of one `sort_pdqPar` call */
+typedef struct sort_pdqPar__Job {
+    Thrd_Pool* pool;
+    sort_IdxCtx idx_ctx;
+    /* start of the whole sequence; anything before a task's range is <= its elements */
+    usize seq_begin;
+} sort_pdqPar__Job;
+/* Result of partitioning one chunk against a pivot outside of it */
+typedef struct sort_pdqPar__Split {
+    usize mid;
+    bool was_partitioned;
+} sort_pdqPar__Split;
+
+$static Thrd_fn_(sort_pdqPar__task, ({ const sort_pdqPar__Job* job; R range; usize limit; }, Void));
+$static Thrd_fn_(sort_pdqPar__partChunk, ({ sort_IdxCtx idx_ctx; R chunk; usize pivot; sort_pdqPar__Split* split; }, Void));
+/* Sorts `range`, forking the smaller side of each partition onto the pool */
+$static fn_((sort_pdqPar__sort(const sort_pdqPar__Job* job, R range, usize limit))(void));
+/* Same contract as `sort_pdq__part`; large ranges are split into chunks partitioned in parallel */
+$static fn_((sort_pdqPar__part(const sort_pdqPar__Job* job, R range, usize* pivot))(bool));
+/* Hoare partition of `chunk` into elements < `items[pivot]` then >=; `pivot` lies outside `chunk` */
+$static fn_((sort_pdqPar__partSeq(R chunk, usize pivot, sort_IdxCtx idx_ctx))(sort_pdqPar__Split));
+
+/* Shared by every task of one `sort_blockPar` call */
+typedef struct sort_blockPar__Job {
+    sort_OrdCtxFn ordFn;
+    u_P_const$raw ctx;
+} sort_blockPar__Job;
+
+$static Thrd_fn_(sort_blockPar__sortRun, ({ const sort_blockPar__Job* job; u_S$raw run; u_S$raw cache; }, Void));
+/* Merges output positions [`out.begin`, `out.end`) of runs `left` ++ `right` from `src` into `dst` */
+$static Thrd_fn_(sort_blockPar__mergePiece, ({
+    const sort_blockPar__Job* job;
+    u_S_const$raw src;
+    u_S$raw dst;
+    R left;
+    R right;
+    R out;
+}, Void));
+$static Thrd_fn_(sort_blockPar__copy, ({ u_S$raw dst; u_S_const$raw src; }, Void));
+/* Number of elements `left` contributes to the first `k` of the stable merge of `left` ++ `right` */
+$static fn_((sort_blockPar__coRank(const sort_blockPar__Job* job, u_S_const$raw left, u_S_const$raw right, usize k))(usize));
+
+/* --- External Definitions --- */
+
+fn_((sort_pdqPar(Thrd_Pool* pool, u_S$raw seq, sort_OrdFn ordFn))(void)) {
+    let_(no_ctx, sort__OrdNoCtxFnAsCtx) = { .ordFn = ordFn };
+    sort_pdqParCtx(pool, seq, wrapFn$(sort_OrdCtxFn, sort__ordNoCtx), u_anyP(&no_ctx));
+};
+
+fn_((sort_pdqParCtx(Thrd_Pool* pool, u_S$raw seq, sort_OrdCtxFn ordFn, u_P_const$raw ctx))(void)) {
+    if (seq.len <= sort_threshold_par_grain || Thrd_Pool_thrdCount(pool) <= 1) {
+        sort_pdqCtx(seq, ordFn, ctx);
+        return;
+    }
+    let_(inner, sort_IdxCtx__Inner) = { .seq = seq, .ordFn = ordFn, .ctx = ctx };
+    let_(job, sort_pdqPar__Job) = {
+        .pool = pool,
+        .idx_ctx = {
+            .inner = u_anyP(&inner),
+            .ordFn = wrapFn(sort_IdxCtx__Inner_ord),
+            .swapFn = wrapFn(sort_IdxCtx__Inner_swap),
+        },
+        .seq_begin = 0,
+    };
+    /* bad-pivot budget of log2(N), as in pdqsort */
+    var_(limit, usize) = 0;
+    for (usize n = seq.len; n > 1; n >>= 1) limit++;
+    sort_pdqPar__sort(&job, $rt(seq.len), limit);
+};
+
+fn_((sort_blockPar(Thrd_Pool* pool, mem_Allocator gpa, u_S$raw seq, sort_OrdFn ordFn))(mem_Err$u_S$raw)) {
+    let_(no_ctx, sort__OrdNoCtxFnAsCtx) = { .ordFn = ordFn };
+    return sort_blockParCtx(pool, gpa, seq, wrapFn$(sort_OrdCtxFn, sort__ordNoCtx), u_anyP(&no_ctx));
+};
+
+fn_((sort_blockParCtx(
+    Thrd_Pool* pool, mem_Allocator gpa, u_S$raw seq, sort_OrdCtxFn ordFn, u_P_const$raw ctx
+))(mem_Err$u_S$raw) $guard) {
+    let workers = Thrd_Pool_thrdCount(pool);
+    if (seq.len <= sort_threshold_par_grain || workers <= 1) {
+        return_ok(try_(sort_blockCtxAlloc(gpa, seq, ordFn, ctx)));
+    }
+    let buf = try_(mem_Allocator_alloc(gpa, seq.type, seq.len));
+    defer_(mem_Allocator_free(gpa, buf));
+    let_(job, sort_blockPar__Job) = { .ordFn = ordFn, .ctx = ctx };
+
+    /* run boundaries: `bounds[i]..bounds[i + 1]` */
+    let run_count = prim_min(
+        prim_min(as$(usize)(sort_limit_par_chunks), workers * 2),
+        (seq.len + sort_threshold_par_grain - 1) / sort_threshold_par_grain
+    );
+    var_(bounds, A$$(sort_limit_par_chunks + 1, usize)) = A_zero();
+    for_(($r(0, run_count + 1))(i) { *A_at((bounds)[i]) = seq.len * i / run_count; });
+
+    /* sort each run, using its share of `buf` as the merge cache */
+    var_(sorts, A$$(sort_limit_par_chunks, Thrd_FnCtx$(sort_blockPar__sortRun))) = A_zero();
+    Thrd_Pool_scope(pool, scope) {
+        for_(($r(0, run_count))(i) {
+            let run = $r(*A_at((bounds)[i]), *A_at((bounds)[i + 1]));
+            *A_at((sorts)[i]) = Thrd_FnCtx_from$((sort_blockPar__sortRun)(&job, u_sliceS(seq, run), u_sliceS(buf, run)));
+            Thrd_Pool_Scope_spawn(&scope, A_at((sorts)[i])->as_raw);
+        });
+    }
+
+    /* merge adjacent runs pairwise, alternating between `seq` and `buf` */
+    var_(merges, A$$(sort_limit_par_chunks, Thrd_FnCtx$(sort_blockPar__mergePiece))) = A_zero();
+    var_(copy, Thrd_FnCtx$(sort_blockPar__copy)) = {};
+    var_(src, u_S$raw) = seq;
+    var_(dst, u_S$raw) = buf;
+    var_(runs, usize) = run_count;
+    while (runs > 1) {
+        let pairs = runs / 2;
+        let pieces_per_pair = prim_max(as$(usize)(1), prim_min(as$(usize)(sort_limit_par_chunks), workers * 2) / pairs);
+        var_(merge_count, usize) = 0;
+        Thrd_Pool_scope(pool, scope) {
+            for_(($r(0, pairs))(pair) {
+                let left = $r(*A_at((bounds)[pair * 2]), *A_at((bounds)[pair * 2 + 1]));
+                let right = $r(left.end, *A_at((bounds)[pair * 2 + 2]));
+                let total = R_len(left) + R_len(right);
+                for_(($r(0, pieces_per_pair))(piece) {
+                    let out = $r(total * piece / pieces_per_pair, total * (piece + 1) / pieces_per_pair);
+                    let merge = A_at((merges)[merge_count++]);
+                    *merge = Thrd_FnCtx_from$((sort_blockPar__mergePiece)(&job, src.as_const, dst, left, right, out));
+                    Thrd_Pool_Scope_spawn(&scope, merge->as_raw);
+                });
+            });
+            /* an odd run out just moves across */
+            if (runs % 2 == 1) {
+                let tail = $r(*A_at((bounds)[runs - 1]), *A_at((bounds)[runs]));
+                copy = Thrd_FnCtx_from$((sort_blockPar__copy)(u_sliceS(dst, tail), u_sliceS(src, tail).as_const));
+                Thrd_Pool_Scope_spawn(&scope, copy.as_raw);
+            }
+        }
+        for_(($r(0, (runs + 1) / 2))(i) { *A_at((bounds)[i]) = *A_at((bounds)[prim_min(i * 2, runs)]); });
+        *A_at((bounds)[(runs + 1) / 2]) = seq.len;
+        runs = (runs + 1) / 2;
+        let swap = src;
+        src = dst;
+        dst = swap;
+    }
+    if (src.ptr != seq.ptr) {
+        /* the result ended up in `buf`: copy it back in worker-sized slices */
+        var_(copies, A$$(sort_limit_par_chunks, Thrd_FnCtx$(sort_blockPar__copy))) = A_zero();
+        let copy_count = prim_min(as$(usize)(sort_limit_par_chunks), workers);
+        Thrd_Pool_scope(pool, scope) {
+            for_(($r(0, copy_count))(i) {
+                let part = $r(seq.len * i / copy_count, seq.len * (i + 1) / copy_count);
+                *A_at((copies)[i]) = Thrd_FnCtx_from$((sort_blockPar__copy)(u_sliceS(seq, part), u_sliceS(buf, part).as_const));
+                Thrd_Pool_Scope_spawn(&scope, A_at((copies)[i])->as_raw);
+            });
+        }
+    }
+    return_ok(seq);
+} $unguarded_(fn);
+
+/* --- Internal Definitions --- */
+
+Thrd_fn_(sort_pdqPar__task, ($ignore, args)$scope) {
+    sort_pdqPar__sort(args->job, args->range, args->limit);
+    return_({});
+} $unscoped_(Thrd_fn);
+
+fn_((sort_pdqPar__sort(const sort_pdqPar__Job* job, R range, usize limit))(void)) {
+    let idx_ctx = job->idx_ctx;
+    var scope = Thrd_Pool_Scope_init(job->pool);
+    var_(forks, A$$(32, Thrd_FnCtx$(sort_pdqPar__task))) = A_zero();
+    var_(fork_count, usize) = 0;
+    var_(was_balanced, bool) = true;
+    var_(was_partitioned, bool) = true;
+
+    while (true) {
+        let len = R_len(range);
+        /* sequential pdqsort keeps its own bad-pivot budget and heapsort fallback */
+        if (len <= sort_threshold_par_grain || limit == 0) {
+            sort_pdqIdx(range, idx_ctx);
+            break;
+        }
+        if (!was_balanced) {
+            sort_pdq__breakPatterns(range, idx_ctx);
+            limit--;
+        }
+
+        var_(pivot, usize) = 0;
+        var_(hint, u8) = sort_pdq__choosePivot(range, &pivot, idx_ctx);
+        if (hint == 1) { /* decreasing */
+            sort_pdq__reverseRange(range, idx_ctx);
+            pivot = (range.end - 1) - (pivot - range.begin);
+            hint = 0;
+        }
+        if (was_balanced && was_partitioned && hint == 0) {
+            if (sort_pdq__insertPartial(range, idx_ctx)) break;
+        }
+        /* the predecessor is a pivot fixed by an earlier partition (or an element equal
+         * to one), so reading it does not race with sibling tasks */
+        if (range.begin > job->seq_begin) {
+            let ord = sort_IdxCtx_ord(idx_ctx, range.begin - 1, pivot);
+            if (!cmp_Ord_isLt(ord)) {
+                range.begin = sort_pdq__partEq(range, pivot, idx_ctx);
+                continue;
+            }
+        }
+
+        var mid = pivot;
+        was_partitioned = sort_pdqPar__part(job, range, &mid);
+        let left = $r(range.begin, mid);
+        let right = $r(mid + 1, range.end);
+        was_balanced = prim_min(R_len(left), R_len(right)) >= len / 8;
+
+        /* keep the larger side, hand the smaller one to the pool */
+        let smaller = R_len(left) < R_len(right) ? left : right;
+        range = R_len(left) < R_len(right) ? right : left;
+        if (fork_count < A_len(forks)) {
+            let fork = A_at((forks)[fork_count++]);
+            *fork = Thrd_FnCtx_from$((sort_pdqPar__task)(job, smaller, limit));
+            Thrd_Pool_Scope_spawn(&scope, fork->as_raw);
+        } else {
+            sort_pdqPar__sort(job, smaller, limit);
+        }
+    }
+    Thrd_Pool_Scope_wait(&scope);
+};
+
+fn_((sort_pdqPar__part(const sort_pdqPar__Job* job, R range, usize* pivot))(bool)) {
+    let idx_ctx = job->idx_ctx;
+    let chunk_count = prim_min(
+        prim_min(as$(usize)(sort_limit_par_chunks), Thrd_Pool_thrdCount(job->pool)),
+        R_len(range) / sort_threshold_par_grain
+    );
+    if (chunk_count <= 1) return sort_pdq__part(range, pivot, idx_ctx);
+
+    /* park the pivot at the front; the chunks partition everything after it */
+    sort_IdxCtx_swap(idx_ctx, range.begin, *pivot);
+    let body = $r(range.begin + 1, range.end);
+    var_(chunks, A$$(sort_limit_par_chunks, R)) = A_zero();
+    var_(splits, A$$(sort_limit_par_chunks, sort_pdqPar__Split)) = A_zero();
+    var_(tasks, A$$(sort_limit_par_chunks, Thrd_FnCtx$(sort_pdqPar__partChunk))) = A_zero();
+    Thrd_Pool_scope(job->pool, scope) {
+        for_(($r(0, chunk_count))(i) {
+            *A_at((chunks)[i]) = $r(
+                body.begin + R_len(body) * i / chunk_count,
+                body.begin + R_len(body) * (i + 1) / chunk_count
+            );
+            *A_at((tasks)[i]) = Thrd_FnCtx_from$((sort_pdqPar__partChunk)(
+                idx_ctx, *A_at((chunks)[i]), range.begin, A_at((splits)[i])
+            ));
+            Thrd_Pool_Scope_spawn(&scope, A_at((tasks)[i])->as_raw);
+        });
+    }
+
+    /* every chunk is now [< pivot | >= pivot]; everything < pivot belongs below `boundary` */
+    var_(boundary, usize) = body.begin;
+    var_(was_partitioned, bool) = true;
+    for_(($r(0, chunk_count))(i) {
+        boundary += A_at((splits)[i])->mid - A_at((chunks)[i])->begin;
+        was_partitioned = was_partitioned && A_at((splits)[i])->was_partitioned;
+    });
+    /* swap the ">=" pieces below `boundary` with the "<" pieces at or above it; both sides hold
+     * the same number of misplaced elements, and they are met in chunk order */
+    var_(lo_chunk, usize) = 0;
+    var_(hi_chunk, usize) = 0;
+    var_(lo, usize) = A_at((splits)[0])->mid;
+    var_(hi, usize) = prim_max(A_at((chunks)[0])->begin, boundary);
+    while (true) {
+        while (lo_chunk < chunk_count && (lo >= prim_min(A_at((chunks)[lo_chunk])->end, boundary))) {
+            if (++lo_chunk < chunk_count) lo = A_at((splits)[lo_chunk])->mid;
+        }
+        while (hi_chunk < chunk_count && hi >= A_at((splits)[hi_chunk])->mid) {
+            if (++hi_chunk < chunk_count) hi = prim_max(A_at((chunks)[hi_chunk])->begin, boundary);
+        }
+        if (lo_chunk == chunk_count || hi_chunk == chunk_count) break;
+        sort_IdxCtx_swap(idx_ctx, lo++, hi++);
+        was_partitioned = false;
+    }
+
+    /* the last "<" element trades places with the pivot */
+    let mid = boundary - 1;
+    sort_IdxCtx_swap(idx_ctx, range.begin, mid);
+    *pivot = mid;
+    return was_partitioned;
+};
+
+Thrd_fn_(sort_pdqPar__partChunk, ($ignore, args)$scope) {
+    *args->split = sort_pdqPar__partSeq(args->chunk, args->pivot, args->idx_ctx);
+    return_({});
+} $unscoped_(Thrd_fn);
+
+fn_((sort_pdqPar__partSeq(R chunk, usize pivot, sort_IdxCtx idx_ctx))(sort_pdqPar__Split)) {
+    var lo = chunk.begin;
+    var hi = chunk.end;
+    var_(was_partitioned, bool) = true;
+    while (true) {
+        while (lo < hi && cmp_Ord_isLt(sort_IdxCtx_ord(idx_ctx, lo, pivot))) lo++;
+        while (lo < hi && !cmp_Ord_isLt(sort_IdxCtx_ord(idx_ctx, hi - 1, pivot))) hi--;
+        if (lo >= hi) break;
+        sort_IdxCtx_swap(idx_ctx, lo++, --hi);
+        was_partitioned = false;
+    }
+    return (sort_pdqPar__Split){ .mid = lo, .was_partitioned = was_partitioned };
+};
+
+Thrd_fn_(sort_blockPar__sortRun, ($ignore, args)$scope) {
+    let_ignore = sort_blockCtxCache(args->cache, args->run, args->job->ordFn, args->job->ctx);
+    return_({});
+} $unscoped_(Thrd_fn);
+
+Thrd_fn_(sort_blockPar__mergePiece, ($ignore, args)$scope) {
+    let job = args->job;
+    let left = u_sliceS(args->src, args->left);
+    let right = u_sliceS(args->src, args->right);
+    var l = sort_blockPar__coRank(job, left, right, args->out.begin);
+    var r = args->out.begin - l;
+    for_(($r(args->left.begin + args->out.begin, args->left.begin + args->out.end))(dst_idx) {
+        /* stable: on ties the left run goes first */
+        let takes_right = l == left.len
+                       || (r < right.len && cmp_Ord_isLt(sort__ord(job->ordFn, u_atS(right, r), u_atS(left, l), job->ctx)));
+        if (takes_right) {
+            u_memcpy(u_atS(args->dst, dst_idx), u_atS(right, r));
+            r++;
+        } else {
+            u_memcpy(u_atS(args->dst, dst_idx), u_atS(left, l));
+            l++;
+        }
+    });
+    return_({});
+} $unscoped_(Thrd_fn);
+
+Thrd_fn_(sort_blockPar__copy, ($ignore, args)$scope) {
+    u_memcpyS(args->dst, args->src);
+    return_({});
+} $unscoped_(Thrd_fn);
+
+fn_((sort_blockPar__coRank(const sort_blockPar__Job* job, u_S_const$raw left, u_S_const$raw right, usize k))(usize)) {
+    /* smallest `i` such that `left[i]` is not output before `right[k - i - 1]` */
+    var lo = k > right.len ? k - right.len : 0;
+    var hi = prim_min(k, left.len);
+    while (lo < hi) {
+        let i = lo + (hi - lo) / 2;
+        let j = k - i;
+        let left_first = !cmp_Ord_isLt(sort__ord(job->ordFn, u_atS(right, j - 1), u_atS(left, i), job->ctx));
+        if (left_first) {
+            lo = i + 1;
+        } else {
+            hi = i;
+        }
+    }
+    return lo;
+};
+
+/*========== External Definitions: Radix Sort ===============================*/
+
+/* --- Internal Declarations --- */
+
+/* LSD passes over `seq`, ping-ponging through `tmp`; the result always lands in `seq` */
+$static fn_((sort_radix__lsd32(S$u32 seq, S$u32 tmp))(void));
+$static fn_((sort_radix__lsd64(S$u64 seq, S$u64 tmp))(void));
+/* American flag pass on the digit at `shift`, then recursion into each bucket */
+$static fn_((sort_radix__flag32(S$u32 seq, u32 shift))(void));
+$static fn_((sort_radix__flag64(S$u64 seq, u32 shift))(void));
+$static fn_((sort_radix__flagByKey(u_S$raw seq, sort_KeyFn keyFn, u32 shift))(void));
+$attr($inline_always)
+$static fn_((sort_radix__key(sort_KeyFn keyFn, u_P_const$raw item))(u64));
+
+/* Order-preserving bit remapping of signed and floating-point keys (`decode` undoes `encode`) */
+$static fn_((sort_radix__encodeI32(S$u32 bits))(void));
+$static fn_((sort_radix__encodeI64(S$u64 bits))(void));
+$static fn_((sort_radix__encodeF32(S$u32 bits))(void));
+$static fn_((sort_radix__decodeF32(S$u32 bits))(void));
+$static fn_((sort_radix__encodeF64(S$u64 bits))(void));
+$static fn_((sort_radix__decodeF64(S$u64 bits))(void));
+
+/* --- External Definitions --- */
+
+fn_((sort_radix$u32(mem_Allocator gpa, S$u32 seq))(mem_Err$void) $guard) {
+    if (seq.len <= 1) return_ok({});
+    let tmp = try_(mem_Allocator_alloc(gpa, typeInfo$(u32), seq.len));
+    defer_(mem_Allocator_free(gpa, tmp));
+    sort_radix__lsd32(seq, u_castS$((S$u32)(tmp)));
+    return_ok({});
+} $unguarded_(fn);
+
+fn_((sort_radix$u64(mem_Allocator gpa, S$u64 seq))(mem_Err$void) $guard) {
+    if (seq.len <= 1) return_ok({});
+    let tmp = try_(mem_Allocator_alloc(gpa, typeInfo$(u64), seq.len));
+    defer_(mem_Allocator_free(gpa, tmp));
+    sort_radix__lsd64(seq, u_castS$((S$u64)(tmp)));
+    return_ok({});
+} $unguarded_(fn);
+
+fn_((sort_radix$i32(mem_Allocator gpa, S$i32 seq))(mem_Err$void) $guard) {
+    if (seq.len <= 1) return_ok({});
+    let tmp = try_(mem_Allocator_alloc(gpa, typeInfo$(u32), seq.len));
+    defer_(mem_Allocator_free(gpa, tmp));
+    let bits = init$S$((u32)(ptrCast$((u32*)(seq.ptr)), seq.len));
+    sort_radix__encodeI32(bits);
+    sort_radix__lsd32(bits, u_castS$((S$u32)(tmp)));
+    sort_radix__encodeI32(bits);
+    return_ok({});
+} $unguarded_(fn);
+
+fn_((sort_radix$i64(mem_Allocator gpa, S$i64 seq))(mem_Err$void) $guard) {
+    if (seq.len <= 1) return_ok({});
+    let tmp = try_(mem_Allocator_alloc(gpa, typeInfo$(u64), seq.len));
+    defer_(mem_Allocator_free(gpa, tmp));
+    let bits = init$S$((u64)(ptrCast$((u64*)(seq.ptr)), seq.len));
+    sort_radix__encodeI64(bits);
+    sort_radix__lsd64(bits, u_castS$((S$u64)(tmp)));
+    sort_radix__encodeI64(bits);
+    return_ok({});
+} $unguarded_(fn);
+
+fn_((sort_radix$f32(mem_Allocator gpa, S$f32 seq))(mem_Err$void) $guard) {
+    if (seq.len <= 1) return_ok({});
+    let tmp = try_(mem_Allocator_alloc(gpa, typeInfo$(u32), seq.len));
+    defer_(mem_Allocator_free(gpa, tmp));
+    let bits = init$S$((u32)(ptrCast$((u32*)(seq.ptr)), seq.len));
+    sort_radix__encodeF32(bits);
+    sort_radix__lsd32(bits, u_castS$((S$u32)(tmp)));
+    sort_radix__decodeF32(bits);
+    return_ok({});
+} $unguarded_(fn);
+
+fn_((sort_radix$f64(mem_Allocator gpa, S$f64 seq))(mem_Err$void) $guard) {
+    if (seq.len <= 1) return_ok({});
+    let tmp = try_(mem_Allocator_alloc(gpa, typeInfo$(u64), seq.len));
+    defer_(mem_Allocator_free(gpa, tmp));
+    let bits = init$S$((u64)(ptrCast$((u64*)(seq.ptr)), seq.len));
+    sort_radix__encodeF64(bits);
+    sort_radix__lsd64(bits, u_castS$((S$u64)(tmp)));
+    sort_radix__decodeF64(bits);
+    return_ok({});
+} $unguarded_(fn);
+
+fn_((sort_radixByKey(mem_Allocator gpa, u_S$raw seq, sort_KeyFn keyFn))(mem_Err$void) $guard) {
+    if (seq.len <= 1) return_ok({});
+    let key_buf = try_(mem_Allocator_alloc(gpa, typeInfo$(u64), seq.len * 2));
+    defer_(mem_Allocator_free(gpa, key_buf));
+    let item_buf = try_(mem_Allocator_alloc(gpa, seq.type, seq.len));
+    defer_(mem_Allocator_free(gpa, item_buf));
+    let keys = u_castS$((S$u64)(key_buf));
+
+    /* extract every key once and count all eight digits in the same sweep */
+    var_(hist, A$$(8 * 256, usize)) = A_zero();
+    var src_keys = S_prefix((keys)(seq.len));
+    var dst_keys = S_suffix((keys)(seq.len));
+    for_(($r(0, seq.len))(i) {
+        let key = sort_radix__key(keyFn, u_atS(seq, i).as_const);
+        *S_at((src_keys)[i]) = key;
+        for_(($r(0, 8))(digit) { (*A_at((hist)[digit * 256 + ((key >> (digit * 8)) & 0xFF)]))++; });
+    });
+
+    var src = seq;
+    var dst = item_buf;
+    for_(($r(0, 8))(digit) {
+        let shift = digit * 8;
+        let counts = A_ptr(hist) + digit * 256;
+        /* every key shares this digit: the pass would be a plain copy */
+        if (counts[(*S_at((src_keys)[0]) >> shift) & 0xFF] == seq.len) continue;
+        var_(offset, usize) = 0;
+        for_(($r(0, 256))(bucket) {
+            let count = counts[bucket];
+            counts[bucket] = offset;
+            offset += count;
+        });
+        for_(($r(0, seq.len))(i) {
+            let key = *S_at((src_keys)[i]);
+            let pos = counts[(key >> shift) & 0xFF]++;
+            *S_at((dst_keys)[pos]) = key;
+            u_memcpy(u_atS(dst, pos), u_atS(src, i).as_const);
+        });
+        let swap_keys = src_keys;
+        src_keys = dst_keys;
+        dst_keys = swap_keys;
+        let swap = src;
+        src = dst;
+        dst = swap;
+    });
+    if (src.ptr != seq.ptr) u_memcpyS(seq, src.as_const);
+    return_ok({});
+} $unguarded_(fn);
+
+fn_((sort_radixFlag$u32(S$u32 seq))(void)) {
+    sort_radix__flag32(seq, 24);
+};
+
+fn_((sort_radixFlag$u64(S$u64 seq))(void)) {
+    sort_radix__flag64(seq, 56);
+};
+
+fn_((sort_radixFlag$i64(S$i64 seq))(void)) {
+    let bits = init$S$((u64)(ptrCast$((u64*)(seq.ptr)), seq.len));
+    sort_radix__encodeI64(bits);
+    sort_radix__flag64(bits, 56);
+    sort_radix__encodeI64(bits);
+};
+
+fn_((sort_radixFlag$f64(S$f64 seq))(void)) {
+    let bits = init$S$((u64)(ptrCast$((u64*)(seq.ptr)), seq.len));
+    sort_radix__encodeF64(bits);
+    sort_radix__flag64(bits, 56);
+    sort_radix__decodeF64(bits);
+};
+
+fn_((sort_radixFlagByKey(u_S$raw seq, sort_KeyFn keyFn))(void)) {
+    sort_radix__flagByKey(seq, keyFn, 56);
+};
+
+/* --- Internal Definitions --- */
+
+fn_((sort_radix__lsd32(S$u32 seq, S$u32 tmp))(void)) {
+    var_(hist, A$$(4 * 256, usize)) = A_zero();
+    for_(($s(seq))(key) {
+        for_(($r(0, 4))(digit) { (*A_at((hist)[digit * 256 + ((*key >> (digit * 8)) & 0xFF)]))++; });
+    });
+    var src = seq;
+    var dst = tmp;
+    for_(($r(0, 4))(digit) {
+        let shift = digit * 8;
+        let counts = A_ptr(hist) + digit * 256;
+        if (counts[(*S_at((src)[0]) >> shift) & 0xFF] == seq.len) continue;
+        var_(offset, usize) = 0;
+        for_(($r(0, 256))(bucket) {
+            let count = counts[bucket];
+            counts[bucket] = offset;
+            offset += count;
+        });
+        for_(($s(src))(key) { *S_at((dst)[counts[(*key >> shift) & 0xFF]++]) = *key; });
+        let swap = src;
+        src = dst;
+        dst = swap;
+    });
+    if (src.ptr != seq.ptr) u_memcpyS(u_anyS(seq), u_anyS(src).as_const);
+};
+
+fn_((sort_radix__lsd64(S$u64 seq, S$u64 tmp))(void)) {
+    var_(hist, A$$(8 * 256, usize)) = A_zero();
+    for_(($s(seq))(key) {
+        for_(($r(0, 8))(digit) { (*A_at((hist)[digit * 256 + ((*key >> (digit * 8)) & 0xFF)]))++; });
+    });
+    var src = seq;
+    var dst = tmp;
+    for_(($r(0, 8))(digit) {
+        let shift = digit * 8;
+        let counts = A_ptr(hist) + digit * 256;
+        if (counts[(*S_at((src)[0]) >> shift) & 0xFF] == seq.len) continue;
+        var_(offset, usize) = 0;
+        for_(($r(0, 256))(bucket) {
+            let count = counts[bucket];
+            counts[bucket] = offset;
+            offset += count;
+        });
+        for_(($s(src))(key) { *S_at((dst)[counts[(*key >> shift) & 0xFF]++]) = *key; });
+        let swap = src;
+        src = dst;
+        dst = swap;
+    });
+    if (src.ptr != seq.ptr) u_memcpyS(u_anyS(seq), u_anyS(src).as_const);
+};
+
+fn_((sort_radix__flag32(S$u32 seq, u32 shift))(void)) {
+    if (seq.len <= sort_threshold_radix_insert_sort) {
+        for_(($r(1, seq.len))(i) {
+            let key = *S_at((seq)[i]);
+            var j = i;
+            for (; j > 0 && key < *S_at((seq)[j - 1]); --j) *S_at((seq)[j]) = *S_at((seq)[j - 1]);
+            *S_at((seq)[j]) = key;
+        });
+        return;
+    }
+    var_(heads, A$$(256, usize)) = A_zero();
+    var_(ends, A$$(256, usize)) = A_zero();
+    for_(($s(seq))(key) { (*A_at((ends)[(*key >> shift) & 0xFF]))++; });
+    var_(offset, usize) = 0;
+    for_(($r(0, 256))(bucket) {
+        *A_at((heads)[bucket]) = offset;
+        offset += *A_at((ends)[bucket]);
+        *A_at((ends)[bucket]) = offset;
+    });
+    /* swap each misplaced key straight into the next free slot of its bucket */
+    for_(($r(0, 256))(bucket) {
+        let head = A_at((heads)[bucket]);
+        while (*head < *A_at((ends)[bucket])) {
+            let dest = (*S_at((seq)[*head]) >> shift) & 0xFF;
+            if (dest == bucket) {
+                (*head)++;
+                continue;
+            }
+            let other = S_at((seq)[(*A_at((heads)[dest]))++]);
+            let key = *S_at((seq)[*head]);
+            *S_at((seq)[*head]) = *other;
+            *other = key;
+        }
+    });
+    if (shift == 0) return;
+    var_(begin, usize) = 0;
+    for_(($r(0, 256))(bucket) {
+        let end = *A_at((ends)[bucket]);
+        if (end - begin > 1) sort_radix__flag32(S_slice((seq)$r(begin, end)), shift - 8);
+        begin = end;
+    });
+};
+
+fn_((sort_radix__flag64(S$u64 seq, u32 shift))(void)) {
+    if (seq.len <= sort_threshold_radix_insert_sort) {
+        for_(($r(1, seq.len))(i) {
+            let key = *S_at((seq)[i]);
+            var j = i;
+            for (; j > 0 && key < *S_at((seq)[j - 1]); --j) *S_at((seq)[j]) = *S_at((seq)[j - 1]);
+            *S_at((seq)[j]) = key;
+        });
+        return;
+    }
+    var_(heads, A$$(256, usize)) = A_zero();
+    var_(ends, A$$(256, usize)) = A_zero();
+    for_(($s(seq))(key) { (*A_at((ends)[(*key >> shift) & 0xFF]))++; });
+    var_(offset, usize) = 0;
+    for_(($r(0, 256))(bucket) {
+        *A_at((heads)[bucket]) = offset;
+        offset += *A_at((ends)[bucket]);
+        *A_at((ends)[bucket]) = offset;
+    });
+    for_(($r(0, 256))(bucket) {
+        let head = A_at((heads)[bucket]);
+        while (*head < *A_at((ends)[bucket])) {
+            let dest = (*S_at((seq)[*head]) >> shift) & 0xFF;
+            if (dest == bucket) {
+                (*head)++;
+                continue;
+            }
+            let other = S_at((seq)[(*A_at((heads)[dest]))++]);
+            let key = *S_at((seq)[*head]);
+            *S_at((seq)[*head]) = *other;
+            *other = key;
+        }
+    });
+    if (shift == 0) return;
+    var_(begin, usize) = 0;
+    for_(($r(0, 256))(bucket) {
+        let end = *A_at((ends)[bucket]);
+        if (end - begin > 1) sort_radix__flag64(S_slice((seq)$r(begin, end)), shift - 8);
+        begin = end;
+    });
+};
+
+fn_((sort_radix__flagByKey(u_S$raw seq, sort_KeyFn keyFn, u32 shift))(void)) {
+    if (seq.len <= sort_threshold_radix_insert_sort) {
+        for_(($r(1, seq.len))(i) {
+            for (usize j = i; j > 0; --j) {
+                let lhs = sort_radix__key(keyFn, u_atS(seq, j - 1).as_const);
+                let rhs = sort_radix__key(keyFn, u_atS(seq, j).as_const);
+                if (lhs <= rhs) break;
+                mem_swapP(u_atS(seq, j - 1), u_atS(seq, j));
+            }
+        });
+        return;
+    }
+    var_(heads, A$$(256, usize)) = A_zero();
+    var_(ends, A$$(256, usize)) = A_zero();
+    for_(($r(0, seq.len))(i) {
+        (*A_at((ends)[(sort_radix__key(keyFn, u_atS(seq, i).as_const) >> shift) & 0xFF]))++;
+    });
+    var_(offset, usize) = 0;
+    for_(($r(0, 256))(bucket) {
+        *A_at((heads)[bucket]) = offset;
+        offset += *A_at((ends)[bucket]);
+        *A_at((ends)[bucket]) = offset;
+    });
+    for_(($r(0, 256))(bucket) {
+        let head = A_at((heads)[bucket]);
+        while (*head < *A_at((ends)[bucket])) {
+            let dest = (sort_radix__key(keyFn, u_atS(seq, *head).as_const) >> shift) & 0xFF;
+            if (dest == bucket) {
+                (*head)++;
+                continue;
+            }
+            mem_swapP(u_atS(seq, *head), u_atS(seq, (*A_at((heads)[dest]))++));
+        }
+    });
+    if (shift == 0) return;
+    var_(begin, usize) = 0;
+    for_(($r(0, 256))(bucket) {
+        let end = *A_at((ends)[bucket]);
+        if (end - begin > 1) sort_radix__flagByKey(u_sliceS(seq, $r(begin, end)), keyFn, shift - 8);
+        begin = end;
+    });
+};
+
+fn_((sort_radix__key(sort_KeyFn keyFn, u_P_const$raw item))(u64)) {
+    return invoke(keyFn, u_load(u_deref(item)));
+};
+
+fn_((sort_radix__encodeI32(S$u32 bits))(void)) {
+    for_(($s(bits))(bit) { *bit ^= as$(u32)(1) << 31; });
+};
+
+fn_((sort_radix__encodeI64(S$u64 bits))(void)) {
+    for_(($s(bits))(bit) { *bit ^= as$(u64)(1) << 63; });
+};
+
+fn_((sort_radix__encodeF32(S$u32 bits))(void)) {
+    for_(($s(bits))(bit) { *bit ^= (as$(u32)(0) - (*bit >> 31)) | (as$(u32)(1) << 31); });
+};
+
+fn_((sort_radix__decodeF32(S$u32 bits))(void)) {
+    for_(($s(bits))(bit) { *bit ^= ((*bit >> 31) - 1) | (as$(u32)(1) << 31); });
+};
+
+fn_((sort_radix__encodeF64(S$u64 bits))(void)) {
+    for_(($s(bits))(bit) { *bit ^= (as$(u64)(0) - (*bit >> 63)) | (as$(u64)(1) << 63); });
+};
+
+fn_((sort_radix__decodeF64(S$u64 bits))(void)) {
+    for_(($s(bits))(bit) { *bit ^= ((*bit >> 63) - 1) | (as$(u64)(1) << 63); });
+};
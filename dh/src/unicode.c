@@ -1,10 +1,30 @@
 #include "dh/unicode.h"
+#include "dh/simd.h"
+
+#if utf8_simd_enabled
+typedef Vec$16$u8 unicode__Bytes;
+typedef Vec$16$u16 unicode__Units;
+#define unicode__block_len (16u)
+$static fn_((unicode__isAsciiUnits(unicode__Units block))(bool));
+/// Widens 16 bytes into code units at `out` when they are all ASCII
+$static fn_((unicode__widenAscii(const u8* bytes, u16* out))(bool));
+/// Narrows 16 code units into bytes at `out` when they are all below U+0080
+$static fn_((unicode__narrowAscii(const u16* units, u8* out))(bool));
+/// UTF-16 length of well-formed UTF-8/WTF-8: one unit per sequence, one more per 4-byte sequence
+$static fn_((unicode__utf16LenOfValid(S_const$u8 utf8))(usize));
+/// Leading code units below U+0080, counted a block at a time
+$static fn_((unicode__asciiPrefixLen(S_const$u16 units))(usize));
+#endif /* utf8_simd_enabled */
 
 /*---------------------------------------------------------------------------
  * Section: Strict Conversions (UTF-8 <-> UTF-16)
  *-------------------------------------------------------------------------*/
 
 fn_((unicode_utf8ToUTF16Len(S_const$u8 utf8))(unicode_utf8_Err$usize) $scope) {
+#if utf8_simd_enabled
+    if (utf8_validate(utf8)) { return_ok(unicode__utf16LenOfValid(utf8)); }
+    // Invalid: the decoding pass below reports the error
+#endif /* utf8_simd_enabled */
     var_(len16, usize) = 0;
     var_(idx, usize) = 0;
     while (idx < utf8.len) {
@@ -22,7 +42,16 @@ $static fn_((unicode__utf8ToUTF16(S_const$u8 utf8, usize required_len, S$u16 out
     claim_assert(required_len <= out_utf16.len);
     var_(out_idx, usize) = 0;
     var it = utf8_iter(utf8_viewUnchkd(utf8));
-    while_some(utf8_Iter_next(&it), codepoint) {
+    while (it.idx < utf8.len) {
+#if utf8_simd_enabled
+        if (it.idx + unicode__block_len <= utf8.len
+            && unicode__widenAscii(utf8.ptr + it.idx, out_utf16.ptr + out_idx)) {
+            it.idx += unicode__block_len;
+            out_idx += unicode__block_len;
+            continue;
+        }
+#endif /* utf8_simd_enabled */
+        let codepoint = unwrap_(utf8_Iter_next(&it));
         let rest_slice = S_slice((out_utf16)$r(out_idx, out_utf16.len));
         let encoded = catch_((utf16_encodeWithin(codepoint, rest_slice))($ignore, claim_unreachable));
         out_idx += encoded.len;
@@ -51,6 +80,10 @@ fn_((unicode_utf8ToUTF16Alloc(S_const$u8 utf8, mem_Allocator gpa))(unicode_mem_E
 fn_((unicode_utf16ToUTF8Len(S_const$u16 utf16))(unicode_utf16_Err$usize) $scope) {
     var_(len8, usize) = 0;
     var it = utf16_iter(utf16);
+#if utf8_simd_enabled
+    it.idx = unicode__asciiPrefixLen(utf16);
+    len8 = it.idx;
+#endif /* utf8_simd_enabled */
     while_some((try_(utf16_Iter_next(&it))), codepoint) {
         let seq_len = try_(utf8_codepointSeqLen(codepoint));
         len8 += seq_len;
@@ -63,7 +96,16 @@ $static fn_((unicode__utf16ToUTF8(S_const$u16 utf16, usize required_len, S$u8 ou
     claim_assert(required_len <= out_utf8.len);
     var_(out_idx, usize) = 0;
     var it = utf16_iter(utf16);
-    while_some((try_(utf16_Iter_next(&it))), codepoint) {
+    while (it.idx < utf16.len) {
+#if utf8_simd_enabled
+        if (it.idx + unicode__block_len <= utf16.len
+            && unicode__narrowAscii(utf16.ptr + it.idx, out_utf8.ptr + out_idx)) {
+            it.idx += unicode__block_len;
+            out_idx += unicode__block_len;
+            continue;
+        }
+#endif /* utf8_simd_enabled */
+        let codepoint = unwrap_(try_(utf16_Iter_next(&it)));
         let rest_slice = S_slice((out_utf8)$r(out_idx, out_utf8.len));
         let encoded = try_(utf8_encodeWithin(codepoint, rest_slice));
         out_idx += encoded.len;
@@ -94,19 +136,32 @@ fn_((unicode_utf16ToUTF8Alloc(S_const$u16 utf16, mem_Allocator gpa))(unicode_mem
  *-------------------------------------------------------------------------*/
 
 fn_((unicode_wtf8ToWTF16Len(S_const$u8 wtf8))(usize)) {
+#if utf8_simd_enabled
+    return unicode__utf16LenOfValid(wtf8);
+#else  /* !utf8_simd_enabled */
     var_(len16, usize) = 0;
     var it = wtf8_iter(wtf8_viewUnchkd(wtf8));
     while_some((wtf8_Iter_next(&it)), codepoint) {
         len16 += (codepoint < 0x10000) ? 1 : 2;
     }
     return len16;
+#endif /* !utf8_simd_enabled */
 };
 
 $static fn_((unicode__wtf8ToWTF16(S_const$u8 wtf8, usize required_len, S$u16 out_wtf16))(S$u16)) {
     claim_assert(required_len <= out_wtf16.len);
     var_(out_idx, usize) = 0;
     var it = wtf8_iter(wtf8_viewUnchkd(wtf8));
-    while_some((wtf8_Iter_next(&it)), codepoint) {
+    while (it.idx < wtf8.len) {
+#if utf8_simd_enabled
+        if (it.idx + unicode__block_len <= wtf8.len
+            && unicode__widenAscii(wtf8.ptr + it.idx, out_wtf16.ptr + out_idx)) {
+            it.idx += unicode__block_len;
+            out_idx += unicode__block_len;
+            continue;
+        }
+#endif /* utf8_simd_enabled */
+        let codepoint = unwrap_(wtf8_Iter_next(&it));
         let rest_slice = S_slice((out_wtf16)$r(out_idx, out_wtf16.len));
         if (utf16_isSurrogate(codepoint)) {
             claim_assert(1 <= rest_slice.len);
@@ -141,6 +196,10 @@ fn_((unicode_wtf8ToWTF16Alloc(S_const$u8 wtf8, mem_Allocator gpa))(unicode_mem_E
 fn_((unicode_wtf16ToWTF8Len(S_const$u16 wtf16))(usize)) {
     var_(len8, usize) = 0;
     var it = wtf16_iter(wtf16);
+#if utf8_simd_enabled
+    it.idx = unicode__asciiPrefixLen(wtf16);
+    len8 = it.idx;
+#endif /* utf8_simd_enabled */
     while_some((wtf16_Iter_next(&it)), codepoint) {
         let seq_len = catch_((utf8_codepointSeqLen(codepoint))($ignore, claim_unreachable));
         len8 += seq_len;
@@ -153,7 +212,16 @@ $static fn_((unicode__wtf16ToWTF8(S_const$u16 wtf16, usize required_len, S$u8 ou
     claim_assert(required_len <= out_wtf8.len);
     var_(out_idx, usize) = 0;
     var it = wtf16_iter(wtf16);
-    while_some((wtf16_Iter_next(&it)), codepoint) {
+    while (it.idx < wtf16.len) {
+#if utf8_simd_enabled
+        if (it.idx + unicode__block_len <= wtf16.len
+            && unicode__narrowAscii(wtf16.ptr + it.idx, out_wtf8.ptr + out_idx)) {
+            it.idx += unicode__block_len;
+            out_idx += unicode__block_len;
+            continue;
+        }
+#endif /* utf8_simd_enabled */
+        let codepoint = unwrap_(wtf16_Iter_next(&it));
         let rest_slice = S_slice((out_wtf8)$r(out_idx, out_wtf8.len));
         let encoded = catch_((wtf8_encodeWithin(codepoint, rest_slice))($ignore, claim_unreachable));
         out_idx += encoded.len;
@@ -210,3 +278,59 @@ fn_((unicode_wtf8ToUTF8LossyAlloc(S_const$u8 wtf8, mem_Allocator gpa))(unicode_m
     }
     return_ok(S_slice((buf)$r(0, dst_idx)));
 } $unscoped_(fn);
+
+/*---------------------------------------------------------------------------
+ * Section: Block Kernels
+ *-------------------------------------------------------------------------*/
+
+#if utf8_simd_enabled
+
+fn_((unicode__isAsciiUnits(unicode__Units block))(bool)) {
+    return Vec_moveMaskBytes(as$(Vec$32$u8)((block & 0xFF80) != 0)) == 0;
+};
+
+fn_((unicode__widenAscii(const u8* bytes, u16* out))(bool)) {
+    var_(block, unicode__Bytes);
+    prim_memcpy(&block, bytes, sizeOf$(unicode__Bytes));
+    if (Vec_moveMaskBytes(block) != 0) { return false; }
+    let units = Vec_cast$(unicode__Units, block);
+    prim_memcpy(out, &units, sizeOf$(unicode__Units));
+    return true;
+};
+
+fn_((unicode__narrowAscii(const u16* units, u8* out))(bool)) {
+    var_(block, unicode__Units);
+    prim_memcpy(&block, units, sizeOf$(unicode__Units));
+    if (!unicode__isAsciiUnits(block)) { return false; }
+    let bytes = Vec_cast$(unicode__Bytes, block);
+    prim_memcpy(out, &bytes, sizeOf$(unicode__Bytes));
+    return true;
+};
+
+fn_((unicode__utf16LenOfValid(S_const$u8 utf8))(usize)) {
+    var_(len16, usize) = 0;
+    var_(idx, usize) = 0;
+    for (; idx + unicode__block_len <= utf8.len; idx += unicode__block_len) {
+        var_(block, unicode__Bytes);
+        prim_memcpy(&block, utf8.ptr + idx, sizeOf$(unicode__Bytes));
+        let cont_mask = Vec_moveMaskBytes((block & 0xC0) == 0x80);
+        let lead4_mask = Vec_moveMaskBytes(block >= 0xF0);
+        len16 += unicode__block_len - raw_popcnt32(cont_mask) + raw_popcnt32(lead4_mask);
+    }
+    for_(($s(S_suffix((utf8)(idx))))(byte) {
+        len16 += ((*byte & 0xC0) != 0x80) + (0xF0 <= *byte);
+    });
+    return len16;
+};
+
+fn_((unicode__asciiPrefixLen(S_const$u16 units))(usize)) {
+    var_(idx, usize) = 0;
+    for (; idx + unicode__block_len <= units.len; idx += unicode__block_len) {
+        var_(block, unicode__Units);
+        prim_memcpy(&block, units.ptr + idx, sizeOf$(unicode__Units));
+        if (!unicode__isAsciiUnits(block)) { break; }
+    }
+    return idx;
+};
+
+#endif /* utf8_simd_enabled */
@@ -1,5 +1,6 @@
 #include "dh/utf8.h"
 #include "dh/utf16.h"
+#include "dh/simd.h"
 
 $attr($must_check)
 $static fn_((utf8__encode(u32 codepoint, utf8_SeqLen requested_len, S$u8 out))(utf8_Err$S$u8));
@@ -10,6 +11,17 @@ $static fn_((utf8__decode2Valid(utf8_Decode2Buf bytes))(u32));
 $static fn_((utf8__decode3Valid(utf8_Decode3Buf bytes))(u32));
 $static fn_((utf8__decode4Valid(utf8_Decode4Buf bytes))(u32));
 
+#if utf8_simd_enabled
+typedef Vec$16$u8 utf8__Block;
+#define utf8__block_len (16u)
+$static fn_((utf8__loadBlock(const u8* ptr))(utf8__Block));
+/// Error bits of every 2-byte window ending in `cur`; zero when they are all valid
+$static fn_((utf8__checkBlock(utf8__Block prev, utf8__Block cur))(utf8__Block));
+/// Bytes of `block` before a trailing sequence that continues past its end (13..16)
+$static fn_((utf8__completeLen(utf8__Block block))(usize));
+$static fn_((utf8__isIncomplete(utf8__Block block))(bool));
+#endif /* utf8_simd_enabled */
+
 $attr($inline_always)
 $static fn_((utf8__isContinuation(u8 byte))(bool)) {
     return (byte & prim_maskHi_static$((u8)(2))) == prim_maskHi_static$((u8)(1));
@@ -178,7 +190,7 @@ fn_((utf8_isValid(u32 codepoint))(bool)) {
     return codepoint <= 0x10FFFF && !utf16_isSurrogate(codepoint);
 };
 
-fn_((utf8_validate(S_const$u8 bytes))(bool) $scope) {
+fn_((utf8_validateScalar(S_const$u8 bytes))(bool) $scope) {
     var_(idx, usize) = 0;
     while (idx < bytes.len) {
         let rest = S_slice((bytes)$r(idx, bytes.len));
@@ -189,7 +201,7 @@ fn_((utf8_validate(S_const$u8 bytes))(bool) $scope) {
     return_(true);
 } $unscoped_(fn);
 
-fn_((utf8_count(S_const$u8 bytes))(usize) $scope) {
+fn_((utf8_countScalar(S_const$u8 bytes))(usize) $scope) {
     var_(count, usize) = 0;
     var_(idx, usize) = 0;
     while (idx < bytes.len) {
@@ -205,6 +217,190 @@ fn_((utf8_count(S_const$u8 bytes))(usize) $scope) {
     return_(count);
 } $unscoped_(fn);
 
+#if !utf8_simd_enabled
+
+fn_((utf8_validate(S_const$u8 bytes))(bool)) {
+    return utf8_validateScalar(bytes);
+};
+
+fn_((utf8_count(S_const$u8 bytes))(usize)) {
+    return utf8_countScalar(bytes);
+};
+
+#else /* utf8_simd_enabled */
+
+/* Lookup-table validation after Keiser & Lemire, "Validating UTF-8 In Less Than One
+ * Instruction Per Byte" (2021): the nibbles of each byte and its predecessor index
+ * three tables whose AND keeps the bits of the errors that pair can exhibit. */
+
+#define utf8__chk_too_short (1u << 0)
+#define utf8__chk_too_long (1u << 1)
+#define utf8__chk_overlong_3 (1u << 2)
+#define utf8__chk_too_large (1u << 3)
+#define utf8__chk_surrogate (1u << 4)
+#define utf8__chk_overlong_2 (1u << 5)
+#define utf8__chk_too_large_1000 (1u << 6)
+#define utf8__chk_overlong_4 (1u << 6)
+#define utf8__chk_two_conts (1u << 7)
+#define utf8__chk_carry (utf8__chk_too_short | utf8__chk_too_long | utf8__chk_two_conts)
+
+/// Indexed by the high nibble of the previous byte
+$static const utf8__Block utf8__byte_1_high = {
+    /* 0_______ ________: ASCII */
+    utf8__chk_too_long, utf8__chk_too_long, utf8__chk_too_long, utf8__chk_too_long,
+    utf8__chk_too_long, utf8__chk_too_long, utf8__chk_too_long, utf8__chk_too_long,
+    /* 10______ ________: continuation */
+    utf8__chk_two_conts, utf8__chk_two_conts, utf8__chk_two_conts, utf8__chk_two_conts,
+    /* 1100____ ________: 2-byte lead, C0/C1 overlong */
+    utf8__chk_too_short | utf8__chk_overlong_2,
+    /* 1101____ ________: 2-byte lead */
+    utf8__chk_too_short,
+    /* 1110____ ________: 3-byte lead */
+    utf8__chk_too_short | utf8__chk_overlong_3 | utf8__chk_surrogate,
+    /* 1111____ ________: 4-byte lead */
+    utf8__chk_too_short | utf8__chk_too_large | utf8__chk_too_large_1000 | utf8__chk_overlong_4,
+};
+
+/// Indexed by the low nibble of the previous byte
+$static const utf8__Block utf8__byte_1_low = {
+    /* ____0000 ________ */
+    utf8__chk_carry | utf8__chk_overlong_3 | utf8__chk_overlong_2 | utf8__chk_overlong_4,
+    /* ____0001 ________ */
+    utf8__chk_carry | utf8__chk_overlong_2,
+    /* ____001_ ________ */
+    utf8__chk_carry,
+    utf8__chk_carry,
+    /* ____0100 ________ */
+    utf8__chk_carry | utf8__chk_too_large,
+    /* ____0101 ________ and up: past U+10FFFF for a 4-byte lead */
+    utf8__chk_carry | utf8__chk_too_large | utf8__chk_too_large_1000,
+    utf8__chk_carry | utf8__chk_too_large | utf8__chk_too_large_1000,
+    utf8__chk_carry | utf8__chk_too_large | utf8__chk_too_large_1000,
+    utf8__chk_carry | utf8__chk_too_large | utf8__chk_too_large_1000,
+    utf8__chk_carry | utf8__chk_too_large | utf8__chk_too_large_1000,
+    utf8__chk_carry | utf8__chk_too_large | utf8__chk_too_large_1000,
+    utf8__chk_carry | utf8__chk_too_large | utf8__chk_too_large_1000,
+    utf8__chk_carry | utf8__chk_too_large | utf8__chk_too_large_1000,
+    /* ____1101 ________: ED starts the surrogates */
+    utf8__chk_carry | utf8__chk_too_large | utf8__chk_too_large_1000 | utf8__chk_surrogate,
+    utf8__chk_carry | utf8__chk_too_large | utf8__chk_too_large_1000,
+    utf8__chk_carry | utf8__chk_too_large | utf8__chk_too_large_1000,
+};
+
+/// Indexed by the high nibble of the current byte
+$static const utf8__Block utf8__byte_2_high = {
+    /* ________ 0_______: ASCII */
+    utf8__chk_too_short, utf8__chk_too_short, utf8__chk_too_short, utf8__chk_too_short,
+    utf8__chk_too_short, utf8__chk_too_short, utf8__chk_too_short, utf8__chk_too_short,
+    /* ________ 1000____ */
+    utf8__chk_too_long | utf8__chk_overlong_2 | utf8__chk_two_conts | utf8__chk_overlong_3 | utf8__chk_too_large_1000 | utf8__chk_overlong_4,
+    /* ________ 1001____ */
+    utf8__chk_too_long | utf8__chk_overlong_2 | utf8__chk_two_conts | utf8__chk_overlong_3 | utf8__chk_too_large,
+    /* ________ 101_____ */
+    utf8__chk_too_long | utf8__chk_overlong_2 | utf8__chk_two_conts | utf8__chk_surrogate | utf8__chk_too_large,
+    utf8__chk_too_long | utf8__chk_overlong_2 | utf8__chk_two_conts | utf8__chk_surrogate | utf8__chk_too_large,
+    /* ________ 11______: lead */
+    utf8__chk_too_short, utf8__chk_too_short, utf8__chk_too_short, utf8__chk_too_short,
+};
+
+/// Lane `i` holds the byte `n` places before lane `i` of `cur`, reaching back into `prev`
+#define utf8__prev1(_prev, _cur) Vec_shuffle(_prev, _cur, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30)
+#define utf8__prev2(_prev, _cur) Vec_shuffle(_prev, _cur, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29)
+#define utf8__prev3(_prev, _cur) Vec_shuffle(_prev, _cur, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28)
+
+fn_((utf8__loadBlock(const u8* ptr))(utf8__Block)) {
+    var_(block, utf8__Block);
+    prim_memcpy(&block, ptr, sizeOf$(utf8__Block));
+    return block;
+};
+
+fn_((utf8__checkBlock(utf8__Block prev, utf8__Block cur))(utf8__Block)) {
+    let prev1 = utf8__prev1(prev, cur);
+    let special = Vec_lookupBytes(utf8__byte_1_high, Vec_shr(prev1, 4))
+                & Vec_lookupBytes(utf8__byte_1_low, prev1)
+                & Vec_lookupBytes(utf8__byte_2_high, Vec_shr(cur, 4));
+    // A 3rd/4th byte must be a continuation, which the 2-byte tables saw as `two_conts`
+    let must_cont = as$(utf8__Block)(Vec_ge(utf8__prev2(prev, cur), Vec_splat$((utf8__Block)(0xE0)))
+                                   | Vec_ge(utf8__prev3(prev, cur), Vec_splat$((utf8__Block)(0xF0))));
+    return special ^ (must_cont & 0x80);
+};
+
+fn_((utf8__completeLen(utf8__Block block))(usize)) {
+    if (0xC0 <= block[15]) { return 15; }
+    if (0xE0 <= block[14]) { return 14; }
+    if (0xF0 <= block[13]) { return 13; }
+    return utf8__block_len;
+};
+
+fn_((utf8__isIncomplete(utf8__Block block))(bool)) {
+    return utf8__completeLen(block) != utf8__block_len;
+};
+
+fn_((utf8_validate(S_const$u8 bytes))(bool)) {
+    let zero = Vec_splat$((utf8__Block)(0));
+    var err = zero;
+    var prev = zero;
+    var_(idx, usize) = 0;
+    for (; idx + 2 * utf8__block_len <= bytes.len; idx += 2 * utf8__block_len) {
+        let lo = utf8__loadBlock(bytes.ptr + idx);
+        let hi = utf8__loadBlock(bytes.ptr + idx + utf8__block_len);
+        if (Vec_moveMaskBytes(lo | hi) == 0) {
+            // ASCII: only a sequence left open by the previous block can fail here
+            if (utf8__isIncomplete(prev)) { return false; }
+        } else {
+            err |= utf8__checkBlock(prev, lo);
+            err |= utf8__checkBlock(lo, hi);
+        }
+        prev = hi;
+    }
+    for (; idx + utf8__block_len <= bytes.len; idx += utf8__block_len) {
+        let cur = utf8__loadBlock(bytes.ptr + idx);
+        err |= utf8__checkBlock(prev, cur);
+        prev = cur;
+    }
+    // Zero padding also fails any sequence cut off by the end of the input
+    var tail = zero;
+    prim_memcpy(&tail, bytes.ptr + idx, bytes.len - idx);
+    err |= utf8__checkBlock(prev, tail);
+    return Vec_moveMaskBytes(err != 0) == 0;
+};
+
+fn_((utf8_count(S_const$u8 bytes))(usize) $scope) {
+    let zero = Vec_splat$((utf8__Block)(0));
+    var_(count, usize) = 0;
+    var_(idx, usize) = 0;
+    while (idx < bytes.len) {
+        if (idx + utf8__block_len <= bytes.len) {
+            let block = utf8__loadBlock(bytes.ptr + idx);
+            let high_mask = Vec_moveMaskBytes(block);
+            if (high_mask == 0) {
+                count += utf8__block_len;
+                idx += utf8__block_len;
+                continue;
+            }
+            // `idx` is on a codepoint boundary, so the block is checked with nothing before it;
+            // a valid block counts its non-continuation bytes up to a sequence it leaves open
+            if (Vec_moveMaskBytes(utf8__checkBlock(zero, block) != 0) == 0) {
+                let len = utf8__completeLen(block);
+                let cont_mask = Vec_moveMaskBytes((block & 0xC0) == 0x80);
+                count += raw_popcnt32(~cont_mask & ((1u << len) - 1));
+                idx += len;
+                continue;
+            }
+        }
+        // Tail and invalid bytes: one codepoint as the reference does
+        let codepoint = catch_((utf8_decode(S_suffix((bytes)(idx))))($ignore, {
+            idx += 1;
+            continue;
+        }));
+        idx += catch_((utf8_codepointSeqLen(codepoint))($ignore, claim_unreachable));
+        count += 1;
+    }
+    return_(count);
+} $unscoped_(fn);
+
+#endif /* utf8_simd_enabled */
+
 fn_((utf8_view(S_const$u8 bytes))(utf8_Err$utf8_View) $scope) {
     if (!utf8_validate(bytes)) { return_err(utf8_Err_InvalidBytes()); }
     return_ok({ .bytes = bytes });
@@ -0,0 +1,163 @@
+#include "dh/main.h"
+#include "dh/ArrList.h"
+#include "dh/ArrListSoA.h"
+#include "dh/simd.h"
+#include "dh/heap/Page.h"
+#include "dh/time/Instant.h"
+#include "dh/io/stream.h"
+
+/// Each size runs for about this many particle updates
+#define bench_updates (1u << 26)
+#define bench_lanes (8u)
+
+#define bench_dt (1.0f / 60.0f)
+#define bench_gravity (-9.8f)
+
+/// 48-byte particle; the update touches position and velocity, half of it
+typedef struct Particle {
+    var_(pos_x, f32);
+    var_(pos_y, f32);
+    var_(pos_z, f32);
+    var_(vel_x, f32);
+    var_(vel_y, f32);
+    var_(vel_z, f32);
+    var_(mass, f32);
+    var_(age, f32);
+    var_(color, u32);
+    var_(seed, u32);
+    var_(kind, u32);
+    var_(id, u32);
+} Particle;
+T_use_S$(Particle);
+
+typedef enum Particle_Field {
+    Particle_pos_x,
+    Particle_pos_y,
+    Particle_pos_z,
+    Particle_vel_x,
+    Particle_vel_y,
+    Particle_vel_z,
+    Particle_Field_count
+} Particle_Field;
+
+typedef enum Kind {
+    Kind_aos,
+    Kind_soa,
+    Kind_soa_vec,
+    Kind_count
+} Kind;
+
+typedef Vec$$(bench_lanes, f32) Lanes;
+
+/// Same particles for both layouts, keyed by index
+$static fn_((particleOf(usize idx))(Particle)) {
+    let t = as$(f32)(idx % 1024) / 1024.0f;
+    return (Particle){
+        .pos_x = t, .pos_y = t * 2.0f, .pos_z = -t,
+        .vel_x = 1.0f - t, .vel_y = t * 4.0f, .vel_z = 0.5f,
+        .mass = 1.0f, .age = 0.0f,
+        .color = 0xffffffffu, .seed = as$(u32)(idx), .kind = 0, .id = as$(u32)(idx),
+    };
+};
+
+$static fn_((updateAoS(S$Particle particles))(void)) {
+    for_(($s(particles))(p) {
+        p->vel_y += bench_gravity * bench_dt;
+        p->pos_x += p->vel_x * bench_dt;
+        p->pos_y += p->vel_y * bench_dt;
+        p->pos_z += p->vel_z * bench_dt;
+    });
+};
+
+$static fn_((updateSoA(ArrListSoA list))(void)) {
+    let pos_x = ArrListSoA_fieldMut$((f32)(list, Particle_pos_x));
+    let pos_y = ArrListSoA_fieldMut$((f32)(list, Particle_pos_y));
+    let pos_z = ArrListSoA_fieldMut$((f32)(list, Particle_pos_z));
+    let vel_x = ArrListSoA_field$((f32)(list, Particle_vel_x));
+    let vel_y = ArrListSoA_fieldMut$((f32)(list, Particle_vel_y));
+    let vel_z = ArrListSoA_field$((f32)(list, Particle_vel_z));
+    for_(($s(vel_y))(vy) { *vy += bench_gravity * bench_dt; });
+    for_(($s(pos_x), $s(vel_x))(px, vx) { *px += *vx * bench_dt; });
+    for_(($s(pos_y), $s(vel_y))(py, vy) { *py += *vy * bench_dt; });
+    for_(($s(pos_z), $s(vel_z))(pz, vz) { *pz += *vz * bench_dt; });
+};
+
+/// `dst += src * scale` a lane group at a time; columns start on a cache line, so every group load is aligned
+$attr($inline_always)
+$static fn_((axpyLanes(S$f32 dst, S_const$f32 src, f32 scale))(void)) {
+    let scales = Vec_splat$((Lanes)(scale));
+    var_(idx, usize) = 0;
+    for (; idx + bench_lanes <= dst.len; idx += bench_lanes) {
+        let d = as$(Lanes*)(dst.ptr + idx);
+        *d = Vec_fma(*as$(const Lanes*)(src.ptr + idx), scales, *d);
+    }
+    for (; idx < dst.len; ++idx) { dst.ptr[idx] += src.ptr[idx] * scale; }
+};
+
+$static fn_((updateSoAVec(ArrListSoA list))(void)) {
+    let vel_y = ArrListSoA_fieldMut$((f32)(list, Particle_vel_y));
+    let gravity = Vec_splat$((Lanes)(bench_gravity * bench_dt));
+    var_(idx, usize) = 0;
+    for (; idx + bench_lanes <= vel_y.len; idx += bench_lanes) {
+        let vy = as$(Lanes*)(vel_y.ptr + idx);
+        *vy = Vec_add(*vy, gravity);
+    }
+    for (; idx < vel_y.len; ++idx) { vel_y.ptr[idx] += bench_gravity * bench_dt; }
+    axpyLanes(ArrListSoA_fieldMut$((f32)(list, Particle_pos_x)), ArrListSoA_field$((f32)(list, Particle_vel_x)), bench_dt);
+    axpyLanes(ArrListSoA_fieldMut$((f32)(list, Particle_pos_y)), vel_y.as_const, bench_dt);
+    axpyLanes(ArrListSoA_fieldMut$((f32)(list, Particle_pos_z)), ArrListSoA_field$((f32)(list, Particle_vel_z)), bench_dt);
+};
+
+/// Nanoseconds per particle update of `kind` over `len` particles
+$static fn_((run(Kind kind, mem_Allocator gpa, usize len))(E$f64) $guard) {
+    let fields = typeInfos$(f32, f32, f32, f32, f32, f32, f32, f32, u32, u32, u32, u32);
+    var aos = try_(ArrList_init(typeInfo$(Particle), gpa, kind == Kind_aos ? len : 0));
+    defer_(ArrList_fini(&aos, typeInfo$(Particle), gpa));
+    var soa = try_(ArrListSoA_init(fields, gpa, kind == Kind_aos ? 0 : len));
+    defer_(ArrListSoA_fini(&soa, gpa));
+    if (kind == Kind_aos) { try_(ArrList_resize(&aos, typeInfo$(Particle), gpa, len)); }
+    let particles = u_castS$((S$Particle)(ArrList_itemsMut(aos, typeInfo$(Particle))));
+    for_(($rf(0), $s(particles))(idx, p) { *p = particleOf(idx); });
+    for (usize idx = 0; kind != Kind_aos && idx < len; ++idx) {
+        var p = particleOf(idx);
+        ArrListSoA_appendWithin(&soa, u_anyV(p));
+    }
+
+    let steps = prim_max(1, bench_updates / len);
+    let start = time_Instant_now();
+    for (usize step = 0; step < steps; ++step) {
+        switch (kind) {
+        case Kind_aos: updateAoS(particles); break;
+        case Kind_soa: updateSoA(soa); break;
+        case Kind_soa_vec: updateSoAVec(soa); break;
+        default: claim_unreachable;
+        }
+    }
+    let secs = time_Duration_asSecs$f64(time_Instant_elapsed(start));
+    return_ok(secs * 1e9 / as$(f64)(steps * len));
+} $unguarded_(fn);
+
+fn_((main(S$S_const$u8 args))(E$void) $guard) {
+    let_ignore = args;
+    var page = lit0$((heap_Page));
+    let gpa = heap_Page_allocator(&page);
+    let_(sizes, A$$(4, usize)) = A_init({ 1u << 10, 1u << 14, 1u << 18, 1u << 22 });
+
+    io_stream_println(u8_l("particle update (pos += vel * dt, vel.y += g * dt), ns per particle"));
+    io_stream_println(
+        u8_l("{:>9s} | {:>9s} | {:>9s} | {:>9s} | {:>9s}"),
+        u8_l("len"), u8_l("aos"), u8_l("soa"), u8_l("soa-vec"), u8_l("speedup")
+    );
+    for_(($a(sizes))(len) {
+        var_(times, A$$(Kind_count, f64)) = A_zero();
+        for (Kind kind = 0; kind < Kind_count; ++kind) {
+            *A_at((times)[kind]) = try_(run(kind, gpa, *len));
+        }
+        io_stream_println(
+            u8_l("{:>9uz} | {:>9.3fl} | {:>9.3fl} | {:>9.3fl} | {:>9.2fl}"),
+            *len, *A_at((times)[Kind_aos]), *A_at((times)[Kind_soa]), *A_at((times)[Kind_soa_vec]),
+            *A_at((times)[Kind_aos]) / *A_at((times)[Kind_soa_vec])
+        );
+    });
+    return_ok({});
+} $unguarded_(fn);
@@ -0,0 +1,162 @@
+#include "dh/main.h"
+#include "dh/ArrPQue.h"
+#include "dh/ArrPQueIdx.h"
+#include "dh/heap/Page.h"
+#include "dh/Rand.h"
+#include "dh/time/Instant.h"
+#include "dh/io/stream.h"
+
+/// Dijkstra from vertex 0 over `bench_vertices * bench_degree` directed edges.
+#define bench_vertices (1000000u)
+#define bench_degree (10u)
+#define bench_max_weight (1000u)
+
+typedef struct Edge {
+    var_(dst, u32);
+    var_(weight, u32);
+} Edge;
+T_use_S$(Edge);
+
+/// `ArrPQue` has no decrease-key cheaper than a scan, so it queues a fresh entry
+/// per relaxation and skips the stale ones when they surface (lazy deletion).
+typedef struct Entry {
+    var_(dist, u64);
+    var_(vertex, u32);
+} Entry;
+T_use$((Entry)(P, S, O));
+T_use$((Entry)(
+    ArrPQue,
+    ArrPQue_init,
+    ArrPQue_fini,
+    ArrPQue_enque,
+    ArrPQue_deque,
+));
+$static cmp_fn_ord$((Entry)(lhs, rhs)) { return prim_ord(lhs.dist, rhs.dist); }
+$static cmp_fn_ordCtx$((Entry)(lhs, rhs, ctx)) { return $unused(ctx), cmp_ord$(Entry)(lhs, rhs); }
+$static cmp_fn_u_ordCtx_default$((Entry)(lhs, rhs, ctx));
+
+T_use$((u64)(
+    ArrPQueIdx,
+    ArrPQueIdx_init,
+    ArrPQueIdx_fini,
+    ArrPQueIdx_contains,
+    ArrPQueIdx_enqueWithin,
+    ArrPQueIdx_deque,
+    ArrPQueIdx_update,
+));
+
+typedef enum Kind {
+    /// Binary `ArrPQue` with lazy deletion
+    Kind_pque_lazy,
+    Kind_idx_2,
+    Kind_idx_4,
+    Kind_idx_8,
+    Kind_idx_16,
+    Kind_count
+} Kind;
+
+/// Every vertex links to its successor, so all are reachable, plus random edges.
+$static fn_((genGraph(S$Edge edges))(void)) {
+    var rng = Rand_initSeed(0x21);
+    for (u32 src = 0; src < bench_vertices; ++src) {
+        let out = S_slice((edges)$r(as$(usize)(src) * bench_degree, as$(usize)(src + 1) * bench_degree));
+        for_(($rf(0), $s(out))(i, edge) {
+            edge->dst = i == 0 ? (src + 1) % bench_vertices : as$(u32)(Rand_next$u64(&rng) % bench_vertices);
+            edge->weight = 1 + as$(u32)(Rand_next$u64(&rng) % bench_max_weight);
+        });
+    }
+};
+
+$static fn_((shortestPathsLazy(S_const$Edge edges, S$u64 dist, mem_Allocator gpa))(E$usize) $guard) {
+    let ctx = lit$((ArrPQue_Ctx){
+        .inner = u_anyP(&lit0$((const Void))),
+        .ordFn = Entry_u_ordCtx,
+    });
+    var pq = try_(ArrPQue_init$Entry(gpa, bench_vertices, &ctx));
+    defer_(ArrPQue_fini$Entry(&pq, gpa));
+    var_(pops, usize) = 0;
+    *S_at((dist)[0]) = 0;
+    try_(ArrPQue_enque$Entry(&pq, gpa, (Entry){ .dist = 0, .vertex = 0 }));
+    while_some(ArrPQue_deque$Entry(&pq), top) {
+        pops++;
+        if (*S_at((dist)[top.vertex]) < top.dist) { continue; }
+        let out = S_slice((edges)$r(as$(usize)(top.vertex) * bench_degree, as$(usize)(top.vertex + 1) * bench_degree));
+        for_(($s(out))(edge) {
+            let next = top.dist + edge->weight;
+            if (next < *S_at((dist)[edge->dst])) {
+                *S_at((dist)[edge->dst]) = next;
+                try_(ArrPQue_enque$Entry(&pq, gpa, (Entry){ .dist = next, .vertex = edge->dst }));
+            }
+        });
+    }
+    return_ok(pops);
+} $unguarded_(fn);
+
+$static fn_((shortestPathsIdx(S_const$Edge edges, S$u64 dist, mem_Allocator gpa, u32 arity))(E$usize) $guard) {
+    let ctx = ArrPQue_Ctx_defaultAsc(cmp_MathType_u64);
+    var pq = try_(ArrPQueIdx_init$u64(gpa, bench_vertices, arity, &ctx));
+    defer_(ArrPQueIdx_fini$u64(&pq, gpa));
+    var_(pops, usize) = 0;
+    *S_at((dist)[0]) = 0;
+    ArrPQueIdx_enqueWithin$u64(&pq, 0, 0);
+    var_(top_dist, u64) = 0;
+    while_some(ArrPQueIdx_deque$u64(&pq, &top_dist), vertex) {
+        pops++;
+        let out = S_slice((edges)$r(vertex * bench_degree, (vertex + 1) * bench_degree));
+        for_(($s(out))(edge) {
+            let next = top_dist + edge->weight;
+            if (next < *S_at((dist)[edge->dst])) {
+                *S_at((dist)[edge->dst]) = next;
+                if (ArrPQueIdx_contains$u64(pq, edge->dst)) {
+                    ArrPQueIdx_update$u64(&pq, edge->dst, next);
+                } else {
+                    ArrPQueIdx_enqueWithin$u64(&pq, edge->dst, next);
+                }
+            }
+        });
+    }
+    return_ok(pops);
+} $unguarded_(fn);
+
+fn_((main(S$S_const$u8 args))(E$void) $guard) {
+    let_ignore = args;
+    var page = lit0$((heap_Page));
+    let gpa = heap_Page_allocator(&page);
+    let edges = u_castS$((S$Edge)(try_(mem_Allocator_alloc(gpa, typeInfo$(Edge), as$(usize)(bench_vertices) * bench_degree))));
+    defer_(mem_Allocator_free(gpa, u_anyS(edges)));
+    let dist = u_castS$((S$u64)(try_(mem_Allocator_alloc(gpa, typeInfo$(u64), bench_vertices))));
+    defer_(mem_Allocator_free(gpa, u_anyS(dist)));
+    let_(kind_names, A$$(Kind_count, S_const$u8)) = A_init({
+        u8_l("ArrPQue lazy"), u8_l("ArrPQueIdx 2"), u8_l("ArrPQueIdx 4"), u8_l("ArrPQueIdx 8"), u8_l("ArrPQueIdx 16"),
+    });
+    let_(arities, A$$(Kind_count, u32)) = A_init({ 0, 2, 4, 8, 16 });
+
+    genGraph(edges);
+    io_stream_println(u8_l("{:u} vertices, {:uz} edges"), bench_vertices, edges.len);
+    io_stream_println(
+        u8_l("{:>13s} | {:>9s} | {:>9s} | {:>10s} | {:>7s}"),
+        u8_l("queue"), u8_l("ms"), u8_l("Medges/s"), u8_l("pops"), u8_l("speedup")
+    );
+    var_(baseline_ms, f64) = 0;
+    var_(baseline_sum, u64) = 0;
+    for (Kind kind = 0; kind < Kind_count; ++kind) {
+        for_(($s(dist))(d) { *d = u64_limit_max; });
+        let start = time_Instant_now();
+        let pops = kind == Kind_pque_lazy
+                     ? try_(shortestPathsLazy(edges.as_const, dist, gpa))
+                     : try_(shortestPathsIdx(edges.as_const, dist, gpa, *A_at((arities)[kind])));
+        let ms = time_Duration_asSecs$f64(time_Instant_elapsed(start)) * 1e3;
+        var_(sum, u64) = 0;
+        for_(($s(dist))(d) { sum += *d; });
+        if (kind == Kind_pque_lazy) {
+            baseline_ms = ms;
+            baseline_sum = sum;
+        }
+        claim_assert(sum == baseline_sum);
+        io_stream_println(
+            u8_l("{:>13s} | {:>9.1fl} | {:>9.1fl} | {:>10uz} | {:>6.2fl}x"),
+            *A_at((kind_names)[kind]), ms, as$(f64)(edges.len) / ms * 1e-3, pops, baseline_ms / ms
+        );
+    }
+    return_ok({});
+} $unguarded_(fn);
@@ -0,0 +1,66 @@
+#include "dh/main.h"
+#include "dh/Hash.h"
+#include "dh/Rand.h"
+#include "dh/time/Instant.h"
+#include "dh/io/stream.h"
+
+/* Previous HashMap default (byte-wise FNV-1a), kept here as the baseline */
+$static fn_((fnv1a(S_const$u8 bytes))(u64)) {
+    var_(hash, u64) = 0xcbf29ce484222325ull;
+    for_(($s(bytes))(byte) {
+        hash ^= *byte;
+        hash *= 0x100000001b3ull;
+    });
+    return hash;
+};
+
+#define bench_buf_len (1ull << 16)
+#define bench_target_bytes (1ull << 30)
+
+$static var_(bench_sink, u64) = 0;
+
+$static fn_((benchBytes(S_const$u8 buf, usize key_len, bool use_fnv))(f64)) {
+    let keys = buf.len / key_len;
+    let rounds = prim_max(as$(usize)(bench_target_bytes / (keys * key_len)), as$(usize)(1));
+    var_(acc, u64) = 0;
+    let start = time_Instant_now();
+    for_(($r(0, rounds))(round) {
+        let_ignore = round;
+        for_(($r(0, keys))(k) {
+            let key = slice$S(buf, $r(k * key_len, (k + 1) * key_len));
+            acc ^= use_fnv ? fnv1a(key) : Hash_bytes(key, Hash_seed_default);
+        });
+    });
+    let secs = time_Duration_asSecs$f64(time_Instant_elapsed(start));
+    bench_sink ^= acc;
+    return as$(f64)(rounds * keys * key_len) / secs / 1e9;
+};
+
+$static fn_((benchInts(usize count))(f64)) {
+    var_(acc, u64) = 0;
+    let start = time_Instant_now();
+    for_(($r(0, count))(i) { acc ^= Hash_u64(i, Hash_seed_default); });
+    let secs = time_Duration_asSecs$f64(time_Instant_elapsed(start));
+    bench_sink ^= acc;
+    return as$(f64)(count) / secs / 1e6;
+};
+
+fn_((main(S$S_const$u8 args))(E$void) $scope) {
+    let_ignore = args;
+    $static var_(buf, A$$(bench_buf_len, u8)) = A_zero();
+    var rng = Rand_initSeed(0xbe4c);
+    for_(($r(0, A_len(buf)))(i) { *A_at((buf)[i]) = Rand_next$u8(&rng); });
+    let bytes = A_ref$((S$u8)(buf)).as_const;
+
+    io_stream_println(u8_l("Hash_use_aes={:d} Hash_use_crc32c={:d}"), as$(i32)(Hash_use_aes), as$(i32)(Hash_use_crc32c));
+    io_stream_println(u8_l("{:>6s} | {:>10s} | {:>10s}"), u8_l("len"), u8_l("fnv1a GB/s"), u8_l("Hash GB/s"));
+    let_(key_lens, A$$(9, usize)) = A_init({ 4, 8, 16, 32, 64, 128, 256, 1024, 4096 });
+    for_(($s(A_ref(key_lens)))(key_len) {
+        let fnv = benchBytes(bytes, *key_len, true);
+        let wide = benchBytes(bytes, *key_len, false);
+        io_stream_println(u8_l("{:>6uz} | {:>10.2fl} | {:>10.2fl}"), *key_len, fnv, wide);
+    });
+    io_stream_println(u8_l("Hash_u64: {:.1fl} Mkeys/s"), benchInts(1ull << 28));
+    io_stream_println(u8_l("(sink {:xl})"), bench_sink);
+    return_ok({});
+} $unscoped_(fn);
@@ -0,0 +1,122 @@
+#include "dh/main.h"
+#include "dh/HashMapConc.h"
+#include "dh/Rand.h"
+#include "dh/Thrd/common.h"
+#include "dh/Thrd/RWLock.h"
+#include "dh/Thrd/WaitGroup.h"
+#include "dh/heap/Page.h"
+#include "dh/heap/Smp.h"
+#include "dh/time/Instant.h"
+#include "dh/io/stream.h"
+
+T_use$((u64, u64)(
+    HashMap,
+    HashMap_init,
+    HashMap_fini,
+    HashMap_contains,
+    HashMap_put
+));
+T_use$((u64, u64)(
+    HashMapConc,
+    HashMapConc_init,
+    HashMapConc_fini,
+    HashMapConc_contains,
+    HashMapConc_put
+));
+
+#define bench_key_space (lit_n$(u64)(1u << 20))
+#define bench_ops_per_thrd (lit_n$(usize)(1u << 21))
+#define bench_max_thrds (64)
+
+$static var_(g_gpa, mem_Allocator) = {};
+$static var_(g_conc, HashMapConc$(u64, u64)) = {};
+$static var_(g_locked, HashMap$(u64, u64)) = {};
+$static var_(g_rwlock, Thrd_RWLock) = {};
+
+$static Thrd_fn_(concWorker, ({ u64 seed; u32 write_pct; }, Void), ($ignore, args)$scope) {
+    var rng = Rand_initSeed(args->seed);
+    for_(($r(0, bench_ops_per_thrd))($ignore) {
+        let key = Rand_next$u64(&rng) % bench_key_space;
+        if (Rand_next$u32(&rng) % 100 < args->write_pct) {
+            catch_((HashMapConc_put$1u64$2u64(g_conc, g_gpa, key, key))($ignore, claim_unreachable));
+        } else {
+            let_ignore = HashMapConc_contains$1u64$2u64(g_conc, key);
+        }
+    });
+    return_({});
+} $unscoped_(Thrd_fn);
+
+$static Thrd_fn_(lockedWorker, ({ u64 seed; u32 write_pct; }, Void), ($ignore, args)$scope) {
+    var rng = Rand_initSeed(args->seed);
+    for_(($r(0, bench_ops_per_thrd))($ignore) {
+        let key = Rand_next$u64(&rng) % bench_key_space;
+        if (Rand_next$u32(&rng) % 100 < args->write_pct) {
+            Thrd_RWLock_lock(&g_rwlock);
+            catch_((HashMap_put$1u64$2u64(&g_locked, g_gpa, key, key))($ignore, claim_unreachable));
+            Thrd_RWLock_unlock(&g_rwlock);
+        } else {
+            Thrd_RWLock_lockShared(&g_rwlock);
+            let_ignore = HashMap_contains$1u64$2u64(g_locked, key);
+            Thrd_RWLock_unlockShared(&g_rwlock);
+        }
+    });
+    return_({});
+} $unscoped_(Thrd_fn);
+
+/// Returns throughput in million operations per second.
+$static fn_((run(usize thrd_count, u32 write_pct, bool conc))(f64) $guard) {
+    var wg = Thrd_WaitGroup_init();
+    defer_(Thrd_WaitGroup_fini(&wg));
+    $static var_(conc_ctxs, A$$(bench_max_thrds, Thrd_FnCtx$(concWorker))) = A_zero();
+    $static var_(locked_ctxs, A$$(bench_max_thrds, Thrd_FnCtx$(lockedWorker))) = A_zero();
+    let start = time_Instant_now();
+    for_(($r(0, thrd_count))(i) {
+        let seed = 0x9e3779b97f4a7c15ull * (i + 1);
+        if (conc) {
+            *A_at((conc_ctxs)[i]) = Thrd_FnCtx_from$((concWorker)(seed, write_pct));
+            Thrd_WaitGroup_spawn(&wg, g_gpa, A_at((conc_ctxs)[i])->as_raw);
+        } else {
+            *A_at((locked_ctxs)[i]) = Thrd_FnCtx_from$((lockedWorker)(seed, write_pct));
+            Thrd_WaitGroup_spawn(&wg, g_gpa, A_at((locked_ctxs)[i])->as_raw);
+        }
+    });
+    Thrd_WaitGroup_wait(&wg);
+    let secs = time_Duration_asSecs$f64(time_Instant_elapsed(start));
+    return as$(f64)(thrd_count * bench_ops_per_thrd) / secs / 1e6;
+} $unguarded_(fn);
+
+fn_((main(S$S_const$u8 args))(E$void) $guard) {
+    let_ignore = args;
+    var page = lit0$((heap_Page));
+    var smp = try_(heap_Smp_createOnHeap(heap_Page_allocator(&page), bench_max_thrds));
+    defer_(heap_Smp_destroyOnHeap(&smp));
+    g_gpa = heap_Smp_allocator(smp);
+
+    let ctx = HashMap_Ctx_for(typeInfo$(u64));
+    g_conc = try_(HashMapConc_init$1u64$2u64(ctx, g_gpa, 0, as$(u32)(bench_key_space)));
+    defer_(HashMapConc_fini$1u64$2u64(&g_conc, g_gpa));
+    g_locked = try_(HashMap_init$1u64$2u64(ctx, g_gpa, as$(u32)(bench_key_space)));
+    defer_(HashMap_fini$1u64$2u64(&g_locked, g_gpa));
+    g_rwlock = Thrd_RWLock_init();
+    defer_(Thrd_RWLock_fini(&g_rwlock));
+
+    /* Populate half the key space so reads see a realistic hit rate */
+    for_(($r(0, bench_key_space / 2))(i) {
+        let key = as$(u64)(i) * 2;
+        try_(HashMapConc_put$1u64$2u64(g_conc, g_gpa, key, key));
+        try_(HashMap_put$1u64$2u64(&g_locked, g_gpa, key, key));
+    });
+
+    let max_thrds = prim_min(catch_((Thrd_cpuCount())($ignore, 1)), as$(usize)(bench_max_thrds));
+    let_(write_pcts, A$$(3, u32)) = A_init({ 1, 10, 50 });
+    for_(($s(A_ref(write_pcts)))(write_pct) {
+        io_stream_println(u8_l("-- {:u}% writes --"), *write_pct);
+        io_stream_println(u8_l("{:>7s} | {:>14s} | {:>14s}"), u8_l("thrds"), u8_l("RWLock Mops/s"), u8_l("Conc Mops/s"));
+        for (usize thrds = 1; thrds <= max_thrds; thrds *= 2) {
+            let locked = run(thrds, *write_pct, false);
+            let conc = run(thrds, *write_pct, true);
+            io_stream_println(u8_l("{:>7uz} | {:>14.2fl} | {:>14.2fl}"), thrds, locked, conc);
+        }
+    });
+    return_ok({});
+} $unguarded_(fn);
@@ -0,0 +1,197 @@
+#include "dh/main.h"
+#include "dh/Thrd/Chan.h"
+#include "dh/Thrd/Cond.h"
+#include "dh/Thrd/Mtx.h"
+#include "dh/heap/Page.h"
+#include "dh/time/Instant.h"
+#include "dh/io/stream.h"
+
+T_use$((u64)(
+    Thrd_Chan,
+    Thrd_Chan_init,
+    Thrd_Chan_fini,
+    Thrd_Chan_send,
+    Thrd_Chan_sendS,
+    Thrd_Chan_recvS
+));
+
+#define bench_msgs (lit_n$(usize)(1u << 22))
+#define bench_cap (lit_n$(usize)(1024))
+#define bench_batch (16)
+#define bench_max_producers (8)
+
+typedef enum_(Kind $bits(8)) {
+    Kind_mtx_cond = 0,
+    Kind_mpmc = 1,
+    Kind_mpmc_batch = 2,
+    Kind_spsc = 3,
+} Kind;
+
+/* --- Baseline: ring guarded by a mutex and two condition variables --- */
+
+typedef struct LockedQue {
+    var_(mtx, Thrd_Mtx);
+    var_(not_empty, Thrd_Cond);
+    var_(not_full, Thrd_Cond);
+    var_(items, A$$(bench_cap, u64));
+    var_(head, usize);
+    var_(len, usize);
+} LockedQue;
+$static var_(g_locked, LockedQue) = {};
+
+$static fn_((lockedSend(u64 value))(void)) {
+    Thrd_Mtx_lock(&g_locked.mtx);
+    while (g_locked.len == bench_cap) { Thrd_Cond_wait(&g_locked.not_full, &g_locked.mtx); }
+    *A_at((g_locked.items)[(g_locked.head + g_locked.len) % bench_cap]) = value;
+    g_locked.len++;
+    Thrd_Cond_signal(&g_locked.not_empty);
+    Thrd_Mtx_unlock(&g_locked.mtx);
+};
+
+$static fn_((lockedRecv(void))(u64)) {
+    Thrd_Mtx_lock(&g_locked.mtx);
+    while (g_locked.len == 0) { Thrd_Cond_wait(&g_locked.not_empty, &g_locked.mtx); }
+    let value = *A_at((g_locked.items)[g_locked.head]);
+    g_locked.head = (g_locked.head + 1) % bench_cap;
+    g_locked.len--;
+    Thrd_Cond_signal(&g_locked.not_full);
+    Thrd_Mtx_unlock(&g_locked.mtx);
+    return value;
+};
+
+/* --- Workers: every message is the tick count at which it was sent --- */
+
+$static var_(g_chan, Thrd_Chan$u64) = {};
+
+$static Thrd_fn_(producer, ({ Kind kind; usize count; }, Void), ($ignore, args)$scope) {
+    var_(batch, A$$(bench_batch, u64)) = A_zero();
+    for (usize sent = 0; sent < args->count;) {
+        switch (args->kind) {
+        case Kind_mtx_cond:
+            lockedSend(time_Instant_ticks(time_Instant_now()));
+            sent++;
+            break;
+        case Kind_mpmc:
+        case Kind_spsc:
+            catch_((Thrd_Chan_send$u64(&g_chan, time_Instant_ticks(time_Instant_now())))($ignore, claim_unreachable));
+            sent++;
+            break;
+        case Kind_mpmc_batch: {
+            let len = prim_min(args->count - sent, A_len(batch));
+            let now = time_Instant_ticks(time_Instant_now());
+            for_(($r(0, len))(i) { *A_at((batch)[i]) = now; });
+            let items = slice$S(A_ref$((S$(const u64))(batch)), $r(0, len));
+            catch_((Thrd_Chan_sendS$u64(&g_chan, items))($ignore, claim_unreachable));
+            sent += len;
+        } break;
+        }
+    }
+    return_({});
+} $unscoped_(Thrd_fn);
+
+/// Receives `total` messages; returns the summed send-to-receive latency in ticks.
+$static fn_((consume(Kind kind, usize total))(u64)) {
+    var_(buf, A$$(bench_batch * 4, u64)) = A_zero();
+    var_(latency, u64) = 0;
+    for (usize received = 0; received < total;) {
+        if (kind == Kind_mtx_cond) {
+            let sent_at = lockedRecv();
+            latency += time_Instant_ticks(time_Instant_now()) - sent_at;
+            received++;
+            continue;
+        }
+        let count = catch_((Thrd_Chan_recvS$u64(&g_chan, A_ref$((S$u64)(buf))))($ignore, claim_unreachable));
+        let now = time_Instant_ticks(time_Instant_now());
+        for_(($r(0, count))(i) { latency += now - *A_at((buf)[i]); });
+        received += count;
+    }
+    return latency;
+};
+
+typedef struct Result {
+    var_(mmsgs_per_sec, f64);
+    var_(latency_us, f64);
+} Result;
+T_use_E$(Result);
+
+$static fn_((setup(Kind kind, mem_Allocator gpa))(E$void) $scope) {
+    if (kind != Kind_mtx_cond) {
+        let mode = kind == Kind_spsc ? Thrd_Chan_Mode_spsc : Thrd_Chan_Mode_mpmc;
+        g_chan = try_(Thrd_Chan_init$u64(gpa, bench_cap, mode));
+        return_ok({});
+    }
+    g_locked.mtx = Thrd_Mtx_init();
+    g_locked.not_empty = Thrd_Cond_init();
+    g_locked.not_full = Thrd_Cond_init();
+    g_locked.head = 0;
+    g_locked.len = 0;
+    return_ok({});
+} $unscoped_(fn);
+
+$static fn_((teardown(Kind kind, mem_Allocator gpa))(void)) {
+    if (kind != Kind_mtx_cond) {
+        Thrd_Chan_fini$u64(&g_chan, gpa);
+        return;
+    }
+    Thrd_Cond_fini(&g_locked.not_full);
+    Thrd_Cond_fini(&g_locked.not_empty);
+    Thrd_Mtx_fini(&g_locked.mtx);
+};
+
+$static fn_((run(Kind kind, usize producers, mem_Allocator gpa))(E$Result) $guard) {
+    try_(setup(kind, gpa));
+    defer_(teardown(kind, gpa));
+
+    var_(ctxs, A$$(bench_max_producers, Thrd_FnCtx$(producer))) = A_zero();
+    var_(thrds, A$$(bench_max_producers, Thrd)) = A_zero();
+    let per_producer = bench_msgs / producers;
+    let start = time_Instant_now();
+    for_(($r(0, producers))(i) {
+        *A_at((ctxs)[i]) = Thrd_FnCtx_from$((producer)(kind, per_producer));
+        *A_at((thrds)[i]) = try_(Thrd_spawn(Thrd_SpawnCfg_default, A_at((ctxs)[i])->as_raw));
+    });
+    let total = per_producer * producers;
+    let latency = consume(kind, total);
+    for_(($r(0, producers))(i) { let_ignore = Thrd_join(*A_at((thrds)[i])); });
+    let secs = time_Duration_asSecs$f64(time_Instant_elapsed(start));
+    return_ok({
+        .mmsgs_per_sec = as$(f64)(total) / secs / 1e6,
+        .latency_us = as$(f64)(latency) * time_Instant_freqInv() / as$(f64)(total) * 1e6,
+    });
+} $unguarded_(fn);
+
+fn_((main(S$S_const$u8 args))(E$void) $scope) {
+    let_ignore = args;
+    var page = (heap_Page){};
+    let gpa = heap_Page_allocator(&page);
+    $static let_(kinds, A$$(3, Kind)) = A_init({ Kind_mtx_cond, Kind_mpmc, Kind_mpmc_batch });
+
+    io_stream_println(u8_l("{:uz} messages through a {:uz}-slot queue into one consumer"), bench_msgs, bench_cap);
+    io_stream_println(
+        u8_l("{:>9s} | {:>13s} | {:>13s} | {:>13s} | {:>13s}"),
+        u8_l("producers"), u8_l("Mtx+Cond"), u8_l("Chan mpmc"), u8_l("Chan sendS"), u8_l("Chan spsc")
+    );
+    for (usize producers = 1; producers <= bench_max_producers; producers *= 2) {
+        var_(results, A$$(4, Result)) = A_zero();
+        for_(($r(0, A_len(kinds)))(i) { *A_at((results)[i]) = try_(run(*A_at((kinds)[i]), producers, gpa)); });
+        /* SPSC only applies to a single producer */
+        if (producers == 1) { *A_at((results)[3]) = try_(run(Kind_spsc, producers, gpa)); }
+        io_stream_println(
+            u8_l("{:>9uz} | {:>7.2fl} Mm/s | {:>7.2fl} Mm/s | {:>7.2fl} Mm/s | {:>7.2fl} Mm/s"),
+            producers,
+            A_at((results)[0])->mmsgs_per_sec,
+            A_at((results)[1])->mmsgs_per_sec,
+            A_at((results)[2])->mmsgs_per_sec,
+            A_at((results)[3])->mmsgs_per_sec
+        );
+        io_stream_println(
+            u8_l("{:>9s} | {:>8.2fl} us | {:>8.2fl} us | {:>8.2fl} us | {:>8.2fl} us"),
+            u8_l("latency"),
+            A_at((results)[0])->latency_us,
+            A_at((results)[1])->latency_us,
+            A_at((results)[2])->latency_us,
+            A_at((results)[3])->latency_us
+        );
+    }
+    return_ok({});
+} $unscoped_(fn);
@@ -0,0 +1,97 @@
+#include "dh/main.h"
+#include "dh/Thrd/Pool.h"
+#include "dh/heap/Page.h"
+#include "dh/time/Instant.h"
+#include "dh/io/stream.h"
+
+#define bench_pool_tasks (1ull << 20)
+#define bench_raw_tasks (1ull << 11)
+#define bench_fork_joins (1ull << 14)
+#define bench_raw_fork_joins (1ull << 8)
+#define bench_max_thrds (64)
+
+$static var_(bench_sink, atom_V$usize) = atom_V_init(0);
+
+$static Thrd_fn_(leaf, ({ usize idx; }, Void), ($ignore, args)$scope) {
+    atom_V_fetchAdd(&bench_sink, args->idx, atom_MemOrd_monotonic);
+    return_({});
+} $unscoped_(Thrd_fn);
+
+$static fn_((leafRange(R range))(void)) {
+    var_(acc, usize) = 0;
+    for (usize i = range.begin; i < range.end; ++i) { acc += i; }
+    atom_V_fetchAdd(&bench_sink, acc, atom_MemOrd_monotonic);
+};
+
+/// Million tasks per second; one task per index (grain 1).
+$static fn_((poolThroughput(Thrd_Pool* pool))(f64)) {
+    let start = time_Instant_now();
+    Thrd_Pool_parallelFor(pool, R_from(0, bench_pool_tasks), 1, wrapFn$(Thrd_Pool_ForFn, leafRange));
+    let secs = time_Duration_asSecs$f64(time_Instant_elapsed(start));
+    return as$(f64)(bench_pool_tasks) / secs / 1e6;
+};
+
+/// Same metric with one `Thrd_spawn`/`Thrd_join` per task.
+$static fn_((rawThroughput(void))(E$f64) $scope) {
+    var_(ctxs, A$$(bench_max_thrds, Thrd_FnCtx$(leaf))) = A_zero();
+    var_(thrds, A$$(bench_max_thrds, Thrd)) = A_zero();
+    let start = time_Instant_now();
+    /* Batches keep the number of live 16 MiB stacks bounded */
+    for (usize base = 0; base < bench_raw_tasks; base += bench_max_thrds) {
+        for_(($r(0, bench_max_thrds))(i) {
+            *A_at((ctxs)[i]) = Thrd_FnCtx_from$((leaf)(base + i));
+            *A_at((thrds)[i]) = try_(Thrd_spawn(Thrd_SpawnCfg_default, A_at((ctxs)[i])->as_raw));
+        });
+        for_(($a(thrds))(thrd) { let_ignore = Thrd_join(*thrd); });
+    }
+    let secs = time_Duration_asSecs$f64(time_Instant_elapsed(start));
+    return_ok(as$(f64)(bench_raw_tasks) / secs / 1e6);
+} $unscoped_(fn);
+
+/// Microseconds per fork/join of one chunk per worker.
+$static fn_((poolForkJoin(Thrd_Pool* pool))(f64)) {
+    let width = Thrd_Pool_thrdCount(pool);
+    let start = time_Instant_now();
+    for_(($r(0, bench_fork_joins))($ignore) {
+        Thrd_Pool_parallelFor(pool, R_from(0, width), 1, wrapFn$(Thrd_Pool_ForFn, leafRange));
+    });
+    let secs = time_Duration_asSecs$f64(time_Instant_elapsed(start));
+    return secs / as$(f64)(bench_fork_joins) * 1e6;
+};
+
+$static fn_((rawForkJoin(usize width))(E$f64) $scope) {
+    var_(ctxs, A$$(bench_max_thrds, Thrd_FnCtx$(leaf))) = A_zero();
+    var_(thrds, A$$(bench_max_thrds, Thrd)) = A_zero();
+    let start = time_Instant_now();
+    for_(($r(0, bench_raw_fork_joins))($ignore) {
+        for_(($r(0, width))(i) {
+            *A_at((ctxs)[i]) = Thrd_FnCtx_from$((leaf)(i));
+            *A_at((thrds)[i]) = try_(Thrd_spawn(Thrd_SpawnCfg_default, A_at((ctxs)[i])->as_raw));
+        });
+        for_(($r(0, width))(i) { let_ignore = Thrd_join(*A_at((thrds)[i])); });
+    });
+    let secs = time_Duration_asSecs$f64(time_Instant_elapsed(start));
+    return_ok(secs / as$(f64)(bench_raw_fork_joins) * 1e6);
+} $unscoped_(fn);
+
+fn_((main(S$S_const$u8 args))(E$void) $guard) {
+    let_ignore = args;
+    var page = (heap_Page){};
+    let cpus = prim_min(catch_((Thrd_cpuCount())($ignore, 1)), as$(usize)(bench_max_thrds));
+    var pool = lit0$((Thrd_Pool));
+    var cfg = Thrd_Pool_Cfg_default;
+    cfg.thrd_count = intCast$((u32)(cpus));
+    try_(Thrd_Pool_init(&pool, heap_Page_allocator(&page), cfg));
+    defer_(Thrd_Pool_fini(&pool));
+
+    io_stream_println(u8_l("workers: {:uz}"), Thrd_Pool_thrdCount(&pool));
+    io_stream_println(u8_l("{:>12s} | {:>14s} | {:>14s}"), u8_l(""), u8_l("Thrd_spawn"), u8_l("Thrd_Pool"));
+    let raw_tput = try_(rawThroughput());
+    let pool_tput = poolThroughput(&pool);
+    io_stream_println(u8_l("{:>12s} | {:>14.3fl} | {:>14.3fl}"), u8_l("Mtasks/s"), raw_tput, pool_tput);
+    let raw_fj = try_(rawForkJoin(cpus));
+    let pool_fj = poolForkJoin(&pool);
+    io_stream_println(u8_l("{:>12s} | {:>14.2fl} | {:>14.2fl}"), u8_l("fork/join us"), raw_fj, pool_fj);
+    io_stream_println(u8_l("(sink {:uz})"), atom_V_load(&bench_sink, atom_MemOrd_monotonic));
+    return_ok({});
+} $unguarded_(fn);
@@ -0,0 +1,176 @@
+#include "dh/main.h"
+#include "dh/async/Exec.h"
+#include "dh/ArrPQueIdx.h"
+#include "dh/heap/Page.h"
+#include "dh/Rand.h"
+#include "dh/time/Instant.h"
+#include "dh/io/stream.h"
+
+/// Timers per queue, with deadlines spread over `bench_horizon_ms`; every other one is cancelled.
+#define bench_timers (lit_n$(usize)(1) << 20)
+#define bench_horizon_ms (60000u)
+/// Coroutines driven by the loop, each suspending `bench_rounds` times
+#define bench_coroutines (lit_n$(usize)(1) << 17)
+#define bench_rounds (16u)
+
+T_use$((Co_Timer)(S));
+T_use$((u64)(
+    ArrPQueIdx,
+    ArrPQueIdx_init,
+    ArrPQueIdx_fini,
+    ArrPQueIdx_enqueWithin,
+    ArrPQueIdx_deque,
+    ArrPQueIdx_remove,
+));
+
+typedef enum Kind {
+    /// `ArrPQueIdx` keyed by deadline, cancelled by handle
+    Kind_heap,
+    /// `Co_Exec` timing wheel
+    Kind_wheel,
+    Kind_count
+} Kind;
+
+typedef struct Rates {
+    var_(insert_ns, f64);
+    var_(cancel_ns, f64);
+    var_(fire_ns, f64);
+    var_(fired, usize);
+} Rates;
+T_use_E$(Rates);
+
+$static fn_((nsPer(time_Instant start, usize count))(f64)) {
+    return time_Duration_asSecs$f64(time_Instant_elapsed(start)) * 1e9 / as$(f64)(count);
+};
+
+$static fn_((timeHeap(S_const$u64 delays, mem_Allocator gpa))(E$Rates) $guard) {
+    let ctx = ArrPQue_Ctx_defaultAsc(cmp_MathType_u64);
+    var pq = try_(ArrPQueIdx_init$u64(gpa, delays.len, ArrPQueIdx_arity_default, &ctx));
+    defer_(ArrPQueIdx_fini$u64(&pq, gpa));
+    var_(rates, Rates) = {};
+
+    var start = time_Instant_now();
+    for_(($rf(0), $s(delays))(handle, delay) { ArrPQueIdx_enqueWithin$u64(&pq, handle, *delay); });
+    rates.insert_ns = nsPer(start, delays.len);
+
+    start = time_Instant_now();
+    for (usize handle = 0; handle < delays.len; handle += 2) { let_ignore = ArrPQueIdx_remove$u64(&pq, handle); }
+    rates.cancel_ns = nsPer(start, delays.len / 2);
+
+    start = time_Instant_now();
+    while_some(ArrPQueIdx_deque$u64(&pq, null), handle) {
+        let_ignore = handle;
+        rates.fired++;
+    }
+    rates.fire_ns = nsPer(start, rates.fired);
+    return_ok(rates);
+} $unguarded_(fn);
+
+$static fn_((timeWheel(S_const$u64 delays, mem_Allocator gpa))(E$Rates) $guard) {
+    let timers = u_castS$((S$Co_Timer)(try_(mem_Allocator_alloc(gpa, typeInfo$(Co_Timer), delays.len))));
+    defer_(mem_Allocator_free(gpa, u_anyS(timers)));
+    for_(($s(timers))(timer) { *timer = Co_Timer_init(); });
+    // A finished frame is queued on expiry but never resumed
+    var done = lit$((Co_Ctx){ .is_init = true, .state = Co_State_ready });
+    var exec = lit0$((Co_Exec));
+    Co_Exec_init(&exec, gpa, time_Duration_milli);
+    defer_(Co_Exec_fini(&exec));
+    var_(rates, Rates) = {};
+
+    var start = time_Instant_now();
+    for_(($s(timers), $s(delays))(timer, delay) {
+        Co_Exec_arm(&exec, timer, &done, time_Duration_fromMillis(*delay));
+    });
+    rates.insert_ns = nsPer(start, delays.len);
+
+    start = time_Instant_now();
+    for (usize i = 0; i < timers.len; i += 2) { let_ignore = Co_Exec_cancel(&exec, S_at((timers)[i])); }
+    rates.cancel_ns = nsPer(start, timers.len / 2);
+
+    start = time_Instant_now();
+    Co_Exec_advanceTo(&exec, time_Instant_addDuration(Co_Exec_now(&exec), time_Duration_fromMillis(bench_horizon_ms + 1)));
+    try_(Co_Exec_drain(&exec));
+    rates.fired = Co_Exec_readyLen(&exec);
+    rates.fire_ns = nsPer(start, rates.fired);
+    let_ignore = Co_Exec_runReady(&exec);
+    return_ok(rates);
+} $unguarded_(fn);
+
+use_Co_Ctx$(Void);
+async_fn_(ticker, (var_(exec, Co_Exec*); var_(delay_ms, u64);), Void);
+async_fn_scope(ticker, {
+    var_(timer, Co_Timer);
+    var_(round, u32);
+}) {
+    for (locals->round = 0; locals->round < bench_rounds; ++locals->round) {
+        Co_sleep(args->exec, &locals->timer, time_Duration_fromMillis(args->delay_ms));
+    }
+    areturn_({});
+} $unscoped_(async_fn);
+typedef Co_CtxFn$(ticker) Ticker;
+T_use$((Ticker)(S));
+
+/// Nanoseconds per resume, stepping a simulated clock one tick per loop iteration.
+/// Each ticker sleeps a random `1..=max_delay_ms` per round, or just yields when it is zero.
+$static fn_((timeLoop(S$Ticker frames, mem_Allocator gpa, u64 max_delay_ms))(E$f64) $guard) {
+    var exec = lit0$((Co_Exec));
+    Co_Exec_init(&exec, gpa, time_Duration_milli);
+    defer_(Co_Exec_fini(&exec));
+    var rng = Rand_initSeed(0x22);
+    for_(($s(frames))(frame) {
+        let delay_ms = max_delay_ms == 0 ? 0 : 1 + Rand_next$u64(&rng) % max_delay_ms;
+        *frame = *async_ctx((ticker)(&exec, delay_ms));
+        try_(Co_Exec_spawn(&exec, frame->anyraw));
+    });
+
+    var_(resumed, usize) = 0;
+    let start = time_Instant_now();
+    while (!Co_Exec_isIdle(&exec)) {
+        resumed += Co_Exec_runReady(&exec);
+        Co_Exec_advanceTo(&exec, time_Instant_addDuration(Co_Exec_now(&exec), time_Duration_milli));
+        try_(Co_Exec_drain(&exec));
+    }
+    let ns = nsPer(start, resumed);
+    claim_assert(resumed == frames.len * (bench_rounds + 1));
+    return_ok(ns);
+} $unguarded_(fn);
+
+fn_((main(S$S_const$u8 args))(E$void) $guard) {
+    let_ignore = args;
+    var page = lit0$((heap_Page));
+    let gpa = heap_Page_allocator(&page);
+    let delays = u_castS$((S$u64)(try_(mem_Allocator_alloc(gpa, typeInfo$(u64), bench_timers))));
+    defer_(mem_Allocator_free(gpa, u_anyS(delays)));
+    var rng = Rand_initSeed(0x22);
+    for_(($s(delays))(delay) { *delay = 1 + Rand_next$u64(&rng) % bench_horizon_ms; });
+    let_(kind_names, A$$(Kind_count, S_const$u8)) = A_init({
+        u8_l("ArrPQueIdx"), u8_l("Co_Exec"),
+    });
+
+    io_stream_println(u8_l("{:uz} timers over {:u} ms, half cancelled"), bench_timers, bench_horizon_ms);
+    io_stream_println(
+        u8_l("{:>10s} | {:>9s} | {:>9s} | {:>9s} | {:>8s}"),
+        u8_l("queue"), u8_l("insert ns"), u8_l("cancel ns"), u8_l("fire ns"), u8_l("fired")
+    );
+    for (Kind kind = 0; kind < Kind_count; ++kind) {
+        let rates = kind == Kind_heap
+                      ? try_(timeHeap(delays.as_const, gpa))
+                      : try_(timeWheel(delays.as_const, gpa));
+        claim_assert(rates.fired == bench_timers / 2);
+        io_stream_println(
+            u8_l("{:>10s} | {:>9.1fl} | {:>9.1fl} | {:>9.1fl} | {:>8uz}"),
+            *A_at((kind_names)[kind]), rates.insert_ns, rates.cancel_ns, rates.fire_ns, rates.fired
+        );
+    }
+
+    let frames = u_castS$((S$Ticker)(try_(mem_Allocator_alloc(gpa, typeInfo$(Ticker), bench_coroutines))));
+    defer_(mem_Allocator_free(gpa, u_anyS(frames)));
+    io_stream_println(u8_l("{:uz} coroutines x {:u} suspensions"), bench_coroutines, bench_rounds);
+    io_stream_println(u8_l("{:>10s} | {:>9s}"), u8_l("sleep ms"), u8_l("ns/resume"));
+    let_(max_delays, A$$(3, u64)) = A_init({ 0, 8, 64 });
+    for_(($a(max_delays))(max_delay_ms) {
+        let ns = try_(timeLoop(frames, gpa, *max_delay_ms));
+        io_stream_println(u8_l("{:>10ul} | {:>9.1fl}"), *max_delay_ms, ns);
+    });
+    return_ok({});
+} $unguarded_(fn);
@@ -0,0 +1,207 @@
+#include "dh/main.h"
+#include "dh/async/Sched.h"
+#include "dh/heap/Page.h"
+#include "dh/time/Instant.h"
+#include "dh/io/stream.h"
+#include "dh/math.h"
+
+#define bench_boids (4096u)
+/// Even, so every boid hears from the same number of boids it talks to
+#define bench_neighbors (16u)
+#define bench_frames (64u)
+#define bench_max_thrds (64)
+
+#define bench_world (128.0f)
+#define bench_separation_radius (8.0f)
+#define bench_alignment_radius (32.0f)
+#define bench_separation_force (0.05f)
+#define bench_alignment_force (0.05f)
+#define bench_cohesion_force (0.01f)
+#define bench_max_speed (2.0f)
+
+/// Boid actor from the actor draft; `sum_*`, `separation` and `count` gather one frame of neighbor messages
+typedef struct Boid {
+    var_(mailbox, Co_Mailbox);
+    var_(pos, m_V2f32);
+    var_(vel, m_V2f32);
+    var_(sum_pos, m_V2f32);
+    var_(sum_vel, m_V2f32);
+    var_(separation, m_V2f32);
+    var_(count, u32);
+} Boid;
+T_use$((Boid)(S));
+
+typedef struct Msg {
+    var_(node, Co_Mailbox_Node);
+    var_(pos, m_V2f32);
+    var_(vel, m_V2f32);
+} Msg;
+T_use$((Msg)(S));
+T_use$((Co_Task)(S));
+
+/// Boids talk to the `bench_neighbors` nearest indices on a ring, which stands in for a spatial grid
+typedef struct Flock {
+    var_(boids, S$Boid);
+    var_(tasks, S$Co_Task);
+    /// `bench_neighbors` outgoing messages per boid, reused every frame
+    var_(msgs, S$Msg);
+    /// Boids done with the current frame
+    var_(arrived, atom_V$u32);
+    var_(frame, atom_V$u32);
+} Flock;
+
+$static fn_((neighborOf(usize idx, usize slot))(usize)) {
+    let off = slot / 2 + 1;
+    return slot % 2 == 0 ? (idx + off) % bench_boids : (idx + bench_boids - off) % bench_boids;
+};
+
+/// Safe to reuse the messages: the frame barrier means every receiver took last frame's
+$static fn_((broadcast(Flock* flock, usize idx))(void)) {
+    let self = S_at((flock->boids)[idx]);
+    for (usize slot = 0; slot < bench_neighbors; ++slot) {
+        let msg = S_at((flock->msgs)[idx * bench_neighbors + slot]);
+        msg->pos = self->pos;
+        msg->vel = self->vel;
+        Co_Mailbox_send(&S_at((flock->boids)[neighborOf(idx, slot)])->mailbox, &msg->node);
+    }
+};
+
+$static fn_((observe(Boid* self, const Msg* msg))(void)) {
+    let diff = m_V2f32_sub(msg->pos, self->pos);
+    let dist = m_V2f32_len(diff);
+    if (dist < 0.001f) { return; }
+    if (dist < bench_separation_radius) {
+        m_V2f32_subAsg(&self->separation, m_V2f32_scalInv(diff, dist));
+    }
+    if (dist < bench_alignment_radius) {
+        m_V2f32_addAsg(&self->sum_pos, msg->pos);
+        m_V2f32_addAsg(&self->sum_vel, msg->vel);
+        self->count++;
+    }
+};
+
+$static fn_((steer(Boid* self))(void)) {
+    if (self->count > 0) {
+        let n = as$(f32)(self->count);
+        let align = m_V2f32_sub(m_V2f32_scalInv(self->sum_vel, n), self->vel);
+        let cohesion = m_V2f32_sub(m_V2f32_scalInv(self->sum_pos, n), self->pos);
+        m_V2f32_addAsg(&self->vel, m_V2f32_scal(self->separation, bench_separation_force));
+        m_V2f32_addAsg(&self->vel, m_V2f32_scal(align, bench_alignment_force));
+        m_V2f32_addAsg(&self->vel, m_V2f32_scal(cohesion, bench_cohesion_force));
+        let speed = m_V2f32_len(self->vel);
+        if (speed > bench_max_speed) { self->vel = m_V2f32_scal(self->vel, bench_max_speed / speed); }
+    }
+    m_V2f32_addAsg(&self->pos, self->vel);
+    self->pos = m_V2f32_wrap(self->pos, m_V2f32_zero, m_V2f32_splat(bench_world));
+    self->sum_pos = m_V2f32_zero;
+    self->sum_vel = m_V2f32_zero;
+    self->separation = m_V2f32_zero;
+    self->count = 0;
+};
+
+/// The last boid to arrive opens the next frame and wakes the rest
+$static fn_((arrive(Flock* flock, usize idx, u32 frame))(bool)) {
+    if (atom_V_fetchAdd(&flock->arrived, 1, atom_MemOrd_acq_rel) + 1 != bench_boids) { return false; }
+    atom_V_store(&flock->arrived, 0, atom_MemOrd_monotonic);
+    atom_V_store(&flock->frame, frame + 1, atom_MemOrd_release);
+    for_(($rf(0), $s(flock->tasks))(i, task) {
+        if (i != idx) { Co_Task_wake(task); }
+    });
+    return true;
+};
+
+use_Co_Ctx$(Void);
+async_fn_(boid, (var_(flock, Flock*); var_(idx, usize);), Void);
+async_fn_scope(boid, {
+    var_(frame, u32);
+    var_(received, u32);
+    var_(node, Co_Mailbox_Node*);
+}) {
+    for (locals->frame = 0; locals->frame < bench_frames; ++locals->frame) {
+        broadcast(args->flock, args->idx);
+        for (locals->received = 0; locals->received < bench_neighbors; ++locals->received) {
+            Co_Mailbox_recv(&S_at((args->flock->boids)[args->idx])->mailbox, locals->node);
+            observe(S_at((args->flock->boids)[args->idx]), as$(const Msg*)(locals->node));
+        }
+        steer(S_at((args->flock->boids)[args->idx]));
+        if (!arrive(args->flock, args->idx, locals->frame)) {
+            while (atom_V_load(&args->flock->frame, atom_MemOrd_acquire) == locals->frame) { suspend_(); }
+        }
+    }
+    areturn_({});
+} $unscoped_(async_fn);
+typedef Co_CtxFn$(boid) BoidFrame;
+T_use$((BoidFrame)(S));
+
+/// Xorshift draw in [0, 1)
+$static fn_((nextUnit(u64* state))(f32)) {
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return as$(f32)(*state >> 40) / as$(f32)(1u << 24);
+};
+
+/// Same starting flock for every worker count; tasks are zeroed since neighbors send before they are spawned
+$static fn_((resetFlock(Flock* flock))(void)) {
+    var_(rng, u64) = 0x9e3779b97f4a7c15ull;
+    for_(($s(flock->boids), $s(flock->tasks))(boid, task) {
+        *task = lit0$((Co_Task));
+        Co_Mailbox_init(&boid->mailbox, task);
+        boid->pos = m_V2f32_of(nextUnit(&rng) * bench_world, nextUnit(&rng) * bench_world);
+        boid->vel = m_V2f32_of(nextUnit(&rng) * 2.0f - 1.0f, nextUnit(&rng) * 2.0f - 1.0f);
+        boid->sum_pos = m_V2f32_zero;
+        boid->sum_vel = m_V2f32_zero;
+        boid->separation = m_V2f32_zero;
+        boid->count = 0;
+    });
+    atom_V_store(&flock->arrived, 0, atom_MemOrd_monotonic);
+    atom_V_store(&flock->frame, 0, atom_MemOrd_monotonic);
+};
+
+/// Milliseconds per frame on `workers` threads
+$static fn_((runFlock(Flock* flock, S$BoidFrame frames, usize workers, mem_Allocator gpa))(E$f64) $guard) {
+    resetFlock(flock);
+    var sched = lit0$((Co_Sched));
+    var cfg = Co_Sched_Cfg_default;
+    cfg.thrd_count = intCast$((u32)(workers));
+    try_(Co_Sched_init(&sched, gpa, cfg));
+    defer_(Co_Sched_fini(&sched));
+
+    let start = time_Instant_now();
+    for_(($rf(0), $s(frames), $s(flock->tasks))(idx, frame, task) {
+        *frame = *async_ctx((boid)(flock, idx));
+        Co_Sched_spawn(&sched, task, frame->anyraw);
+    });
+    Co_Sched_wait(&sched);
+    let secs = time_Duration_asSecs$f64(time_Instant_elapsed(start));
+    return_ok(secs / as$(f64)(bench_frames) * 1e3);
+} $unguarded_(fn);
+
+fn_((main(S$S_const$u8 args))(E$void) $guard) {
+    let_ignore = args;
+    var page = lit0$((heap_Page));
+    let gpa = heap_Page_allocator(&page);
+    let cpus = prim_min(catch_((Thrd_cpuCount())($ignore, 1)), as$(usize)(bench_max_thrds));
+    var flock = lit0$((Flock));
+    flock.boids = u_castS$((S$Boid)(try_(mem_Allocator_alloc(gpa, typeInfo$(Boid), bench_boids))));
+    defer_(mem_Allocator_free(gpa, u_anyS(flock.boids)));
+    flock.tasks = u_castS$((S$Co_Task)(try_(mem_Allocator_alloc(gpa, typeInfo$(Co_Task), bench_boids))));
+    defer_(mem_Allocator_free(gpa, u_anyS(flock.tasks)));
+    flock.msgs = u_castS$((S$Msg)(try_(mem_Allocator_alloc(gpa, typeInfo$(Msg), bench_boids * bench_neighbors))));
+    defer_(mem_Allocator_free(gpa, u_anyS(flock.msgs)));
+    let frames = u_castS$((S$BoidFrame)(try_(mem_Allocator_alloc(gpa, typeInfo$(BoidFrame), bench_boids))));
+    defer_(mem_Allocator_free(gpa, u_anyS(frames)));
+
+    io_stream_println(
+        u8_l("{:u} boid actors x {:u} neighbors x {:u} frames"),
+        bench_boids, bench_neighbors, bench_frames
+    );
+    io_stream_println(u8_l("{:>10s} | {:>9s} | {:>9s}"), u8_l("workers"), u8_l("ms/frame"), u8_l("speedup"));
+    var_(base_ms, f64) = 0.0;
+    for (usize workers = 1; workers != 0; workers = workers < cpus ? prim_min(workers * 2, cpus) : 0) {
+        let ms = try_(runFlock(&flock, frames, workers, gpa));
+        if (workers == 1) { base_ms = ms; }
+        io_stream_println(u8_l("{:>10uz} | {:>9.2fl} | {:>9.2fl}"), workers, ms, base_ms / ms);
+    }
+    return_ok({});
+} $unguarded_(fn);
@@ -0,0 +1,239 @@
+#include "dh/main.h"
+#include "dh/ArrList.h"
+#include "dh/ArrPQue.h"
+#include "dh/sort.h"
+#include "dh/mem/common.h"
+#include "dh/heap/Page.h"
+#include "dh/time/Instant.h"
+#include "dh/io/stream.h"
+
+#define bench_ops (lit_n$(usize)(1u << 20))
+
+/// 32-byte record keyed by its first field
+typedef struct Rec32 {
+    u64 key;
+    A$$(3, u64) payload;
+} Rec32;
+T_use$((Rec32)(P, S, O));
+
+T_use$((u32)(ArrList, ArrList_init, ArrList_fini, ArrList_append, ArrList_at, ArrList_pop));
+T_use$((u64)(ArrList, ArrList_init, ArrList_fini, ArrList_append, ArrList_at, ArrList_pop));
+T_use$((Rec32)(ArrList, ArrList_init, ArrList_fini, ArrList_append, ArrList_at, ArrList_pop));
+T_use$((u32)(ArrPQue, ArrPQue_init, ArrPQue_fini, ArrPQue_enque, ArrPQue_deque));
+T_use$((u64)(ArrPQue, ArrPQue_init, ArrPQue_fini, ArrPQue_enque, ArrPQue_deque));
+T_use$((Rec32)(ArrPQue, ArrPQue_init, ArrPQue_fini, ArrPQue_enque, ArrPQue_deque));
+
+$static fn_((make$u32(usize i))(u32)) { return as$(u32)(i); };
+$static fn_((make$u64(usize i))(u64)) { return as$(u64)(i); };
+$static fn_((make$Rec32(usize i))(Rec32)) { return (Rec32){ .key = i, .payload = A_init({ i, i, i }) }; };
+$static fn_((keyOf$u32(u32 val))(u64)) { return val; };
+$static fn_((keyOf$u64(u64 val))(u64)) { return val; };
+$static fn_((keyOf$Rec32(Rec32 val))(u64)) { return val.key; };
+
+$static fn_((ordRec32(u_V$raw lhs, u_V$raw rhs, u_V$raw ctx))(cmp_Ord)) {
+    let_ignore = ctx;
+    return prim_ord(u_castV$((Rec32)(lhs)).key, u_castV$((Rec32)(rhs)).key);
+};
+$static fn_((ctx$u32(void))(ArrPQue_Ctx)) { return ArrPQue_Ctx_defaultAsc(cmp_MathType_u32); };
+$static fn_((ctx$u64(void))(ArrPQue_Ctx)) { return ArrPQue_Ctx_defaultAsc(cmp_MathType_u64); };
+$static fn_((ctx$Rec32(void))(ArrPQue_Ctx)) {
+    $static let_(inner, Void) = {};
+    return (ArrPQue_Ctx){ .inner = u_anyP(&inner), .ordFn = ordRec32 };
+};
+
+typedef enum Op {
+    Op_push,
+    Op_get,
+    Op_pop,
+    Op_enque,
+    Op_deque,
+    Op_count
+} Op;
+
+$static var_(bench_sink, u64) = 0;
+
+$static fn_((nsPerOp(time_Instant start))(f64)) {
+    return time_Duration_asSecs$f64(time_Instant_elapsed(start)) * 1e9 / as$(f64)(bench_ops);
+};
+
+/// Fills `ns[op]` with the cost of each operation, either through the typed
+/// wrappers (`typed`) or the TypeInfo-driven API they fall back to.
+#define bench_defineOps$(_T...) \
+    $static fn_((tpl_id(benchOps, _T)(mem_Allocator gpa, bool typed, A$$(Op_count, f64)* ns))(mem_Err$void) $guard) { \
+        var list = try_(tpl_id(ArrList_init, _T)(gpa, 0)); \
+        defer_(tpl_id(ArrList_fini, _T)(&list, gpa)); \
+        var start = time_Instant_now(); \
+        for (usize i = 0; i < bench_ops; ++i) { \
+            let item = tpl_id(make, _T)(i); \
+            if (typed) { \
+                try_(tpl_id(ArrList_append, _T)(&list, gpa, item)); \
+            } else { \
+                try_(ArrList_append(list.as_raw, gpa, u_anyV(item))); \
+            } \
+        } \
+        *A_at((*ns)[Op_push]) = nsPerOp(start); \
+        start = time_Instant_now(); \
+        for (usize i = 0; i < bench_ops; ++i) { \
+            let item = typed \
+                ? *tpl_id(ArrList_at, _T)(list, i) \
+                : *u_castP$((const _T*)(ArrList_at(*list.as_raw, typeInfo$(_T), i))); \
+            bench_sink += tpl_id(keyOf, _T)(item); \
+        } \
+        *A_at((*ns)[Op_get]) = nsPerOp(start); \
+        start = time_Instant_now(); \
+        for (usize i = 0; i < bench_ops; ++i) { \
+            if (typed) { \
+                bench_sink += tpl_id(ArrList_pop, _T)(&list).is_some; \
+            } else { \
+                bench_sink += ArrList_pop(list.as_raw, u_retV$(_T)).is_some; \
+            } \
+        } \
+        *A_at((*ns)[Op_pop]) = nsPerOp(start); \
+\
+        let ctx = tpl_id(ctx, _T)(); \
+        var que = try_(tpl_id(ArrPQue_init, _T)(gpa, 0, &ctx)); \
+        defer_(tpl_id(ArrPQue_fini, _T)(&que, gpa)); \
+        start = time_Instant_now(); \
+        for (usize i = 0; i < bench_ops; ++i) { \
+            /* scrambled insertion order */ \
+            let item = tpl_id(make, _T)((i * 2654435761u) % bench_ops); \
+            if (typed) { \
+                try_(tpl_id(ArrPQue_enque, _T)(&que, gpa, item)); \
+            } else { \
+                try_(ArrPQue_enque(que.as_raw, gpa, u_anyV(item))); \
+            } \
+        } \
+        *A_at((*ns)[Op_enque]) = nsPerOp(start); \
+        start = time_Instant_now(); \
+        for (usize i = 0; i < bench_ops; ++i) { \
+            if (typed) { \
+                bench_sink += tpl_id(ArrPQue_deque, _T)(&que).is_some; \
+            } else { \
+                bench_sink += ArrPQue_deque(que.as_raw, u_retV$(_T)).is_some; \
+            } \
+        } \
+        *A_at((*ns)[Op_deque]) = nsPerOp(start); \
+        return_ok({}); \
+    } $unguarded_(fn)
+bench_defineOps$(u32);
+bench_defineOps$(u64);
+bench_defineOps$(Rec32);
+
+$static fn_((ordU32(u_V$raw lhs, u_V$raw rhs))(cmp_Ord)) {
+    return prim_ord(u_castV$((u32)(lhs)), u_castV$((u32)(rhs)));
+};
+$static fn_((ordU64(u_V$raw lhs, u_V$raw rhs))(cmp_Ord)) {
+    return prim_ord(u_castV$((u64)(lhs)), u_castV$((u64)(rhs)));
+};
+$static fn_((ordRec32Key(u_V$raw lhs, u_V$raw rhs))(cmp_Ord)) {
+    return prim_ord(u_castV$((Rec32)(lhs)).key, u_castV$((Rec32)(rhs)).key);
+};
+$static fn_((keyRec32(u_V$raw item))(u64)) {
+    return u_castV$((Rec32)(item)).key;
+};
+
+/// ns per element: comparison sort through `sort_OrdFn` vs the key-specialized radix sort.
+$static fn_((benchSort(mem_Allocator gpa, TypeInfo type, A$$(2, f64)* ns))(mem_Err$void) $guard) {
+    let seq = try_(mem_Allocator_alloc(gpa, type, bench_ops));
+    defer_(mem_Allocator_free(gpa, seq));
+    for_(($r(0, A_len(*ns)))(pass) {
+        /* the same scrambled keys for both passes */
+        for_(($r(0, bench_ops))(i) {
+            let key = (i * 2654435761u) % bench_ops;
+            if (type.size == sizeOf$(u32)) {
+                *S_at((u_castS$((S$u32)(seq)))[i]) = as$(u32)(key);
+            } else if (type.size == sizeOf$(u64)) {
+                *S_at((u_castS$((S$u64)(seq)))[i]) = key;
+            } else {
+                *S_at((u_castS$((S$Rec32)(seq)))[i]) = make$Rec32(key);
+            }
+        });
+        let start = time_Instant_now();
+        if (type.size == sizeOf$(u32)) {
+            if (pass == 0) sort_pdq(seq, wrapFn$(sort_OrdFn, ordU32));
+            else try_(sort_radix$u32(gpa, u_castS$((S$u32)(seq))));
+        } else if (type.size == sizeOf$(u64)) {
+            if (pass == 0) sort_pdq(seq, wrapFn$(sort_OrdFn, ordU64));
+            else try_(sort_radix$u64(gpa, u_castS$((S$u64)(seq))));
+        } else {
+            if (pass == 0) sort_pdq(seq, wrapFn$(sort_OrdFn, ordRec32Key));
+            else try_(sort_radixByKey(gpa, seq, wrapFn$(sort_KeyFn, keyRec32)));
+        }
+        *A_at((*ns)[pass]) = nsPerOp(start);
+    });
+    return_ok({});
+} $unguarded_(fn);
+
+/// ns per element: `mem_copy` (one bulk memcpy) vs the former per-element `u_memcpy` loop.
+$static fn_((benchCopy(mem_Allocator gpa, A$$(2, f64)* ns))(mem_Err$void) $guard) {
+    let src = try_(mem_Allocator_alloc(gpa, typeInfo$(Rec32), bench_ops));
+    defer_(mem_Allocator_free(gpa, src));
+    let dst = try_(mem_Allocator_alloc(gpa, typeInfo$(Rec32), bench_ops));
+    defer_(mem_Allocator_free(gpa, dst));
+    u_memset0S(src);
+    var start = time_Instant_now();
+    for_(($r(0, bench_ops))(i) { u_memcpy(u_atS(dst, i), u_atS(src, i).as_const); });
+    *A_at((*ns)[0]) = nsPerOp(start);
+    start = time_Instant_now();
+    mem_copy(dst, src.as_const);
+    *A_at((*ns)[1]) = nsPerOp(start);
+    return_ok({});
+} $unguarded_(fn);
+
+fn_((main(S$S_const$u8 args))(E$void) $scope) {
+    let_ignore = args;
+    var page = (heap_Page){};
+    let gpa = heap_Page_allocator(&page);
+    let_(op_names, A$$(Op_count, S_const$u8)) = A_init({
+        u8_l("push"), u8_l("get"), u8_l("pop"), u8_l("enque"), u8_l("deque"),
+    });
+    let_(type_names, A$$(3, S_const$u8)) = A_init({ u8_l("u32"), u8_l("u64"), u8_l("Rec32") });
+
+    io_stream_println(u8_l("{:uz} ops each, ns/op"), bench_ops);
+    io_stream_println(u8_l("{:>5s} | {:>6s} | {:>9s} | {:>9s}"), u8_l("type"), u8_l("op"), u8_l("TypeInfo"), u8_l("typed"));
+    for_(($r(0, A_len(type_names)))(t) {
+        var_(generic, A$$(Op_count, f64)) = A_zero();
+        var_(typed, A$$(Op_count, f64)) = A_zero();
+        switch (t) {
+        case 0:
+            try_(benchOps$u32(gpa, false, &generic));
+            try_(benchOps$u32(gpa, true, &typed));
+            break;
+        case 1:
+            try_(benchOps$u64(gpa, false, &generic));
+            try_(benchOps$u64(gpa, true, &typed));
+            break;
+        default:
+            try_(benchOps$Rec32(gpa, false, &generic));
+            try_(benchOps$Rec32(gpa, true, &typed));
+            break;
+        }
+        for_(($r(0, Op_count))(op) {
+            io_stream_println(
+                u8_l("{:>5s} | {:>6s} | {:>9.2fl} | {:>9.2fl}"),
+                *A_at((type_names)[t]), *A_at((op_names)[op]), *A_at((generic)[op]), *A_at((typed)[op])
+            );
+        });
+    });
+
+    let_(sort_types, A$$(3, TypeInfo)) = A_init({ typeInfo$(u32), typeInfo$(u64), typeInfo$(Rec32) });
+    io_stream_println(u8_l("{:>5s} | {:>6s} | {:>9s} | {:>9s}"), u8_l("type"), u8_l("op"), u8_l("sort_pdq"), u8_l("radix"));
+    for_(($r(0, A_len(sort_types)))(t) {
+        var_(ns, A$$(2, f64)) = A_zero();
+        try_(benchSort(gpa, *A_at((sort_types)[t]), &ns));
+        io_stream_println(
+            u8_l("{:>5s} | {:>6s} | {:>9.2fl} | {:>9.2fl}"),
+            *A_at((type_names)[t]), u8_l("sort"), *A_at((ns)[0]), *A_at((ns)[1])
+        );
+    });
+
+    var_(copy_ns, A$$(2, f64)) = A_zero();
+    try_(benchCopy(gpa, &copy_ns));
+    io_stream_println(u8_l("{:>5s} | {:>6s} | {:>9s} | {:>9s}"), u8_l("type"), u8_l("op"), u8_l("per-elem"), u8_l("mem_copy"));
+    io_stream_println(
+        u8_l("{:>5s} | {:>6s} | {:>9.2fl} | {:>9.2fl}"),
+        u8_l("Rec32"), u8_l("copy"), *A_at((copy_ns)[0]), *A_at((copy_ns)[1])
+    );
+    io_stream_println(u8_l("(sink {:ul})"), bench_sink);
+    return_ok({});
+} $unscoped_(fn);
@@ -0,0 +1,121 @@
+#include "dh/main.h"
+#include "dh/fmt/common.h"
+#include "dh/io/Fixed.h"
+#include "dh/heap/Page.h"
+#include "dh/time/Instant.h"
+#include "dh/io/stream.h"
+
+/// Lines are written into a `bench_buf_len` buffer, rewound whenever it is nearly full.
+#define bench_buf_len (lit_n$(usize)(1) << 20)
+#define bench_lines (lit_n$(usize)(1) << 21)
+
+typedef enum Line {
+    /// `[INFO] src/net.c:120 GET /index.html -> 200 in 1.234 ms (4096 bytes)`
+    Line_request,
+    /// `metric cpu.load{host=node-7} 0.731000 1700000000`
+    Line_metric,
+    /// `step 42 done`
+    Line_short,
+    Line_count
+} Line;
+
+typedef enum Kind {
+    /// `io_Writer_print`: format string parsed on every call
+    Kind_print,
+    /// `io_Writer_printCached`: parsed once per call site
+    Kind_print_cached,
+    /// `fmt_formatCompiled` with a format compiled up front
+    Kind_compiled,
+    Kind_count
+} Kind;
+
+$static let_(line_fmts, A$$(Line_count, S_const$u8)) = A_init({
+    [Line_request] = u8_l("[{:s}] {:s}:{:u} {:s} {:s} -> {:u} in {:.3fl} ms ({:uz} bytes)"),
+    [Line_metric] = u8_l("metric {:s}{{host={:s}}} {:fl} {:ul}"),
+    [Line_short] = u8_l("step {:uz} done"),
+});
+
+/// Writes one line of `line`; only `Kind_print_cached` needs a call site per format.
+$static fn_((writeLine(Kind kind, Line line, io_Writer out, const fmt_Compiled* compiled, usize i))(E$void) $scope) {
+    let fmt = *A_at((line_fmts)[line]);
+    let status = as$(u32)(200 + (i & 3));
+    let took = as$(f64)(i & 1023) * 0.001;
+    switch (kind) {
+    case Kind_print:
+        switch (line) {
+        case Line_request: return_ok(try_(io_Writer_print(out, fmt, u8_l("INFO"), u8_l("src/net.c"), 120u, u8_l("GET"), u8_l("/index.html"), status, took, i)));
+        case Line_metric: return_ok(try_(io_Writer_print(out, fmt, u8_l("cpu.load"), u8_l("node-7"), took, as$(u64)(i))));
+        case Line_short: return_ok(try_(io_Writer_print(out, fmt, i)));
+        default: claim_unreachable;
+        }
+    case Kind_print_cached:
+        switch (line) {
+        case Line_request: return_ok(try_(io_Writer_printCached(out, fmt, u8_l("INFO"), u8_l("src/net.c"), 120u, u8_l("GET"), u8_l("/index.html"), status, took, i)));
+        case Line_metric: return_ok(try_(io_Writer_printCached(out, fmt, u8_l("cpu.load"), u8_l("node-7"), took, as$(u64)(i))));
+        case Line_short: return_ok(try_(io_Writer_printCached(out, fmt, i)));
+        default: claim_unreachable;
+        }
+    case Kind_compiled:
+        switch (line) {
+        case Line_request: return_ok(try_(fmt_formatCompiled(out, compiled, u8_l("INFO"), u8_l("src/net.c"), 120u, u8_l("GET"), u8_l("/index.html"), status, took, i)));
+        case Line_metric: return_ok(try_(fmt_formatCompiled(out, compiled, u8_l("cpu.load"), u8_l("node-7"), took, as$(u64)(i))));
+        case Line_short: return_ok(try_(fmt_formatCompiled(out, compiled, i)));
+        default: claim_unreachable;
+        }
+    default: claim_unreachable;
+    }
+} $unscoped_(fn);
+
+/// Nanoseconds per line; `bytes` receives the total written.
+$static fn_((run(Kind kind, Line line, S$u8 buf, usize* bytes))(E$f64) $scope) {
+    let compiled = try_(fmt_compile(*A_at((line_fmts)[line])));
+    var writer = io_Fixed_Writer_init(io_Fixed_writing(buf));
+    let out = io_Fixed_writer(&writer);
+    *bytes = 0;
+    let start = time_Instant_now();
+    for_(($r(0, bench_lines))(i) {
+        /* every line is under 128 bytes */
+        if (buf.len < writer.stream.pos + 128) {
+            *bytes += writer.stream.pos;
+            writer.stream.pos = 0;
+        }
+        try_(writeLine(kind, line, out, &compiled, i));
+    });
+    let secs = time_Duration_asSecs$f64(time_Instant_elapsed(start));
+    *bytes += writer.stream.pos;
+    return_ok(secs * 1e9 / as$(f64)(bench_lines));
+} $unscoped_(fn);
+
+fn_((main(S$S_const$u8 args))(E$void) $guard) {
+    let_ignore = args;
+    var page = lit0$((heap_Page));
+    let gpa = heap_Page_allocator(&page);
+    let buf = u_castS$((S$u8)(try_(mem_Allocator_alloc(gpa, typeInfo$(u8), bench_buf_len))));
+    defer_(mem_Allocator_free(gpa, u_anyS(buf)));
+    let_(line_names, A$$(Line_count, S_const$u8)) = A_init({
+        u8_l("request"), u8_l("metric"), u8_l("short"),
+    });
+    let_(kind_names, A$$(Kind_count, S_const$u8)) = A_init({
+        u8_l("print"), u8_l("print cached"), u8_l("compiled"),
+    });
+
+    io_stream_println(u8_l("{:uz} lines per method into a fixed buffer"), bench_lines);
+    io_stream_println(
+        u8_l("{:>7s} | {:>12s} | {:>9s} | {:>9s} | {:>7s}"),
+        u8_l("line"), u8_l("method"), u8_l("ns/line"), u8_l("MB/s"), u8_l("speedup")
+    );
+    for (Line line = 0; line < Line_count; ++line) {
+        var_(baseline_ns, f64) = 0;
+        for (Kind kind = 0; kind < Kind_count; ++kind) {
+            var_(bytes, usize) = 0;
+            let ns = try_(run(kind, line, buf, &bytes));
+            if (kind == Kind_print) { baseline_ns = ns; }
+            let mbps = as$(f64)(bytes) / (ns * as$(f64)(bench_lines)) * 1e3;
+            io_stream_println(
+                u8_l("{:>7s} | {:>12s} | {:>9.1fl} | {:>9.1fl} | {:>6.2fl}x"),
+                *A_at((line_names)[line]), *A_at((kind_names)[kind]), ns, mbps, baseline_ns / ns
+            );
+        }
+    }
+    return_ok({});
+} $unguarded_(fn);
@@ -0,0 +1,169 @@
+#include "dh/main.h"
+#include "dh/mem/common.h"
+#include "dh/ascii.h"
+#include "dh/fmt/common.h"
+#include "dh/io/Fixed.h"
+#include "dh/heap/Page.h"
+#include "dh/Rand.h"
+#include "dh/time/Instant.h"
+#include "dh/io/stream.h"
+
+#include <stdlib.h>
+
+/// Each column is `bench_column_len` bytes of newline-separated fields, parsed `bench_rounds` times per method.
+#define bench_column_len (lit_n$(usize)(1) << 22)
+#define bench_rounds (8u)
+
+typedef enum Column {
+    /// Prices with two decimals, e.g. `1234.56`
+    Column_price,
+    /// Unsigned integers up to 9 digits
+    Column_int,
+    /// Scientific notation with 7 significant digits
+    Column_sci,
+    /// 20 to 24 significant digits, past what the fast path reads
+    Column_long,
+    Column_count
+} Column;
+
+typedef enum Kind {
+    /// Accumulate with `result * 10` and `power *= 0.1`, as `fmt_parseFlt` did before
+    Kind_naive,
+    Kind_parse_flt,
+    /// libc strtod
+    Kind_strtod,
+    /// Digit-at-a-time integer loop; integer column only
+    Kind_uint_scalar,
+    Kind_parse_uint,
+    Kind_count
+} Kind;
+
+$static fn_((naiveParseFlt(S_const$u8 str))(f64)) {
+    var_(pos, usize) = 0;
+    var_(sign, f64) = 1.0;
+    var_(result, f64) = 0.0;
+    if (pos < str.len && *S_at((str)[pos]) == u8_c('-')) {
+        sign = -1.0;
+        pos++;
+    }
+    while (pos < str.len && ascii_isDigit(*S_at((str)[pos]))) { result = result * 10.0 + (*S_at((str)[pos++]) - u8_c('0')); }
+    if (pos < str.len && *S_at((str)[pos]) == u8_c('.')) {
+        pos++;
+        var_(power, f64) = 0.1;
+        while (pos < str.len && ascii_isDigit(*S_at((str)[pos]))) {
+            result += (*S_at((str)[pos++]) - u8_c('0')) * power;
+            power *= 0.1;
+        }
+    }
+    if (pos < str.len && (*S_at((str)[pos]) == u8_c('e') || *S_at((str)[pos]) == u8_c('E'))) {
+        pos++;
+        var_(exp_sign, f64) = 1.0;
+        if (pos < str.len && *S_at((str)[pos]) == u8_c('-')) {
+            exp_sign = -1.0;
+            pos++;
+        }
+        var_(exp, i32) = 0;
+        while (pos < str.len && ascii_isDigit(*S_at((str)[pos]))) { exp = exp * 10 + (*S_at((str)[pos++]) - u8_c('0')); }
+        result *= __builtin_pow(10.0, exp * exp_sign);
+    }
+    return result * sign;
+};
+
+$static fn_((scalarParseUInt(S_const$u8 str))(u64)) {
+    var_(result, u64) = 0;
+    for_(($s(str))(ch) { result = result * 10 + (*ch - u8_c('0')); });
+    return result;
+};
+
+/// Fills `buf` with fields of `column`, one per line; returns the text and the field count.
+$static fn_((genColumn(Column column, S$u8 buf, usize* fields))(E$S$u8) $scope) {
+    var rng = Rand_initSeed(0x19 + column);
+    var writer = io_Fixed_Writer_init(io_Fixed_writing(buf));
+    let out = io_Fixed_writer(&writer);
+    *fields = 0;
+    /* the longest field is under 32 bytes */
+    while (writer.stream.pos + 32 <= buf.len) {
+        switch (column) {
+        case Column_price:
+            try_(fmt_format(out, u8_l("{:.2fl}\n"), as$(f64)(Rand_next$u64(&rng) % 1000000) / 100.0));
+            break;
+        case Column_int:
+            try_(fmt_format(out, u8_l("{:ul}\n"), Rand_next$u64(&rng) % 1000000000));
+            break;
+        case Column_sci: {
+            let exp = as$(i32)(Rand_next$u64(&rng) % 61) - 30;
+            try_(fmt_format(out, u8_l("{:.6fl}e{:d}\n"), 1.0 + Rand_next$f64(&rng) * 9.0, exp));
+        } break;
+        case Column_long: {
+            let digits = 20 + Rand_next$u64(&rng) % 5;
+            try_(fmt_format(out, u8_l("0.")));
+            for_(($r(0, digits))(i) {
+                let_ignore = i;
+                try_(fmt_format(out, u8_l("{:ul}"), Rand_next$u64(&rng) % 10));
+            });
+            try_(fmt_format(out, u8_l("\n")));
+        } break;
+        default: claim_unreachable;
+        }
+        *fields += 1;
+    }
+    return_ok(io_Fixed_written(writer.stream));
+} $unscoped_(fn);
+
+/// Nanoseconds per field; `check` receives a sum of the parsed values so the work is kept.
+$static fn_((run(Kind kind, S_const$u8 text, usize fields, f64* check))(f64)) {
+    *check = 0;
+    let start = time_Instant_now();
+    for_(($r(0, bench_rounds))(round) {
+        let_ignore = round;
+        var rest = text;
+        while (rest.len != 0) {
+            let end = orelse_((mem_idxByte(rest, '\n'))(rest.len));
+            let field = S_prefix((rest)(end));
+            switch (kind) {
+            case Kind_naive: *check += naiveParseFlt(field); break;
+            case Kind_parse_flt: *check += catch_((fmt_parseFlt(field))($ignore, claim_unreachable)); break;
+            case Kind_strtod: *check += strtod(as$(const char*)(field.ptr), null); break;
+            case Kind_uint_scalar: *check += as$(f64)(scalarParseUInt(field)); break;
+            case Kind_parse_uint: *check += as$(f64)(catch_((fmt_parseUInt(field, 10))($ignore, claim_unreachable))); break;
+            default: claim_unreachable;
+            }
+            rest = S_suffix((rest)(prim_min(end + 1, rest.len)));
+        }
+    });
+    let secs = time_Duration_asSecs$f64(time_Instant_elapsed(start));
+    return secs * 1e9 / as$(f64)(fields * bench_rounds);
+};
+
+fn_((main(S$S_const$u8 args))(E$void) $guard) {
+    let_ignore = args;
+    var page = lit0$((heap_Page));
+    let gpa = heap_Page_allocator(&page);
+    let buf = u_castS$((S$u8)(try_(mem_Allocator_alloc(gpa, typeInfo$(u8), bench_column_len))));
+    defer_(mem_Allocator_free(gpa, u_anyS(buf)));
+    let_(column_names, A$$(Column_count, S_const$u8)) = A_init({
+        u8_l("price"), u8_l("int"), u8_l("sci"), u8_l("long"),
+    });
+    let_(kind_names, A$$(Kind_count, S_const$u8)) = A_init({
+        u8_l("naive"), u8_l("parseFlt"), u8_l("strtod"), u8_l("uint scalar"), u8_l("parseUInt"),
+    });
+
+    io_stream_println(u8_l("{:uz} MiB per column"), bench_column_len >> 20);
+    io_stream_println(u8_l("{:>6s} | {:>11s} | {:>9s} | {:>9s}"), u8_l("column"), u8_l("method"), u8_l("MB/s"), u8_l("ns/field"));
+    for (Column column = 0; column < Column_count; ++column) {
+        var_(fields, usize) = 0;
+        let text = try_(genColumn(column, buf, &fields)).as_const;
+        for (Kind kind = 0; kind < Kind_count; ++kind) {
+            if (Kind_uint_scalar <= kind && column != Column_int) { continue; }
+            var_(check, f64) = 0;
+            let ns = run(kind, text, fields, &check);
+            claim_assert(check != 0);
+            let mbps = as$(f64)(text.len) / as$(f64)(fields) / ns * 1e3;
+            io_stream_println(
+                u8_l("{:>6s} | {:>11s} | {:>9.1fl} | {:>9.2fl}"),
+                *A_at((column_names)[column]), *A_at((kind_names)[kind]), mbps, ns
+            );
+        }
+    }
+    return_ok({});
+} $unguarded_(fn);
@@ -0,0 +1,112 @@
+#include "dh/main.h"
+#include "dh/heap/Arena.h"
+#include "dh/heap/Classic.h"
+#include "dh/heap/Page.h"
+#include "dh/Rand.h"
+#include "dh/time/Instant.h"
+#include "dh/io/stream.h"
+
+/// Every request creates `bench_objs` small objects, touches them, then drops them all.
+#define bench_requests (1u << 12)
+#define bench_objs (1u << 12)
+#define bench_obj_align (mem_alignToLog2(16))
+
+typedef enum Kind {
+    /// malloc/free per object
+    Kind_classic,
+    /// Arena reset keeping its buffers
+    Kind_reset,
+    /// Arena savepoint restored after each request
+    Kind_restore,
+    /// Thread scratch arena taken per request
+    Kind_scratch,
+    /// Virtual-memory arena restored after each request
+    Kind_virt,
+    Kind_count
+} Kind;
+
+$static var_(g_lens, A$$(bench_objs, usize)) = A_zero();
+$static var_(g_objs, A$$(bench_objs, S$u8)) = A_zero();
+
+/// Allocates and touches one request's objects; returns a checksum so the work is kept.
+$static fn_((request(mem_Allocator gpa))(E$usize) $scope) {
+    var_(sum, usize) = 0;
+    for_(($s(A_ref(g_objs)), $a(g_lens))(obj, len_ptr) {
+        let len = *len_ptr;
+        let ptr = orelse_((mem_Allocator_rawAlloc(gpa, len, bench_obj_align))(return_err(mem_Err_OutOfMemory())));
+        *obj = init$S$((u8)(ptr, len));
+        *S_at((*obj)[0]) = as$(u8)(len);
+        *S_at((*obj)[len - 1]) = as$(u8)(len);
+        sum += len;
+    });
+    return_ok(sum);
+} $unscoped_(fn);
+
+/// Nanoseconds per request with objects served as `kind` does.
+$static fn_((run(Kind kind, mem_Allocator sys))(E$f64) $guard) {
+    var classic = lit0$((heap_Classic));
+    var arena = heap_Arena_init(sys);
+    defer_(heap_Arena_fini(arena));
+    var virt = try_(heap_Arena_Virt_init(lit_n$(usize)(1) * 1024 * 1024 * 1024));
+    defer_(heap_Arena_Virt_fini(&virt));
+    defer_(heap_Arena_scratchFini());
+
+    var_(sum, usize) = 0;
+    let start = time_Instant_now();
+    for_(($r(0, bench_requests))(i) {
+        let_ignore = i;
+        switch (kind) {
+        case Kind_classic: {
+            let gpa = heap_Classic_allocator(&classic);
+            sum += try_(request(gpa));
+            for_(($a(g_objs))(obj) { mem_Allocator_rawFree(gpa, *obj, bench_obj_align); });
+        } break;
+        case Kind_reset: {
+            sum += try_(request(heap_Arena_allocator(&arena)));
+            let_ignore = heap_Arena_reset(&arena, union_of$((heap_Arena_ResetMode)(heap_Arena_ResetMode_retain_capacity)(lit0$((Void)))));
+        } break;
+        case Kind_restore: {
+            let savepoint = heap_Arena_save(&arena);
+            sum += try_(request(heap_Arena_allocator(&arena)));
+            heap_Arena_restore(&arena, savepoint);
+        } break;
+        case Kind_scratch: {
+            let scratch = heap_Arena_scratch(lit0$((S_const$P$heap_Arena)));
+            sum += try_(request(heap_Arena_allocator(scratch.arena)));
+            heap_Arena_Scratch_end(scratch);
+        } break;
+        case Kind_virt: {
+            let savepoint = heap_Arena_Virt_save(&virt);
+            sum += try_(request(heap_Arena_Virt_allocator(&virt)));
+            heap_Arena_Virt_restore(&virt, savepoint);
+        } break;
+        default: claim_unreachable;
+        }
+    });
+    let ns = time_Duration_asSecs$f64(time_Instant_elapsed(start)) * 1e9 / as$(f64)(bench_requests);
+    claim_assert(sum != 0);
+    return_ok(ns);
+} $unguarded_(fn);
+
+fn_((main(S$S_const$u8 args))(E$void) $scope) {
+    let_ignore = args;
+    var rng = Rand_initSeed(0x15);
+    /* object sizes of 16..256 bytes, the same for every request */
+    for_(($s(A_ref(g_lens)))(len) { *len = 16 + Rand_next$usize(&rng) % (256 - 16 + 1); });
+    var page = lit0$((heap_Page));
+    let sys = heap_Page_allocator(&page);
+    let_(kind_names, A$$(Kind_count, S_const$u8)) = A_init({
+        u8_l("classic"), u8_l("reset"), u8_l("restore"), u8_l("scratch"), u8_l("virt"),
+    });
+
+    io_stream_println(u8_l("{:uz} requests of {:uz} objects (16..256 bytes)"), as$(usize)(bench_requests), as$(usize)(bench_objs));
+    io_stream_println(u8_l("{:>8s} | {:>12s} | {:>9s}"), u8_l("alloc"), u8_l("ns/request"), u8_l("ns/obj"));
+    for (Kind kind = 0; kind < Kind_count; ++kind) {
+        let ns = try_(run(kind, sys));
+        io_stream_println(
+            u8_l("{:>8s} | {:>12.1fl} | {:>9.2fl}"),
+            *A_at((kind_names)[kind]), ns, ns / as$(f64)(bench_objs)
+        );
+    }
+    return_ok({});
+} $unscoped_(fn);
@@ -0,0 +1,92 @@
+#include "dh/main.h"
+#include "dh/ArrList.h"
+#include "dh/heap/Page.h"
+#include "dh/time/Instant.h"
+#include "dh/io/stream.h"
+
+/// Grown by appending and writing one chunk at a time, like a log or column being filled.
+#define bench_target_bytes (lit_n$(usize)(4) * 1024 * 1024 * 1024)
+#define bench_chunk_bytes (lit_n$(usize)(1) * 1024 * 1024)
+
+$static fn_((copyAlloc(P$raw ctx, usize len, mem_Align align))(O$P$u8));
+$static fn_((copyFree(P$raw ctx, S$u8 buf, mem_Align buf_align))(void));
+
+/// Forwards to the wrapped allocator but never resizes or remaps: every growth
+/// is a new mapping plus a full copy, the cost before `mremap` was used.
+$static fn_((copyingAllocator(mem_Allocator* inner))(mem_Allocator)) {
+    $static const mem_Allocator_VT vt $like_ref = { {
+        .alloc = copyAlloc,
+        .resize = mem_Allocator_VT_noResize,
+        .remap = mem_Allocator_VT_noRemap,
+        .free = copyFree,
+    } };
+    return mem_Allocator_ensureValid((mem_Allocator){
+        .ctx = inner,
+        .vt = vt,
+    });
+};
+
+fn_((copyAlloc(P$raw ctx, usize len, mem_Align align))(O$P$u8)) {
+    return mem_Allocator_rawAlloc(*as$(mem_Allocator*)(ctx), len, align);
+};
+
+fn_((copyFree(P$raw ctx, S$u8 buf, mem_Align buf_align))(void)) {
+    return mem_Allocator_rawFree(*as$(mem_Allocator*)(ctx), buf, buf_align);
+};
+
+/// Seconds to grow a byte list to `bench_target_bytes` through `gpa`.
+$static fn_((run(mem_Allocator gpa))(E$f64) $guard) {
+    var list = ArrList_empty(typeInfo$(u8));
+    defer_(ArrList_fini(&list, typeInfo$(u8), gpa));
+    let start = time_Instant_now();
+    while (list.items.len < bench_target_bytes) {
+        let chunk = u_castS$((S$u8)(try_(ArrList_addBackN(&list, typeInfo$(u8), gpa, bench_chunk_bytes))));
+        mem_setBytes(chunk, as$(u8)(list.items.len >> 20));
+    }
+    let secs = time_Duration_asSecs$f64(time_Instant_elapsed(start));
+    claim_assert(*S_at((u_castS$((S$u8)(ArrList_itemsMut(list, typeInfo$(u8)))))[bench_target_bytes - 1]) == as$(u8)(bench_target_bytes >> 20));
+    return_ok(secs);
+} $unguarded_(fn);
+
+fn_((main(S$S_const$u8 args))(E$void) $scope) {
+    let_ignore = args;
+    io_stream_println(
+        u8_l("ArrList growth to {:uz} MiB in {:uz} MiB appends"),
+        bench_target_bytes >> 20, bench_chunk_bytes >> 20
+    );
+    io_stream_println(u8_l("{:>22s} | {:>9s} | {:>9s}"), u8_l("mode"), u8_l("secs"), u8_l("GiB/s"));
+
+    var base = lit0$((heap_Page));
+    var base_gpa = heap_Page_allocator(&base);
+    var_(pages, A$$(6, heap_Page)) = A_zero();
+    let_(names, A$$(6, S_const$u8)) = A_init({
+        u8_l("copy (no mremap)"),
+        u8_l("mremap"),
+        u8_l("mremap + populate"),
+        u8_l("mremap + THP"),
+        u8_l("mremap + hugetlb"),
+        u8_l("mremap + THP + populate"),
+    });
+    var cfg = heap_Page_Cfg_default;
+    *A_at((pages)[1]) = heap_Page_fromCfg(cfg);
+    cfg.populate = true;
+    *A_at((pages)[2]) = heap_Page_fromCfg(cfg);
+    cfg = heap_Page_Cfg_default;
+    cfg.huge = heap_Page_Huge_transparent;
+    *A_at((pages)[3]) = heap_Page_fromCfg(cfg);
+    cfg.huge = heap_Page_Huge_explicit;
+    *A_at((pages)[4]) = heap_Page_fromCfg(cfg);
+    cfg.huge = heap_Page_Huge_transparent;
+    cfg.populate = true;
+    *A_at((pages)[5]) = heap_Page_fromCfg(cfg);
+
+    for_(($r(0, A_len(pages)))(mode) {
+        let gpa = mode == 0 ? copyingAllocator(&base_gpa) : heap_Page_allocator(A_at((pages)[mode]));
+        let secs = try_(run(gpa));
+        io_stream_println(
+            u8_l("{:>22s} | {:>9.3fl} | {:>9.2fl}"),
+            *A_at((names)[mode]), secs, as$(f64)(bench_target_bytes >> 30) / secs
+        );
+    });
+    return_ok({});
+} $unscoped_(fn);
@@ -0,0 +1,125 @@
+#include "dh/main.h"
+#include "dh/ListDbl.h"
+#include "dh/heap/Arena.h"
+#include "dh/heap/Classic.h"
+#include "dh/heap/Page.h"
+#include "dh/heap/Pool.h"
+#include "dh/Rand.h"
+#include "dh/time/Instant.h"
+#include "dh/io/stream.h"
+
+T_use$((u64)(ListDbl_Link, ListDbl_Adp, ListDbl));
+T_use$((u64)(ListDbl_empty, ListDbl_append, ListDbl_remove, ListDbl_shift, ListDbl_Link_data));
+
+#define bench_nodes (1u << 20)
+#define bench_churn_ops (1u << 22)
+
+typedef ListDbl_Adp$u64 Node;
+
+typedef enum Kind {
+    Kind_pool,
+    Kind_arena,
+    Kind_classic,
+    Kind_count
+} Kind;
+
+typedef enum Phase {
+    /// Append every node to one list
+    Phase_build,
+    /// Walk the list front to back
+    Phase_walk,
+    /// Unlink a random node, free it, append a fresh one
+    Phase_churn,
+    /// Shift and free every node
+    Phase_teardown,
+    Phase_count
+} Phase;
+
+$static var_(g_nodes, A$$(bench_nodes, Node*)) = A_zero();
+
+$static fn_((nsPer(time_Instant start, usize ops))(f64)) {
+    return time_Duration_asSecs$f64(time_Instant_elapsed(start)) * 1e9 / as$(f64)(ops);
+};
+
+/// Nodes come from `gpa` through the plain allocator interface, as any list would use it.
+$static fn_((createNode(mem_Allocator gpa, u64 data))(mem_Err$u_P$raw) $scope) {
+    let node = try_(mem_Allocator_create(gpa, typeInfo$(Node)));
+    let_ignore = ListDbl_Adp_init(u_anyV(data), node.raw);
+    return_ok(node);
+} $unscoped_(fn);
+
+/// Nanoseconds per node for every phase, with nodes from `gpa`.
+$static fn_((run(mem_Allocator gpa, S$f64 ns))(E$void) $scope) {
+    var rng = Rand_initSeed(0x9001);
+    var list = ListDbl_empty$u64();
+
+    var start = time_Instant_now();
+    for_(($s(A_ref(g_nodes)), $rf(0))(slot, i) {
+        *slot = u_castP$((Node*)(try_(createNode(gpa, i))));
+        ListDbl_append$u64(&list, &(*slot)->link);
+    });
+    *S_at((ns)[Phase_build]) = nsPer(start, bench_nodes);
+
+    start = time_Instant_now();
+    var_(sum, u64) = 0;
+    var it = list.first;
+    while_some(it, link) {
+        sum += *ListDbl_Link_data$u64(link);
+        it = link->next;
+    }
+    *S_at((ns)[Phase_walk]) = nsPer(start, bench_nodes);
+    claim_assert(sum == as$(u64)(bench_nodes) * (bench_nodes - 1) / 2);
+
+    start = time_Instant_now();
+    for_(($r(0, bench_churn_ops))(i) {
+        let slot = A_at((g_nodes)[Rand_next$usize(&rng) % bench_nodes]);
+        ListDbl_remove$u64(&list, &(*slot)->link);
+        mem_Allocator_destroy(gpa, u_anyP(*slot));
+        *slot = u_castP$((Node*)(try_(createNode(gpa, i))));
+        ListDbl_append$u64(&list, &(*slot)->link);
+    });
+    *S_at((ns)[Phase_churn]) = nsPer(start, bench_churn_ops);
+
+    start = time_Instant_now();
+    while_some(ListDbl_shift$u64(&list), link) {
+        mem_Allocator_destroy(gpa, u_anyP(as$(Node*)(link)));
+    }
+    *S_at((ns)[Phase_teardown]) = nsPer(start, bench_nodes);
+    return_ok({});
+} $unscoped_(fn);
+
+fn_((main(S$S_const$u8 args))(E$void) $guard) {
+    let_ignore = args;
+    var page = lit0$((heap_Page));
+    let sys = heap_Page_allocator(&page);
+    var classic = lit0$((heap_Classic));
+    /* neither takes memory from `sys` before its first allocation */
+    var pool = heap_Pool_init(typeInfo$(Node), sys, heap_Pool_Cfg_default);
+    defer_(heap_Pool_fini(&pool, typeInfo$(Node)));
+    /* frees are dropped, so churn keeps growing the arena */
+    var arena = heap_Arena_init(sys);
+    defer_(heap_Arena_fini(arena));
+    let_(gpas, A$$(Kind_count, mem_Allocator)) = A_init({
+        heap_Pool_allocator(&pool),
+        heap_Arena_allocator(&arena),
+        heap_Classic_allocator(&classic),
+    });
+    let_(kind_names, A$$(Kind_count, S_const$u8)) = A_init({ u8_l("pool"), u8_l("arena"), u8_l("classic") });
+
+    io_stream_println(u8_l("{:uz} list nodes of {:uz} bytes, ns per node"), as$(usize)(bench_nodes), sizeOf$(Node));
+    io_stream_println(
+        u8_l("{:>8s} | {:>9s} | {:>9s} | {:>9s} | {:>9s}"),
+        u8_l("alloc"), u8_l("build"), u8_l("walk"), u8_l("churn"), u8_l("teardown")
+    );
+    for (Kind kind = 0; kind < Kind_count; ++kind) {
+        var_(ns, A$$(Phase_count, f64)) = A_zero();
+        try_(run(*A_at((gpas)[kind]), A_ref$((S$f64)(ns))));
+        io_stream_println(
+            u8_l("{:>8s} | {:>9.2fl} | {:>9.2fl} | {:>9.2fl} | {:>9.2fl}"),
+            *A_at((kind_names)[kind]),
+            *A_at((ns)[Phase_build]), *A_at((ns)[Phase_walk]),
+            *A_at((ns)[Phase_churn]), *A_at((ns)[Phase_teardown])
+        );
+    }
+    return_ok({});
+} $unguarded_(fn);
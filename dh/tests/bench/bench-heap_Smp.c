@@ -0,0 +1,92 @@
+#include "dh/main.h"
+#include "dh/heap/Page.h"
+#include "dh/heap/Smp.h"
+#include "dh/Rand.h"
+#include "dh/time/Instant.h"
+#include "dh/io/stream.h"
+
+#define bench_live_peak (1u << 18)
+#define bench_churn_ops (1u << 21)
+/* After churn, keep every n-th object live: sparse survivors pin whole slabs */
+#define bench_keep_every (10u)
+
+$static var_(g_objs, A$$(bench_live_peak, S$u8)) = A_zero();
+
+/// Mixed sizes: mostly small records, some medium buffers, a few larger blobs.
+$static fn_((drawLen(Rand* rng))(usize)) {
+    let roll = Rand_next$u32(rng) % 100;
+    if (roll < 70) { return 8 + Rand_next$usize(rng) % 120; }
+    if (roll < 95) { return 128 + Rand_next$usize(rng) % 896; }
+    return 1024 + Rand_next$usize(rng) % 7168;
+};
+
+$static fn_((asMiB(usize bytes))(f64)) {
+    return as$(f64)(bytes) / (1024.0 * 1024.0);
+};
+
+$static fn_((fragPct(heap_Smp_Stats stats))(f64)) {
+    if (stats.resident == 0) { return 0.0; }
+    return as$(f64)(stats.fragmented) * 100.0 / as$(f64)(stats.resident);
+};
+
+/// Fill, churn, then shrink to a tenth of the peak under `cfg`, printing one row.
+$static fn_((run(heap_Smp_Cfg cfg, S_const$u8 name))(E$void) $guard) {
+    var page = lit0$((heap_Page));
+    var smp = try_(heap_Smp_createOnHeapCfg(heap_Page_allocator(&page), 1, cfg));
+    defer_(heap_Smp_destroyOnHeap(&smp));
+    let gpa = heap_Smp_allocator(smp);
+    var rng = Rand_initSeed(0xf4a9);
+
+    for_(($s(A_ref(g_objs)))(obj) {
+        *obj = u_castS$((S$u8)(try_(mem_Allocator_alloc(gpa, typeInfo$(u8), drawLen(&rng)))));
+    });
+    let start = time_Instant_now();
+    for_(($r(0, bench_churn_ops))($ignore) {
+        let obj = A_at((g_objs)[Rand_next$usize(&rng) % bench_live_peak]);
+        let old = *obj;
+        mem_Allocator_free(gpa, u_anyS(old));
+        *obj = u_castS$((S$u8)(try_(mem_Allocator_alloc(gpa, typeInfo$(u8), drawLen(&rng)))));
+    });
+    let churn_ns = time_Duration_asSecs$f64(time_Instant_elapsed(start)) * 1e9 / as$(f64)(bench_churn_ops);
+    let peak = heap_Smp_stats(smp);
+
+    for_(($s(A_ref(g_objs)), $rf(0))(obj, i) {
+        if (i % bench_keep_every == 0) { continue; }
+        let live = *obj;
+        mem_Allocator_free(gpa, u_anyS(live));
+    });
+    let shrunk = heap_Smp_stats(smp);
+    io_stream_println(
+        u8_l("{:>14s} | {:>9.1fl} | {:>9.2fl} | {:>6.1fl} | {:>9.2fl} | {:>6.1fl} | {:>9.2fl}"),
+        name, churn_ns,
+        asMiB(peak.resident), fragPct(peak),
+        asMiB(shrunk.resident), fragPct(shrunk), asMiB(shrunk.cached)
+    );
+
+    for_(($s(A_ref(g_objs)), $rf(0))(obj, i) {
+        if (i % bench_keep_every != 0) { continue; }
+        let live = *obj;
+        mem_Allocator_free(gpa, u_anyS(live));
+    });
+    return_ok({});
+} $unguarded_(fn);
+
+fn_((main(S$S_const$u8 args))(E$void) $scope) {
+    let_ignore = args;
+    io_stream_println(
+        u8_l("{:>14s} | {:>9s} | {:>9s} | {:>6s} | {:>9s} | {:>6s} | {:>9s}"),
+        u8_l("classes/decay"), u8_l("churn ns"), u8_l("peak MiB"), u8_l("frag%"),
+        u8_l("tail MiB"), u8_l("frag%"), u8_l("cache MiB")
+    );
+    var cfg = heap_Smp_Cfg_default;
+    cfg.size_classes = heap_Smp_SizeClasses_pow2;
+    try_(run(cfg, u8_l("pow2/10s")));
+    cfg.decay = time_Duration_zero;
+    try_(run(cfg, u8_l("pow2/0s")));
+    cfg = heap_Smp_Cfg_default;
+    cfg.size_classes = heap_Smp_SizeClasses_quarter;
+    try_(run(cfg, u8_l("quarter/10s")));
+    cfg.decay = time_Duration_zero;
+    try_(run(cfg, u8_l("quarter/0s")));
+    return_ok({});
+} $unscoped_(fn);
@@ -0,0 +1,187 @@
+#include "dh/main.h"
+#include "dh/Thrd/Chan.h"
+#include "dh/Thrd/WaitGroup.h"
+#include "dh/heap/Classic.h"
+#include "dh/heap/Page.h"
+#include "dh/heap/Smp.h"
+#include "dh/heap/ThrdSafe.h"
+#include "dh/Rand.h"
+#include "dh/time/Instant.h"
+#include "dh/io/stream.h"
+
+T_use$((u64)(
+    Thrd_Chan,
+    Thrd_Chan_init,
+    Thrd_Chan_fini,
+    Thrd_Chan_send,
+    Thrd_Chan_recvS
+));
+
+#define bench_objs_per_pair (lit_n$(usize)(1u << 20))
+#define bench_storm_ops_per_thrd (lit_n$(usize)(1u << 19))
+#define bench_storm_live (256)
+#define bench_chan_cap (lit_n$(usize)(1024))
+#define bench_batch (64)
+#define bench_max_thrds (64)
+#define bench_max_pairs (bench_max_thrds / 2)
+
+typedef enum Kind {
+    /// heap_Smp: lock-free owner path, remote frees queued on the owning slab
+    Kind_smp,
+    /// Every call serialized behind one mutex, like a locked per-thread meta
+    /// that all threads end up freeing into
+    Kind_locked,
+    /// The C runtime allocator, for reference
+    Kind_classic,
+    Kind_count
+} Kind;
+
+$static var_(g_sys, mem_Allocator) = {};
+$static var_(g_gpa, mem_Allocator) = {};
+$static var_(g_smp, heap_Smp*) = null;
+$static var_(g_chans, A$$(bench_max_pairs, Thrd_Chan$u64)) = A_zero();
+
+/// Mostly small records: the sizes a producer hands to a consumer.
+$static fn_((allocObj(Rand* rng))(P$u8)) {
+    let len = 16 + Rand_next$usize(rng) % 240;
+    let ptr = unwrap_(mem_Allocator_rawAlloc(g_gpa, len, mem_alignToLog2(8)));
+    /* The freeing side reads the length back from the object */
+    *ptrAlignCast$((usize*)(ptr)) = len;
+    return ptr;
+};
+
+$static fn_((freeObj(P$u8 ptr))(void)) {
+    let len = *ptrAlignCast$((usize*)(ptr));
+    mem_Allocator_rawFree(g_gpa, init$S$((u8)(ptr, len)), mem_alignToLog2(8));
+};
+
+/// Hands the meta of an exiting worker to the next one.
+$static fn_((detach(void))(void)) {
+    if (g_smp != null) { heap_Smp_detachThrd(g_smp); }
+};
+
+$static Thrd_fn_(producer, ({ usize pair; u64 seed; }, Void), ($ignore, args)$scope) {
+    var rng = Rand_initSeed(args->seed);
+    let chan = A_at((g_chans)[args->pair]);
+    for_(($r(0, bench_objs_per_pair))($ignore) {
+        catch_((Thrd_Chan_send$u64(chan, ptrToInt(allocObj(&rng))))($ignore, claim_unreachable));
+    });
+    detach();
+    return_({});
+} $unscoped_(Thrd_fn);
+
+$static Thrd_fn_(consumer, ({ usize pair; }, Void), ($ignore, args)$scope) {
+    var_(buf, A$$(bench_batch, u64)) = A_zero();
+    let chan = A_at((g_chans)[args->pair]);
+    for (usize received = 0; received < bench_objs_per_pair;) {
+        let count = catch_((Thrd_Chan_recvS$u64(chan, A_ref$((S$u64)(buf))))($ignore, claim_unreachable));
+        for_(($r(0, count))(i) { freeObj(intToPtr$((P$u8)(*A_at((buf)[i])))); });
+        received += count;
+    }
+    detach();
+    return_({});
+} $unscoped_(Thrd_fn);
+
+$static Thrd_fn_(stormer, ({ u64 seed; }, Void), ($ignore, args)$scope) {
+    var rng = Rand_initSeed(args->seed);
+    var_(live, A$$(bench_storm_live, P$u8)) = A_zero();
+    for_(($s(A_ref(live)))(obj) { *obj = allocObj(&rng); });
+    for_(($r(0, bench_storm_ops_per_thrd))($ignore) {
+        let obj = A_at((live)[Rand_next$usize(&rng) % bench_storm_live]);
+        freeObj(*obj);
+        *obj = allocObj(&rng);
+    });
+    for_(($s(A_ref(live)))(obj) { freeObj(*obj); });
+    detach();
+    return_({});
+} $unscoped_(Thrd_fn);
+
+/// Every producer allocates, its consumer frees: returns million objects per second.
+$static fn_((runPairs(usize pairs))(E$f64) $guard) {
+    $static var_(prod_ctxs, A$$(bench_max_pairs, Thrd_FnCtx$(producer))) = A_zero();
+    $static var_(cons_ctxs, A$$(bench_max_pairs, Thrd_FnCtx$(consumer))) = A_zero();
+    for_(($r(0, pairs))(i) {
+        *A_at((g_chans)[i]) = try_(Thrd_Chan_init$u64(g_sys, bench_chan_cap, Thrd_Chan_Mode_spsc));
+    });
+    defer_(for_(($r(0, pairs))(i) { Thrd_Chan_fini$u64(A_at((g_chans)[i]), g_sys); }));
+    var wg = Thrd_WaitGroup_init();
+    defer_(Thrd_WaitGroup_fini(&wg));
+    let start = time_Instant_now();
+    for_(($r(0, pairs))(i) {
+        *A_at((prod_ctxs)[i]) = Thrd_FnCtx_from$((producer)(i, 0x9e3779b97f4a7c15ull * (i + 1)));
+        *A_at((cons_ctxs)[i]) = Thrd_FnCtx_from$((consumer)(i));
+        Thrd_WaitGroup_spawn(&wg, g_sys, A_at((prod_ctxs)[i])->as_raw);
+        Thrd_WaitGroup_spawn(&wg, g_sys, A_at((cons_ctxs)[i])->as_raw);
+    });
+    Thrd_WaitGroup_wait(&wg);
+    let secs = time_Duration_asSecs$f64(time_Instant_elapsed(start));
+    return_ok(as$(f64)(pairs * bench_objs_per_pair) / secs / 1e6);
+} $unguarded_(fn);
+
+/// Every thread churns its own live set: returns million alloc/free pairs per second.
+$static fn_((runStorm(usize thrds))(f64) $guard) {
+    $static var_(ctxs, A$$(bench_max_thrds, Thrd_FnCtx$(stormer))) = A_zero();
+    var wg = Thrd_WaitGroup_init();
+    defer_(Thrd_WaitGroup_fini(&wg));
+    let start = time_Instant_now();
+    for_(($r(0, thrds))(i) {
+        *A_at((ctxs)[i]) = Thrd_FnCtx_from$((stormer)(0x2545f4914f6cdd1dull * (i + 1)));
+        Thrd_WaitGroup_spawn(&wg, g_sys, A_at((ctxs)[i])->as_raw);
+    });
+    Thrd_WaitGroup_wait(&wg);
+    let secs = time_Duration_asSecs$f64(time_Instant_elapsed(start));
+    return as$(f64)(thrds * bench_storm_ops_per_thrd) / secs / 1e6;
+} $unguarded_(fn);
+
+fn_((main(S$S_const$u8 args))(E$void) $guard) {
+    let_ignore = args;
+    var page = lit0$((heap_Page));
+    g_sys = heap_Page_allocator(&page);
+    /* Fewer metas than threads, so the storms also exercise spilling */
+    var smp = try_(heap_Smp_createOnHeap(g_sys, 8));
+    defer_(heap_Smp_destroyOnHeap(&smp));
+    var classic = lit0$((heap_Classic));
+    var locked = (heap_ThrdSafe){
+        .child_allocator = heap_Classic_allocator(&classic),
+        .mtx = Thrd_Mtx_init(),
+    };
+    defer_(Thrd_Mtx_fini(&locked.mtx));
+    let_(gpas, A$$(Kind_count, mem_Allocator)) = A_init({
+        heap_Smp_allocator(smp),
+        heap_ThrdSafe_allocator(&locked),
+        heap_Classic_allocator(&classic),
+    });
+
+    io_stream_println(u8_l("-- producer/consumer: Mobjs/s --"));
+    io_stream_println(u8_l("{:>7s} | {:>9s} | {:>9s} | {:>9s}"), u8_l("pairs"), u8_l("Smp"), u8_l("locked"), u8_l("classic"));
+    for (usize pairs = 1; pairs <= bench_max_pairs; pairs *= 2) {
+        var_(rates, A$$(Kind_count, f64)) = A_zero();
+        for (Kind kind = 0; kind < Kind_count; ++kind) {
+            g_gpa = *A_at((gpas)[kind]);
+            g_smp = kind == Kind_smp ? smp : null;
+            *A_at((rates)[kind]) = try_(runPairs(pairs));
+        }
+        io_stream_println(
+            u8_l("{:>7uz} | {:>9.2fl} | {:>9.2fl} | {:>9.2fl}"),
+            pairs, *A_at((rates)[Kind_smp]), *A_at((rates)[Kind_locked]), *A_at((rates)[Kind_classic])
+        );
+    }
+
+    io_stream_println(u8_l("-- alloc/free storm: Mops/s --"));
+    io_stream_println(u8_l("{:>7s} | {:>9s} | {:>9s} | {:>9s}"), u8_l("thrds"), u8_l("Smp"), u8_l("locked"), u8_l("classic"));
+    for (usize thrds = 1; thrds <= bench_max_thrds; thrds *= 2) {
+        var_(rates, A$$(Kind_count, f64)) = A_zero();
+        for (Kind kind = 0; kind < Kind_count; ++kind) {
+            g_gpa = *A_at((gpas)[kind]);
+            g_smp = kind == Kind_smp ? smp : null;
+            *A_at((rates)[kind]) = runStorm(thrds);
+        }
+        io_stream_println(
+            u8_l("{:>7uz} | {:>9.2fl} | {:>9.2fl} | {:>9.2fl}"),
+            thrds, *A_at((rates)[Kind_smp]), *A_at((rates)[Kind_locked]), *A_at((rates)[Kind_classic])
+        );
+    }
+    let stats = heap_Smp_stats(smp);
+    io_stream_println(u8_l("Smp resident after runs: {:uz} bytes, cached: {:uz} bytes"), stats.resident, stats.cached);
+    return_ok({});
+} $unguarded_(fn);
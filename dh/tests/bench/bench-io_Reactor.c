@@ -0,0 +1,208 @@
+#include "dh/main.h"
+#include "dh/io/Reactor.h"
+#include "dh/Thrd.h"
+#include "dh/heap/Page.h"
+#include "dh/time/Instant.h"
+#include "dh/io/stream.h"
+#include <unistd.h>
+#include <sys/resource.h>
+
+/// Echo peers, capped by the descriptor limit (four per peer)
+#define bench_max_peers (10000u)
+#define bench_rounds (16u)
+#define bench_msg_len (64u)
+/// Blocking peers only ever touch a 64-byte buffer
+#define bench_thrd_stack (64u * 1024u)
+
+typedef enum Kind {
+    /// One coroutine per peer on a single-threaded `io_Reactor`
+    Kind_coroutines,
+    /// One blocking `Thrd` per peer
+    Kind_threads,
+    Kind_count
+} Kind;
+
+/// `req` carries the client's messages to the peer and `rep` carries them back
+typedef struct Peer {
+    var_(req_rd, fs_File_Handle);
+    var_(req_wr, fs_File_Handle);
+    var_(rep_rd, fs_File_Handle);
+    var_(rep_wr, fs_File_Handle);
+} Peer;
+T_use$((Peer)(S));
+
+$static fn_((readAll(fs_File_Handle handle, u8* buf, usize len))(void)) {
+    for (usize got = 0; got < len;) {
+        let n = read(handle, buf + got, len - got);
+        claim_assert(n > 0);
+        got += as$(usize)(n);
+    }
+};
+
+$static fn_((writeAll(fs_File_Handle handle, const u8* buf, usize len))(void)) {
+    for (usize put = 0; put < len;) {
+        let n = write(handle, buf + put, len - put);
+        claim_assert(n > 0);
+        put += as$(usize)(n);
+    }
+};
+
+/// Each round sends one message to every peer, then collects every reply.
+/// A message fits in a pipe buffer, so the sends never wait on the peers.
+$static Thrd_fn_(client, ({ S$Peer peers; }, Void), ($ignore, args)$scope) {
+    var_(msg, A$$(bench_msg_len, u8)) = A_zero();
+    for (u32 round = 0; round < bench_rounds; ++round) {
+        for_(($s(args->peers))(peer) { writeAll(peer->req_wr, A_ptr(msg), A_len(msg)); });
+        for_(($s(args->peers))(peer) { readAll(peer->rep_rd, A_ptr(msg), A_len(msg)); });
+    }
+    return_({});
+} $unscoped_(Thrd_fn);
+
+$static Thrd_fn_(blockingPeer, ({ Peer peer; }, Void), ($ignore, args)$scope) {
+    var_(msg, A$$(bench_msg_len, u8)) = A_zero();
+    for (u32 round = 0; round < bench_rounds; ++round) {
+        readAll(args->peer.req_rd, A_ptr(msg), A_len(msg));
+        writeAll(args->peer.rep_wr, A_ptr(msg), A_len(msg));
+    }
+    return_({});
+} $unscoped_(Thrd_fn);
+typedef Thrd_FnCtx$(blockingPeer) BlockingPeer;
+T_use$((BlockingPeer)(S));
+T_use$((Thrd)(S));
+
+use_Co_Ctx$(Void);
+async_fn_(asyncPeer, (var_(reactor, io_Reactor*); var_(peer, const Peer*);), Void);
+async_fn_scope(asyncPeer, {
+    var_(msg, A$$(bench_msg_len, u8));
+    var_(len, usize);
+    var_(round, u32);
+    var_(op, io_Reactor_Op);
+}) {
+    for (locals->round = 0; locals->round < bench_rounds; ++locals->round) {
+        for (locals->len = 0; locals->len < bench_msg_len;) {
+            locals->op = io_Reactor_Op_read(args->peer->req_rd, suffixS(A_ref$((S$u8)(locals->msg)), locals->len));
+            io_Reactor_await(args->reactor, &locals->op);
+            locals->len += catch_((io_Reactor_Op_result(&locals->op))($ignore, claim_unreachable));
+        }
+        for (locals->len = 0; locals->len < bench_msg_len;) {
+            locals->op = io_Reactor_Op_write(args->peer->rep_wr, suffixS(A_ref$((S$u8)(locals->msg)), locals->len).as_const);
+            io_Reactor_await(args->reactor, &locals->op);
+            locals->len += catch_((io_Reactor_Op_result(&locals->op))($ignore, claim_unreachable));
+        }
+    }
+    areturn_({});
+} $unscoped_(async_fn);
+typedef Co_CtxFn$(asyncPeer) AsyncPeer;
+T_use$((AsyncPeer)(S));
+
+$static fn_((runCoroutines(S$Peer peers, mem_Allocator gpa))(E$void) $guard) {
+    let frames = u_castS$((S$AsyncPeer)(try_(mem_Allocator_alloc(gpa, typeInfo$(AsyncPeer), peers.len))));
+    defer_(mem_Allocator_free(gpa, u_anyS(frames)));
+    var exec = lit0$((Co_Exec));
+    Co_Exec_init(&exec, gpa, Co_Exec_tick_default);
+    defer_(Co_Exec_fini(&exec));
+    var reactor = try_(io_Reactor_init(&exec, 1024));
+    defer_(io_Reactor_fini(&reactor));
+    for_(($s(frames), $s(peers))(frame, peer) {
+        *frame = *async_ctx((asyncPeer)(&reactor, peer));
+        try_(Co_Exec_spawn(&exec, frame->anyraw));
+    });
+
+    var ctx = Thrd_FnCtx_from$((client)(peers));
+    let thrd = try_(Thrd_spawn(Thrd_SpawnCfg_default, ctx.as_raw));
+    try_(io_Reactor_run(&reactor));
+    let_ignore = Thrd_join(thrd);
+    for_(($s(peers))(peer) {
+        io_Reactor_deregister(&reactor, peer->req_rd);
+        io_Reactor_deregister(&reactor, peer->rep_wr);
+    });
+    return_ok({});
+} $unguarded_(fn);
+
+$static fn_((runThreads(S$Peer peers, mem_Allocator gpa))(E$void) $guard) {
+    let ctxs = u_castS$((S$BlockingPeer)(try_(mem_Allocator_alloc(gpa, typeInfo$(BlockingPeer), peers.len))));
+    defer_(mem_Allocator_free(gpa, u_anyS(ctxs)));
+    let thrds = u_castS$((S$Thrd)(try_(mem_Allocator_alloc(gpa, typeInfo$(Thrd), peers.len))));
+    defer_(mem_Allocator_free(gpa, u_anyS(thrds)));
+    let cfg = lit$((Thrd_SpawnCfg){ .allocator = none(), .stack_size = bench_thrd_stack });
+    for_(($s(ctxs), $s(thrds), $s(peers))(ctx, thrd, peer) {
+        *ctx = Thrd_FnCtx_from$((blockingPeer)(*peer));
+        *thrd = try_(Thrd_spawn(cfg, ctx->as_raw));
+    });
+
+    var ctx = Thrd_FnCtx_from$((client)(peers));
+    let_ignore = Thrd_join(try_(Thrd_spawn(Thrd_SpawnCfg_default, ctx.as_raw)));
+    for_(($s(thrds))(thrd) { let_ignore = Thrd_join(*thrd); });
+    return_ok({});
+} $unguarded_(fn);
+
+/// Fresh pipes per run, since the reactor leaves its ends non-blocking
+$static fn_((openPeers(S$Peer peers))(void)) {
+    for_(($s(peers))(peer) {
+        var_(req, A$$(2, i32)) = A_zero();
+        var_(rep, A$$(2, i32)) = A_zero();
+        claim_assert(pipe(A_ptr(req)) == 0 && pipe(A_ptr(rep)) == 0);
+        *peer = lit$((Peer){
+            .req_rd = *A_at((req)[0]),
+            .req_wr = *A_at((req)[1]),
+            .rep_rd = *A_at((rep)[0]),
+            .rep_wr = *A_at((rep)[1]),
+        });
+    });
+};
+
+$static fn_((closePeers(S$Peer peers))(void)) {
+    for_(($s(peers))(peer) {
+        let_ignore = close(peer->req_rd);
+        let_ignore = close(peer->req_wr);
+        let_ignore = close(peer->rep_rd);
+        let_ignore = close(peer->rep_wr);
+    });
+};
+
+/// Raises the soft descriptor limit as far as allowed and returns how many peers fit
+$static fn_((peerCapacity(void))(usize)) {
+    var_(limit, struct rlimit) = {};
+    if (getrlimit(RLIMIT_NOFILE, &limit) != 0) { return 0; }
+    limit.rlim_cur = limit.rlim_max;
+    let_ignore = setrlimit(RLIMIT_NOFILE, &limit);
+    let_ignore = getrlimit(RLIMIT_NOFILE, &limit);
+    if (limit.rlim_cur <= 64) { return 0; }
+    return prim_min(as$(usize)(bench_max_peers), as$(usize)((limit.rlim_cur - 64) / 4));
+};
+
+fn_((main(S$S_const$u8 args))(E$void) $guard) {
+    let_ignore = args;
+    var page = lit0$((heap_Page));
+    let gpa = heap_Page_allocator(&page);
+    let peer_count = peerCapacity();
+    claim_assert(peer_count != 0);
+    let peers = u_castS$((S$Peer)(try_(mem_Allocator_alloc(gpa, typeInfo$(Peer), peer_count))));
+    defer_(mem_Allocator_free(gpa, u_anyS(peers)));
+    let_(kind_names, A$$(Kind_count, S_const$u8)) = A_init({
+        u8_l("Co+Reactor"), u8_l("Thrd"),
+    });
+
+    io_stream_println(
+        u8_l("{:uz} pipe peers x {:u} rounds of {:u}-byte echoes"),
+        peer_count, bench_rounds, bench_msg_len
+    );
+    io_stream_println(u8_l("{:>10s} | {:>9s} | {:>9s}"), u8_l("backend"), u8_l("ms"), u8_l("k echo/s"));
+    for (Kind kind = 0; kind < Kind_count; ++kind) {
+        openPeers(peers);
+        let start = time_Instant_now();
+        if (kind == Kind_coroutines) {
+            try_(runCoroutines(peers, gpa));
+        } else {
+            try_(runThreads(peers, gpa));
+        }
+        let secs = time_Duration_asSecs$f64(time_Instant_elapsed(start));
+        closePeers(peers);
+        let echoes = as$(f64)(peer_count * bench_rounds);
+        io_stream_println(
+            u8_l("{:>10s} | {:>9.1fl} | {:>9.1fl}"),
+            *A_at((kind_names)[kind]), secs * 1e3, echoes / secs / 1e3
+        );
+    }
+    return_ok({});
+} $unguarded_(fn);
@@ -0,0 +1,70 @@
+#include "dh/main.h"
+#include "dh/log.h"
+#include "dh/Thrd.h"
+#include "dh/heap/Page.h"
+#include "dh/time/Instant.h"
+#include "dh/io/stream.h"
+
+#define bench_msgs_per_thrd (lit_n$(usize)(1u << 17))
+#define bench_max_thrds (8)
+
+/* --- Workers: every thread logs the same formatted line --- */
+
+$static Thrd_fn_(logger, ({ usize count; }, Void), ($ignore, args)$scope) {
+    for (usize i = 0; i < args->count; ++i) {
+        log_info("request %zu served in %d us (%s)", i, 42, "ok");
+    }
+    return_({});
+} $unscoped_(Thrd_fn);
+
+/// Returns the mean cost of one `log_info` call in nanoseconds, as seen by the callers.
+$static fn_((run(usize thrds))(E$f64) $scope) {
+    var_(ctxs, A$$(bench_max_thrds, Thrd_FnCtx$(logger))) = A_zero();
+    var_(handles, A$$(bench_max_thrds, Thrd)) = A_zero();
+    let start = time_Instant_now();
+    for_(($r(0, thrds))(i) {
+        *A_at((ctxs)[i]) = Thrd_FnCtx_from$((logger)(bench_msgs_per_thrd));
+        *A_at((handles)[i]) = try_(Thrd_spawn(Thrd_SpawnCfg_default, A_at((ctxs)[i])->as_raw));
+    });
+    for_(($r(0, thrds))(i) { let_ignore = Thrd_join(*A_at((handles)[i])); });
+    let secs = time_Duration_asSecs$f64(time_Instant_elapsed(start));
+    return_ok(secs * 1e9 / as$(f64)(bench_msgs_per_thrd));
+} $unscoped_(fn);
+
+/// Same as `run`, with the async backend active; teardown writes whatever is still queued.
+$static fn_((runAsync(usize thrds, mem_Allocator gpa, log_Overflow overflow))(E$f64) $guard) {
+    var config = log_AsyncConfig_default;
+    config.overflow = overflow;
+    try_(log_initAsync(gpa, config));
+    defer_(log_finiAsync());
+    return_ok(try_(run(thrds)));
+} $unguarded_(fn);
+
+fn_((main(S$S_const$u8 args))(E$void) $scope) {
+    let_ignore = args;
+    var page = (heap_Page){};
+    let gpa = heap_Page_allocator(&page);
+
+    let sink = tmpfile();
+    if (!sink) { return_err(fs_File_Err_OpenFailed()); }
+    log_initWithFile(sink);
+    log_setLevel(log_Level_info);
+
+    io_stream_println(u8_l("{:uz} log_info calls per thread, written to a temporary file"), bench_msgs_per_thrd);
+    io_stream_println(
+        u8_l("{:>7s} | {:>12s} | {:>12s} | {:>12s} | {:>10s}"),
+        u8_l("threads"), u8_l("sync"), u8_l("async block"), u8_l("async drop"), u8_l("dropped")
+    );
+    for (usize thrds = 1; thrds <= bench_max_thrds; thrds *= 2) {
+        let sync_ns = try_(run(thrds));
+        let block_ns = try_(runAsync(thrds, gpa, log_Overflow_block));
+        let drop_ns = try_(runAsync(thrds, gpa, log_Overflow_drop));
+        let dropped = log_droppedCount();
+        io_stream_println(
+            u8_l("{:>7uz} | {:>7.1fl} ns/m | {:>7.1fl} ns/m | {:>7.1fl} ns/m | {:>10uz}"),
+            thrds, sync_ns, block_ns, drop_ns, dropped
+        );
+    }
+    log_fini();
+    return_ok({});
+} $unscoped_(fn);
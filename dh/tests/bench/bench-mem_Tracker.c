@@ -0,0 +1,90 @@
+#include "dh/main.h"
+#include "dh/heap/Classic.h"
+#include "dh/mem/Tracker.h"
+#include "dh/Rand.h"
+#include "dh/time/Instant.h"
+#include "dh/io/stream.h"
+
+#if defined(MEM_NO_TRACE_ALLOC_AND_FREE) || !debug_comp_enabled
+fn_((main(S$S_const$u8 args))(E$void) $scope) {
+    let_ignore = args;
+    io_stream_println(u8_l("mem_Tracker is compiled out; build with debug enabled"));
+    return_ok({});
+} $unscoped_(fn);
+#else
+
+/// Allocation-heavy loop: keeps `bench_live` objects alive and replaces a random one per op.
+#define bench_live (1u << 14)
+#define bench_ops (1u << 22)
+
+typedef enum Mode {
+    /// Straight to the allocator's vtable, as in a build without tracking
+    Mode_untracked,
+    /// Every allocation tracked
+    Mode_tracked,
+    /// One sample per 512 KiB allocated
+    Mode_sampled,
+    /// Every allocation tracked and logged
+    Mode_logged,
+    Mode_count
+} Mode;
+
+$static var_(g_objs, A$$(bench_live, S$u8)) = A_zero();
+
+$static fn_((allocObj(Mode mode, mem_Allocator gpa, usize len))(O$P$u8)) {
+    if (mode == Mode_untracked) { return gpa.vt->alloc(gpa.ctx, len, mem_alignToLog2(16)); }
+    return mem_Allocator_rawAlloc(gpa, len, mem_alignToLog2(16));
+};
+
+$static fn_((freeObj(Mode mode, mem_Allocator gpa, S$u8 obj))(void)) {
+    if (mode == Mode_untracked) { return gpa.vt->free(gpa.ctx, obj, mem_alignToLog2(16)); }
+    return mem_Allocator_rawFree(gpa, obj, mem_alignToLog2(16));
+};
+
+/// Nanoseconds per alloc/free pair.
+$static fn_((run(Mode mode, mem_Allocator gpa))(E$f64) $scope) {
+    var rng = Rand_initSeed(0x16);
+    for_(($s(A_ref(g_objs)))(obj) {
+        let len = 16 + Rand_next$usize(&rng) % 512;
+        let ptr = orelse_((allocObj(mode, gpa, len))(return_err(mem_Err_OutOfMemory())));
+        *obj = init$S$((u8)(ptr, len));
+    });
+    let start = time_Instant_now();
+    for_(($r(0, bench_ops))(i) {
+        let_ignore = i;
+        let obj = A_at((g_objs)[Rand_next$usize(&rng) % bench_live]);
+        freeObj(mode, gpa, *obj);
+        let len = 16 + Rand_next$usize(&rng) % 512;
+        let ptr = orelse_((allocObj(mode, gpa, len))(return_err(mem_Err_OutOfMemory())));
+        *obj = init$S$((u8)(ptr, len));
+    });
+    let ns = time_Duration_asSecs$f64(time_Instant_elapsed(start)) * 1e9 / as$(f64)(bench_ops);
+    for_(($a(g_objs))(obj) { freeObj(mode, gpa, *obj); });
+    return_ok(ns);
+} $unscoped_(fn);
+
+fn_((main(S$S_const$u8 args))(E$void) $scope) {
+    let_ignore = args;
+    var classic = lit0$((heap_Classic));
+    let gpa = heap_Classic_allocator(&classic);
+    let_(mode_names, A$$(Mode_count, S_const$u8)) = A_init({
+        u8_l("untracked"), u8_l("tracked"), u8_l("sampled 512K"), u8_l("tracked + log"),
+    });
+
+    io_stream_println(u8_l("{:uz} alloc/free pairs over {:uz} live objects (16..527 bytes)"), as$(usize)(bench_ops), as$(usize)(bench_live));
+    io_stream_println(u8_l("{:>14s} | {:>9s} | {:>9s}"), u8_l("mode"), u8_l("ns/op"), u8_l("overhead"));
+    var_(base_ns, f64) = 0.0;
+    for (Mode mode = 0; mode < Mode_count; ++mode) {
+        var cfg = mem_Tracker_Cfg_default;
+        cfg.sample_interval = mode == Mode_sampled ? lit_n$(usize)(512) * 1024 : 0;
+        cfg.logs_events = mode == Mode_logged;
+        mem_Tracker_configure(cfg);
+        let ns = try_(run(mode, gpa));
+        if (mode == Mode_untracked) { base_ns = ns; }
+        io_stream_println(u8_l("{:>14s} | {:>9.1fl} | {:>8.1fl}x"), *A_at((mode_names)[mode]), ns, ns / base_ns);
+    }
+    let stats = mem_Tracker_stats();
+    io_stream_println(u8_l("tracked live at exit: {:uz} bytes in {:uz} allocations"), stats.live_bytes, stats.live_count);
+    return_ok({});
+} $unscoped_(fn);
+#endif /* defined(MEM_NO_TRACE_ALLOC_AND_FREE) || !debug_comp_enabled */
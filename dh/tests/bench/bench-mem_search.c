@@ -0,0 +1,103 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+/* memmem */
+#define _GNU_SOURCE
+#endif
+#include "dh/main.h"
+#include "dh/mem/common.h"
+#include "dh/heap/Page.h"
+#include "dh/Rand.h"
+#include "dh/time/Instant.h"
+#include "dh/io/stream.h"
+
+#include <string.h>
+
+/// Splits a text of `bench_text_len` bytes into lines, `bench_rounds` times per method.
+#define bench_text_len (lit_n$(usize)(1) << 24)
+#define bench_rounds (16u)
+
+typedef enum Kind {
+    /// Byte-at-a-time loop, as the readers did before the kernels
+    Kind_scalar,
+    /// Vector byte search
+    Kind_simd,
+    /// libc memchr
+    Kind_memchr,
+    /// Vector substring search for a two-byte delimiter
+    Kind_simd_pattern,
+    /// libc memmem for a two-byte delimiter
+    Kind_memmem,
+    Kind_count
+} Kind;
+
+$static fn_((scalarIdxByte(S_const$u8 haystack, u8 byte))(usize)) {
+    var_(idx, usize) = 0;
+    while (idx < haystack.len && haystack.ptr[idx] != byte) { idx++; }
+    return idx;
+};
+
+/// Index of the next delimiter in `rest`, or `rest.len`, with its length.
+$static fn_((nextDelim(Kind kind, S_const$u8 rest, usize* delim_len))(usize)) {
+    *delim_len = kind < Kind_simd_pattern ? 1 : 2;
+    switch (kind) {
+    case Kind_scalar: return scalarIdxByte(rest, '\n');
+    case Kind_simd: return orelse_((mem_idxByte(rest, '\n'))(rest.len));
+    case Kind_memchr: {
+        let found = as$(const u8*)(memchr(rest.ptr, '\n', rest.len));
+        return found == null ? rest.len : as$(usize)(found - rest.ptr);
+    }
+    case Kind_simd_pattern: return orelse_((mem_idxBytes(rest, u8_l("\r\n")))(rest.len));
+    case Kind_memmem: {
+        let found = as$(const u8*)(memmem(rest.ptr, rest.len, "\r\n", 2));
+        return found == null ? rest.len : as$(usize)(found - rest.ptr);
+    }
+    default: claim_unreachable;
+    }
+};
+
+/// GB/s of text split into lines; `lines` receives the count so the work is kept.
+$static fn_((run(Kind kind, S_const$u8 text, usize* lines))(f64)) {
+    *lines = 0;
+    let start = time_Instant_now();
+    for_(($r(0, bench_rounds))(round) {
+        let_ignore = round;
+        var rest = text;
+        while (rest.len != 0) {
+            var_(delim_len, usize) = 0;
+            let idx = nextDelim(kind, rest, &delim_len);
+            *lines += 1;
+            rest = S_suffix((rest)(prim_min(idx + delim_len, rest.len)));
+        }
+    });
+    let secs = time_Duration_asSecs$f64(time_Instant_elapsed(start));
+    return as$(f64)(text.len) * bench_rounds / secs / 1e9;
+};
+
+fn_((main(S$S_const$u8 args))(E$void) $guard) {
+    let_ignore = args;
+    var page = lit0$((heap_Page));
+    let gpa = heap_Page_allocator(&page);
+    let text = u_castS$((S$u8)(try_(mem_Allocator_alloc(gpa, typeInfo$(u8), bench_text_len))));
+    defer_(mem_Allocator_free(gpa, u_anyS(text)));
+    var rng = Rand_initSeed(0x17);
+    /* printable text with CRLF line endings every 0..160 bytes (80 on average) */
+    var_(idx, usize) = 0;
+    while (idx < text.len) {
+        let line_len = prim_min(Rand_next$usize(&rng) % 161, text.len - idx);
+        for_(($r(0, line_len))(i) { *S_at((text)[idx + i]) = as$(u8)(' ' + Rand_next$usize(&rng) % 95); });
+        idx += line_len;
+        if (idx < text.len) { *S_at((text)[idx++]) = '\r'; }
+        if (idx < text.len) { *S_at((text)[idx++]) = '\n'; }
+    }
+    let_(kind_names, A$$(Kind_count, S_const$u8)) = A_init({
+        u8_l("scalar"), u8_l("simd"), u8_l("memchr"), u8_l("simd \\r\\n"), u8_l("memmem \\r\\n"),
+    });
+
+    io_stream_println(u8_l("{:uz} MiB of text, {:uz} lanes per step"), text.len >> 20, as$(usize)(mem_search_lanes));
+    io_stream_println(u8_l("{:>12s} | {:>9s} | {:>9s}"), u8_l("search"), u8_l("GB/s"), u8_l("lines"));
+    for (Kind kind = 0; kind < Kind_count; ++kind) {
+        var_(lines, usize) = 0;
+        let gbps = run(kind, text.as_const, &lines);
+        io_stream_println(u8_l("{:>12s} | {:>9.2fl} | {:>9uz}"), *A_at((kind_names)[kind]), gbps, lines / bench_rounds);
+    }
+    return_ok({});
+} $unguarded_(fn);
@@ -0,0 +1,186 @@
+#include "dh/main.h"
+#include "dh/sort.h"
+#include "dh/Thrd/Pool.h"
+#include "dh/heap/Page.h"
+#include "dh/Rand.h"
+#include "dh/time/Instant.h"
+#include "dh/io/stream.h"
+
+#define bench_max_thrds (64)
+
+/// 32-byte record keyed by its first field
+typedef struct Rec {
+    u64 key;
+    A$$(3, u64) payload;
+} Rec;
+T_use_S$(Rec);
+
+typedef enum Kind {
+    Kind_u64,
+    Kind_f64,
+    Kind_rec,
+    Kind_count
+} Kind;
+
+typedef enum Pattern {
+    Pattern_random,
+    Pattern_sorted,
+    Pattern_reversed,
+    Pattern_few_unique,
+    Pattern_nearly_sorted,
+    Pattern_count
+} Pattern;
+
+$static fn_((ordU64(u_V$raw lhs, u_V$raw rhs))(cmp_Ord)) {
+    return prim_ord(u_castV$((u64)(lhs)), u_castV$((u64)(rhs)));
+};
+
+$static fn_((ordF64(u_V$raw lhs, u_V$raw rhs))(cmp_Ord)) {
+    return prim_ord(u_castV$((f64)(lhs)), u_castV$((f64)(rhs)));
+};
+
+$static fn_((ordRec(u_V$raw lhs, u_V$raw rhs))(cmp_Ord)) {
+    return prim_ord(u_castV$((Rec)(lhs)).key, u_castV$((Rec)(rhs)).key);
+};
+
+$static fn_((kindType(Kind kind))(TypeInfo)) {
+    switch (kind) {
+    case Kind_u64: return typeInfo$(u64);
+    case Kind_f64: return typeInfo$(f64);
+    case Kind_rec: return typeInfo$(Rec);
+    default: claim_unreachable;
+    }
+};
+
+$static fn_((kindOrd(Kind kind))(sort_OrdFn)) {
+    switch (kind) {
+    case Kind_u64: return wrapFn$(sort_OrdFn, ordU64);
+    case Kind_f64: return wrapFn$(sort_OrdFn, ordF64);
+    case Kind_rec: return wrapFn$(sort_OrdFn, ordRec);
+    default: claim_unreachable;
+    }
+};
+
+$static fn_((patternKey(Rand* rng, Pattern pattern, usize idx, usize len))(u64)) {
+    switch (pattern) {
+    case Pattern_random: return Rand_next$u64(rng);
+    case Pattern_sorted: return idx;
+    case Pattern_reversed: return len - idx;
+    case Pattern_few_unique: return Rand_next$u64(rng) % 8;
+    case Pattern_nearly_sorted: return idx;
+    default: claim_unreachable;
+    }
+};
+
+/// Fills `seq` with keys following `pattern`, stored as `kind`.
+$static fn_((fill(u_S$raw seq, Kind kind, Pattern pattern, Rand* rng))(void)) {
+    /* nearly sorted: ascending with 1% of the positions swapped at random */
+    let swaps = pattern == Pattern_nearly_sorted ? seq.len / 100 : 0;
+    if (kind == Kind_rec) {
+        let recs = u_castS$((S$Rec)(seq));
+        for_(($r(0, recs.len))(i) {
+            asg_lit((S_at((recs)[i]))({ .key = patternKey(rng, pattern, i, recs.len), .payload = A_init({ i, i, i }) }));
+        });
+        for_(($r(0, swaps))($ignore) {
+            let lhs = S_at((recs)[Rand_next$usize(rng) % recs.len]);
+            let rhs = S_at((recs)[Rand_next$usize(rng) % recs.len]);
+            let tmp = *lhs;
+            *lhs = *rhs;
+            *rhs = tmp;
+        });
+        return;
+    }
+    let keys = u_castS$((S$u64)(seq));
+    for_(($r(0, keys.len))(i) { *S_at((keys)[i]) = patternKey(rng, pattern, i, keys.len); });
+    for_(($r(0, swaps))($ignore) {
+        let lhs = S_at((keys)[Rand_next$usize(rng) % keys.len]);
+        let rhs = S_at((keys)[Rand_next$usize(rng) % keys.len]);
+        let tmp = *lhs;
+        *lhs = *rhs;
+        *rhs = tmp;
+    });
+    if (kind == Kind_f64) {
+        /* same width: convert each slot in place */
+        let flts = u_castS$((S$f64)(seq));
+        for_(($r(0, keys.len))(i) { *S_at((flts)[i]) = as$(f64)(*S_at((keys)[i])); });
+    }
+};
+
+typedef enum Algo {
+    Algo_pdq,
+    Algo_pdq_par,
+    Algo_block,
+    Algo_block_par,
+    Algo_count
+} Algo;
+
+/// Milliseconds to sort a fresh copy of `src` with `algo`.
+$static fn_((run(Algo algo, Thrd_Pool* pool, mem_Allocator gpa, u_S$raw work, u_S_const$raw src, sort_OrdFn ordFn))(E$f64) $scope) {
+    u_memcpyS(work, src);
+    let start = time_Instant_now();
+    switch (algo) {
+    case Algo_pdq: sort_pdq(work, ordFn); break;
+    case Algo_pdq_par: sort_pdqPar(pool, work, ordFn); break;
+    case Algo_block: $ignore_void try_(sort_blockAlloc(gpa, work, ordFn)); break;
+    case Algo_block_par: $ignore_void try_(sort_blockPar(pool, gpa, work, ordFn)); break;
+    default: claim_unreachable;
+    }
+    let secs = time_Duration_asSecs$f64(time_Instant_elapsed(start));
+    claim_assert(sort_inOrdd(work.as_const, ordFn));
+    return_ok(secs * 1e3);
+} $unscoped_(fn);
+
+/// Prints one row per pattern for `len` elements of `kind`.
+$static fn_((benchSize(Thrd_Pool* pool, mem_Allocator gpa, Kind kind, usize len, Rand* rng))(E$void) $guard) {
+    let_(kind_names, A$$(Kind_count, S_const$u8)) = A_init({ u8_l("u64"), u8_l("f64"), u8_l("rec32") });
+    let_(pattern_names, A$$(Pattern_count, S_const$u8)) = A_init({
+        u8_l("random"), u8_l("sorted"), u8_l("reversed"), u8_l("few-unique"), u8_l("nearly"),
+    });
+    let type = kindType(kind);
+    let ordFn = kindOrd(kind);
+    let src = try_(mem_Allocator_alloc(gpa, type, len));
+    defer_(mem_Allocator_free(gpa, src));
+    let work = try_(mem_Allocator_alloc(gpa, type, len));
+    defer_(mem_Allocator_free(gpa, work));
+    for (Pattern pattern = 0; pattern < Pattern_count; ++pattern) {
+        fill(src, kind, pattern, rng);
+        var_(times, A$$(Algo_count, f64)) = A_zero();
+        for (Algo algo = 0; algo < Algo_count; ++algo) {
+            *A_at((times)[algo]) = try_(run(algo, pool, gpa, work, src.as_const, ordFn));
+        }
+        io_stream_println(
+            u8_l("{:>5s} | {:>9uz} | {:>10s} | {:>9.2fl} | {:>9.2fl} | {:>9.2fl} | {:>9.2fl}"),
+            *A_at((kind_names)[kind]), len, *A_at((pattern_names)[pattern]),
+            *A_at((times)[Algo_pdq]), *A_at((times)[Algo_pdq_par]),
+            *A_at((times)[Algo_block]), *A_at((times)[Algo_block_par])
+        );
+    }
+    return_ok({});
+} $unguarded_(fn);
+
+fn_((main(S$S_const$u8 args))(E$void) $guard) {
+    let_ignore = args;
+    var page = (heap_Page){};
+    let gpa = heap_Page_allocator(&page);
+    let cpus = prim_min(catch_((Thrd_cpuCount())($ignore, 1)), as$(usize)(bench_max_thrds));
+    var pool = lit0$((Thrd_Pool));
+    var cfg = Thrd_Pool_Cfg_default;
+    cfg.thrd_count = intCast$((u32)(cpus));
+    try_(Thrd_Pool_init(&pool, gpa, cfg));
+    defer_(Thrd_Pool_fini(&pool));
+
+    let_(sizes, A$$(3, usize)) = A_init({ 1u << 16, 1u << 20, 1u << 23 });
+    var rng = Rand_initSeed(0x5047);
+
+    io_stream_println(u8_l("workers: {:uz}, times in ms"), Thrd_Pool_thrdCount(&pool));
+    io_stream_println(
+        u8_l("{:>5s} | {:>9s} | {:>10s} | {:>9s} | {:>9s} | {:>9s} | {:>9s}"),
+        u8_l("type"), u8_l("len"), u8_l("pattern"), u8_l("pdq"), u8_l("pdqPar"), u8_l("block"), u8_l("blockPar")
+    );
+    for (Kind kind = 0; kind < Kind_count; ++kind) {
+        for_(($r(0, A_len(sizes)))(s) {
+            try_(benchSize(&pool, gpa, kind, *A_at((sizes)[s]), &rng));
+        });
+    }
+    return_ok({});
+} $unguarded_(fn);
@@ -0,0 +1,117 @@
+#include "dh/main.h"
+#include "dh/sort.h"
+#include "dh/heap/Page.h"
+#include "dh/Rand.h"
+#include "dh/time/Instant.h"
+#include "dh/io/stream.h"
+
+#define bench_len (lit_n$(usize)(1u << 22))
+
+typedef enum Dist {
+    Dist_uniform,
+    /* keys drawn from a 16-bit range: high digits are constant */
+    Dist_narrow,
+    /* most keys fall in a handful of values, the rest are uniform */
+    Dist_skewed,
+    Dist_count
+} Dist;
+
+typedef enum Algo {
+    Algo_pdq,
+    Algo_radix,
+    Algo_radix_flag,
+    Algo_count
+} Algo;
+
+$static fn_((ordU64(u_V$raw lhs, u_V$raw rhs))(cmp_Ord)) {
+    return prim_ord(u_castV$((u64)(lhs)), u_castV$((u64)(rhs)));
+};
+
+$static fn_((ordF64(u_V$raw lhs, u_V$raw rhs))(cmp_Ord)) {
+    return prim_ord(u_castV$((f64)(lhs)), u_castV$((f64)(rhs)));
+};
+
+$static fn_((drawKey(Rand* rng, Dist dist))(u64)) {
+    switch (dist) {
+    case Dist_uniform: return Rand_next$u64(rng);
+    case Dist_narrow: return Rand_next$u64(rng) & 0xFFFF;
+    case Dist_skewed: return Rand_next$u32(rng) % 10 < 9 ? Rand_next$u64(rng) % 4 : Rand_next$u64(rng);
+    default: claim_unreachable;
+    }
+};
+
+/// Milliseconds to sort a fresh copy of `src` (u64 keys) with `algo`.
+$static fn_((runU64(Algo algo, mem_Allocator gpa, S$u64 work, S_const$u64 src))(E$f64) $scope) {
+    u_memcpyS(u_anyS(work), u_anyS(src));
+    let start = time_Instant_now();
+    switch (algo) {
+    case Algo_pdq: sort_pdq(u_anyS(work), wrapFn$(sort_OrdFn, ordU64)); break;
+    case Algo_radix: try_(sort_radix$u64(gpa, work)); break;
+    case Algo_radix_flag: sort_radixFlag$u64(work); break;
+    default: claim_unreachable;
+    }
+    let secs = time_Duration_asSecs$f64(time_Instant_elapsed(start));
+    claim_assert(sort_inOrdd(u_anyS(work).as_const, wrapFn$(sort_OrdFn, ordU64)));
+    return_ok(secs * 1e3);
+} $unscoped_(fn);
+
+/// Same as `runU64` with the keys reinterpreted as f64 values.
+$static fn_((runF64(Algo algo, mem_Allocator gpa, S$f64 work, S_const$f64 src))(E$f64) $scope) {
+    u_memcpyS(u_anyS(work), u_anyS(src));
+    let start = time_Instant_now();
+    switch (algo) {
+    case Algo_pdq: sort_pdq(u_anyS(work), wrapFn$(sort_OrdFn, ordF64)); break;
+    case Algo_radix: try_(sort_radix$f64(gpa, work)); break;
+    case Algo_radix_flag: sort_radixFlag$f64(work); break;
+    default: claim_unreachable;
+    }
+    let secs = time_Duration_asSecs$f64(time_Instant_elapsed(start));
+    claim_assert(sort_inOrdd(u_anyS(work).as_const, wrapFn$(sort_OrdFn, ordF64)));
+    return_ok(secs * 1e3);
+} $unscoped_(fn);
+
+fn_((main(S$S_const$u8 args))(E$void) $guard) {
+    let_ignore = args;
+    var page = (heap_Page){};
+    let gpa = heap_Page_allocator(&page);
+    let src_buf = try_(mem_Allocator_alloc(gpa, typeInfo$(u64), bench_len));
+    defer_(mem_Allocator_free(gpa, src_buf));
+    let work_buf = try_(mem_Allocator_alloc(gpa, typeInfo$(u64), bench_len));
+    defer_(mem_Allocator_free(gpa, work_buf));
+    let src = u_castS$((S$u64)(src_buf));
+    let work = u_castS$((S$u64)(work_buf));
+    let flt_src = u_castS$((S$f64)(src_buf));
+    let flt_work = u_castS$((S$f64)(work_buf));
+
+    let_(dist_names, A$$(Dist_count, S_const$u8)) = A_init({ u8_l("uniform"), u8_l("narrow"), u8_l("skewed") });
+    var rng = Rand_initSeed(0x4ad1);
+    io_stream_println(u8_l("{:uz} keys, times in ms"), bench_len);
+    io_stream_println(
+        u8_l("{:>4s} | {:>8s} | {:>9s} | {:>9s} | {:>9s}"),
+        u8_l("type"), u8_l("dist"), u8_l("pdq"), u8_l("radix"), u8_l("flag")
+    );
+    for (Dist dist = 0; dist < Dist_count; ++dist) {
+        for_(($s(src))(key) { *key = drawKey(&rng, dist); });
+        var_(times, A$$(Algo_count, f64)) = A_zero();
+        for (Algo algo = 0; algo < Algo_count; ++algo) {
+            *A_at((times)[algo]) = try_(runU64(algo, gpa, work, src.as_const));
+        }
+        io_stream_println(
+            u8_l("{:>4s} | {:>8s} | {:>9.2fl} | {:>9.2fl} | {:>9.2fl}"),
+            u8_l("u64"), *A_at((dist_names)[dist]),
+            *A_at((times)[Algo_pdq]), *A_at((times)[Algo_radix]), *A_at((times)[Algo_radix_flag])
+        );
+
+        /* same distribution as signed magnitudes */
+        for_(($s(flt_src))(val) { *val = as$(f64)(as$(i64)(drawKey(&rng, dist))) * 1e-3; });
+        for (Algo algo = 0; algo < Algo_count; ++algo) {
+            *A_at((times)[algo]) = try_(runF64(algo, gpa, flt_work, flt_src.as_const));
+        }
+        io_stream_println(
+            u8_l("{:>4s} | {:>8s} | {:>9.2fl} | {:>9.2fl} | {:>9.2fl}"),
+            u8_l("f64"), *A_at((dist_names)[dist]),
+            *A_at((times)[Algo_pdq]), *A_at((times)[Algo_radix]), *A_at((times)[Algo_radix_flag])
+        );
+    }
+    return_ok({});
+} $unguarded_(fn);
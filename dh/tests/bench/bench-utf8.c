@@ -0,0 +1,108 @@
+#include "dh/main.h"
+#include "dh/unicode.h"
+#include "dh/heap/Page.h"
+#include "dh/Rand.h"
+#include "dh/time/Instant.h"
+#include "dh/io/stream.h"
+
+/// Each corpus is `bench_text_len` bytes of UTF-8, processed `bench_rounds` times per method.
+#define bench_text_len (lit_n$(usize)(1) << 22)
+#define bench_rounds (16u)
+
+typedef enum Corpus {
+    Corpus_ascii,
+    /// Mostly ASCII with accented letters, as in European languages
+    Corpus_latin,
+    /// 3-byte CJK ideographs with ASCII punctuation
+    Corpus_cjk,
+    /// Short ASCII words between 4-byte emoji
+    Corpus_emoji,
+    Corpus_count
+} Corpus;
+
+typedef enum Kind {
+    Kind_validate_scalar,
+    Kind_validate_simd,
+    Kind_count_scalar,
+    Kind_count_simd,
+    /// UTF-8 to UTF-16, length pass included
+    Kind_to_utf16,
+    Kind_count
+} Kind;
+
+/// Picks the next codepoint of `corpus`.
+$static fn_((nextCodepoint(Corpus corpus, Rand* rng))(u32)) {
+    let roll = Rand_next$usize(rng) % 100;
+    let letter = as$(u32)('a' + Rand_next$usize(rng) % 26);
+    switch (corpus) {
+    case Corpus_ascii: return roll < 15 ? ' ' : letter;
+    case Corpus_latin: return roll < 15 ? ' ' : roll < 25 ? 0xC0 + as$(u32)(Rand_next$usize(rng) % 0x40) : letter;
+    case Corpus_cjk: return roll < 10 ? ',' : 0x4E00 + as$(u32)(Rand_next$usize(rng) % 0x5000);
+    case Corpus_emoji: return roll < 20 ? 0x1F600 + as$(u32)(Rand_next$usize(rng) % 0x50) : roll < 35 ? ' ' : letter;
+    default: claim_unreachable;
+    }
+};
+
+$static fn_((genCorpus(Corpus corpus, S$u8 buf))(S_const$u8)) {
+    var rng = Rand_initSeed(0x18 + corpus);
+    var_(len, usize) = 0;
+    while (len + 4 <= buf.len) {
+        let encoded = catch_((utf8_encodeWithin(nextCodepoint(corpus, &rng), S_suffix((buf)(len))))($ignore, claim_unreachable));
+        len += encoded.len;
+    }
+    return S_prefix((buf)(len)).as_const;
+};
+
+/// GB/s of UTF-8 input; `check` receives a result so the work is kept.
+$static fn_((run(Kind kind, S_const$u8 text, S$u16 utf16, usize* check))(f64)) {
+    *check = 0;
+    let start = time_Instant_now();
+    for_(($r(0, bench_rounds))(round) {
+        let_ignore = round;
+        switch (kind) {
+        case Kind_validate_scalar: *check += utf8_validateScalar(text); break;
+        case Kind_validate_simd: *check += utf8_validate(text); break;
+        case Kind_count_scalar: *check += utf8_countScalar(text); break;
+        case Kind_count_simd: *check += utf8_count(text); break;
+        case Kind_to_utf16: {
+            let units = catch_((unicode_utf8ToUTF16Within(text, utf16))($ignore, claim_unreachable));
+            *check += units.len;
+        } break;
+        default: claim_unreachable;
+        }
+    });
+    let secs = time_Duration_asSecs$f64(time_Instant_elapsed(start));
+    return as$(f64)(text.len) * bench_rounds / secs / 1e9;
+};
+
+fn_((main(S$S_const$u8 args))(E$void) $guard) {
+    let_ignore = args;
+    var page = lit0$((heap_Page));
+    let gpa = heap_Page_allocator(&page);
+    let buf = u_castS$((S$u8)(try_(mem_Allocator_alloc(gpa, typeInfo$(u8), bench_text_len))));
+    defer_(mem_Allocator_free(gpa, u_anyS(buf)));
+    let utf16 = u_castS$((S$u16)(try_(mem_Allocator_alloc(gpa, typeInfo$(u16), bench_text_len))));
+    defer_(mem_Allocator_free(gpa, u_anyS(utf16)));
+    let_(corpus_names, A$$(Corpus_count, S_const$u8)) = A_init({
+        u8_l("ascii"), u8_l("latin"), u8_l("cjk"), u8_l("emoji"),
+    });
+    let_(kind_names, A$$(Kind_count, S_const$u8)) = A_init({
+        u8_l("validate scalar"), u8_l("validate"), u8_l("count scalar"), u8_l("count"), u8_l("to utf16"),
+    });
+
+    io_stream_println(
+        u8_l("{:uz} MiB per corpus, block kernels {:s}"),
+        bench_text_len >> 20, utf8_simd_enabled ? u8_l("on") : u8_l("off")
+    );
+    io_stream_println(u8_l("{:>6s} | {:>15s} | {:>9s}"), u8_l("corpus"), u8_l("method"), u8_l("GB/s"));
+    for (Corpus corpus = 0; corpus < Corpus_count; ++corpus) {
+        let text = genCorpus(corpus, buf);
+        for (Kind kind = 0; kind < Kind_count; ++kind) {
+            var_(check, usize) = 0;
+            let gbps = run(kind, text, utf16, &check);
+            claim_assert(check != 0);
+            io_stream_println(u8_l("{:>6s} | {:>15s} | {:>9.2fl}"), *A_at((corpus_names)[corpus]), *A_at((kind_names)[kind]), gbps);
+        }
+    }
+    return_ok({});
+} $unguarded_(fn);
@@ -0,0 +1,121 @@
+#include "dh/main.h"
+#include "dh/ArrListSoA.h"
+#include "dh/heap/Page.h"
+
+#define test_particles (100u)
+
+typedef struct Particle {
+    var_(x, f32);
+    var_(y, f32);
+    var_(id, u32);
+} Particle;
+
+typedef enum Particle_Field {
+    Particle_x,
+    Particle_y,
+    Particle_id,
+    Particle_Field_count
+} Particle_Field;
+
+$static fn_((particleAt(ArrListSoA list, usize idx))(Particle)) {
+    return u_castV$((Particle)(ArrListSoA_get(list, idx, u_retV$(Particle))));
+};
+
+$static fn_((ordF32(u_V$raw lhs, u_V$raw rhs))(cmp_Ord)) {
+    return prim_ord(u_castV$((f32)(lhs)), u_castV$((f32)(rhs)));
+};
+
+TEST_fn_("append scatters records into cache-line-aligned columns" $guard) {
+    let gpa = heap_Page_allocator(&(heap_Page){});
+    let fields = typeInfos$(f32, f32, u32);
+    var list = ArrListSoA_empty(fields);
+    defer_(ArrListSoA_fini(&list, gpa));
+    try_(TEST_expect(TypeInfo_eq(ArrListSoA_recordType(list), typeInfo$(Particle))));
+    try_(TEST_expect(ArrListSoA_field$((f32)(list, Particle_x)).len == 0));
+
+    for (u32 i = 0; i < test_particles; ++i) {
+        let_(p, Particle) = { .x = as$(f32)(i), .y = as$(f32)(i) * 2.0f, .id = i };
+        try_(ArrListSoA_append(&list, gpa, u_anyV(p)));
+    }
+    try_(TEST_expect(ArrListSoA_len(list) == test_particles));
+    try_(TEST_expect(ArrListSoA_cap(list) % ArrListSoA_cap_align == 0));
+    for (usize field_idx = 0; field_idx < Particle_Field_count; ++field_idx) {
+        let column = ArrListSoA_field(list, field_idx);
+        try_(TEST_expect(column.len == test_particles));
+        try_(TEST_expect(as$(usize)(column.ptr) % arch_cache_line_bytes == 0));
+    }
+
+    let xs = ArrListSoA_field$((f32)(list, Particle_x));
+    let ids = ArrListSoA_field$((u32)(list, Particle_id));
+    for_(($rf(0), $s(xs), $s(ids))(i, x, id) {
+        try_(TEST_expect(*x == as$(f32)(i)));
+        try_(TEST_expect(*id == i));
+    });
+
+    let ys = ArrListSoA_fieldMut$((f32)(list, Particle_y));
+    for_(($s(ys))(y) { *y += 1.0f; });
+    let p = particleAt(list, 10);
+    try_(TEST_expect(p.x == 10.0f && p.y == 21.0f && p.id == 10));
+
+    let_(q, Particle) = { .x = -1.0f, .y = -2.0f, .id = 999 };
+    ArrListSoA_set(list, 10, u_anyV(q));
+    try_(TEST_expect(*S_at((xs)[10]) == -1.0f));
+    try_(TEST_expect(*S_at((ys)[10]) == -2.0f));
+    try_(TEST_expect(*S_at((ids)[10]) == 999));
+} $unguarded_(TEST_fn);
+
+TEST_fn_("removeOrdd shifts and removeSwap moves the last record" $guard) {
+    let gpa = heap_Page_allocator(&(heap_Page){});
+    let fields = typeInfos$(f32, f32, u32);
+    var list = try_(ArrListSoA_init(fields, gpa, 8));
+    defer_(ArrListSoA_fini(&list, gpa));
+    for (u32 i = 0; i < 8; ++i) {
+        let_(p, Particle) = { .x = as$(f32)(i), .y = 0.0f, .id = i };
+        ArrListSoA_appendWithin(&list, u_anyV(p));
+    }
+
+    let removed = u_castV$((Particle)(ArrListSoA_removeOrdd(&list, 2, u_retV$(Particle))));
+    try_(TEST_expect(removed.id == 2));
+    let after_ordd = A_from$((u32){ 0, 1, 3, 4, 5, 6, 7 });
+    try_(TEST_expect(ArrListSoA_len(list) == A_len(after_ordd)));
+    for_(($rf(0), $a(after_ordd))(i, id) {
+        let p = particleAt(list, i);
+        try_(TEST_expect(p.id == *id && p.x == as$(f32)(*id)));
+    });
+
+    let swapped = u_castV$((Particle)(ArrListSoA_removeSwap(&list, 1, u_retV$(Particle))));
+    try_(TEST_expect(swapped.id == 1));
+    let after_swap = A_from$((u32){ 0, 7, 3, 4, 5, 6 });
+    try_(TEST_expect(ArrListSoA_len(list) == A_len(after_swap)));
+    for_(($rf(0), $a(after_swap))(i, id) {
+        let p = particleAt(list, i);
+        try_(TEST_expect(p.id == *id && p.x == as$(f32)(*id)));
+    });
+
+    let last = ArrListSoA_pop(&list, u_retV$(Particle));
+    try_(TEST_expect(isSome(last)));
+    try_(TEST_expect(u_castV$((Particle)(unwrap_(last))).id == 6));
+    ArrListSoA_clearRetainingCap(&list);
+    try_(TEST_expect(isNone(ArrListSoA_pop(&list, u_retV$(Particle)))));
+} $unguarded_(TEST_fn);
+
+TEST_fn_("sortByField orders by one column and carries the rest along" $guard) {
+    let gpa = heap_Page_allocator(&(heap_Page){});
+    let fields = typeInfos$(f32, f32, u32);
+    var list = ArrListSoA_empty(fields);
+    defer_(ArrListSoA_fini(&list, gpa));
+    try_(ArrListSoA_resize(&list, gpa, test_particles));
+    // A permutation of 0..n, since 37 is coprime to 100
+    for_(($rf(0), $s(ArrListSoA_fieldMut$((u32)(list, Particle_id))))(i, id) { *id = as$(u32)((i * 37) % test_particles); });
+    for_(($s(ArrListSoA_field$((u32)(list, Particle_id))), $s(ArrListSoA_fieldMut$((f32)(list, Particle_x))), $s(ArrListSoA_fieldMut$((f32)(list, Particle_y))))(id, x, y) {
+        *x = as$(f32)(*id) * 0.5f;
+        *y = -as$(f32)(*id);
+    });
+
+    ArrListSoA_sortByField(&list, Particle_x, wrapFn$(sort_OrdFn, ordF32));
+    for_(($rf(0), $s(ArrListSoA_field$((f32)(list, Particle_x))), $s(ArrListSoA_field$((f32)(list, Particle_y))), $s(ArrListSoA_field$((u32)(list, Particle_id))))(i, x, y, id) {
+        try_(TEST_expect(*id == i));
+        try_(TEST_expect(*x == as$(f32)(i) * 0.5f));
+        try_(TEST_expect(*y == -as$(f32)(i)));
+    });
+} $unguarded_(TEST_fn);
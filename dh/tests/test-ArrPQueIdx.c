@@ -0,0 +1,164 @@
+#include "dh/main.h"
+#include "dh/ArrPQueIdx.h"
+#include "dh/heap/Page.h"
+#include "dh/Rand.h"
+
+T_use$((u32)(
+    ArrPQueIdx,
+    ArrPQueIdx_init,
+    ArrPQueIdx_fini,
+    ArrPQueIdx_len,
+    ArrPQueIdx_cap,
+    ArrPQueIdx_contains,
+    ArrPQueIdx_peek,
+    ArrPQueIdx_peekHandle,
+    ArrPQueIdx_at,
+    ArrPQueIdx_enque,
+    ArrPQueIdx_enqueWithin,
+    ArrPQueIdx_deque,
+    ArrPQueIdx_remove,
+    ArrPQueIdx_update,
+    ArrPQueIdx_clearRetainingCap
+));
+
+TEST_fn_("enque and deque by handle" $guard) {
+    let gpa = heap_Page_allocator(&(heap_Page){});
+    let ctx = ArrPQue_Ctx_defaultAsc(cmp_MathType_u32);
+    var pq = try_(ArrPQueIdx_init$u32(gpa, 8, ArrPQueIdx_arity_default, &ctx));
+    defer_(ArrPQueIdx_fini$u32(&pq, gpa));
+
+    let items = A_from$((u32){ 54, 12, 7, 23, 25, 13 });
+    for_(($rf(0), $a(items))(handle, item) {
+        ArrPQueIdx_enqueWithin$u32(&pq, handle, *item);
+    });
+    try_(TEST_expect(ArrPQueIdx_len$u32(pq) == 6));
+    try_(TEST_expect(*unwrap_(ArrPQueIdx_peek$u32(pq)) == 7));
+    try_(TEST_expect(unwrap_(ArrPQueIdx_peekHandle$u32(pq)) == 2));
+
+    let sorted_handles = A_from$((usize){ 2, 1, 5, 3, 4, 0 });
+    let sorted_items = A_from$((u32){ 7, 12, 13, 23, 25, 54 });
+    for_(($a(sorted_handles), $a(sorted_items))(handle, sorted) {
+        var_(item, u32) = 0;
+        try_(TEST_expect(unwrap_(ArrPQueIdx_deque$u32(&pq, &item)) == *handle));
+        try_(TEST_expect(item == *sorted));
+        try_(TEST_expect(!ArrPQueIdx_contains$u32(pq, *handle)));
+    });
+    try_(TEST_expect(isNone(ArrPQueIdx_deque$u32(&pq, null))));
+} $unguarded_(TEST_fn);
+
+TEST_fn_("contains and at" $guard) {
+    let gpa = heap_Page_allocator(&(heap_Page){});
+    let ctx = ArrPQue_Ctx_defaultAsc(cmp_MathType_u32);
+    var pq = try_(ArrPQueIdx_init$u32(gpa, 4, 2, &ctx));
+    defer_(ArrPQueIdx_fini$u32(&pq, gpa));
+
+    ArrPQueIdx_enqueWithin$u32(&pq, 1, 10);
+    ArrPQueIdx_enqueWithin$u32(&pq, 3, 30);
+    try_(TEST_expect(!ArrPQueIdx_contains$u32(pq, 0)));
+    try_(TEST_expect(ArrPQueIdx_contains$u32(pq, 1)));
+    try_(TEST_expect(ArrPQueIdx_contains$u32(pq, 3)));
+    try_(TEST_expect(!ArrPQueIdx_contains$u32(pq, 100)));
+    try_(TEST_expect(*unwrap_(ArrPQueIdx_at$u32(pq, 3)) == 30));
+    try_(TEST_expect(isNone(ArrPQueIdx_at$u32(pq, 2))));
+
+    ArrPQueIdx_clearRetainingCap$u32(&pq);
+    try_(TEST_expect(ArrPQueIdx_len$u32(pq) == 0));
+    try_(TEST_expect(!ArrPQueIdx_contains$u32(pq, 1)));
+    try_(TEST_expect(!ArrPQueIdx_contains$u32(pq, 3)));
+} $unguarded_(TEST_fn);
+
+TEST_fn_("enque grows handle range" $guard) {
+    let gpa = heap_Page_allocator(&(heap_Page){});
+    let ctx = ArrPQue_Ctx_defaultAsc(cmp_MathType_u32);
+    var pq = try_(ArrPQueIdx_init$u32(gpa, 0, ArrPQueIdx_arity_default, &ctx));
+    defer_(ArrPQueIdx_fini$u32(&pq, gpa));
+
+    try_(ArrPQueIdx_enque$u32(&pq, gpa, 100, 5));
+    try_(ArrPQueIdx_enque$u32(&pq, gpa, 3, 1));
+    try_(ArrPQueIdx_enque$u32(&pq, gpa, 1000, 3));
+    try_(TEST_expect(1000 < ArrPQueIdx_cap$u32(pq)));
+    try_(TEST_expect(unwrap_(ArrPQueIdx_deque$u32(&pq, null)) == 3));
+    try_(TEST_expect(unwrap_(ArrPQueIdx_deque$u32(&pq, null)) == 1000));
+    try_(TEST_expect(unwrap_(ArrPQueIdx_deque$u32(&pq, null)) == 100));
+} $unguarded_(TEST_fn);
+
+TEST_fn_("update decreases and increases keys" $guard) {
+    let gpa = heap_Page_allocator(&(heap_Page){});
+    let ctx = ArrPQue_Ctx_defaultAsc(cmp_MathType_u32);
+    var pq = try_(ArrPQueIdx_init$u32(gpa, 8, ArrPQueIdx_arity_default, &ctx));
+    defer_(ArrPQueIdx_fini$u32(&pq, gpa));
+
+    let items = A_from$((u32){ 50, 40, 30, 20, 10, 60, 70, 80 });
+    for_(($rf(0), $a(items))(handle, item) {
+        ArrPQueIdx_enqueWithin$u32(&pq, handle, *item);
+    });
+    ArrPQueIdx_update$u32(&pq, 7, 5);  // 80 -> 5
+    ArrPQueIdx_update$u32(&pq, 4, 90); // 10 -> 90
+    ArrPQueIdx_update$u32(&pq, 0, 50); // unchanged
+    try_(TEST_expect(*unwrap_(ArrPQueIdx_at$u32(pq, 7)) == 5));
+
+    let sorted_handles = A_from$((usize){ 7, 3, 2, 1, 0, 5, 6, 4 });
+    for_(($a(sorted_handles))(handle) {
+        try_(TEST_expect(unwrap_(ArrPQueIdx_deque$u32(&pq, null)) == *handle));
+    });
+} $unguarded_(TEST_fn);
+
+TEST_fn_("remove by handle" $guard) {
+    let gpa = heap_Page_allocator(&(heap_Page){});
+    let ctx = ArrPQue_Ctx_defaultAsc(cmp_MathType_u32);
+    var pq = try_(ArrPQueIdx_init$u32(gpa, 16, 2, &ctx));
+    defer_(ArrPQueIdx_fini$u32(&pq, gpa));
+
+    let items = A_from$((u32){ 0, 1, 100, 2, 3, 101, 102, 4, 5, 6, 7, 103, 104, 105, 106, 8 });
+    for_(($rf(0), $a(items))(handle, item) {
+        ArrPQueIdx_enqueWithin$u32(&pq, handle, *item);
+    });
+    // Refilling slot 6 with the last element (8) has to sift it up
+    try_(TEST_expect(unwrap_(ArrPQueIdx_remove$u32(&pq, 6)) == 102));
+    try_(TEST_expect(isNone(ArrPQueIdx_remove$u32(&pq, 6))));
+    try_(TEST_expect(unwrap_(ArrPQueIdx_remove$u32(&pq, 0)) == 0));
+
+    let sorted_items = A_from$((u32){ 1, 2, 3, 4, 5, 6, 7, 8, 100, 101, 103, 104, 105, 106 });
+    for_(($a(sorted_items))(sorted) {
+        var_(item, u32) = 0;
+        let_ignore = unwrap_(ArrPQueIdx_deque$u32(&pq, &item));
+        try_(TEST_expect(item == *sorted));
+    });
+    try_(TEST_expect(ArrPQueIdx_len$u32(pq) == 0));
+} $unguarded_(TEST_fn);
+
+TEST_fn_("random updates keep heap order for every arity" $guard) {
+    let gpa = heap_Page_allocator(&(heap_Page){});
+    let ctx = ArrPQue_Ctx_defaultAsc(cmp_MathType_u32);
+    let_(arities, A$$(4, u32)) = A_init({ 2, 4, 8, 16 });
+    for_(($a(arities))(arity) {
+        var rng = Rand_initSeed(0x21 + *arity);
+        var pq = try_(ArrPQueIdx_init$u32(gpa, 512, *arity, &ctx));
+        var_(keys, A$$(512, u32)) = A_zero();
+        for (usize handle = 0; handle < A_len(keys); ++handle) {
+            let key = as$(u32)(Rand_next$u64(&rng) % 10000);
+            *A_at((keys)[handle]) = key;
+            ArrPQueIdx_enqueWithin$u32(&pq, handle, key);
+        }
+        for_(($r(0, 2048))(step) {
+            let handle = as$(usize)(Rand_next$u64(&rng) % A_len(keys));
+            let key = as$(u32)(Rand_next$u64(&rng) % 10000);
+            if (ArrPQueIdx_contains$u32(pq, handle)) {
+                ArrPQueIdx_update$u32(&pq, handle, key);
+            } else {
+                ArrPQueIdx_enqueWithin$u32(&pq, handle, key);
+            }
+            *A_at((keys)[handle]) = key;
+            if (step % 7 == 0) { let_ignore = ArrPQueIdx_remove$u32(&pq, as$(usize)(Rand_next$u64(&rng) % A_len(keys))); }
+        });
+        var_(prev, u32) = 0;
+        while (ArrPQueIdx_len$u32(pq) != 0) {
+            var_(item, u32) = 0;
+            let handle = unwrap_(ArrPQueIdx_deque$u32(&pq, &item));
+            try_(TEST_expect(prev <= item));
+            try_(TEST_expect(item == *A_at((keys)[handle])));
+            prev = item;
+        }
+        ArrPQueIdx_fini$u32(&pq, gpa);
+    });
+} $unguarded_(TEST_fn);
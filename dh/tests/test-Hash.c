@@ -0,0 +1,110 @@
+#include "dh/main.h"
+#include "dh/Hash.h"
+#include "dh/HashMap.h"
+#include "dh/Rand.h"
+#include "dh/heap/Page.h"
+
+T_use$((usize, u16)(
+    HashMap,
+    HashMap_init,
+    HashMap_fini,
+    HashMap_by,
+    HashMap_contains,
+    HashMap_put
+));
+
+/// Fraction of output bits flipped by single-bit input flips must stay close to 1/2
+/// for every output bit (worst bit checked, not just the mean).
+$static fn_((avalancheWorstBias(Rand* rng, usize len))(f64)) {
+    var_(buf, A$$(256, u8)) = A_zero();
+    var_(flips, A$$(64, u32)) = A_zero();
+    let trials = lit_n$(usize)(48);
+    let bytes = A_prefix$((S$u8)(buf)(len));
+    for_(($r(0, trials))(trial) {
+        let_ignore = trial;
+        for_(($r(0, len))(i) { *A_at((buf)[i]) = Rand_next$u8(rng); });
+        let base = Hash_bytes(bytes.as_const, Hash_seed_default);
+        for_(($r(0, len * 8))(bit) {
+            *A_at((buf)[bit / 8]) ^= as$(u8)(1u << (bit % 8));
+            let diff = base ^ Hash_bytes(bytes.as_const, Hash_seed_default);
+            *A_at((buf)[bit / 8]) ^= as$(u8)(1u << (bit % 8));
+            for_(($r(0, 64))(out) { *A_at((flips)[out]) += as$(u32)((diff >> out) & 1); });
+        });
+    });
+    let samples = as$(f64)(trials * len * 8);
+    var_(worst, f64) = 0.0;
+    for_(($r(0, 64))(out) {
+        let p = as$(f64)(*A_at((flips)[out])) / samples;
+        let bias = p < 0.5 ? 0.5 - p : p - 0.5;
+        if (worst < bias) { worst = bias; }
+    });
+    return worst;
+};
+
+TEST_fn_("Hash_bytes is deterministic and seed dependent" $scope) {
+    let msg = u8_l("the quick brown fox jumps over the lazy dog");
+    try_(TEST_expect(Hash_bytes(msg, Hash_seed_default) == Hash_bytes(msg, Hash_seed_default)));
+    try_(TEST_expect(Hash_bytes(msg, Hash_seed_default) != Hash_bytes(msg, Hash_seed_default + 1)));
+    try_(TEST_expect(Hash_bytes(msg, Hash_seed_default) == Hash_bytesPortable(msg, Hash_seed_default)));
+    try_(TEST_expect(Hash_bytes(u8_l(""), 0) != Hash_bytes(u8_l("\0"), 0)));
+    try_(TEST_expect(Hash_bytes(u8_l("ab"), 0) != Hash_bytes(u8_l("ba"), 0)));
+} $unscoped_(TEST_fn);
+
+TEST_fn_("Hash_val dispatches to the fixed-width mixers" $scope) {
+    let_(k32, u32) = 0xdeadbeefu;
+    let_(k64, u64) = 0x0123456789abcdefull;
+    try_(TEST_expect(Hash_val(u_anyV(k32), 7) == Hash_u32(k32, 7)));
+    try_(TEST_expect(Hash_val(u_anyV(k64), 7) == Hash_u64(k64, 7)));
+    try_(TEST_expect(Hash_u64(k64, 7) != Hash_u64(k64 ^ 1, 7)));
+} $unscoped_(TEST_fn);
+
+TEST_fn_("Hash_bytes avalanche across short, medium and bulk lengths" $scope) {
+    var rng = Rand_initSeed(0x5eed);
+    let_(lens, A$$(8, usize)) = A_init({ 1, 3, 4, 8, 16, 31, 64, 200 });
+    for_(($r(0, A_len(lens)))(i) {
+        let len = *A_at((lens)[i]);
+        /* very short inputs have too few samples for a tight bound */
+        let bound = len < 4 ? 0.12 : 0.05;
+        try_(TEST_expect(avalancheWorstBias(&rng, len) < bound));
+    });
+} $unscoped_(TEST_fn);
+
+TEST_fn_("Hash integer mixers spread sequential keys over low and top bits" $scope) {
+    var_(slots, A$$(1024, u32)) = A_zero();
+    var_(fingerprints, A$$(128, u32)) = A_zero();
+    let keys = lit_n$(u32)(1u << 16);
+    for_(($r(0, keys))(k) {
+        let h = Hash_u64(k, Hash_seed_default);
+        *A_at((slots)[h & (A_len(slots) - 1)]) += 1;
+        *A_at((fingerprints)[h >> 57]) += 1;
+    });
+    let slot_expect = keys / A_len(slots);
+    for_(($r(0, A_len(slots)))(i) {
+        try_(TEST_expect(*A_at((slots)[i]) < slot_expect * 2));
+        try_(TEST_expect(slot_expect / 2 < *A_at((slots)[i])));
+    });
+    let fp_expect = keys / A_len(fingerprints);
+    for_(($r(0, A_len(fingerprints)))(i) {
+        try_(TEST_expect(*A_at((fingerprints)[i]) < fp_expect + fp_expect / 4));
+        try_(TEST_expect(fp_expect - fp_expect / 4 < *A_at((fingerprints)[i])));
+    });
+} $unscoped_(TEST_fn);
+
+TEST_fn_("HashMap_Ctx_for selects the fixed-width context" $guard) {
+    let ctx = HashMap_Ctx_for(typeInfo$(usize));
+    try_(TEST_expect(ctx != HashMap_Ctx_default()));
+    try_(TEST_expect(HashMap_Ctx_for(typeInfo$(A$$(3, u8))) == HashMap_Ctx_default()));
+
+    var heap = (heap_Page){};
+    let gpa = heap_Page_allocator(&heap);
+    var map = try_(HashMap_init$1usize$2u16(ctx, gpa, 64));
+    defer_(HashMap_fini$1usize$2u16(&map, gpa));
+    for_(($r(0, 1000))(i) {
+        try_(HashMap_put$1usize$2u16(&map, gpa, i * 4096, intCast$((u16)(i))));
+    });
+    for_(($r(0, 1000))(i) {
+        try_(TEST_expect(HashMap_contains$1usize$2u16(map, i * 4096)));
+        try_(TEST_expect(i == unwrap_(HashMap_by$1usize$2u16(map, i * 4096))));
+    });
+    try_(TEST_expect(!HashMap_contains$1usize$2u16(map, 1)));
+} $unguarded_(TEST_fn);
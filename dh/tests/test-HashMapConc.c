@@ -0,0 +1,105 @@
+#include "dh/main.h"
+#include "dh/HashMapConc.h"
+#include "dh/Thrd/common.h"
+#include "dh/heap/Page.h"
+#include "dh/heap/Smp.h"
+
+T_use$((u64, u64)(
+    HashMapConc,
+    HashMapConc_init,
+    HashMapConc_fini,
+    HashMapConc_reclaim,
+    HashMapConc_count,
+    HashMapConc_by,
+    HashMapConc_contains,
+    HashMapConc_put,
+    HashMapConc_remove
+));
+
+TEST_fn_("HashMapConc: put/by/remove across shard growth" $guard) {
+    var heap = (heap_Page){};
+    let gpa = heap_Page_allocator(&heap);
+    var map = try_(HashMapConc_init$1u64$2u64(HashMap_Ctx_for(typeInfo$(u64)), gpa, 4, 0));
+    defer_(HashMapConc_fini$1u64$2u64(&map, gpa));
+    try_(TEST_expect(map.shards.len == 4));
+
+    for_(($r(0, 4096))(i) { try_(HashMapConc_put$1u64$2u64(map, gpa, i, i * 3)); });
+    try_(TEST_expect(HashMapConc_count$1u64$2u64(map) == 4096));
+    // No lookup is in flight, so every retired table goes
+    HashMapConc_reclaim$1u64$2u64(map, gpa);
+    for_(($s(map.shards))(shard) { try_(TEST_expect(shard->retired == null)); });
+    for_(($r(0, 4096))(i) {
+        try_(TEST_expect(unwrap_(HashMapConc_by$1u64$2u64(map, i)) == i * 3));
+    });
+
+    try_(HashMapConc_put$1u64$2u64(map, gpa, 7, 70));
+    try_(TEST_expect(unwrap_(HashMapConc_by$1u64$2u64(map, 7)) == 70));
+    try_(TEST_expect(HashMapConc_remove$1u64$2u64(map, 7)));
+    try_(TEST_expect(!HashMapConc_remove$1u64$2u64(map, 7)));
+    try_(TEST_expect(!HashMapConc_contains$1u64$2u64(map, 7)));
+    try_(TEST_expect(HashMapConc_count$1u64$2u64(map) == 4095));
+} $unguarded_(TEST_fn);
+
+TEST_fn_("HashMapConc: put/remove churn rehashes tombstones in place" $guard) {
+    var heap = (heap_Page){};
+    let gpa = heap_Page_allocator(&heap);
+    var map = try_(HashMapConc_init$1u64$2u64(HashMap_Ctx_for(typeInfo$(u64)), gpa, 1, 0));
+    defer_(HashMapConc_fini$1u64$2u64(&map, gpa));
+    let shard = S_at((map.shards)[0]);
+    let cap = HashMap_cap(shard->map);
+
+    // Never more than one live key, so the shard must not grow
+    for_(($r(0, 100000))(i) {
+        try_(HashMapConc_put$1u64$2u64(map, gpa, i, i));
+        try_(TEST_expect(HashMapConc_remove$1u64$2u64(map, i)));
+    });
+    try_(TEST_expect(HashMapConc_count$1u64$2u64(map) == 0));
+    try_(TEST_expect(HashMap_cap(shard->map) == cap));
+    try_(TEST_expect(shard->retired == null));
+} $unguarded_(TEST_fn);
+
+$static var_(g_shared, HashMapConc$(u64, u64)) = {};
+$static var_(g_gpa, mem_Allocator) = {};
+
+/* Every value written is key * 2, so a torn read would show up as a mismatch */
+$static Thrd_fn_(writer, ({ u64 base; }, Void), ($ignore, args)$scope) {
+    for_(($r(0, 20000))(i) {
+        let key = args->base + i;
+        catch_((HashMapConc_put$1u64$2u64(g_shared, g_gpa, key, key * 2))($ignore, claim_unreachable));
+    });
+    return_({});
+} $unscoped_(Thrd_fn);
+
+$static Thrd_fn_(reader, ({ u64 limit; }, usize), ($ignore, args)$scope) {
+    var_(mismatches, usize) = 0;
+    for_(($r(0, 200000))(i) {
+        let key = as$(u64)(i) % args->limit;
+        if_some((HashMapConc_by$1u64$2u64(g_shared, key))(val)) {
+            if (val != key * 2) { mismatches++; }
+        }
+    });
+    return_(mismatches);
+} $unscoped_(Thrd_fn);
+
+TEST_fn_("HashMapConc: lock-free readers never observe torn values" $guard) {
+    var page = (heap_Page){};
+    var smp = try_(heap_Smp_createOnHeap(heap_Page_allocator(&page), 8));
+    defer_(heap_Smp_destroyOnHeap(&smp));
+    g_gpa = heap_Smp_allocator(smp);
+    g_shared = try_(HashMapConc_init$1u64$2u64(HashMap_Ctx_for(typeInfo$(u64)), g_gpa, 8, 0));
+    defer_(HashMapConc_fini$1u64$2u64(&g_shared, g_gpa));
+
+    var w0 = Thrd_FnCtx_from$((writer)(0));
+    var w1 = Thrd_FnCtx_from$((writer)(20000));
+    var r0 = Thrd_FnCtx_from$((reader)(40000));
+    var r1 = Thrd_FnCtx_from$((reader)(40000));
+    let tw0 = try_(Thrd_spawn(Thrd_SpawnCfg_default, w0.as_raw));
+    let tw1 = try_(Thrd_spawn(Thrd_SpawnCfg_default, w1.as_raw));
+    let tr0 = try_(Thrd_spawn(Thrd_SpawnCfg_default, r0.as_raw));
+    let tr1 = try_(Thrd_spawn(Thrd_SpawnCfg_default, r1.as_raw));
+    let_ignore = Thrd_join(tw0);
+    let_ignore = Thrd_join(tw1);
+    try_(TEST_expect(Thrd_FnCtx_ret$((reader)(Thrd_join(tr0))) == 0));
+    try_(TEST_expect(Thrd_FnCtx_ret$((reader)(Thrd_join(tr1))) == 0));
+    try_(TEST_expect(HashMapConc_count$1u64$2u64(g_shared) == 40000));
+} $unguarded_(TEST_fn);
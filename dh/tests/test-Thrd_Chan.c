@@ -0,0 +1,158 @@
+#include "dh/main.h"
+#include "dh/Thrd/Chan.h"
+#include "dh/heap/Page.h"
+
+T_use$((u64)(
+    Thrd_Chan,
+    Thrd_Chan_init,
+    Thrd_Chan_fini,
+    Thrd_Chan_trySend,
+    Thrd_Chan_send,
+    Thrd_Chan_sendS,
+    Thrd_Chan_tryRecv,
+    Thrd_Chan_recv,
+    Thrd_Chan_timedRecv,
+    Thrd_Chan_tryRecvS,
+    Thrd_Chan_recvS
+));
+
+$static fn_((expectFifo(Thrd_Chan_Mode mode))(E$void) $guard) {
+    var page = (heap_Page){};
+    let gpa = heap_Page_allocator(&page);
+    var chan = try_(Thrd_Chan_init$u64(gpa, 3, mode));
+    defer_(Thrd_Chan_fini$u64(&chan, gpa));
+    try_(TEST_expect(Thrd_Chan_cap(chan.as_raw) == 4));
+
+    for_(($r(0, 4))(i) { try_(TEST_expect(try_(Thrd_Chan_trySend$u64(&chan, i)))); });
+    try_(TEST_expect(!try_(Thrd_Chan_trySend$u64(&chan, 4))));
+    try_(TEST_expect(Thrd_Chan_len(chan.as_raw) == 4));
+    for_(($r(0, 4))(i) { try_(TEST_expect(unwrap_(Thrd_Chan_tryRecv$u64(&chan)) == i)); });
+    try_(TEST_expect(isNone(Thrd_Chan_tryRecv$u64(&chan))));
+
+    /* Batches wrap around the ring */
+    var_(values, A$$(3, u64)) = A_zero();
+    var_(out, A$$(4, u64)) = A_zero();
+    for_(($r(0, 8))(round) {
+        for_(($r(0, A_len(values)))(i) { *A_at((values)[i]) = round * 3 + i; });
+        try_(Thrd_Chan_sendS$u64(&chan, A_ref$((S$(const u64))(values))));
+        try_(TEST_expect(Thrd_Chan_tryRecvS$u64(&chan, A_ref$((S$u64)(out))) == 3));
+        for_(($r(0, A_len(values)))(i) { try_(TEST_expect(*A_at((out)[i]) == round * 3 + i)); });
+    });
+    return_ok({});
+} $unguarded_(fn);
+
+TEST_fn_("Thrd_Chan: try operations respect capacity and FIFO order" $scope) {
+    try_(expectFifo(Thrd_Chan_Mode_spsc));
+    try_(expectFifo(Thrd_Chan_Mode_mpmc));
+} $unscoped_(TEST_fn);
+
+TEST_fn_("Thrd_Chan: close drains queued values, then fails" $guard) {
+    var page = (heap_Page){};
+    let gpa = heap_Page_allocator(&page);
+    var chan = try_(Thrd_Chan_init$u64(gpa, 8, Thrd_Chan_Mode_mpmc));
+    defer_(Thrd_Chan_fini$u64(&chan, gpa));
+
+    try_(TEST_expect(isErr(Thrd_Chan_timedRecv$u64(&chan, time_Duration_fromMillis(5)))));
+    try_(Thrd_Chan_send$u64(&chan, 1));
+    try_(Thrd_Chan_send$u64(&chan, 2));
+    Thrd_Chan_close(chan.as_raw);
+    try_(TEST_expect(Thrd_Chan_isClosed(chan.as_raw)));
+    try_(TEST_expect(isErr(Thrd_Chan_trySend$u64(&chan, 3))));
+    try_(TEST_expect(try_(Thrd_Chan_recv$u64(&chan)) == 1));
+    try_(TEST_expect(try_(Thrd_Chan_recv$u64(&chan)) == 2));
+    try_(TEST_expect(isErr(Thrd_Chan_recv$u64(&chan))));
+} $unguarded_(TEST_fn);
+
+#define test_per_producer (50000u)
+
+$static var_(g_chan, Thrd_Chan$u64) = {};
+
+/* Producer `base` sends base * N + [0, N) in small batches */
+$static Thrd_fn_(producer, ({ u64 base; }, Void), ($ignore, args)$scope) {
+    var_(batch, A$$(16, u64)) = A_zero();
+    for (u64 i = 0; i < test_per_producer; i += A_len(batch)) {
+        for_(($r(0, A_len(batch)))(j) { *A_at((batch)[j]) = args->base * test_per_producer + i + j; });
+        catch_((Thrd_Chan_sendS$u64(&g_chan, A_ref$((S$(const u64))(batch))))($ignore, claim_unreachable));
+    }
+    return_({});
+} $unscoped_(Thrd_fn);
+
+typedef struct Totals {
+    var_(sum, u64);
+    var_(count, usize);
+} Totals;
+
+$static Thrd_fn_(consumer, ({ usize batch_len; }, Totals), ($ignore, args)$scope) {
+    var_(storage, A$$(32, u64)) = A_zero();
+    let buf = slice$S(A_ref$((S$u64)(storage)), $r(0, prim_min(args->batch_len, A_len(storage))));
+    var_(sum, u64) = 0;
+    var_(count, usize) = 0;
+    while (true) {
+        let received = catch_((Thrd_Chan_recvS$u64(&g_chan, buf))($ignore, break));
+        for_(($s(slice$S(buf, $r(0, received))))(value) { sum += *value; });
+        count += received;
+    }
+    return_({ .sum = sum, .count = count });
+} $unscoped_(Thrd_fn);
+
+TEST_fn_("Thrd_Chan: MPMC delivers every value exactly once" $guard) {
+    var page = (heap_Page){};
+    let gpa = heap_Page_allocator(&page);
+    g_chan = try_(Thrd_Chan_init$u64(gpa, 256, Thrd_Chan_Mode_mpmc));
+    defer_(Thrd_Chan_fini$u64(&g_chan, gpa));
+
+    var_(producers, A$$(4, Thrd_FnCtx$(producer))) = A_zero();
+    var_(producer_thrds, A$$(4, Thrd)) = A_zero();
+    var_(consumers, A$$(2, Thrd_FnCtx$(consumer))) = A_zero();
+    var_(consumer_thrds, A$$(2, Thrd)) = A_zero();
+    for_(($r(0, A_len(consumers)))(i) {
+        /* One consumer takes single values, the other whole batches */
+        *A_at((consumers)[i]) = Thrd_FnCtx_from$((consumer)(i == 0 ? 1 : 32));
+        *A_at((consumer_thrds)[i]) = try_(Thrd_spawn(Thrd_SpawnCfg_default, A_at((consumers)[i])->as_raw));
+    });
+    for_(($r(0, A_len(producers)))(i) {
+        *A_at((producers)[i]) = Thrd_FnCtx_from$((producer)(i));
+        *A_at((producer_thrds)[i]) = try_(Thrd_spawn(Thrd_SpawnCfg_default, A_at((producers)[i])->as_raw));
+    });
+    for_(($a(producer_thrds))(thrd) { let_ignore = Thrd_join(*thrd); });
+    Thrd_Chan_close(g_chan.as_raw);
+
+    var_(sum, u64) = 0;
+    var_(count, usize) = 0;
+    for_(($a(consumer_thrds))(thrd) {
+        let ret = Thrd_FnCtx_ret$((consumer)(Thrd_join(*thrd)));
+        sum += ret.sum;
+        count += ret.count;
+    });
+    let total = as$(u64)(A_len(producers)) * test_per_producer;
+    try_(TEST_expect(count == total));
+    try_(TEST_expect(sum == total * (total - 1) / 2));
+} $unguarded_(TEST_fn);
+
+$static Thrd_fn_(spscProducer, ({ u64 count; }, Void), ($ignore, args)$scope) {
+    for (u64 i = 0; i < args->count; ++i) {
+        catch_((Thrd_Chan_send$u64(&g_chan, i))($ignore, claim_unreachable));
+    }
+    Thrd_Chan_close(g_chan.as_raw);
+    return_({});
+} $unscoped_(Thrd_fn);
+
+TEST_fn_("Thrd_Chan: SPSC preserves order across threads" $guard) {
+    var page = (heap_Page){};
+    let gpa = heap_Page_allocator(&page);
+    g_chan = try_(Thrd_Chan_init$u64(gpa, 64, Thrd_Chan_Mode_spsc));
+    defer_(Thrd_Chan_fini$u64(&g_chan, gpa));
+
+    var ctx = Thrd_FnCtx_from$((spscProducer)(200000));
+    let thrd = try_(Thrd_spawn(Thrd_SpawnCfg_default, ctx.as_raw));
+    var_(expected, u64) = 0;
+    var_(in_order, bool) = true;
+    while (true) {
+        let value = catch_((Thrd_Chan_recv$u64(&g_chan))($ignore, break));
+        in_order = in_order && value == expected;
+        expected++;
+    }
+    let_ignore = Thrd_join(thrd);
+    try_(TEST_expect(in_order));
+    try_(TEST_expect(expected == 200000));
+} $unguarded_(TEST_fn);
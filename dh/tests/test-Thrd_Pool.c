@@ -0,0 +1,85 @@
+#include "dh/main.h"
+#include "dh/Thrd/Pool.h"
+#include "dh/heap/Page.h"
+
+$static Thrd_fn_(bump, ({ atom_V$usize* counter; }, Void), ($ignore, args)$scope) {
+    atom_V_fetchAdd(args->counter, 1, atom_MemOrd_monotonic);
+    return_({});
+} $unscoped_(Thrd_fn);
+
+TEST_fn_("Thrd_Pool: scope waits for every spawned task" $guard) {
+    var page = (heap_Page){};
+    var pool = lit0$((Thrd_Pool));
+    try_(Thrd_Pool_init(&pool, heap_Page_allocator(&page), (Thrd_Pool_Cfg){
+        .thrd_count = 4,
+        .deque_cap = 64,
+        .injector_cap = 64,
+        .stack_size = Thrd_Pool_Cfg_default_stack_size,
+    }));
+    defer_(Thrd_Pool_fini(&pool));
+    try_(TEST_expect(Thrd_Pool_thrdCount(&pool) == 4));
+    try_(TEST_expect(isNone(Thrd_Pool_currentIdx(&pool))));
+
+    var counter = atom_V_init$(atom_V$usize, 0);
+    /* More tasks than the injector holds: the overflow runs inline on this thread */
+    $static var_(ctxs, A$$(1000, Thrd_FnCtx$(bump))) = A_zero();
+    Thrd_Pool_scope(&pool, scope) {
+        for_(($s(A_ref(ctxs)))(ctx) {
+            *ctx = Thrd_FnCtx_from$((bump)(&counter));
+            Thrd_Pool_Scope_spawn(&scope, ctx->as_raw);
+        });
+    }
+    try_(TEST_expect(atom_V_load(&counter, atom_MemOrd_acquire) == A_len(ctxs)));
+} $unguarded_(TEST_fn);
+
+$static var_(fib_pool, Thrd_Pool*) = null;
+
+/* Each call forks its left branch onto the pool, so scopes nest inside workers */
+$static Thrd_fn_(fib, ({ u32 n; }, u64), ($ignore, args)$scope) {
+    if (args->n < 2) { return_(args->n); }
+    if (args->n < 12) {
+        let lhs = Thrd_FnCtx_call$((fib)(args->n - 1));
+        let rhs = Thrd_FnCtx_call$((fib)(args->n - 2));
+        return_(lhs + rhs);
+    }
+    var lhs = Thrd_FnCtx_from$((fib)(args->n - 1));
+    var scope = Thrd_Pool_Scope_init(fib_pool);
+    Thrd_Pool_Scope_spawn(&scope, lhs.as_raw);
+    let rhs = Thrd_FnCtx_call$((fib)(args->n - 2));
+    Thrd_Pool_Scope_wait(&scope);
+    return_(lhs.ret.as_typed + rhs);
+} $unscoped_(Thrd_fn);
+
+TEST_fn_("Thrd_Pool: nested fork/join from inside workers" $guard) {
+    var page = (heap_Page){};
+    var pool = lit0$((Thrd_Pool));
+    try_(Thrd_Pool_init(&pool, heap_Page_allocator(&page), Thrd_Pool_Cfg_default));
+    defer_(Thrd_Pool_fini(&pool));
+    fib_pool = &pool;
+
+    var root = Thrd_FnCtx_from$((fib)(24));
+    var scope = Thrd_Pool_Scope_init(&pool);
+    Thrd_Pool_Scope_spawn(&scope, root.as_raw);
+    Thrd_Pool_Scope_wait(&scope);
+    try_(TEST_expect(root.ret.as_typed == 46368));
+} $unguarded_(TEST_fn);
+
+TEST_fn_("Thrd_Pool: parallelFor covers the range exactly once" $guard) {
+    var page = (heap_Page){};
+    var pool = lit0$((Thrd_Pool));
+    try_(Thrd_Pool_init(&pool, heap_Page_allocator(&page), Thrd_Pool_Cfg_default));
+    defer_(Thrd_Pool_fini(&pool));
+
+    $static var_(hits, A$$(10007, u8)) = A_zero();
+    let hits_ptr = A_ptr(hits);
+    let visit = la_((R range)(void)) {
+        for (usize i = range.begin; i < range.end; ++i) { hits_ptr[i] += 1; }
+    };
+    Thrd_Pool_parallelFor(&pool, R_from(0, A_len(hits)), 64, wrapLa$(Thrd_Pool_ForFn, visit));
+    for_(($a(hits))(hit) { try_(TEST_expect(*hit == 1)); });
+
+    /* Automatic grain, and an empty range is a no-op */
+    Thrd_Pool_parallelFor(&pool, R_from(0, A_len(hits)), 0, wrapLa$(Thrd_Pool_ForFn, visit));
+    Thrd_Pool_parallelFor(&pool, R_from(5, 5), 0, wrapLa$(Thrd_Pool_ForFn, visit));
+    for_(($a(hits))(hit) { try_(TEST_expect(*hit == 2)); });
+} $unguarded_(TEST_fn);
@@ -0,0 +1,152 @@
+#include "dh/main.h"
+#include "dh/async/Exec.h"
+#include "dh/heap/Page.h"
+
+$static var_(woken_count, usize) = 0;
+
+use_Co_Ctx$(usize);
+/// Returns how many sleepers woke before it
+async_fn_(sleeper, (var_(exec, Co_Exec*); var_(delay, time_Duration);), usize);
+async_fn_scope(sleeper, { var_(timer, Co_Timer); }) {
+    Co_sleep(args->exec, &locals->timer, args->delay);
+    areturn_(woken_count++);
+} $unscoped_(async_fn);
+
+use_Co_Ctx$(bool);
+/// Returns whether the wait timed out
+async_fn_(waiter, (var_(exec, Co_Exec*); var_(flag, const bool*);), bool);
+async_fn_scope(waiter, { var_(timer, Co_Timer); }) {
+    Co_timeout(args->exec, &locals->timer, time_Duration_fromMillis(100), *args->flag);
+    areturn_(Co_Timer_isExpired(&locals->timer));
+} $unscoped_(async_fn);
+
+TEST_fn_("sleepers resume in deadline order across wheel levels" $guard) {
+    let gpa = heap_Page_allocator(&(heap_Page){});
+    var exec = lit0$((Co_Exec));
+    Co_Exec_init(&exec, gpa, time_Duration_milli);
+    defer_(Co_Exec_fini(&exec));
+    woken_count = 0;
+
+    // Levels 0, 0, 1, 1, 2 and 3 at one tick per millisecond
+    let delays = A_from$((u64){ 300, 5, 70000, 70, 1, 4200000 });
+    var_(frames, A$$(6, Co_CtxFn$(sleeper))) = A_zero();
+    for (usize i = 0; i < A_len(frames); ++i) {
+        *A_at((frames)[i]) = *async_ctx((sleeper)(&exec, time_Duration_fromMillis(*A_at((delays)[i]))));
+        try_(Co_Exec_spawn(&exec, A_at((frames)[i])->anyraw));
+    }
+    try_(TEST_expect(Co_Exec_runReady(&exec) == 6));
+    try_(TEST_expect(Co_Exec_pendingLen(&exec) == 6));
+
+    let order = A_from$((usize){ 4, 1, 3, 0, 2, 5 });
+    for_(($rf(0), $a(order))(rank, idx) {
+        let delay = *A_at((delays)[*idx]);
+        Co_Exec_advanceTo(&exec, time_Instant_addDuration(exec.origin, time_Duration_fromMillis(delay - 1)));
+        try_(Co_Exec_drain(&exec));
+        try_(TEST_expect(Co_Exec_readyLen(&exec) == 0));
+        Co_Exec_advanceTo(&exec, time_Instant_addDuration(exec.origin, time_Duration_fromMillis(delay)));
+        try_(Co_Exec_drain(&exec));
+        try_(TEST_expect(Co_Exec_runReady(&exec) == 1));
+        try_(TEST_expect(A_at((frames)[*idx])->state == Co_State_ready));
+        try_(TEST_expect(Co_Ctx_returned(A_at((frames)[*idx])) == rank));
+    });
+    try_(TEST_expect(Co_Exec_isIdle(&exec)));
+} $unguarded_(TEST_fn);
+
+TEST_fn_("cancel and wake" $guard) {
+    let gpa = heap_Page_allocator(&(heap_Page){});
+    var exec = lit0$((Co_Exec));
+    Co_Exec_init(&exec, gpa, time_Duration_milli);
+    defer_(Co_Exec_fini(&exec));
+
+    // A finished frame is queued like any other but never resumed
+    var done = lit$((Co_Ctx){ .is_init = true, .state = Co_State_ready });
+    var a = Co_Timer_init();
+    var b = Co_Timer_init();
+    var c = Co_Timer_init();
+    let after = time_Duration_fromMillis(10);
+    Co_Exec_arm(&exec, &a, &done, after);
+    Co_Exec_arm(&exec, &b, &done, after);
+    Co_Exec_arm(&exec, &c, &done, after);
+    try_(TEST_expect(Co_Exec_cancel(&exec, &b)));
+    try_(TEST_expect(!Co_Exec_cancel(&exec, &b)));
+    try_(TEST_expect(Co_Exec_wake(&exec, &c)));
+    try_(TEST_expect(Co_Exec_pendingLen(&exec) == 2));
+
+    try_(Co_Exec_drain(&exec));
+    try_(TEST_expect(Co_Exec_readyLen(&exec) == 1));
+    try_(TEST_expect(c.state == Co_Timer_State_notified));
+    try_(TEST_expect(!Co_Exec_wake(&exec, &c)));
+
+    Co_Exec_advanceTo(&exec, time_Instant_addDuration(exec.origin, after));
+    try_(Co_Exec_drain(&exec));
+    try_(TEST_expect(Co_Timer_isExpired(&a)));
+    try_(TEST_expect(b.state == Co_Timer_State_idle));
+    try_(TEST_expect(Co_Exec_readyLen(&exec) == 2));
+    try_(TEST_expect(Co_Exec_runReady(&exec) == 0));
+    try_(TEST_expect(Co_Exec_isIdle(&exec)));
+} $unguarded_(TEST_fn);
+
+TEST_fn_("timeout tells wakeups from expiry" $guard) {
+    let gpa = heap_Page_allocator(&(heap_Page){});
+    var exec = lit0$((Co_Exec));
+    Co_Exec_init(&exec, gpa, time_Duration_milli);
+    defer_(Co_Exec_fini(&exec));
+
+    var_(flag_woken, bool) = false;
+    var_(flag_late, bool) = false;
+    var woken = *async_ctx((waiter)(&exec, &flag_woken));
+    var late = *async_ctx((waiter)(&exec, &flag_late));
+    try_(Co_Exec_spawn(&exec, woken.anyraw));
+    try_(Co_Exec_spawn(&exec, late.anyraw));
+    try_(TEST_expect(Co_Exec_runReady(&exec) == 2));
+
+    Co_Exec_advanceTo(&exec, time_Instant_addDuration(exec.origin, time_Duration_fromMillis(50)));
+    flag_woken = true;
+    try_(TEST_expect(Co_Exec_wake(&exec, &woken.locals.timer)));
+    try_(Co_Exec_drain(&exec));
+    try_(TEST_expect(Co_Exec_runReady(&exec) == 1));
+    try_(TEST_expect(woken.state == Co_State_ready));
+    try_(TEST_expect(!Co_Ctx_returned(&woken)));
+
+    Co_Exec_advanceTo(&exec, time_Instant_addDuration(exec.origin, time_Duration_fromMillis(100)));
+    try_(Co_Exec_drain(&exec));
+    try_(TEST_expect(Co_Exec_runReady(&exec) == 1));
+    try_(TEST_expect(late.state == Co_State_ready));
+    try_(TEST_expect(Co_Ctx_returned(&late)));
+} $unguarded_(TEST_fn);
+
+TEST_fn_("deadlines past the wheel span are re-parked" $guard) {
+    let gpa = heap_Page_allocator(&(heap_Page){});
+    var exec = lit0$((Co_Exec));
+    // 2^36 ticks of 1 ns cover about 68.7 s
+    Co_Exec_init(&exec, gpa, time_Duration_fromNanos(1));
+    defer_(Co_Exec_fini(&exec));
+
+    var done = lit$((Co_Ctx){ .is_init = true, .state = Co_State_ready });
+    var timer = Co_Timer_init();
+    Co_Exec_arm(&exec, &timer, &done, time_Duration_fromSecs(100));
+    Co_Exec_advanceTo(&exec, time_Instant_addDuration(exec.origin, time_Duration_from(99, 999999999)));
+    try_(Co_Exec_drain(&exec));
+    try_(TEST_expect(Co_Timer_isPending(&timer)));
+    Co_Exec_advanceTo(&exec, time_Instant_addDuration(exec.origin, time_Duration_fromSecs(100)));
+    try_(Co_Exec_drain(&exec));
+    try_(TEST_expect(Co_Timer_isExpired(&timer)));
+    try_(TEST_expect(Co_Exec_readyLen(&exec) == 1));
+} $unguarded_(TEST_fn);
+
+TEST_fn_("delays near the duration limit do not wrap to an immediate expiry" $guard) {
+    let gpa = heap_Page_allocator(&(heap_Page){});
+    var exec = lit0$((Co_Exec));
+    Co_Exec_init(&exec, gpa, time_Duration_milli);
+    defer_(Co_Exec_fini(&exec));
+
+    // Saturates to u64_limit_max nanoseconds, which rounding up must not push past the limit
+    var done = lit$((Co_Ctx){ .is_init = true, .state = Co_State_ready });
+    var timer = Co_Timer_init();
+    Co_Exec_arm(&exec, &timer, &done, time_Duration_fromSecs(u64_limit_max));
+    try_(Co_Exec_drain(&exec));
+    try_(TEST_expect(Co_Timer_isPending(&timer)));
+    try_(TEST_expect(Co_Exec_readyLen(&exec) == 0));
+    try_(TEST_expect(Co_Exec_cancel(&exec, &timer)));
+    try_(TEST_expect(Co_Exec_isIdle(&exec)));
+} $unguarded_(TEST_fn);
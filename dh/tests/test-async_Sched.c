@@ -0,0 +1,175 @@
+#include "dh/main.h"
+#include "dh/async/Sched.h"
+#include "dh/heap/Page.h"
+
+#define test_tasks (1000u)
+#define test_yields (16u)
+#define test_senders (8u)
+#define test_msgs_per_sender (1000u)
+
+$static var_(g_steps, atom_V$u32) = atom_V_init(0);
+
+use_Co_Ctx$(Void);
+/// Bumps `g_steps` once per round, yielding between rounds
+async_fn_(stepper, (var_(rounds, u32);), Void);
+async_fn_scope(stepper, { var_(round, u32); }) {
+    for (locals->round = 0; locals->round < args->rounds; ++locals->round) {
+        atom_V_fetchAdd(&g_steps, 1, atom_MemOrd_monotonic);
+        Co_Sched_yield();
+    }
+    areturn_({});
+} $unscoped_(async_fn);
+typedef Co_CtxFn$(stepper) Stepper;
+T_use$((Stepper)(S));
+T_use$((Co_Task)(S));
+
+typedef struct Msg {
+    var_(node, Co_Mailbox_Node);
+    var_(value, u64);
+} Msg;
+T_use$((Msg)(S));
+
+async_fn_(sender, (var_(mailbox, Co_Mailbox*); var_(msgs, S$Msg);), Void);
+async_fn_scope(sender, { var_(idx, usize); }) {
+    for (locals->idx = 0; locals->idx < args->msgs.len; ++locals->idx) {
+        Co_Mailbox_send(args->mailbox, &S_at((args->msgs)[locals->idx])->node);
+        Co_Sched_yield();
+    }
+    areturn_({});
+} $unscoped_(async_fn);
+
+use_Co_Ctx$(u64);
+/// Sums the values of `count` messages
+async_fn_(receiver, (var_(mailbox, Co_Mailbox*); var_(count, usize);), u64);
+async_fn_scope(receiver, {
+    var_(node, Co_Mailbox_Node*);
+    var_(received, usize);
+    var_(sum, u64);
+}) {
+    locals->sum = 0;
+    for (locals->received = 0; locals->received < args->count; ++locals->received) {
+        Co_Mailbox_recv(args->mailbox, locals->node);
+        locals->sum += (as$(Msg*)(locals->node))->value;
+    }
+    areturn_(locals->sum);
+} $unscoped_(async_fn);
+
+use_Co_Ctx$(bool);
+/// Suspends until woken from outside, then reports the flag it was woken for
+async_fn_(sleeper, (var_(flag, const atom_V$u32*);), bool);
+async_fn_scope(sleeper, {}) {
+    while (atom_V_load(args->flag, atom_MemOrd_acquire) == 0) { suspend_(); }
+    areturn_(true);
+} $unscoped_(async_fn);
+
+/// Yields until `flag` is set by another task
+async_fn_(spinner, (var_(flag, const atom_V$u32*);), Void);
+async_fn_scope(spinner, {}) {
+    while (atom_V_load(args->flag, atom_MemOrd_acquire) == 0) { Co_Sched_yield(); }
+    areturn_({});
+} $unscoped_(async_fn);
+
+async_fn_(setter, (var_(flag, atom_V$u32*);), Void);
+async_fn_scope(setter, {}) {
+    atom_V_store(args->flag, 1, atom_MemOrd_release);
+    areturn_({});
+} $unscoped_(async_fn);
+
+TEST_fn_("every yield of every task runs exactly once" $guard) {
+    let gpa = heap_Page_allocator(&(heap_Page){});
+    var sched = lit0$((Co_Sched));
+    try_(Co_Sched_init(&sched, gpa, (Co_Sched_Cfg){ .thrd_count = 4, .deque_cap = 64, .stack_size = Co_Sched_Cfg_default_stack_size }));
+    defer_(Co_Sched_fini(&sched));
+
+    let frames = u_castS$((S$Stepper)(try_(mem_Allocator_alloc(gpa, typeInfo$(Stepper), test_tasks))));
+    defer_(mem_Allocator_free(gpa, u_anyS(frames)));
+    let tasks = u_castS$((S$Co_Task)(try_(mem_Allocator_alloc(gpa, typeInfo$(Co_Task), test_tasks))));
+    defer_(mem_Allocator_free(gpa, u_anyS(tasks)));
+    atom_V_store(&g_steps, 0, atom_MemOrd_monotonic);
+    // A 64-slot deque overflows into the injector
+    for_(($s(frames), $s(tasks))(frame, task) {
+        *frame = *async_ctx((stepper)(test_yields));
+        Co_Sched_spawn(&sched, task, frame->anyraw);
+    });
+    Co_Sched_wait(&sched);
+
+    try_(TEST_expect(atom_V_load(&g_steps, atom_MemOrd_acquire) == test_tasks * test_yields));
+    for_(($s(frames), $s(tasks))(frame, task) {
+        try_(TEST_expect(Co_Task_isDone(task)));
+        try_(TEST_expect(frame->state == Co_State_ready));
+    });
+} $unguarded_(TEST_fn);
+
+TEST_fn_("a mailbox delivers every message from concurrent senders" $guard) {
+    let gpa = heap_Page_allocator(&(heap_Page){});
+    var sched = lit0$((Co_Sched));
+    try_(Co_Sched_init(&sched, gpa, (Co_Sched_Cfg){ .thrd_count = 4, .deque_cap = 64, .stack_size = Co_Sched_Cfg_default_stack_size }));
+    defer_(Co_Sched_fini(&sched));
+
+    let total = test_senders * test_msgs_per_sender;
+    let msgs = u_castS$((S$Msg)(try_(mem_Allocator_alloc(gpa, typeInfo$(Msg), total))));
+    defer_(mem_Allocator_free(gpa, u_anyS(msgs)));
+    var_(expected, u64) = 0;
+    for_(($rf(0), $s(msgs))(i, msg) {
+        msg->value = i + 1;
+        expected += msg->value;
+    });
+
+    var_(mailbox, Co_Mailbox) = {};
+    var_(recv_task, Co_Task) = {};
+    Co_Mailbox_init(&mailbox, &recv_task);
+    var recv = *async_ctx((receiver)(&mailbox, total));
+    Co_Sched_spawn(&sched, &recv_task, recv.anyraw);
+    var_(send_frames, A$$(test_senders, Co_CtxFn$(sender))) = A_zero();
+    var_(send_tasks, A$$(test_senders, Co_Task)) = A_zero();
+    for (usize i = 0; i < test_senders; ++i) {
+        let part = slice$S(msgs, $r(i * test_msgs_per_sender, (i + 1) * test_msgs_per_sender));
+        *A_at((send_frames)[i]) = *async_ctx((sender)(&mailbox, part));
+        Co_Sched_spawn(&sched, A_at((send_tasks)[i]), A_at((send_frames)[i])->anyraw);
+    }
+    Co_Sched_wait(&sched);
+
+    try_(TEST_expect(Co_Task_isDone(&recv_task)));
+    try_(TEST_expect(Co_Ctx_returned(&recv) == expected));
+    try_(TEST_expect(isNone(Co_Mailbox_tryRecv(&mailbox))));
+} $unguarded_(TEST_fn);
+
+TEST_fn_("a task woken from outside the pool resumes" $guard) {
+    let gpa = heap_Page_allocator(&(heap_Page){});
+    var sched = lit0$((Co_Sched));
+    try_(Co_Sched_init(&sched, gpa, (Co_Sched_Cfg){ .thrd_count = 2, .deque_cap = 16, .stack_size = Co_Sched_Cfg_default_stack_size }));
+    defer_(Co_Sched_fini(&sched));
+
+    var_(flag, atom_V$u32) = atom_V_init(0);
+    var_(task, Co_Task) = {};
+    var frame = *async_ctx((sleeper)(&flag));
+    Co_Sched_spawn(&sched, &task, frame.anyraw);
+    // Spurious wakes only re-run the check
+    Co_Task_wake(&task);
+    Co_Task_wake(&task);
+    try_(TEST_expect(!Co_Task_isDone(&task)));
+    atom_V_store(&flag, 1, atom_MemOrd_release);
+    Co_Task_wake(&task);
+    Co_Sched_wait(&sched);
+    try_(TEST_expect(Co_Task_isDone(&task)));
+    try_(TEST_expect(Co_Ctx_returned(&frame)));
+} $unguarded_(TEST_fn);
+
+TEST_fn_("a yielding task lets the other queued tasks run on a single worker" $guard) {
+    let gpa = heap_Page_allocator(&(heap_Page){});
+    var sched = lit0$((Co_Sched));
+    try_(Co_Sched_init(&sched, gpa, (Co_Sched_Cfg){ .thrd_count = 1, .deque_cap = 16, .stack_size = Co_Sched_Cfg_default_stack_size }));
+    defer_(Co_Sched_fini(&sched));
+
+    // The spinner runs first; if a yield handed it straight back the setter would never run
+    var_(flag, atom_V$u32) = atom_V_init(0);
+    var_(spin_task, Co_Task) = {};
+    var_(set_task, Co_Task) = {};
+    var spin = *async_ctx((spinner)(&flag));
+    var set = *async_ctx((setter)(&flag));
+    Co_Sched_spawn(&sched, &spin_task, spin.anyraw);
+    Co_Sched_spawn(&sched, &set_task, set.anyraw);
+    Co_Sched_wait(&sched);
+    try_(TEST_expect(Co_Task_isDone(&spin_task)));
+    try_(TEST_expect(Co_Task_isDone(&set_task)));
+} $unguarded_(TEST_fn);
@@ -16,6 +16,8 @@
 #include "dh/main.h"
 #include "dh/fmt/common.h"
 #include "dh/math/common.h"
+#include "dh/io/Fixed.h"
+#include "dh/Rand.h"
 
 /*========== Unsigned Integer Parsing Tests =================================*/
 
@@ -77,6 +79,27 @@ TEST_fn_("fmt_parse$u32: Edge cases and errors" $scope) {
     try_(TEST_expect(isErr(res_overflow)));
 } $unscoped_(TEST_fn);
 
+TEST_fn_("fmt_parse$u64: Long digit runs" $scope) {
+    // Several 8-digit chunks
+    let res1 = try_(fmt_parse$u64(u8_l("1234567890123456789"), 10));
+    try_(TEST_expect(res1 == 1234567890123456789ULL));
+
+    // Leading zeros do not count towards overflow
+    let res2 = try_(fmt_parse$u64(u8_l("000000000000000000000042"), 10));
+    try_(TEST_expect(res2 == 42ULL));
+
+    // Surrounding whitespace is ignored
+    let res3 = try_(fmt_parse$u64(u8_l("  77 "), 10));
+    try_(TEST_expect(res3 == 77ULL));
+
+    // Invalid character inside a full chunk
+    try_(TEST_expect(isErr(fmt_parse$u64(u8_l("1234x6789"), 10))));
+
+    // Trailing junk fails whether or not whitespace precedes it
+    try_(TEST_expect(isErr(fmt_parse$u64(u8_l("12abc"), 10))));
+    try_(TEST_expect(isErr(fmt_parse$u64(u8_l("12 abc"), 10))));
+} $unscoped_(TEST_fn);
+
 TEST_fn_("fmt_parse$usize: Basic test" $scope) {
     // A reasonably large number that should fit in usize
     let res = try_(fmt_parse$usize(u8_l("12345678"), 10));
@@ -115,6 +138,10 @@ TEST_fn_("fmt_parse$i64: Edge cases and errors" $scope) {
     // Underflow
     let res_underflow = fmt_parse$i64(u8_l("-9223372036854775809"), 10);
     try_(TEST_expect(isErr(res_underflow)));
+
+    // Trailing junk
+    try_(TEST_expect(isErr(fmt_parse$i64(u8_l("-12 abc"), 10))));
+    try_(TEST_expect(try_(fmt_parse$i64(u8_l(" -12\n"), 10)) == -12));
 } $unscoped_(TEST_fn);
 
 TEST_fn_("fmt_parse$i32: Edge cases and errors" $scope) {
@@ -189,6 +216,58 @@ TEST_fn_("fmt_parse$f64: Errors" $scope) {
     try_(TEST_expect(isErr(fmt_parse$f64(u8_l("1a")))));
 } $unscoped_(TEST_fn);
 
+/// Bits of the parsed value, so rounding can be checked exactly
+$static fn_((parseBits(S_const$u8 str))(E$u64) $scope) {
+    let value = try_(fmt_parse$f64(str));
+    return_ok(bitCast$((u64)(value)));
+} $unscoped_(fn);
+
+TEST_fn_("fmt_parse$f64: Hex, special values and correct rounding" $scope) {
+    // Hexadecimal
+    try_(TEST_expect(try_(fmt_parse$f64(u8_l("0x1.8p3"))) == 12.0));
+    try_(TEST_expect(try_(parseBits(u8_l("0x1p-1074"))) == 0x1ull));
+
+    // Infinity and NaN
+    try_(TEST_expect(try_(parseBits(u8_l("-Infinity"))) == 0xFFF0000000000000ull));
+    let nan = try_(fmt_parse$f64(u8_l("nan")));
+    try_(TEST_expect(nan != nan));
+
+    // Out of range
+    try_(TEST_expect(try_(fmt_parse$f64(u8_l("1e-400"))) == 0.0));
+    try_(TEST_expect(try_(parseBits(u8_l("1e400"))) == 0x7FF0000000000000ull));
+
+    // Ties round to even
+    try_(TEST_expect(try_(parseBits(u8_l("9007199254740993"))) == 0x4340000000000000ull));
+    try_(TEST_expect(try_(parseBits(u8_l("2.2250738585072011e-308"))) == 0x000FFFFFFFFFFFFFull));
+
+    // More digits than the fast path reads: exactly halfway, then just above it
+    let halfway = u8_l("1.00000000000000011102230246251565404236316680908203125");
+    try_(TEST_expect(try_(parseBits(halfway)) == 0x3FF0000000000000ull));
+    let above = u8_l("1.000000000000000111022302462515654042363166809082031251");
+    try_(TEST_expect(try_(parseBits(above)) == 0x3FF0000000000001ull));
+} $unscoped_(TEST_fn);
+
+/// Fixed notation with enough decimals to hold every shortest digit of `value`
+$static fn_((formatParse(f64 value, S$u8 buf))(E$f64) $scope) {
+    var writer = io_Fixed_Writer_init(io_Fixed_writing(buf));
+    try_(fmt_format(io_Fixed_writer(&writer), u8_l("{:.64fl}"), value));
+    return_ok(try_(fmt_parse$f64(io_Fixed_written(writer.stream).as_const)));
+} $unscoped_(fn);
+
+TEST_fn_("fmt_parse$f64: Round-trips the Ryu formatter bit for bit" $scope) {
+    var rng = Rand_initSeed(0x19);
+    var_(buf, A$$(320, u8)) = A_zero();
+    for_(($r(0, 20000))(round) {
+        let_ignore = round;
+        // Magnitudes in [2^-100, 2^600), so 64 decimals and 320 bytes are enough
+        let exponent = 923 + Rand_next$u64(&rng) % 700;
+        let bits = (Rand_next$u64(&rng) & 0x800FFFFFFFFFFFFFull) | (exponent << 52);
+        let value = bitCast$((f64)(bits));
+        let parsed = try_(formatParse(value, A_ref$((S$u8)(buf))));
+        try_(TEST_expect(bitCast$((u64)(parsed)) == bits));
+    });
+} $unscoped_(TEST_fn);
+
 TEST_fn_("fmt_parse$f32: Basic test" $scope) {
     let epsilon = 1e-6f;
     let res     = try_(fmt_parse$f32(u8_l("12.34")));
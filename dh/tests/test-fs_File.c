@@ -0,0 +1,102 @@
+#include "dh/main.h"
+#include "dh/fs/File.h"
+#include "dh/mem/common.h"
+#include "dh/fmt/common.h"
+#include <stdio.h>
+
+/// Temporary file holding `content`, left open for read and write
+$static fn_((tmpFileWith(S_const$u8 content))(FILE*)) {
+    let file = tmpfile();
+    claim_assert_nonnull(file);
+    let written = fwrite(content.ptr, 1, content.len, file);
+    claim_assert(written == content.len);
+    let_ignore = fflush(file);
+    return file;
+};
+
+TEST_fn_("fs_File_map: views the file at an unaligned offset without copying" $guard) {
+    let file = tmpFileWith(u8_l("skip\nalpha\nbeta\ngamma"));
+    defer_(let_ignore = fclose(file));
+    var flags = fs_File_MapFlags_default;
+    flags.offset = 5;
+    flags.advice = fs_File_MapAdvice_sequential;
+    var mapped = try_(fs_File_map(fs_File_Handle_promote(fileno(file)), flags));
+    defer_(fs_MappedFile_unmap(&mapped));
+    try_(TEST_expect(mem_eqlBytes(fs_MappedFile_bytes(mapped), u8_l("alpha\nbeta\ngamma"))));
+
+    var reader = fs_MappedFile_Reader_init(mapped);
+    let first = unwrap_(fs_MappedFile_Reader_takeUntilByte(&reader, '\n'));
+    try_(TEST_expect(mem_eqlBytes(first, u8_l("alpha"))));
+    try_(TEST_expect(first.ptr == fs_MappedFile_bytes(mapped).ptr));
+    try_(TEST_expect(mem_eqlBytes(unwrap_(fs_MappedFile_Reader_takeUntilByte(&reader, '\n')), u8_l("beta"))));
+
+    /* The io_Reader adapter continues from the same position */
+    var_(buf, A$$(8, u8)) = A_zero();
+    let read = try_(io_Reader_read(fs_MappedFile_reader(&reader), A_ref$((S$u8)(buf))));
+    try_(TEST_expect(mem_eqlBytes(A_prefix$((S_const$u8)(buf)(read)), u8_l("gamma"))));
+    try_(TEST_expect(isNone(fs_MappedFile_Reader_takeUntilByte(&reader, '\n'))));
+} $unguarded_(TEST_fn);
+
+TEST_fn_("fs_File_map: writable shared mappings reach the file after sync" $guard) {
+    let file = tmpFileWith(u8_l("hello world"));
+    defer_(let_ignore = fclose(file));
+    var flags = fs_File_MapFlags_default;
+    flags.mode = fs_File_OpenMode_read_write;
+    var mapped = try_(fs_File_map(fs_File_Handle_promote(fileno(file)), flags));
+    defer_(fs_MappedFile_unmap(&mapped));
+    let bytes = fs_MappedFile_bytesMut(mapped);
+    *S_at((bytes)[0]) = 'j';
+    try_(fs_MappedFile_sync(mapped, true));
+
+    var_(buf, A$$(11, u8)) = A_zero();
+    rewind(file);
+    try_(TEST_expect(fread(A_ptr(buf), 1, A_len(buf), file) == A_len(buf)));
+    try_(TEST_expect(mem_eqlBytes(A_ref$((S_const$u8)(buf)), u8_l("jello world"))));
+} $unguarded_(TEST_fn);
+
+TEST_fn_("fs_File_map: rejects ranges past the end of the file" $guard) {
+    let file = tmpFileWith(u8_l("short"));
+    defer_(let_ignore = fclose(file));
+    var flags = fs_File_MapFlags_default;
+    flags.len = 64;
+    try_(TEST_expect(isErr(fs_File_map(fs_File_Handle_promote(fileno(file)), flags))));
+    flags.offset = 5;
+    flags.len = 0;
+    var empty = try_(fs_File_map(fs_File_Handle_promote(fileno(file)), flags));
+    try_(TEST_expect(fs_MappedFile_bytes(empty).len == 0));
+    fs_MappedFile_unmap(&empty);
+} $unguarded_(TEST_fn);
+
+TEST_fn_("fs_File: positional I/O leaves the cursor alone" $guard) {
+    let file = tmpFileWith(u8_l("0123456789"));
+    defer_(let_ignore = fclose(file));
+    let handle = fs_File_Handle_promote(fileno(file));
+    let_ignore = try_(fs_File_seek(handle, 2, fs_File_SeekFrom_start));
+
+    try_(TEST_expect(try_(fs_File_pwrite(handle, u8_l("ab"), 8)) == 2));
+    var_(buf, A$$(4, u8)) = A_zero();
+    try_(TEST_expect(try_(fs_File_pread(handle, A_ref$((S$u8)(buf)), 6)) == 4));
+    try_(TEST_expect(mem_eqlBytes(A_ref$((S_const$u8)(buf)), u8_l("67ab"))));
+    try_(TEST_expect(try_(fs_File_getPos(handle)) == 2));
+    try_(TEST_expect(try_(fs_File_getEndPos(handle)) == 10));
+    try_(TEST_expect(try_(fs_File_seek(handle, -3, fs_File_SeekFrom_end)) == 7));
+} $unguarded_(TEST_fn);
+
+TEST_fn_("fs_File: vectored writes through io_Writer keep segment order" $guard) {
+    let file = tmpFileWith(u8_l(""));
+    defer_(let_ignore = fclose(file));
+    let handle = fs_File_Handle_promote(fileno(file));
+    let writer = fs_File_writer(handle);
+
+    let_(segs, A$$(3, S_const$u8)) = A_init({ u8_l("gather"), u8_l(""), u8_l(" write ") });
+    try_(io_Writer_writeVecAll(writer, A_ref$((S_const$S_const$u8)(segs))));
+    try_(fmt_format(writer, u8_l("{:uz}{{}}"), as$(usize)(42)));
+
+    var_(chunk_a, A$$(7, u8)) = A_zero();
+    var_(chunk_b, A$$(12, u8)) = A_zero();
+    let_(bufs, A$$(2, S$u8)) = A_init({ A_ref$((S$u8)(chunk_a)), A_ref$((S$u8)(chunk_b)) });
+    let_ignore = try_(fs_File_seek(handle, 0, fs_File_SeekFrom_start));
+    try_(TEST_expect(try_(fs_File_readv(handle, A_ref$((S_const$S$u8)(bufs)))) == 17));
+    try_(TEST_expect(mem_eqlBytes(A_ref$((S_const$u8)(chunk_a)), u8_l("gather "))));
+    try_(TEST_expect(mem_eqlBytes(A_prefix$((S_const$u8)(chunk_b)(10)), u8_l("write 42{}"))));
+} $unguarded_(TEST_fn);
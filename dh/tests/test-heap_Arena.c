@@ -19,3 +19,52 @@ TEST_fn_("test heap_Arena reset while retaining a buffer" $guard) {
         &arena, union_of$((heap_Arena_ResetMode)(heap_Arena_ResetMode_retain_with_limit)(1))
     )));
 } $unguarded_(TEST_fn);
+
+TEST_fn_("test heap_Arena restore frees buffers added after the savepoint" $guard) {
+    var arena = heap_Arena_init(heap_Page_allocator(&(heap_Page){}));
+    defer_(heap_Arena_fini(arena));
+    let a = heap_Arena_allocator(&arena);
+
+    let_ignore = try_(mem_Allocator_alloc(a, typeInfo$(u8), 16));
+    let savepoint = heap_Arena_save(&arena);
+    let first = unwrap_(arena.state.buf_list.first);
+    let_ignore = try_(mem_Allocator_alloc(a, typeInfo$(u8), 4096));
+    let_ignore = try_(mem_Allocator_alloc(a, typeInfo$(u8), 8192));
+    try_(TEST_expect(unwrap_(arena.state.buf_list.first) != first));
+
+    heap_Arena_restore(&arena, savepoint);
+    try_(TEST_expect(unwrap_(arena.state.buf_list.first) == first));
+    try_(TEST_expect(arena.state.end_idx == savepoint.end_idx));
+} $unguarded_(TEST_fn);
+
+TEST_fn_("test heap_Arena scratch skips conflicting arenas" $guard) {
+    defer_(heap_Arena_scratchFini());
+    let outer = heap_Arena_scratch(lit0$((S_const$P$heap_Arena)));
+    defer_(heap_Arena_Scratch_end(outer));
+    let_ignore = try_(mem_Allocator_alloc(heap_Arena_allocator(outer.arena), typeInfo$(u8), 64));
+
+    let_(conflicts, A$$(1, P$heap_Arena)) = A_init({ outer.arena });
+    let inner = heap_Arena_scratch(A_ref$((S_const$P$heap_Arena)(conflicts)));
+    defer_(heap_Arena_Scratch_end(inner));
+    try_(TEST_expect(inner.arena != outer.arena));
+} $unguarded_(TEST_fn);
+
+TEST_fn_("test heap_Arena_Virt commits on demand and grows the last allocation in place" $guard) {
+    var arena = try_(heap_Arena_Virt_init(lit_n$(usize)(64) * 1024 * 1024));
+    defer_(heap_Arena_Virt_fini(&arena));
+    let a = heap_Arena_Virt_allocator(&arena);
+    try_(TEST_expect(arena.committed == 0));
+
+    let savepoint = heap_Arena_Virt_save(&arena);
+    var buf = u_castS$((S$u8)(try_(mem_Allocator_alloc(a, typeInfo$(u8), 100))));
+    try_(TEST_expect(arena.committed == heap_Arena_Virt_commit_granule));
+    let grown = u_castS$((S$u8)(unwrap_(mem_Allocator_remap(a, u_anyS(buf), heap_Arena_Virt_commit_granule * 3))));
+    try_(TEST_expect(grown.ptr == buf.ptr));
+    buf = grown;
+    *S_at((buf)[buf.len - 1]) = 0xab;
+
+    heap_Arena_Virt_restore(&arena, savepoint);
+    try_(TEST_expect(arena.end_idx == 0));
+    heap_Arena_Virt_reset(&arena, 0);
+    try_(TEST_expect(arena.committed == 0));
+} $unguarded_(TEST_fn);
@@ -0,0 +1,46 @@
+#include "dh/main.h"
+#include "dh/heap/Page.h"
+
+TEST_fn_("heap_Page: remap grows a buffer and keeps its contents" $guard) {
+    var page = lit0$((heap_Page));
+    let gpa = heap_Page_allocator(&page);
+    var buf = u_castS$((S$u8)(try_(mem_Allocator_alloc(gpa, typeInfo$(u8), mem_page_size * 4))));
+    defer_(mem_Allocator_free(gpa, u_anyS(buf)));
+    for_(($s(buf), $rf(0))(byte, i) { *byte = as$(u8)(i * 7); });
+
+    let grown_len = mem_page_size * 1024;
+    if_some((mem_Allocator_remap(gpa, u_anyS(buf), grown_len))(grown)) {
+        buf = u_castS$((S$u8)(grown));
+    } else_none {
+        /* only Linux has mremap */
+        try_(TEST_expect(!plat_is_linux));
+        return_ok({});
+    }
+    try_(TEST_expect(buf.len == grown_len));
+    for_(($r(0, mem_page_size * 4))(i) { try_(TEST_expect(*S_at((buf)[i]) == as$(u8)(i * 7))); });
+    /* the added pages are mapped and zeroed */
+    try_(TEST_expect(*S_at((buf)[grown_len - 1]) == 0));
+    *S_at((buf)[grown_len - 1]) = 1;
+} $unguarded_(TEST_fn);
+
+TEST_fn_("heap_Page: granules shrink by advice and grow back in place" $guard) {
+    var cfg = heap_Page_Cfg_default;
+    cfg.granule = mem_page_size * 16;
+    cfg.shrink = heap_Page_Shrink_free;
+    var page = heap_Page_fromCfg(cfg);
+    let gpa = heap_Page_allocator(&page);
+    var buf = u_castS$((S$u8)(try_(mem_Allocator_alloc(gpa, typeInfo$(u8), mem_page_size * 3))));
+    defer_(mem_Allocator_free(gpa, u_anyS(buf)));
+
+    /* the whole granule is mapped, so growing within it never fails */
+    try_(TEST_expect(mem_Allocator_resize(gpa, u_anyS(buf), mem_page_size * 16)));
+    buf.len = mem_page_size * 16;
+    *S_at((buf)[buf.len - 1]) = 0xab;
+
+    try_(TEST_expect(mem_Allocator_resize(gpa, u_anyS(buf), mem_page_size)));
+    buf.len = mem_page_size;
+    try_(TEST_expect(mem_Allocator_resize(gpa, u_anyS(buf), mem_page_size * 16)));
+    buf.len = mem_page_size * 16;
+    *S_at((buf)[buf.len - 1]) = 0xcd;
+    try_(TEST_expect(*S_at((buf)[buf.len - 1]) == 0xcd));
+} $unguarded_(TEST_fn);
@@ -0,0 +1,150 @@
+#include "dh/main.h"
+#include "dh/heap/Page.h"
+#include "dh/heap/Pool.h"
+#include "dh/ListSgl.h"
+#include "dh/Thrd/WaitGroup.h"
+
+typedef struct Particle {
+    f32 x, y;
+    u32 id;
+} Particle;
+T_use_P$(Particle);
+T_use_O$(P$Particle);
+T_use_E$($set(mem_Err)(P$Particle));
+T_use$((Particle)(
+    heap_Pool,
+    heap_Pool_init,
+    heap_Pool_fini,
+    heap_Pool_create,
+    heap_Pool_destroy,
+    heap_Pool_createHdl,
+    heap_Pool_destroyHdl,
+    heap_Pool_at,
+    heap_Pool_hdlOf
+));
+
+T_use$((u32)(ListSgl_Link, ListSgl_Adp, ListSgl));
+T_use$((u32)(ListSgl_Adp_init, ListSgl_empty, ListSgl_len, ListSgl_prepend, ListSgl_shift, ListSgl_Link_data));
+
+TEST_fn_("heap_Pool: create and destroy reuse slots across chunks" $guard) {
+    var page = lit0$((heap_Page));
+    var cfg = heap_Pool_Cfg_default;
+    cfg.first_chunk_len = 3; /* rounded up to 4 */
+    var pool = heap_Pool_init$Particle(heap_Page_allocator(&page), cfg);
+    defer_(heap_Pool_fini$Particle(&pool));
+
+    var_(objs, A$$(20, P$Particle)) = A_zero();
+    for_(($s(A_ref(objs)), $rf(0))(obj, i) {
+        *obj = try_(heap_Pool_create$Particle(&pool));
+        asg_lit((*obj)({ .x = 1.0f, .y = 2.0f, .id = as$(u32)(i) }));
+    });
+    /* chunks of 4, 8 and 16 slots */
+    try_(TEST_expect(heap_Pool_len(pool.as_raw) == 20));
+    try_(TEST_expect(heap_Pool_cap(pool.as_raw) == 28));
+    for_(($s(A_ref(objs)), $rf(0))(obj, i) {
+        try_(TEST_expect((*obj)->id == i));
+        try_(TEST_expect(mem_isAligned(ptrToInt(*obj), alignOf$(Particle))));
+    });
+
+    /* the free list hands back the last destroyed slot first */
+    let freed = *A_at((objs)[7]);
+    heap_Pool_destroy$Particle(&pool, freed);
+    try_(TEST_expect(heap_Pool_len(pool.as_raw) == 19));
+    *A_at((objs)[7]) = try_(heap_Pool_create$Particle(&pool));
+    try_(TEST_expect(*A_at((objs)[7]) == freed));
+    try_(TEST_expect(heap_Pool_cap(pool.as_raw) == 28));
+
+    for_(($s(A_ref(objs)))(obj) { heap_Pool_destroy$Particle(&pool, *obj); });
+    try_(TEST_expect(heap_Pool_len(pool.as_raw) == 0));
+} $unguarded_(TEST_fn);
+
+TEST_fn_("heap_Pool: handles go stale once their object is destroyed" $guard) {
+    var page = lit0$((heap_Page));
+    var pool = heap_Pool_init$Particle(heap_Page_allocator(&page), heap_Pool_Cfg_default);
+    defer_(heap_Pool_fini$Particle(&pool));
+
+    let hdl = try_(heap_Pool_createHdl$Particle(&pool));
+    unwrap_(heap_Pool_at$Particle(&pool, hdl))->id = 42;
+    try_(TEST_expect(unwrap_(heap_Pool_at$Particle(&pool, hdl))->id == 42));
+    let obj = unwrap_(heap_Pool_at$Particle(&pool, hdl));
+    let round_trip = heap_Pool_hdlOf$Particle(&pool, obj);
+    try_(TEST_expect(round_trip.idx == hdl.idx && round_trip.gen == hdl.gen));
+
+    try_(TEST_expect(heap_Pool_destroyHdl$Particle(&pool, hdl)));
+    try_(TEST_expect(isNone(heap_Pool_at$Particle(&pool, hdl))));
+    try_(TEST_expect(!heap_Pool_destroyHdl$Particle(&pool, hdl)));
+
+    /* same slot, new generation: the old handle still does not resolve */
+    let reused = try_(heap_Pool_createHdl$Particle(&pool));
+    try_(TEST_expect(reused.idx == hdl.idx && reused.gen != hdl.gen));
+    try_(TEST_expect(isNone(heap_Pool_at$Particle(&pool, hdl))));
+    try_(TEST_expect(isSome(heap_Pool_at$Particle(&pool, reused))));
+    try_(TEST_expect(!heap_Pool_isLive(pool.as_raw, heap_Pool_Hdl_nil)));
+    try_(TEST_expect(!heap_Pool_isLive(pool.as_raw, lit0$((heap_Pool_Hdl)))));
+} $unguarded_(TEST_fn);
+
+TEST_fn_("heap_Pool: allocator backs ListSgl nodes" $guard) {
+    var page = lit0$((heap_Page));
+    var pool = heap_Pool_init(typeInfo$(ListSgl_Adp$u32), heap_Page_allocator(&page), heap_Pool_Cfg_default);
+    defer_(heap_Pool_fini(&pool, typeInfo$(ListSgl_Adp$u32)));
+    let gpa = heap_Pool_allocator(&pool);
+
+    var list = ListSgl_empty$u32();
+    for (u32 i = 0; i < 1000; ++i) {
+        let node = u_castP$((ListSgl_Adp$u32*)(try_(mem_Allocator_create(gpa, typeInfo$(ListSgl_Adp$u32)))));
+        *node = ListSgl_Adp_init$u32(i);
+        ListSgl_prepend$u32(&list, &node->link);
+    }
+    try_(TEST_expect(ListSgl_len$u32(&list) == 1000));
+    try_(TEST_expect(heap_Pool_len(&pool) == 1000));
+
+    /* requests larger than a node are refused */
+    try_(TEST_expect(isNone(mem_Allocator_rawAlloc(gpa, sizeOf$(ListSgl_Adp$u32) + 1, alignOf$(ListSgl_Adp$u32)))));
+
+    for (u32 expected = 1000; expected-- > 0;) {
+        let link = unwrap_(ListSgl_shift$u32(&list));
+        try_(TEST_expect(*ListSgl_Link_data$u32(link) == expected));
+        mem_Allocator_destroy(gpa, u_anyP(as$(ListSgl_Adp$u32*)(link)));
+    }
+    try_(TEST_expect(heap_Pool_len(&pool) == 0));
+} $unguarded_(TEST_fn);
+
+#define test_thrd_count (4)
+#define test_thrd_objs (lit_n$(usize)(1u << 14))
+
+$static var_(g_pool, heap_Pool$Particle) = {};
+
+$static Thrd_fn_(churn, ({ u32 seed; }, Void), ($ignore, args)$scope) {
+    var_(live, A$$(64, P$Particle)) = A_zero();
+    for_(($r(0, test_thrd_objs))(i) {
+        let slot = A_at((live)[i % A_len(live)]);
+        if (*slot != null) {
+            claim_assert((*slot)->id == args->seed);
+            heap_Pool_destroy$Particle(&g_pool, *slot);
+        }
+        *slot = catch_((heap_Pool_create$Particle(&g_pool))($ignore, claim_unreachable));
+        (*slot)->id = args->seed;
+    });
+    for_(($s(A_ref(live)))(obj) { heap_Pool_destroy$Particle(&g_pool, *obj); });
+    return_({});
+} $unscoped_(Thrd_fn);
+
+TEST_fn_("heap_Pool: thread-safe variant under concurrent churn" $guard) {
+    var page = lit0$((heap_Page));
+    let gpa = heap_Page_allocator(&page);
+    var cfg = heap_Pool_Cfg_default;
+    cfg.is_thrd_safe = true;
+    g_pool = heap_Pool_init$Particle(gpa, cfg);
+    defer_(heap_Pool_fini$Particle(&g_pool));
+
+    $static var_(ctxs, A$$(test_thrd_count, Thrd_FnCtx$(churn))) = A_zero();
+    var wg = Thrd_WaitGroup_init();
+    defer_(Thrd_WaitGroup_fini(&wg));
+    for_(($r(0, test_thrd_count))(i) {
+        *A_at((ctxs)[i]) = Thrd_FnCtx_from$((churn)(as$(u32)(i + 1)));
+        Thrd_WaitGroup_spawn(&wg, gpa, A_at((ctxs)[i])->as_raw);
+    });
+    Thrd_WaitGroup_wait(&wg);
+    try_(TEST_expect(heap_Pool_len(g_pool.as_raw) == 0));
+    try_(TEST_expect(heap_Pool_cap(g_pool.as_raw) >= 64));
+} $unguarded_(TEST_fn);
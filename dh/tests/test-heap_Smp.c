@@ -1,11 +1,13 @@
 #include "dh/main.h"
 #include "dh/heap/Page.h"
 #include "dh/heap/Smp.h"
+#include "dh/Thrd/common.h"
 
 TEST_fn_("SmpAllocator with custom parent" $guard) {
     $static var_(thrd_metas, A$$(16, heap_Smp_ThrdMeta)) = A_zero();
     var page = lit0$((heap_Page));
     var smp = heap_Smp_from(heap_Page_allocator(&page), A_ref$((S$heap_Smp_ThrdMeta)(thrd_metas)));
+    defer_(heap_Smp_fini(&smp));
     let gpa = heap_Smp_allocator(&smp);
 
     // Test basic allocation
@@ -22,13 +24,142 @@ TEST_fn_("SmpAllocator with custom parent" $guard) {
 
 TEST_fn_("SmpAllocator heap allocation" $guard) {
     var page = lit0$((heap_Page));
-    var smp = try_(heap_Smp_createOnHeap(heap_Page_allocator(&page), heap_Smp_max_thrd_count));
+    var smp = try_(heap_Smp_createOnHeap(heap_Page_allocator(&page), 4));
     defer_(heap_Smp_destroyOnHeap(&smp));
     let gpa = heap_Smp_allocator(smp);
 
-    // Test heap allocation for large thread counts
+    // Threads beyond the preallocated metas get spilled ones
     let slice = u_castS$((S$u8)(try_(mem_Allocator_alloc(gpa, typeInfo$(u8), 100))));
     defer_(mem_Allocator_free(gpa, u_anyS(slice)));
 
     try_(TEST_expect(slice.len == 100));
 } $unguarded_(TEST_fn);
+
+TEST_fn_("SmpAllocator quarter size classes" $guard) {
+    $static var_(thrd_metas, A$$(4, heap_Smp_ThrdMeta)) = A_zero();
+    var page = lit0$((heap_Page));
+    var cfg = heap_Smp_Cfg_default;
+    cfg.size_classes = heap_Smp_SizeClasses_quarter;
+    var smp = heap_Smp_fromCfg(heap_Page_allocator(&page), A_ref$((S$heap_Smp_ThrdMeta)(thrd_metas)), cfg);
+    defer_(heap_Smp_fini(&smp));
+    let gpa = heap_Smp_allocator(&smp);
+
+    // A 72-byte object takes an 80-byte slot instead of a 128-byte one
+    let obj = u_castS$((S$u8)(try_(mem_Allocator_alloc(gpa, typeInfo$(u8), 72))));
+    defer_(mem_Allocator_free(gpa, u_anyS(obj)));
+    let stats = heap_Smp_stats(&smp);
+    try_(TEST_expect(stats.requested == 72));
+    try_(TEST_expect(stats.active == 80));
+
+    // Over-aligned requests still get a suitably aligned slot
+    let aligned = unwrap_(mem_Allocator_rawAlloc(gpa, 40, mem_alignToLog2(32)));
+    defer_(mem_Allocator_rawFree(gpa, init$S$((u8)(aligned, 40)), mem_alignToLog2(32)));
+    try_(TEST_expect(mem_isAligned(ptrToInt(aligned), 32)));
+} $unguarded_(TEST_fn);
+
+TEST_fn_("SmpAllocator releases empty slabs after decay" $guard) {
+    $static var_(thrd_metas, A$$(4, heap_Smp_ThrdMeta)) = A_zero();
+    var page = lit0$((heap_Page));
+    var cfg = heap_Smp_Cfg_default;
+    cfg.decay = time_Duration_zero;
+    var smp = heap_Smp_fromCfg(heap_Page_allocator(&page), A_ref$((S$heap_Smp_ThrdMeta)(thrd_metas)), cfg);
+    defer_(heap_Smp_fini(&smp));
+    let gpa = heap_Smp_allocator(&smp);
+
+    var_(ptrs, A$$(4096, P$u8)) = A_zero();
+    for_(($s(A_ref(ptrs)))(ptr) {
+        *ptr = unwrap_(mem_Allocator_rawAlloc(gpa, 96, mem_alignToLog2(8)));
+    });
+    let peak = heap_Smp_stats(&smp);
+    try_(TEST_expect(peak.resident >= A_len(ptrs) * 96));
+    try_(TEST_expect(peak.requested == A_len(ptrs) * 96));
+    for_(($s(A_ref(ptrs)))(ptr) { mem_Allocator_rawFree(gpa, init$S$((u8)(*ptr, 96)), mem_alignToLog2(8)); });
+    let after = heap_Smp_stats(&smp);
+    try_(TEST_expect(after.resident == 0));
+    try_(TEST_expect(after.requested == 0));
+    try_(TEST_expect(after.cached == 0));
+} $unguarded_(TEST_fn);
+
+TEST_fn_("SmpAllocator aligns slabs on page-granular backing memory" $guard) {
+    $static var_(thrd_metas, A$$(4, heap_Smp_ThrdMeta)) = A_zero();
+    var page = lit0$((heap_Page));
+    var cfg = heap_Smp_Cfg_default;
+    cfg.decay = time_Duration_zero;
+    var smp = heap_Smp_fromCfg(heap_Page_allocator(&page), A_ref$((S$heap_Smp_ThrdMeta)(thrd_metas)), cfg);
+    defer_(heap_Smp_fini(&smp));
+    let gpa = heap_Smp_allocator(&smp);
+
+    // heap_Page maps whole pages at no particular 64 KiB boundary, yet the first
+    // slot of every fresh slab (one per size here) must sit on a slab boundary
+    let_(sizes, A$$(8, usize)) = A_init({ 8, 24, 48, 96, 160, 320, 1000, 4000 });
+    var_(ptrs, A$$(8, P$u8)) = A_zero();
+    for_(($a(sizes), $s(A_ref(ptrs)))(size, ptr) {
+        *ptr = unwrap_(mem_Allocator_rawAlloc(gpa, *size, mem_alignToLog2(8)));
+        try_(TEST_expect(mem_isAligned(ptrToInt(*ptr), heap_Smp_slab_len)));
+    });
+    for_(($a(sizes), $s(A_ref(ptrs)))(size, ptr) { mem_Allocator_rawFree(gpa, init$S$((u8)(*ptr, *size)), mem_alignToLog2(8)); });
+    try_(TEST_expect(heap_Smp_stats(&smp).resident == 0));
+} $unguarded_(TEST_fn);
+
+$static var_(g_smp, heap_Smp*) = null;
+$static var_(g_gpa, mem_Allocator) = {};
+$static var_(g_ptrs, A$$(4096, P$u8)) = A_zero();
+
+/* Frees what the main thread allocated, then allocates on a meta of its own */
+$static Thrd_fn_(remoteFreer, ({ usize len; }, Void), ($ignore, args)$scope) {
+    for_(($s(A_ref(g_ptrs)))(ptr) { mem_Allocator_rawFree(g_gpa, init$S$((u8)(*ptr, args->len)), mem_alignToLog2(8)); });
+    let own = unwrap_(mem_Allocator_rawAlloc(g_gpa, args->len, mem_alignToLog2(8)));
+    mem_Allocator_rawFree(g_gpa, init$S$((u8)(own, args->len)), mem_alignToLog2(8));
+    heap_Smp_detachThrd(g_smp);
+    return_({});
+} $unscoped_(Thrd_fn);
+
+TEST_fn_("SmpAllocator takes back slots freed by other threads" $guard) {
+    $static var_(thrd_metas, A$$(1, heap_Smp_ThrdMeta)) = A_zero();
+    var page = lit0$((heap_Page));
+    var smp = heap_Smp_from(heap_Page_allocator(&page), A_ref$((S$heap_Smp_ThrdMeta)(thrd_metas)));
+    defer_(heap_Smp_fini(&smp));
+    g_smp = &smp;
+    g_gpa = heap_Smp_allocator(&smp);
+
+    for_(($s(A_ref(g_ptrs)))(ptr) {
+        *ptr = unwrap_(mem_Allocator_rawAlloc(g_gpa, 96, mem_alignToLog2(8)));
+    });
+    // The only preallocated meta is taken, so the freeing thread spills another
+    var freer = Thrd_FnCtx_from$((remoteFreer)(96));
+    let_ignore = Thrd_join(try_(Thrd_spawn(Thrd_SpawnCfg_default, freer.as_raw)));
+    try_(TEST_expect(atom_V_load(&smp.spilled_metas, atom_MemOrd_acquire) != 0));
+
+    // Remote frees stay queued until the owner collects them
+    let queued = heap_Smp_stats(&smp);
+    try_(TEST_expect(queued.requested == A_len(g_ptrs) * 96));
+    let_ignore = heap_Smp_purge(&smp);
+    let after = heap_Smp_stats(&smp);
+    try_(TEST_expect(after.resident == 0));
+    try_(TEST_expect(after.requested == 0));
+    try_(TEST_expect(after.cached == 0));
+} $unguarded_(TEST_fn);
+
+/* Allocates and exits without detaching */
+$static Thrd_fn_(leaver, ({ usize len; }, Void), ($ignore, args)$scope) {
+    let_ignore = unwrap_(mem_Allocator_rawAlloc(g_gpa, args->len, mem_alignToLog2(8)));
+    return_({});
+} $unscoped_(Thrd_fn);
+
+TEST_fn_("SmpAllocator releases the metas of exited threads" $guard) {
+    $static var_(thrd_metas, A$$(1, heap_Smp_ThrdMeta)) = A_zero();
+    var page = lit0$((heap_Page));
+    var smp = heap_Smp_from(heap_Page_allocator(&page), A_ref$((S$heap_Smp_ThrdMeta)(thrd_metas)));
+    defer_(heap_Smp_fini(&smp));
+    g_smp = &smp;
+    g_gpa = heap_Smp_allocator(&smp);
+
+    // Each thread finds the only meta free again instead of spilling a new one
+    for (usize round = 0; round < 4; ++round) {
+        var thrd = Thrd_FnCtx_from$((leaver)(96));
+        let_ignore = Thrd_join(try_(Thrd_spawn(Thrd_SpawnCfg_default, thrd.as_raw)));
+        try_(TEST_expect(atom_V_load(&A_at((thrd_metas)[0])->owner, atom_MemOrd_acquire) == 0));
+        try_(TEST_expect(atom_V_load(&smp.spilled_metas, atom_MemOrd_acquire) == 0));
+    }
+    try_(TEST_expect(heap_Smp_stats(&smp).requested == 4 * 96));
+} $unguarded_(TEST_fn);
@@ -0,0 +1,33 @@
+/**
+ * @copyright Copyright (c) 2026 Gyeongtae Kim
+ * @license   MIT License - see LICENSE file for details
+ *
+ * @file    io_Reactor-uring.c
+ * @author  Gyeongtae Kim(dev-dasae)
+ * @date    2026-10-17 (date of creation)
+ * @updated 2026-10-17 (date of last update)
+ * @version v0.1-alpha
+ * @ingroup dasae-headers(dh)/tests
+ * @prefix  test
+ *
+ * @brief   The io_Reactor tests, run against the io_uring backend
+ * @details The library builds the epoll backend. This test compiles the io_uring
+ *          one into itself under its own symbol names, so both link side by side.
+ *          It needs Linux 5.11 or later with io_uring allowed.
+ */
+#define io_Reactor_use_uring pp_true
+#define io_Reactor_Op_readable io_Reactor_uring_Op_readable
+#define io_Reactor_Op_writable io_Reactor_uring_Op_writable
+#define io_Reactor_Op_read io_Reactor_uring_Op_read
+#define io_Reactor_Op_write io_Reactor_uring_Op_write
+#define io_Reactor_Op_withTimeout io_Reactor_uring_Op_withTimeout
+#define io_Reactor_Op_result io_Reactor_uring_Op_result
+#define io_Reactor_init io_Reactor_uring_init
+#define io_Reactor_fini io_Reactor_uring_fini
+#define io_Reactor_deregister io_Reactor_uring_deregister
+#define io_Reactor_step io_Reactor_uring_step
+#define io_Reactor_poll io_Reactor_uring_poll
+#define io_Reactor_run io_Reactor_uring_run
+
+#include "../src/io_Reactor.c"
+#include "test-io_Reactor.c"
@@ -0,0 +1,220 @@
+#include "dh/main.h"
+#include "dh/io/Reactor.h"
+#include "dh/heap/Page.h"
+#include "dh/mem/common.h"
+#include <stdio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/socket.h>
+
+use_Co_Ctx$(usize);
+/// Returns the bytes read into `buf`, or `usize_limit_max` on failure
+async_fn_(reader, (var_(reactor, io_Reactor*); var_(handle, fs_File_Handle); var_(buf, S$u8);), usize);
+async_fn_scope(reader, { var_(op, io_Reactor_Op); }) {
+    locals->op = io_Reactor_Op_read(args->handle, args->buf);
+    io_Reactor_await(args->reactor, &locals->op);
+    areturn_(catch_((io_Reactor_Op_result(&locals->op))($ignore, usize_limit_max)));
+} $unscoped_(async_fn);
+
+/// Writes `bytes` after sleeping `delay`, so the reader has to wait for them
+async_fn_(writer, (var_(reactor, io_Reactor*); var_(handle, fs_File_Handle); var_(bytes, S_const$u8); var_(delay, time_Duration);), usize);
+async_fn_scope(writer, { var_(timer, Co_Timer); var_(op, io_Reactor_Op); }) {
+    Co_sleep(args->reactor->exec, &locals->timer, args->delay);
+    locals->op = io_Reactor_Op_write(args->handle, args->bytes);
+    io_Reactor_await(args->reactor, &locals->op);
+    areturn_(catch_((io_Reactor_Op_result(&locals->op))($ignore, usize_limit_max)));
+} $unscoped_(async_fn);
+
+/// Sends back whatever arrives until the peer closes, returning the bytes echoed
+async_fn_(echo, (var_(reactor, io_Reactor*); var_(handle, fs_File_Handle);), usize);
+async_fn_scope(echo, {
+    var_(buf, A$$(16, u8));
+    var_(len, usize);
+    var_(total, usize);
+    var_(op, io_Reactor_Op);
+}) {
+    locals->total = 0;
+    while (true) {
+        locals->op = io_Reactor_Op_read(args->handle, A_ref$((S$u8)(locals->buf)));
+        io_Reactor_await(args->reactor, &locals->op);
+        locals->len = catch_((io_Reactor_Op_result(&locals->op))($ignore, 0));
+        if (locals->len == 0) { break; }
+        locals->op = io_Reactor_Op_write(args->handle, prefixS(A_ref$((S$u8)(locals->buf)), locals->len).as_const);
+        io_Reactor_await(args->reactor, &locals->op);
+        locals->total += locals->len;
+    }
+    areturn_(locals->total);
+} $unscoped_(async_fn);
+
+use_Co_Ctx$(bool);
+/// Returns whether a read on `handle` gave up with `io_Reactor_Err_Timeout`
+async_fn_(impatient, (var_(reactor, io_Reactor*); var_(handle, fs_File_Handle);), bool);
+async_fn_scope(impatient, { var_(buf, A$$(4, u8)); var_(op, io_Reactor_Op); }) {
+    locals->op = io_Reactor_Op_withTimeout(
+        io_Reactor_Op_read(args->handle, A_ref$((S$u8)(locals->buf))),
+        time_Duration_fromMillis(20)
+    );
+    io_Reactor_await(args->reactor, &locals->op);
+    areturn_(locals->op.timed_out && isErr(io_Reactor_Op_result(&locals->op)));
+} $unscoped_(async_fn);
+
+TEST_fn_("a pipe read waits for a delayed write" $guard) {
+    let gpa = heap_Page_allocator(&(heap_Page){});
+    var exec = lit0$((Co_Exec));
+    Co_Exec_init(&exec, gpa, time_Duration_milli);
+    defer_(Co_Exec_fini(&exec));
+    var reactor = try_(io_Reactor_init(&exec, 16));
+    defer_(io_Reactor_fini(&reactor));
+
+    var_(fds, A$$(2, i32)) = A_zero();
+    try_(TEST_expect(pipe(A_ptr(fds)) == 0));
+    defer_({
+        let_ignore = close(*A_at((fds)[0]));
+        let_ignore = close(*A_at((fds)[1]));
+    });
+    var_(buf, A$$(16, u8)) = A_zero();
+    var rd = *async_ctx((reader)(&reactor, *A_at((fds)[0]), A_ref$((S$u8)(buf))));
+    var wr = *async_ctx((writer)(&reactor, *A_at((fds)[1]), u8_l("ping"), time_Duration_fromMillis(5)));
+    try_(Co_Exec_spawn(&exec, rd.anyraw));
+    try_(Co_Exec_spawn(&exec, wr.anyraw));
+    try_(io_Reactor_run(&reactor));
+
+    try_(TEST_expect(rd.state == Co_State_ready && wr.state == Co_State_ready));
+    try_(TEST_expect(Co_Ctx_returned(&wr) == 4));
+    try_(TEST_expect(Co_Ctx_returned(&rd) == 4));
+    try_(TEST_expect(mem_eqlBytes(prefixS(A_ref$((S$u8)(buf)), 4).as_const, u8_l("ping"))));
+} $unguarded_(TEST_fn);
+
+TEST_fn_("a socketpair echoes in both directions" $guard) {
+    let gpa = heap_Page_allocator(&(heap_Page){});
+    var exec = lit0$((Co_Exec));
+    Co_Exec_init(&exec, gpa, time_Duration_milli);
+    defer_(Co_Exec_fini(&exec));
+    var reactor = try_(io_Reactor_init(&exec, 16));
+    defer_(io_Reactor_fini(&reactor));
+
+    var_(fds, A$$(2, i32)) = A_zero();
+    try_(TEST_expect(socketpair(AF_UNIX, SOCK_STREAM, 0, A_ptr(fds)) == 0));
+    defer_(let_ignore = close(*A_at((fds)[1])));
+    var_(buf, A$$(16, u8)) = A_zero();
+    var server = *async_ctx((echo)(&reactor, *A_at((fds)[1])));
+    var wr = *async_ctx((writer)(&reactor, *A_at((fds)[0]), u8_l("hello"), time_Duration_zero));
+    var rd = *async_ctx((reader)(&reactor, *A_at((fds)[0]), A_ref$((S$u8)(buf))));
+    try_(Co_Exec_spawn(&exec, server.anyraw));
+    try_(Co_Exec_spawn(&exec, rd.anyraw));
+    try_(Co_Exec_spawn(&exec, wr.anyraw));
+    while (rd.state != Co_State_ready) {
+        try_(Co_Exec_poll(&exec));
+        let_ignore = try_(io_Reactor_poll(&reactor, Co_Exec_untilNext(&exec)));
+    }
+    try_(TEST_expect(Co_Ctx_returned(&rd) == 5));
+    try_(TEST_expect(mem_eqlBytes(prefixS(A_ref$((S$u8)(buf)), 5).as_const, u8_l("hello"))));
+
+    // Closing our end lets the echo loop see end of file
+    io_Reactor_deregister(&reactor, *A_at((fds)[0]));
+    let_ignore = close(*A_at((fds)[0]));
+    try_(io_Reactor_run(&reactor));
+    try_(TEST_expect(server.state == Co_State_ready));
+    try_(TEST_expect(Co_Ctx_returned(&server) == 5));
+} $unguarded_(TEST_fn);
+
+TEST_fn_("a regular file read finishes without waiting" $guard) {
+    let gpa = heap_Page_allocator(&(heap_Page){});
+    var exec = lit0$((Co_Exec));
+    Co_Exec_init(&exec, gpa, time_Duration_milli);
+    defer_(Co_Exec_fini(&exec));
+    var reactor = try_(io_Reactor_init(&exec, 16));
+    defer_(io_Reactor_fini(&reactor));
+
+    let file = tmpfile();
+    try_(TEST_expect(file != null));
+    defer_(let_ignore = fclose(file));
+    try_(TEST_expect(fwrite("contents", 1, 8, file) == 8));
+    let_ignore = fflush(file);
+    rewind(file);
+    var_(buf, A$$(16, u8)) = A_zero();
+    var rd = *async_ctx((reader)(&reactor, fileno(file), A_ref$((S$u8)(buf))));
+    try_(Co_Exec_spawn(&exec, rd.anyraw));
+    try_(io_Reactor_run(&reactor));
+    try_(TEST_expect(Co_Ctx_returned(&rd) == 8));
+    try_(TEST_expect(mem_eqlBytes(prefixS(A_ref$((S$u8)(buf)), 8).as_const, u8_l("contents"))));
+} $unguarded_(TEST_fn);
+
+TEST_fn_("a read on an empty pipe times out" $guard) {
+    let gpa = heap_Page_allocator(&(heap_Page){});
+    var exec = lit0$((Co_Exec));
+    Co_Exec_init(&exec, gpa, time_Duration_milli);
+    defer_(Co_Exec_fini(&exec));
+    var reactor = try_(io_Reactor_init(&exec, 16));
+    defer_(io_Reactor_fini(&reactor));
+
+    var_(fds, A$$(2, i32)) = A_zero();
+    try_(TEST_expect(pipe(A_ptr(fds)) == 0));
+    defer_({
+        let_ignore = close(*A_at((fds)[0]));
+        let_ignore = close(*A_at((fds)[1]));
+    });
+    var waiting = *async_ctx((impatient)(&reactor, *A_at((fds)[0])));
+    try_(Co_Exec_spawn(&exec, waiting.anyraw));
+    let start = time_Instant_now();
+    try_(io_Reactor_run(&reactor));
+    try_(TEST_expect(Co_Ctx_returned(&waiting)));
+    try_(TEST_expect(time_Duration_asSecs$f64(time_Instant_elapsed(start)) >= 0.015));
+    try_(TEST_expect(reactor.in_flight == 0));
+} $unguarded_(TEST_fn);
+
+TEST_fn_("deregister restores the blocking mode" $guard) {
+    let gpa = heap_Page_allocator(&(heap_Page){});
+    var exec = lit0$((Co_Exec));
+    Co_Exec_init(&exec, gpa, time_Duration_milli);
+    defer_(Co_Exec_fini(&exec));
+    var reactor = try_(io_Reactor_init(&exec, 16));
+    defer_(io_Reactor_fini(&reactor));
+
+    var_(fds, A$$(2, i32)) = A_zero();
+    try_(TEST_expect(pipe(A_ptr(fds)) == 0));
+    defer_({
+        let_ignore = close(*A_at((fds)[0]));
+        let_ignore = close(*A_at((fds)[1]));
+    });
+    try_(TEST_expect(write(*A_at((fds)[1]), "x", 1) == 1));
+    var_(buf, A$$(4, u8)) = A_zero();
+    var rd = *async_ctx((reader)(&reactor, *A_at((fds)[0]), A_ref$((S$u8)(buf))));
+    try_(Co_Exec_spawn(&exec, rd.anyraw));
+    try_(io_Reactor_run(&reactor));
+    try_(TEST_expect(Co_Ctx_returned(&rd) == 1));
+
+    io_Reactor_deregister(&reactor, *A_at((fds)[0]));
+    try_(TEST_expect((fcntl(*A_at((fds)[0]), F_GETFL) & O_NONBLOCK) == 0));
+} $unguarded_(TEST_fn);
+
+#if !io_Reactor_use_uring
+TEST_fn_("a second reader on one handle fails instead of waiting" $guard) {
+    let gpa = heap_Page_allocator(&(heap_Page){});
+    var exec = lit0$((Co_Exec));
+    Co_Exec_init(&exec, gpa, time_Duration_milli);
+    defer_(Co_Exec_fini(&exec));
+    var reactor = try_(io_Reactor_init(&exec, 16));
+    defer_(io_Reactor_fini(&reactor));
+
+    var_(fds, A$$(2, i32)) = A_zero();
+    try_(TEST_expect(pipe(A_ptr(fds)) == 0));
+    defer_({
+        let_ignore = close(*A_at((fds)[0]));
+        let_ignore = close(*A_at((fds)[1]));
+    });
+    var_(first_buf, A$$(8, u8)) = A_zero();
+    var_(second_buf, A$$(8, u8)) = A_zero();
+    var first = *async_ctx((reader)(&reactor, *A_at((fds)[0]), A_ref$((S$u8)(first_buf))));
+    var second = *async_ctx((reader)(&reactor, *A_at((fds)[0]), A_ref$((S$u8)(second_buf))));
+    var wr = *async_ctx((writer)(&reactor, *A_at((fds)[1]), u8_l("pong"), time_Duration_fromMillis(5)));
+    try_(Co_Exec_spawn(&exec, first.anyraw));
+    try_(Co_Exec_spawn(&exec, second.anyraw));
+    try_(Co_Exec_spawn(&exec, wr.anyraw));
+    try_(io_Reactor_run(&reactor));
+
+    try_(TEST_expect(Co_Ctx_returned(&second) == usize_limit_max));
+    try_(TEST_expect(Co_Ctx_returned(&first) == 4));
+    try_(TEST_expect(mem_eqlBytes(prefixS(A_ref$((S$u8)(first_buf)), 4).as_const, u8_l("pong"))));
+} $unguarded_(TEST_fn);
+#endif /* !io_Reactor_use_uring */
@@ -0,0 +1,138 @@
+/**
+ * @copyright Copyright (c) 2026 Gyeongtae Kim
+ * @license   MIT License - see LICENSE file for details
+ *
+ * @file    io_Writer-print_cached.c
+ * @author  Gyeongtae Kim(dev-dasae)
+ * @date    2026-10-17 (date of creation)
+ * @updated 2026-10-17 (date of last update)
+ * @version v0.1-alpha
+ * @ingroup dasae-headers(dh)/tests
+ * @prefix  test
+ *
+ * @brief   Unit tests for compiled format strings
+ * @details Tests for fmt_compile, fmt_formatCompiled and the per-call-site cached
+ *          io_Writer_printCached, checked against io_Writer_print output
+ */
+
+/*========== Includes =======================================================*/
+
+#include "dh/main.h"
+#include "dh/io/Writer.h"
+#include "dh/fmt/common.h"
+#include <stdio.h>
+
+/*========== Test Helper - Buffer Writer ===================================*/
+
+typedef struct test_Buf {
+    S$u8 data;
+    usize pos;
+} test_Buf;
+$attr($must_check)
+$static fn_((test_Buf_VT_write(P$raw ctx, S_const$u8 bytes))(E$usize) $scope) {
+    let self = ptrAlignCast$((test_Buf*)(ctx));
+    let remaining = self->data.len - self->pos;
+    let to_write = prim_min(bytes.len, remaining);
+    if (0 < to_write) {
+        prim_memcpyS(
+            S_prefix((S_suffix((self->data)(self->pos)))(to_write)),
+            S_prefix((bytes)(to_write))
+        );
+        self->pos += to_write;
+    }
+    return_ok(to_write);
+} $unscoped_(fn);
+$static fn_((test_Buf_init(S$u8 data))(test_Buf)) {
+    return (test_Buf){
+        .data = data,
+        .pos = 0
+    };
+}
+$static fn_((test_Buf_writer(test_Buf* self))(io_Writer)) {
+    claim_assert_nonnull(self);
+    return lit$((io_Writer){ .ctx = self, .write = test_Buf_VT_write });
+}
+$static fn_((test_Buf_clear(test_Buf* self))(void)) {
+    claim_assert_nonnull(self);
+    self->pos = 0;
+}
+$static fn_((test_Buf_view(test_Buf self))(S_const$u8)) {
+    if (self.pos == 0) { return zeroS$((const u8)); }
+    return S_slice((self.data)$r(0, self.pos)).as_const;
+}
+
+/*========== Compiled Format Tests =========================================*/
+
+TEST_fn_("io_Writer-print_cached: Compile splits literals and specs" $scope) {
+    let compiled = try_(fmt_compile(u8_l("a {{b}} {1:d} c {0:s}{1:dl}!")));
+    try_(TEST_expect(compiled.spec_count == 3));
+    try_(TEST_expect(compiled.arg_count == 2));
+    let first = A_at((compiled.specs)[0]);
+    try_(TEST_expect(first->arg_index == 1));
+    try_(TEST_expect(first->literal_escaped));
+    try_(TEST_expect(mem_eqlBytes(first->literal, u8_l("a {{b}} "))));
+    let second = A_at((compiled.specs)[1]);
+    try_(TEST_expect(second->arg_index == 0));
+    try_(TEST_expect(!second->literal_escaped));
+    try_(TEST_expect(mem_eqlBytes(second->literal, u8_l(" c "))));
+    try_(TEST_expect(A_at((compiled.specs)[2])->literal.len == 0));
+    try_(TEST_expect(mem_eqlBytes(compiled.trailing, u8_l("!"))));
+    try_(TEST_expect(!compiled.trailing_escaped));
+} $unscoped_(TEST_fn);
+
+TEST_fn_("io_Writer-print_cached: Compiled output matches runtime parsing" $scope) {
+    T_use_A$(256, u8);
+    A$256$u8 expected_mem = A_zero();
+    A$256$u8 actual_mem = A_zero();
+    test_Buf expected = test_Buf_init(A_ref$((S$u8)(expected_mem)));
+    test_Buf actual = test_Buf_init(A_ref$((S$u8)(actual_mem)));
+
+    let fmt = u8_l("[{:s}] {:s}:{:u} took {:.3fl} ms ({:uz} bytes, {{ok}})");
+    let compiled = try_(fmt_compile(fmt));
+    try_(io_Writer_print(test_Buf_writer(&expected), fmt, u8_l("INFO"), u8_l("net.c"), 42u, 1.25, as$(usize)(4096)));
+    try_(fmt_formatCompiled(test_Buf_writer(&actual), &compiled, u8_l("INFO"), u8_l("net.c"), 42u, 1.25, as$(usize)(4096)));
+    let result = test_Buf_view(actual);
+    printf("Result: '%.*s' (len=%zu)\n", as$(i32)(result.len), result.ptr, result.len);
+    try_(TEST_expect(mem_eqlBytes(result, u8_l("[INFO] net.c:42 took 1.250 ms (4096 bytes, {ok})"))));
+    try_(TEST_expect(mem_eqlBytes(result, test_Buf_view(expected))));
+} $unscoped_(TEST_fn);
+
+TEST_fn_("io_Writer-print_cached: Call site reuses its compiled format" $scope) {
+    T_use_A$(256, u8);
+    A$256$u8 mem = A_zero();
+    test_Buf buf = test_Buf_init(A_ref$((S$u8)(mem)));
+    io_Writer writer = test_Buf_writer(&buf);
+
+    // The first pass compiles, the later ones read the cache
+    for (i32 i = 0; i < 3; ++i) {
+        test_Buf_clear(&buf);
+        try_(io_Writer_printCached(writer, u8_l("{1:d} {0:d} {1:x}"), i, 10 + i));
+        let result = test_Buf_view(buf);
+        printf("Result: '%.*s' (len=%zu)\n", as$(i32)(result.len), result.ptr, result.len);
+        let_(expected, A$$(3, S_const$u8)) = A_init({ u8_l("10 0 a"), u8_l("11 1 b"), u8_l("12 2 c") });
+        try_(TEST_expect(mem_eqlBytes(result, *A_at((expected)[i]))));
+    }
+
+    test_Buf_clear(&buf);
+    try_(io_Writer_printlnCached(writer, u8_l("no args")));
+    try_(TEST_expect(mem_eqlBytes(S_prefix((test_Buf_view(buf))(7)), u8_l("no args"))));
+    try_(TEST_expect(7 < test_Buf_view(buf).len));
+} $unscoped_(TEST_fn);
+
+TEST_fn_("io_Writer-print_cached: Call site formats each string it is given" $scope) {
+    T_use_A$(256, u8);
+    A$256$u8 mem = A_zero();
+    test_Buf buf = test_Buf_init(A_ref$((S$u8)(mem)));
+    io_Writer writer = test_Buf_writer(&buf);
+
+    // One call site, alternating format strings: only the first is cached
+    let_(fmts, A$$(2, S_const$u8)) = A_init({ u8_l("a={:d}"), u8_l("b={:x}!") });
+    let_(expected, A$$(4, S_const$u8)) = A_init({ u8_l("a=10"), u8_l("b=b!"), u8_l("a=12"), u8_l("b=d!") });
+    for (i32 i = 0; i < 4; ++i) {
+        test_Buf_clear(&buf);
+        try_(io_Writer_printCached(writer, *A_at((fmts)[i % 2]), 10 + i));
+        let result = test_Buf_view(buf);
+        printf("Result: '%.*s' (len=%zu)\n", as$(i32)(result.len), result.ptr, result.len);
+        try_(TEST_expect(mem_eqlBytes(result, *A_at((expected)[i]))));
+    }
+} $unscoped_(TEST_fn);
@@ -0,0 +1,47 @@
+#include "dh/main.h"
+#include "dh/heap/Classic.h"
+#include "dh/mem/Tracker.h"
+
+#if defined(MEM_NO_TRACE_ALLOC_AND_FREE) || !debug_comp_enabled
+#else
+TEST_fn_("mem_Tracker: live stats and call sites follow allocations" $guard) {
+    var classic = lit0$((heap_Classic));
+    let gpa = heap_Classic_allocator(&classic);
+    let before = mem_Tracker_stats();
+
+    let buf = u_castS$((S$u8)(try_(mem_Allocator_alloc(gpa, typeInfo$(u8), 1234))));
+    let during = mem_Tracker_stats();
+    try_(TEST_expect(during.live_bytes == before.live_bytes + 1234));
+    try_(TEST_expect(during.alloc_count == before.alloc_count + 1));
+
+    /* the busiest site holds at least this allocation */
+    var_(sites, A$$(1, mem_Tracker_Site)) = A_zero();
+    try_(TEST_expect(mem_Tracker_sites(A_ref$((S$mem_Tracker_Site)(sites))) == 1));
+    let top = A_at((sites)[0]);
+    try_(TEST_expect(1234 <= top->alloc_bytes - top->free_bytes));
+
+    mem_Allocator_free(gpa, u_anyS(buf));
+    try_(TEST_expect(mem_Tracker_stats().live_bytes == before.live_bytes));
+} $unguarded_(TEST_fn);
+
+TEST_fn_("mem_Tracker: sampled allocations are weighted to estimate the total" $guard) {
+    var classic = lit0$((heap_Classic));
+    let gpa = heap_Classic_allocator(&classic);
+    let cfg = mem_Tracker_instance()->cfg;
+    defer_(mem_Tracker_configure(cfg));
+    var sampled = cfg;
+    sampled.sample_interval = 4096;
+    mem_Tracker_configure(sampled);
+
+    let before = mem_Tracker_stats();
+    var_(objs, A$$(4096, S$u8)) = A_zero();
+    for_(($s(A_ref(objs)))(obj) {
+        *obj = u_castS$((S$u8)(try_(mem_Allocator_alloc(gpa, typeInfo$(u8), 64))));
+    });
+    let during = mem_Tracker_stats();
+    /* 256 KiB allocated; the estimate is within a generous margin */
+    let estimate = during.alloc_bytes - before.alloc_bytes;
+    try_(TEST_expect(4096 * 64 / 4 < estimate && estimate < 4096 * 64 * 4));
+    for_(($a(objs))(obj) { mem_Allocator_free(gpa, u_anyS(*obj)); });
+} $unguarded_(TEST_fn);
+#endif /* defined(MEM_NO_TRACE_ALLOC_AND_FREE) || !debug_comp_enabled */
@@ -0,0 +1,61 @@
+#include "dh/main.h"
+#include "dh/mem/common.h"
+
+T_use$((u8)(
+    mem_TokenIter,
+    mem_tokenizeChoice,
+    mem_TokenIter_next
+));
+
+/// Scalar reference; `len` when there is no match.
+$static fn_((refIdxByte(S_const$u8 haystack, u8 byte, bool last))(usize)) {
+    var_(found, usize) = haystack.len;
+    for_(($s(haystack), $rf(0))(c, idx) {
+        if (*c != byte) { continue; }
+        found = idx;
+        if (!last) { break; }
+    });
+    return found;
+};
+
+TEST_fn_("mem_search: byte kernels agree with a scalar scan at every offset and length" $scope) {
+    var_(bytes, A$$(100, u8)) = A_zero();
+    for_(($s(A_ref(bytes)), $rf(0))(byte, idx) { *byte = as$(u8)('a' + idx % 7); });
+    *A_at((bytes)[3]) = '\n';
+    *A_at((bytes)[40]) = '\n';
+    *A_at((bytes)[97]) = '\n';
+    let all = A_ref$((S_const$u8)(bytes));
+    for_(($r(0, all.len))(begin) {
+        for_(($r(begin, all.len + 1))(end) {
+            let haystack = S_slice((all)$r(begin, end));
+            let first = orelse_((mem_idxByte(haystack, '\n'))(haystack.len));
+            let last = orelse_((mem_idxLastByte(haystack, '\n'))(haystack.len));
+            try_(TEST_expect(first == refIdxByte(haystack, '\n', false)));
+            try_(TEST_expect(last == refIdxByte(haystack, '\n', true)));
+            let any = orelse_((mem_idxAnyByte2(haystack, 'z', '\n'))(haystack.len));
+            try_(TEST_expect(any == first));
+        });
+    });
+} $unscoped_(TEST_fn);
+
+TEST_fn_("mem_search: substring search finds the first occurrence past the vector width" $scope) {
+    let text = u8_l("a quick brown fox jumps over the lazy dog; the lazy dog sleeps; lazy!");
+    try_(TEST_expect(orelse_((mem_idxBytes(text, u8_l("lazy dog")))(0)) == 33));
+    try_(TEST_expect(orelse_((mem_idxBytes(text, u8_l("lazy!")))(0)) == 64));
+    try_(TEST_expect(orelse_((mem_idxBytes(text, u8_l("a")))(1)) == 0));
+    try_(TEST_expect(isNone(mem_idxBytes(text, u8_l("lazy cat")))));
+    try_(TEST_expect(orelse_((mem_idxAnyBytes(text, u8_l(";!?.")))(0)) == 41));
+} $unscoped_(TEST_fn);
+
+TEST_fn_("mem_search: byte tokenizer splits on any of its delimiters" $scope) {
+    let text = u8_l("alpha, beta;;gamma,delta epsilon zeta eta theta iota kappa lambda");
+    var iter = mem_tokenizeChoice$u8(text, u8_l(" ,;"));
+    var_(count, usize) = 0;
+    var_(total, usize) = 0;
+    while_some(mem_TokenIter_next$u8(&iter), token) {
+        count++;
+        total += token.len;
+    }
+    try_(TEST_expect(count == 11));
+    try_(TEST_expect(total == 53));
+} $unscoped_(TEST_fn);
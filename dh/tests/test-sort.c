@@ -0,0 +1,147 @@
+#include "dh/main.h"
+#include "dh/sort.h"
+#include "dh/Thrd/Pool.h"
+#include "dh/heap/Page.h"
+#include "dh/Rand.h"
+
+#define test_sort_len (1u << 17)
+
+typedef struct Rec {
+    u32 key;
+    u32 order;
+} Rec;
+T_use_S$(Rec);
+
+$static fn_((ordU64(u_V$raw lhs, u_V$raw rhs))(cmp_Ord)) {
+    return prim_ord(u_castV$((u64)(lhs)), u_castV$((u64)(rhs)));
+};
+
+$static fn_((ordRecKey(u_V$raw lhs, u_V$raw rhs))(cmp_Ord)) {
+    return prim_ord(u_castV$((Rec)(lhs)).key, u_castV$((Rec)(rhs)).key);
+};
+
+$static var_(test_items, A$$(test_sort_len, u64)) = A_zero();
+$static var_(test_recs, A$$(test_sort_len, Rec)) = A_zero();
+
+/// Fills `test_items` with values drawn from `[0, range)`, then applies `pattern`.
+$static fn_((fillItems(Rand* rng, u64 range, u8 pattern))(void)) {
+    for_(($r(0, test_sort_len))(i) { *A_at((test_items)[i]) = Rand_next$u64(rng) % range; });
+    switch (pattern) {
+    case 1: /* ascending */
+        for_(($r(0, test_sort_len))(i) { *A_at((test_items)[i]) = i; });
+        break;
+    case 2: /* descending */
+        for_(($r(0, test_sort_len))(i) { *A_at((test_items)[i]) = test_sort_len - i; });
+        break;
+    default:
+        break;
+    }
+};
+
+$static fn_((isAscending(void))(bool)) {
+    for_(($r(1, test_sort_len))(i) {
+        if (*A_at((test_items)[i - 1]) > *A_at((test_items)[i])) return false;
+    });
+    return true;
+};
+
+TEST_fn_("sort_pdqPar: sorts random, duplicate-heavy and presorted input" $guard) {
+    var page = (heap_Page){};
+    var pool = lit0$((Thrd_Pool));
+    try_(Thrd_Pool_init(&pool, heap_Page_allocator(&page), Thrd_Pool_Cfg_default));
+    defer_(Thrd_Pool_fini(&pool));
+
+    var rng = Rand_initSeed(0x5eed);
+    let_(ranges, A$$(3, u64)) = A_init({ u64_limit_max, 1000, 4 });
+    for_(($r(0, A_len(ranges)))(r) {
+        for (u8 pattern = 0; pattern < 3; ++pattern) {
+            fillItems(&rng, *A_at((ranges)[r]), pattern);
+            var_(sum_before, u64) = 0;
+            for_(($r(0, test_sort_len))(i) { sum_before += *A_at((test_items)[i]); });
+
+            sort_pdqPar(&pool, u_anyS(A_ref$((S$u64)(test_items))), wrapFn$(sort_OrdFn, ordU64));
+            try_(TEST_expect(isAscending()));
+            var_(sum_after, u64) = 0;
+            for_(($r(0, test_sort_len))(i) { sum_after += *A_at((test_items)[i]); });
+            try_(TEST_expect(sum_before == sum_after));
+        }
+    });
+} $unguarded_(TEST_fn);
+
+TEST_fn_("sort_blockPar: sorts and keeps equal keys in input order" $guard) {
+    var page = (heap_Page){};
+    let gpa = heap_Page_allocator(&page);
+    var pool = lit0$((Thrd_Pool));
+    try_(Thrd_Pool_init(&pool, gpa, Thrd_Pool_Cfg_default));
+    defer_(Thrd_Pool_fini(&pool));
+
+    var rng = Rand_initSeed(0xb10c);
+    for_(($r(0, test_sort_len))(i) {
+        asg_lit((A_at((test_recs)[i]))({ .key = as$(u32)(Rand_next$u32(&rng) % 64), .order = as$(u32)(i) }));
+    });
+    let sorted = try_(sort_blockPar(&pool, gpa, u_anyS(A_ref$((S$Rec)(test_recs))), wrapFn$(sort_OrdFn, ordRecKey)));
+    try_(TEST_expect(sorted.len == test_sort_len));
+    for_(($r(1, test_sort_len))(i) {
+        let prev = A_at((test_recs)[i - 1]);
+        let curr = A_at((test_recs)[i]);
+        try_(TEST_expect(prev->key < curr->key || (prev->key == curr->key && prev->order < curr->order)));
+    });
+
+    /* short input takes the sequential path */
+    let short_recs = A_prefix$((S$Rec)(test_recs)(100));
+    for_(($r(0, short_recs.len))(i) { S_at((short_recs)[i])->key = as$(u32)(100 - i); });
+    let_ignore = try_(sort_blockPar(&pool, gpa, u_anyS(short_recs), wrapFn$(sort_OrdFn, ordRecKey)));
+    try_(TEST_expect(S_at((short_recs)[0])->key == 1));
+    try_(TEST_expect(S_at((short_recs)[99])->key == 100));
+} $unguarded_(TEST_fn);
+
+$static fn_((recKey(u_V$raw item))(u64)) {
+    return u_castV$((Rec)(item)).key;
+};
+
+TEST_fn_("sort_radix: integer and float keys, with scratch and in place" $guard) {
+    var page = (heap_Page){};
+    let gpa = heap_Page_allocator(&page);
+    var rng = Rand_initSeed(0x4ad1);
+
+    fillItems(&rng, u64_limit_max, 0);
+    try_(sort_radix$u64(gpa, A_ref$((S$u64)(test_items))));
+    try_(TEST_expect(isAscending()));
+    fillItems(&rng, 1u << 12, 0);
+    sort_radixFlag$u64(A_ref$((S$u64)(test_items)));
+    try_(TEST_expect(isAscending()));
+
+    var_(flts, A$$(10, f64)) = A_init({ 3.5, -0.0, -1e300, 0.0, 2.0, -2.5, f64_inf, -f64_inf, 1e-300, -1e-300 });
+    let_(expected, A$$(10, f64)) = A_init({ -f64_inf, -1e300, -2.5, -1e-300, -0.0, 0.0, 1e-300, 2.0, 3.5, f64_inf });
+    try_(sort_radix$f64(gpa, A_ref$((S$f64)(flts))));
+    /* compare bits so -0.0 and +0.0 are told apart */
+    for_(($r(0, A_len(flts)))(i) {
+        try_(TEST_expect(bitCast$((u64)(*A_at((flts)[i]))) == bitCast$((u64)(*A_at((expected)[i])))));
+    });
+
+    var_(ints, A$$(6, i64)) = A_init({ 5, -7, i64_limit_min, 0, i64_limit_max, -1 });
+    sort_radixFlag$i64(A_ref$((S$i64)(ints)));
+    try_(TEST_expect(*A_at((ints)[0]) == i64_limit_min));
+    try_(TEST_expect(*A_at((ints)[1]) == -7));
+    try_(TEST_expect(*A_at((ints)[5]) == i64_limit_max));
+} $unguarded_(TEST_fn);
+
+TEST_fn_("sort_radixByKey: stable by extracted key" $guard) {
+    var page = (heap_Page){};
+    let gpa = heap_Page_allocator(&page);
+    var rng = Rand_initSeed(0x4ad2);
+    for_(($r(0, test_sort_len))(i) {
+        asg_lit((A_at((test_recs)[i]))({ .key = as$(u32)(Rand_next$u32(&rng) % 1000), .order = as$(u32)(i) }));
+    });
+    try_(sort_radixByKey(gpa, u_anyS(A_ref$((S$Rec)(test_recs))), wrapFn$(sort_KeyFn, recKey)));
+    for_(($r(1, test_sort_len))(i) {
+        let prev = A_at((test_recs)[i - 1]);
+        let curr = A_at((test_recs)[i]);
+        try_(TEST_expect(prev->key < curr->key || (prev->key == curr->key && prev->order < curr->order)));
+    });
+
+    sort_radixFlagByKey(u_anyS(A_ref$((S$Rec)(test_recs))), wrapFn$(sort_KeyFn, recKey));
+    for_(($r(1, test_sort_len))(i) {
+        try_(TEST_expect(A_at((test_recs)[i - 1])->key <= A_at((test_recs)[i])->key));
+    });
+} $unguarded_(TEST_fn);
@@ -0,0 +1,64 @@
+#include "dh/main.h"
+#include "dh/unicode.h"
+#include "dh/Rand.h"
+
+/// Valid sequences of every length, followed by invalid ones the validator must reject
+$static let_(test_pieces, A$$(12, S_const$u8)) = A_init({
+    u8_l("a"),
+    u8_l("\xC3\xA9"),
+    u8_l("\xE2\x82\xAC"),
+    u8_l("\xF0\x9F\x98\x80"),
+    u8_l("\x80"),             /* lone continuation */
+    u8_l("\xC0\x80"),         /* overlong 2-byte */
+    u8_l("\xE0\x80\x80"),     /* overlong 3-byte */
+    u8_l("\xED\xA0\x80"),     /* surrogate */
+    u8_l("\xF4\x90\x80\x80"), /* past U+10FFFF */
+    u8_l("\xC3"),             /* truncated */
+    u8_l("\xF0\x9F"),         /* truncated */
+    u8_l("\xFF"),             /* never a UTF-8 byte */
+});
+#define test_valid_pieces (4u)
+
+/// Fills `buf` with random pieces; `valid_only` keeps to the first `test_valid_pieces`.
+$static fn_((genText(Rand* rng, S$u8 buf, bool valid_only))(S_const$u8)) {
+    var_(len, usize) = 0;
+    while (true) {
+        let n_pieces = valid_only ? test_valid_pieces : A_len(test_pieces);
+        /* mostly ASCII, so the block fast paths are taken too */
+        let pick = Rand_next$usize(rng) % 3 == 0 ? Rand_next$usize(rng) % n_pieces : 0;
+        let piece = *A_at((test_pieces)[pick]);
+        if (buf.len < len + piece.len) { break; }
+        prim_memcpy(buf.ptr + len, piece.ptr, piece.len);
+        len += piece.len;
+    }
+    return S_prefix((buf)(len)).as_const;
+};
+
+TEST_fn_("utf8: block validation and counting agree with the scalar reference" $scope) {
+    var rng = Rand_initSeed(0x18);
+    var_(mem, A$$(256, u8)) = A_zero();
+    for_(($r(0, 20000))(round) {
+        let buf = S_prefix((A_ref$((S$u8)(mem)))(Rand_next$usize(&rng) % A_len(mem)));
+        let text = genText(&rng, buf, round % 2 == 0);
+        try_(TEST_expect(utf8_validate(text) == utf8_validateScalar(text)));
+        try_(TEST_expect(utf8_count(text) == utf8_countScalar(text)));
+    });
+} $unscoped_(TEST_fn);
+
+TEST_fn_("utf8: transcoding round-trips through UTF-16" $scope) {
+    var rng = Rand_initSeed(0x18);
+    var_(mem, A$$(256, u8)) = A_zero();
+    var_(mem16, A$$(256, u16)) = A_zero();
+    var_(mem8, A$$(256, u8)) = A_zero();
+    for_(($r(0, 2000))(round) {
+        let_ignore = round;
+        let text = genText(&rng, A_ref$((S$u8)(mem)), true);
+        let utf16 = try_(unicode_utf8ToUTF16(text, A_ref$((S$u16)(mem16))));
+        try_(TEST_expect(utf16.len == try_(unicode_utf8ToUTF16Len(text))));
+        try_(TEST_expect(utf16.len == unicode_wtf8ToWTF16Len(text)));
+        let utf8 = try_(unicode_utf16ToUTF8(utf16.as_const, A_ref$((S$u8)(mem8))));
+        try_(TEST_expect(mem_eqlBytes(utf8.as_const, text)));
+    });
+    /* an invalid tail after an ASCII block is still reported */
+    try_(TEST_expect(isErr(unicode_utf8ToUTF16Len(u8_l("abcdefghijklmnopqrstuvwxyz\xC3")))));
+} $unscoped_(TEST_fn);